@@ -0,0 +1,92 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <new>
+
+#include "Benchmark.h"
+
+static unsigned long allocations = 0;
+static size_t allocatedBytes = 0;
+
+unsigned long allocationCount() { return allocations; }
+
+size_t allocationBytes() { return allocatedBytes; }
+
+void *operator new(size_t size) {
+  allocations++;
+  allocatedBytes += size;
+  void *ptr = malloc(size ? size : 1);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+
+void operator delete(void *ptr) noexcept { free(ptr); }
+
+void operator delete[](void *ptr) noexcept { free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+
+void operator delete[](void *ptr, size_t) noexcept { free(ptr); }
+
+StageTimer::~StageTimer() {
+  uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  stats.calls++;
+  stats.totalNanos += nanos;
+  if (nanos > stats.maxNanos) {
+    stats.maxNanos = nanos;
+  }
+  stats.allocations += allocationCount() - allocations;
+  stats.bytes += allocationBytes() - bytes;
+}
+
+void printStageHeader() {
+  printf("%-10s %9s %12s %9s %9s %10s %10s\n", "stage", "calls", "calls/s",
+         "avg ns", "max ns", "allocs/msg", "bytes/msg");
+}
+
+void StageStats::print(unsigned long messages) const {
+  if (calls == 0) {
+    return;
+  }
+  double perMessage = messages > 0 ? 1.0 / messages : 0.0;
+  printf("%-10s %9lu %12.0f %9.0f %9llu %10.2f %10.1f\n", name, calls,
+         totalNanos > 0 ? calls * 1e9 / totalNanos : 0.0,
+         static_cast<double>(totalNanos) / calls,
+         static_cast<unsigned long long>(maxNanos),
+         allocations * perMessage, bytes * perMessage);
+}
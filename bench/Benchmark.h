@@ -0,0 +1,81 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+
+// Heap allocations since start, counted by the replaced operator new
+unsigned long allocationCount();
+size_t allocationBytes();
+
+// Time, calls and heap allocations of one pipeline stage
+struct StageStats {
+  explicit StageStats(const char *name)
+      : name(name),
+        calls(0),
+        totalNanos(0),
+        maxNanos(0),
+        allocations(0),
+        bytes(0) {}
+
+  void print(unsigned long messages) const;
+
+  const char *name;
+  unsigned long calls;
+  uint64_t totalNanos;
+  uint64_t maxNanos;
+  unsigned long allocations;
+  size_t bytes;
+};
+
+// Accounts the lifetime of the object to a stage
+class StageTimer {
+ public:
+  explicit StageTimer(StageStats &stats)
+      : stats(stats),
+        allocations(allocationCount()),
+        bytes(allocationBytes()),
+        start(std::chrono::steady_clock::now()) {}
+  ~StageTimer();
+
+ private:
+  StageStats &stats;
+  unsigned long allocations;
+  size_t bytes;
+  std::chrono::steady_clock::time_point start;
+};
+
+void printStageHeader();
+
+#endif  // BENCHMARK_H
@@ -0,0 +1,342 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// Host benchmark of the receive pipeline of the gateway.  Replays
+// recorded or generated traces through the same filter, logging, queue
+// and batch classes as RfHandler and MqttClient and reports per stage
+// throughput, heap allocations per message and the worst case latency.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <Arduino.h>
+#include <ArduinoSimpleLogging.h>
+
+#include <LogPipeline.h>
+#include <Metrics.h>
+#include <PublishBatch.h>
+#include <RawCapture.h>
+#include <RfDeviceFilter.h>
+#include <RfDuplicateFilter.h>
+#include <RfEventQueue.h>
+
+#include "Benchmark.h"
+#include "Trace.h"
+
+// Stands in for the serial/syslog/websocket log targets
+class NullLogSink : public LogSink {
+ public:
+  void writeLine(const char *line, size_t length,
+                 const LogContext &context) override {
+    bytes += length;
+  }
+
+  size_t bytes = 0;
+};
+
+struct Options {
+  unsigned long duplicateWindow = 0;
+  uint16_t rate = 0;
+  uint8_t burst = 3;
+  bool changeOnly = false;
+  unsigned long changeRefresh = 0;
+  String allow;
+  String deny;
+  size_t batchSize = 0;
+  std::string receiveTopic = "rf434/recv/";
+  unsigned long interval = 100;
+  unsigned long passes = 1;
+  SimpleLogger::Level logLevel = SimpleLogger::INFO;
+};
+
+static void usage(const char *name) {
+  fprintf(stderr,
+          "usage: %s [options] [trace...]\n"
+          "  traces are capture files (/debug/capture) or mosquitto_sub -v\n"
+          "  output, without a trace random traffic is generated\n"
+          "  -w ms      duplicate window (rfDuplicateWindow)\n"
+          "  -r n       messages per minute and device (rfDeviceRate)\n"
+          "  -b n       burst (rfDeviceBurst)\n"
+          "  -c s       publish changes only, refresh after s seconds\n"
+          "  -a list    device allow list (rfDeviceAllow)\n"
+          "  -d list    device deny list (rfDeviceDeny)\n"
+          "  -B n       batch n messages (mqttBatchSize)\n"
+          "  -t topic   receive topic of the trace (mqttReceiveTopic)\n"
+          "  -i ms      interval of messages without receive time\n"
+          "  -n n       replay the trace n times\n"
+          "  -l level   log level: debug, info, warning or error\n",
+          name);
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+  int opt;
+  while ((opt = getopt(argc, argv, "w:r:b:c:a:d:B:t:i:n:l:h")) != -1) {
+    switch (opt) {
+      case 'w':
+        options.duplicateWindow = strtoul(optarg, nullptr, 10);
+        break;
+      case 'r':
+        options.rate = strtoul(optarg, nullptr, 10);
+        break;
+      case 'b':
+        options.burst = strtoul(optarg, nullptr, 10);
+        break;
+      case 'c':
+        options.changeOnly = true;
+        options.changeRefresh = strtoul(optarg, nullptr, 10) * 1000UL;
+        break;
+      case 'a':
+        options.allow = optarg;
+        break;
+      case 'd':
+        options.deny = optarg;
+        break;
+      case 'B':
+        options.batchSize = strtoul(optarg, nullptr, 10);
+        break;
+      case 't':
+        options.receiveTopic = optarg;
+        break;
+      case 'i':
+        options.interval = strtoul(optarg, nullptr, 10);
+        break;
+      case 'n':
+        options.passes = strtoul(optarg, nullptr, 10);
+        break;
+      case 'l':
+        options.logLevel = Logger.stringToLevel(optarg);
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+class Pipeline {
+ public:
+  explicit Pipeline(const Options &options)
+      : options(options),
+        capture("capture"),
+        duplicate("duplicate"),
+        device("device"),
+        log("log"),
+        logSink("logSink"),
+        queue("queue"),
+        publish("publish"),
+        total("total"),
+        published(0),
+        publishedBytes(0),
+        captureBytes(0) {
+    rawCapture.setStreaming(true);
+    duplicateFilter.setWindow(options.duplicateWindow);
+    deviceFilter.setLists(options.allow, options.deny);
+    deviceFilter.setRate(options.rate, options.burst);
+    deviceFilter.setChangeOnly(options.changeOnly, options.changeRefresh);
+    Logs.attach(sink, options.logLevel);
+    Logs.begin();
+  }
+
+  ~Pipeline() { Logs.detach(sink); }
+
+  // Capture with streaming enabled, as for rawCaptureMqtt
+  void pulses(const Trace::Pulses &record) {
+    setMillis(record.time);
+    StageTimer timer(capture);
+    rawCapture.push(record.pulses.data(), record.pulses.size());
+    rawCapture.loop([this](const RawCapture::Record &captured) {
+      captureBytes += captured.train.serialize(buffer, sizeof(buffer));
+    });
+  }
+
+  // Same order as RfHandler::onRfCode() and the MQTT loop
+  void message(const Trace::Message &record, unsigned long offset) {
+    setMillis(offset + record.time);
+    StageTimer all(total);
+    const char *protocol = record.protocol.c_str();
+    const char *deviceID = record.deviceID.c_str();
+    const char *text = record.message.c_str();
+    size_t length = record.message.length();
+    {
+      StageTimer timer(duplicate);
+      if (duplicateFilter.isDuplicate(protocol, deviceID, text, length)) {
+        Metrics.inc(METRIC_RF_DUPLICATES);
+        Metrics.countDuplicate(protocol);
+        return;
+      }
+      Metrics.inc(METRIC_RF_RECEIVED);
+      Metrics.countProtocol(protocol);
+    }
+    {
+      StageTimer timer(device);
+      switch (deviceFilter.check(protocol, deviceID, text, length)) {
+        case RfDeviceFilter::PASS:
+          break;
+        case RfDeviceFilter::DENIED:
+          Metrics.inc(METRIC_RF_DENIED);
+          return;
+        case RfDeviceFilter::UNCHANGED:
+          Metrics.inc(METRIC_RF_UNCHANGED);
+          return;
+        default:
+          Metrics.inc(METRIC_RF_RATE_LIMITED);
+          return;
+      }
+    }
+    {
+      StageTimer timer(log);
+      if (Logs.enabled(Logger.INFO)) {
+        Logs.setContext(protocol, deviceID);
+        Logger.info.print(F("rf signal received: "));
+        Logger.info.print(text);
+        Logger.info.print(F(" with protocol "));
+        Logger.info.print(protocol);
+        Logger.info.print(F(" deviceID="));
+        Logger.info.println(deviceID);
+        Logs.clearContext();
+      }
+    }
+    {
+      StageTimer timer(logSink);
+      Logs.loop();
+    }
+    {
+      StageTimer timer(queue);
+      events.push(protocol, deviceID, text, length);
+    }
+    {
+      StageTimer timer(publish);
+      events.drain([this](const RfEvent &event) { return send(event); });
+    }
+  }
+
+  void flush() {
+    if (!batch.empty()) {
+      StageTimer timer(publish);
+      publishPayload(batch.payload(), batch.length());
+      batch.clear();
+    }
+  }
+
+  void report(const Trace &trace) const {
+    unsigned long messages = trace.messages.size() * options.passes;
+    printf("%lu messages, %lu published (%zu bytes), %zu log bytes\n",
+           messages, published, publishedBytes, sink.bytes);
+    printf("%lu pulse trains, %zu capture bytes\n\n",
+           trace.pulses.size() * options.passes, captureBytes);
+    printStageHeader();
+    capture.print(trace.pulses.size() * options.passes);
+    for (const StageStats *stage :
+         {&duplicate, &device, &log, &logSink, &queue, &publish, &total}) {
+      stage->print(messages);
+    }
+    printf("\nmetrics: %s\n", Metrics.toJson().c_str());
+  }
+
+ private:
+  bool send(const RfEvent &event) {
+    if (options.batchSize <= 1) {
+      publishPayload(event.message, strlen(event.message));
+      return true;
+    }
+    if (!batch.add(event, millis() - event.timestamp, MQTT_MAX_PACKET_SIZE)) {
+      flush();
+      batch.add(event, millis() - event.timestamp, MQTT_MAX_PACKET_SIZE);
+    }
+    if (batch.size() >= options.batchSize) {
+      flush();
+    }
+    return true;
+  }
+
+  void publishPayload(const char *payload, size_t length) {
+    Metrics.inc(METRIC_MQTT_PUBLISHED);
+    published++;
+    publishedBytes += length;
+  }
+
+  const Options &options;
+  RawCapture rawCapture;
+  RfDuplicateFilter duplicateFilter;
+  RfDeviceFilter deviceFilter;
+  RfEventQueue events;
+  PublishBatch batch;
+  NullLogSink sink;
+  StageStats capture;
+  StageStats duplicate;
+  StageStats device;
+  StageStats log;
+  StageStats logSink;
+  StageStats queue;
+  StageStats publish;
+  StageStats total;
+  unsigned long published;
+  size_t publishedBytes;
+  size_t captureBytes;
+  uint8_t buffer[sizeof(CompactPulseTrain)];
+};
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  Trace trace;
+  for (int i = optind; i < argc; ++i) {
+    if (!trace.load(argv[i], options.receiveTopic, options.interval)) {
+      fprintf(stderr, "cannot read trace %s\n", argv[i]);
+      return 1;
+    }
+  }
+  if (optind == argc) {
+    trace.generate(10000, 1000, options.interval);
+  }
+
+  Pipeline pipeline(options);
+  unsigned long offset = 0;
+  for (unsigned long pass = 0; pass < options.passes; ++pass) {
+    for (const Trace::Pulses &record : trace.pulses) {
+      pipeline.pulses(record);
+    }
+    for (const Trace::Message &record : trace.messages) {
+      pipeline.message(record, offset);
+    }
+    if (!trace.messages.empty()) {
+      offset += trace.messages.back().time + options.interval;
+    }
+  }
+  pipeline.flush();
+  pipeline.report(trace);
+  return 0;
+}
@@ -0,0 +1,42 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// The library sources of the benchmarked pipeline.  They are compiled
+// here instead of as PlatformIO libraries, as their directories also
+// contain sources that need the ESP8266 SDK.
+
+#include "../lib/LogPipeline/LogPipeline.cpp"
+#include "../lib/MQTT/PublishBatch.cpp"
+#include "../lib/Metrics/Metrics.cpp"
+#include "../lib/RfEvent/RfEvent.cpp"
+#include "../lib/RfEvent/RfEventQueue.cpp"
+#include "../lib/RfHandler/CompactPulseTrain.cpp"
+#include "../lib/RfHandler/RawCapture.cpp"
+#include "../lib/RfHandler/RfDeviceFilter.cpp"
+#include "../lib/RfHandler/RfDuplicateFilter.cpp"
@@ -0,0 +1,176 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <CompactPulseTrain.h>
+
+#include "Trace.h"
+
+static const uint32_t CAPTURE_FILE_MAGIC = 0x31504352;  // "RCP1"
+
+static uint32_t readLE32(const uint8_t *data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) |
+         (static_cast<uint32_t>(data[3]) << 24);
+}
+
+bool Trace::load(const char *path, const std::string &receiveTopic,
+                 unsigned long interval) {
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  uint8_t magic[4];
+  bool capture = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+                 readLE32(magic) == CAPTURE_FILE_MAGIC;
+  bool ok = true;
+  if (capture) {
+    ok = loadCapture(file);
+  } else {
+    rewind(file);
+    loadMessages(file, receiveTopic, interval);
+  }
+  fclose(file);
+  return ok;
+}
+
+bool Trace::loadCapture(FILE *file) {
+  std::vector<uint8_t> data;
+  uint8_t buffer[4096];
+  size_t size;
+  while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.insert(data.end(), buffer, buffer + size);
+  }
+
+  // records: device millis() (LE32) and the serialized pulse train
+  size_t pos = 0;
+  CompactPulseTrain train;
+  uint16_t decoded[PULSE_TRAIN_MAX_LENGTH];
+  while (pos + 4 < data.size()) {
+    size_t used =
+        train.deserialize(data.data() + pos + 4, data.size() - pos - 4);
+    if (used == 0) {
+      fprintf(stderr, "corrupt capture record at offset %zu\n", pos + 4);
+      return false;
+    }
+    size_t length = train.decode(decoded, PULSE_TRAIN_MAX_LENGTH);
+    pulses.push_back({readLE32(data.data() + pos),
+                      std::vector<uint16_t>(decoded, decoded + length)});
+    pos += 4 + used;
+  }
+  return true;
+}
+
+void Trace::loadMessages(FILE *file, const std::string &receiveTopic,
+                         unsigned long interval) {
+  char line[1024];
+  unsigned long time = messages.empty() ? 0 : messages.back().time;
+  double firstStamp = -1;
+  while (fgets(line, sizeof(line), file)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    char *pos = line;
+
+    // optional receive time of mosquitto_sub -F '%U %t %p'
+    char *end;
+    double stamp = strtod(pos, &end);
+    const char *dot = strchr(pos, '.');
+    if (end != pos && *end == ' ' && dot != nullptr && dot < end) {
+      if (firstStamp < 0) {
+        firstStamp = stamp;
+      }
+      time = static_cast<unsigned long>((stamp - firstStamp) * 1000);
+      pos = end + 1;
+    } else {
+      time += interval;
+    }
+
+    char *payload = strchr(pos, ' ');
+    if (payload == nullptr ||
+        strncmp(pos, receiveTopic.c_str(), receiveTopic.length()) != 0) {
+      continue;
+    }
+    *payload++ = '\0';
+    std::string device(pos + receiveTopic.length());
+    size_t slash = device.find('/');
+    Message message = {time, device.substr(0, slash), "", payload};
+    if (slash != std::string::npos) {
+      message.deviceID = device.substr(slash + 1);
+    }
+    messages.push_back(message);
+  }
+}
+
+void Trace::generate(size_t count, size_t trains, unsigned long interval) {
+  static const char *const protocols[] = {"arctech_switch", "elro_800_switch",
+                                          "tfa", "alecto_ws1700"};
+  static const size_t DEVICES = 24;
+  static const size_t REPEATS = 3;
+
+  srand(433);
+  unsigned long time = messages.empty() ? 0 : messages.back().time;
+  char text[128];
+  char id[16];
+  while (count > 0) {
+    size_t device = rand() % DEVICES;
+    const char *protocol = protocols[device % 4];
+    snprintf(id, sizeof(id), "%zu", 1000 + device);
+    if (device % 4 < 2) {
+      snprintf(text, sizeof(text), "{\"id\":%zu,\"unit\":%d,\"state\":\"%s\"}",
+               1000 + device, rand() % 4, rand() % 2 ? "on" : "off");
+    } else {
+      snprintf(text, sizeof(text),
+               "{\"id\":%zu,\"temperature\":%.1f,\"humidity\":%d,"
+               "\"battery\":1}",
+               1000 + device, 15 + (rand() % 100) / 10.0, 40 + rand() % 20);
+    }
+    time += interval * (1 + rand() % 20);
+    for (size_t repeat = 0; repeat < REPEATS && count > 0; ++repeat) {
+      messages.push_back({time, protocol, id, text});
+      time += 50;
+      count--;
+    }
+  }
+
+  // pulse trains of a 24 bit code with jitter and a sync pulse
+  time = pulses.empty() ? 0 : pulses.back().time;
+  while (trains-- > 0) {
+    Pulses train = {time, {}};
+    uint32_t code = rand() & 0xffffff;
+    for (int bit = 23; bit >= 0; --bit) {
+      bool one = (code >> bit) & 1;
+      train.pulses.push_back((one ? 900 : 300) + rand() % 40);
+      train.pulses.push_back((one ? 300 : 900) + rand() % 40);
+    }
+    train.pulses.push_back(300 + rand() % 40);
+    train.pulses.push_back(9300 + rand() % 200);
+    pulses.push_back(train);
+    time += interval;
+  }
+}
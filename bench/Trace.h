@@ -0,0 +1,75 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+// Recorded input of the gateway, replayed by the benchmark.
+//
+// Pulse trains are read from the capture files of the firmware
+// (/debug/capture).  Messages are read from the output of
+//   mosquitto_sub -v -t '<receive topic>#'
+// optionally with -F '%U %t %p' to keep the receive times, otherwise
+// the messages are spaced by a fixed interval.
+struct Trace {
+  struct Pulses {
+    unsigned long time;
+    std::vector<uint16_t> pulses;
+  };
+  struct Message {
+    unsigned long time;
+    std::string protocol;
+    std::string deviceID;
+    std::string message;
+  };
+
+  // Returns false if the file cannot be read.
+  bool load(const char *path, const std::string &receiveTopic,
+            unsigned long interval);
+  // Random traffic of remotes and sensors: each frame is repeated, as
+  // most RF devices do.
+  void generate(size_t messages, size_t trains, unsigned long interval);
+
+  std::vector<Pulses> pulses;
+  std::vector<Message> messages;
+
+ private:
+  bool loadCapture(FILE *file);
+  void loadMessages(FILE *file, const std::string &receiveTopic,
+                    unsigned long interval);
+};
+
+#endif  // TRACE_H
@@ -0,0 +1,144 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdio.h>
+
+#include <Arduino.h>
+#include <ArduinoSimpleLogging.h>
+#include <FS.h>
+
+static unsigned long clockMillis = 0;
+
+unsigned long millis() { return clockMillis; }
+
+unsigned long micros() { return clockMillis * 1000UL; }
+
+void setMillis(unsigned long now) { clockMillis = now; }
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::print(const __FlashStringHelper *str) {
+  return write(reinterpret_cast<const char *>(str));
+}
+
+size_t Print::print(const String &str) {
+  return write(str.c_str(), str.length());
+}
+
+size_t Print::print(long value) {
+  char buffer[24];
+  return write(buffer, snprintf(buffer, sizeof(buffer), "%ld", value));
+}
+
+size_t Print::print(unsigned long value) {
+  char buffer[24];
+  return write(buffer, snprintf(buffer, sizeof(buffer), "%lu", value));
+}
+
+size_t Print::print(double value, int digits) {
+  char buffer[32];
+  return write(buffer,
+               snprintf(buffer, sizeof(buffer), "%.*f", digits, value));
+}
+
+String operator+(const String &lhs, const String &rhs) {
+  String result(lhs);
+  result += rhs;
+  return result;
+}
+
+String operator+(const String &lhs, const char *rhs) {
+  String result(lhs);
+  result += rhs;
+  return result;
+}
+
+String operator+(const String &lhs, const __FlashStringHelper *rhs) {
+  String result(lhs);
+  result += rhs;
+  return result;
+}
+
+FS SPIFFS;
+
+SimpleLogger Logger;
+
+SimpleLogger::SimpleLogger()
+    : debug(*this, DEBUG),
+      info(*this, INFO),
+      warning(*this, WARNING),
+      error(*this, ERROR),
+      handlerCount(0) {}
+
+void SimpleLogger::addHandler(Level level, Print &handler) {
+  for (size_t i = 0; i < handlerCount; ++i) {
+    if (handlers[i].target == &handler) {
+      handlers[i].level = level;
+      return;
+    }
+  }
+  if (handlerCount < SIMPLE_LOGGING_HANDLERS) {
+    handlers[handlerCount++] = {&handler, level};
+  }
+}
+
+void SimpleLogger::removeHandler(Print &handler) {
+  for (size_t i = 0; i < handlerCount; ++i) {
+    if (handlers[i].target == &handler) {
+      handlers[i] = handlers[--handlerCount];
+      return;
+    }
+  }
+}
+
+SimpleLogger::Level SimpleLogger::stringToLevel(const String &name) {
+  if (name == "debug") return DEBUG;
+  if (name == "info") return INFO;
+  if (name == "warning") return WARNING;
+  return ERROR;
+}
+
+size_t SimpleLogger::LevelPrint::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t SimpleLogger::LevelPrint::write(const uint8_t *buffer, size_t size) {
+  for (size_t i = 0; i < logger.handlerCount; ++i) {
+    if (level >= logger.handlers[i].level) {
+      logger.handlers[i].target->write(buffer, size);
+    }
+  }
+  return size;
+}
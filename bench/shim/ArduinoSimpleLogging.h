@@ -0,0 +1,81 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// Logger of ArduinoSimpleLogging: each level forwards to the handlers
+// registered for it or a lower level.
+
+#ifndef ARDUINOSIMPLELOGGING_H
+#define ARDUINOSIMPLELOGGING_H
+
+#include <WString.h>
+
+#include <Print.h>
+
+#define SIMPLE_LOGGING_HANDLERS 8
+
+class SimpleLogger {
+ public:
+  enum Level { DEBUG = 0, INFO = 1, WARNING = 2, ERROR = 3 };
+
+  class LevelPrint : public Print {
+   public:
+    LevelPrint(SimpleLogger &logger, Level level)
+        : logger(logger), level(level) {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+
+   private:
+    SimpleLogger &logger;
+    Level level;
+  };
+
+  SimpleLogger();
+
+  void addHandler(Level level, Print &handler);
+  void removeHandler(Print &handler);
+  Level stringToLevel(const String &name);
+
+  LevelPrint debug;
+  LevelPrint info;
+  LevelPrint warning;
+  LevelPrint error;
+
+ private:
+  struct Handler {
+    Print *target;
+    Level level;
+  };
+  Handler handlers[SIMPLE_LOGGING_HANDLERS];
+  size_t handlerCount;
+};
+
+extern SimpleLogger Logger;
+
+#endif  // ARDUINOSIMPLELOGGING_H
@@ -0,0 +1,61 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// SPIFFS is not available on the host: files never open, so the
+// benchmarked sources take their "no file system" paths.
+
+#ifndef FS_H
+#define FS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <WString.h>
+
+class File {
+ public:
+  explicit operator bool() const { return false; }
+  void close() {}
+  void flush() {}
+  size_t size() const { return 0; }
+  size_t write(const uint8_t *buffer, size_t size) { return 0; }
+  size_t read(uint8_t *buffer, size_t size) { return 0; }
+};
+
+class FS {
+ public:
+  File open(const String &path, const char *mode) { return File(); }
+  bool exists(const String &path) { return false; }
+  bool remove(const String &path) { return false; }
+  bool rename(const String &from, const String &to) { return false; }
+};
+
+extern FS SPIFFS;
+
+#endif  // FS_H
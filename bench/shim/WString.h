@@ -0,0 +1,137 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef WSTRING_H
+#define WSTRING_H
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <string>
+
+#include <pgmspace.h>
+
+// Subset of the Arduino String used by the benchmarked sources.  It is
+// backed by std::string, so its allocations show up in the counters.
+class String {
+ public:
+  String() = default;
+  String(const char *str) : data(str ? str : "") {}
+  String(const char *str, size_t length) : data(str, length) {}
+  String(const __FlashStringHelper *str)
+      : data(reinterpret_cast<const char *>(str)) {}
+  explicit String(char c) : data(1, c) {}
+  explicit String(int value) : data(std::to_string(value)) {}
+  explicit String(unsigned int value) : data(std::to_string(value)) {}
+  explicit String(long value) : data(std::to_string(value)) {}
+  explicit String(unsigned long value) : data(std::to_string(value)) {}
+
+  const char *c_str() const { return data.c_str(); }
+  unsigned int length() const { return data.length(); }
+  bool reserve(unsigned int size) {
+    data.reserve(size);
+    return true;
+  }
+
+  char operator[](unsigned int index) const {
+    return index < data.length() ? data[index] : 0;
+  }
+  char charAt(unsigned int index) const { return (*this)[index]; }
+
+  String &operator+=(const String &str) {
+    data += str.data;
+    return *this;
+  }
+  String &operator+=(const char *str) {
+    data += str;
+    return *this;
+  }
+  String &operator+=(const __FlashStringHelper *str) {
+    return *this += reinterpret_cast<const char *>(str);
+  }
+  String &operator+=(char c) {
+    data += c;
+    return *this;
+  }
+  String &operator+=(int value) { return *this += String(value); }
+  String &operator+=(unsigned int value) { return *this += String(value); }
+  String &operator+=(long value) { return *this += String(value); }
+  String &operator+=(unsigned long value) { return *this += String(value); }
+  bool concat(const String &str) {
+    *this += str;
+    return true;
+  }
+  bool concat(char c) {
+    *this += c;
+    return true;
+  }
+
+  bool equals(const String &str) const { return data == str.data; }
+  bool operator==(const String &str) const { return data == str.data; }
+  bool operator==(const char *str) const { return data == (str ? str : ""); }
+  bool operator!=(const String &str) const { return data != str.data; }
+  bool operator!=(const char *str) const { return !(*this == str); }
+  bool startsWith(const String &prefix) const {
+    return data.compare(0, prefix.data.length(), prefix.data) == 0;
+  }
+  bool endsWith(const String &suffix) const {
+    return data.length() >= suffix.data.length() &&
+           data.compare(data.length() - suffix.data.length(),
+                        suffix.data.length(), suffix.data) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t pos = data.find(c, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+  }
+  int indexOf(const String &str, unsigned int from = 0) const {
+    size_t pos = data.find(str.data, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+  }
+  String substring(unsigned int from) const {
+    return from < data.length() ? String(data.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    return from < to && from < data.length()
+               ? String(data.substr(from, to - from))
+               : String();
+  }
+  long toInt() const { return strtol(data.c_str(), nullptr, 10); }
+
+ private:
+  explicit String(const std::string &str) : data(str) {}
+
+  std::string data;
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const String &lhs, const __FlashStringHelper *rhs);
+
+#endif  // WSTRING_H
@@ -1,1527 +0,0 @@
-static const unsigned int index_html_gz_len = 18296;
-static const char index_html_gz[] PROGMEM = {
-    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d,
-    0x6b, 0x77, 0xdb, 0x36, 0xb6, 0xe8, 0xf7, 0xf9, 0x15, 0x34, 0x9b, 0xf1,
-    0x90, 0x35, 0x25, 0xcb, 0xf2, 0x23, 0x09, 0x65, 0x5a, 0xb7, 0x49, 0xdc,
-    0x69, 0x66, 0xa5, 0x69, 0x6e, 0x93, 0x76, 0xda, 0x3a, 0x9e, 0x2c, 0x5a,
-    0x82, 0x2d, 0x3a, 0x12, 0xa9, 0x92, 0x94, 0x65, 0xd7, 0xd2, 0xfd, 0xed,
-    0x77, 0xef, 0x0d, 0x80, 0x04, 0x40, 0x50, 0x76, 0x3a, 0xe7, 0xac, 0x39,
-    0x77, 0xad, 0x7b, 0x7a, 0x26, 0x26, 0xde, 0xc0, 0xc6, 0x7e, 0x63, 0x03,
-    0x3a, 0xde, 0x1a, 0x67, 0xa3, 0xf2, 0x6e, 0xce, 0x9c, 0x49, 0x39, 0x9b,
-    0x9e, 0x1c, 0xe3, 0xbf, 0xce, 0x34, 0x4e, 0xaf, 0x22, 0x97, 0xa5, 0x2e,
-    0xa4, 0x59, 0x3c, 0x3e, 0x39, 0x9e, 0xb1, 0x32, 0x76, 0x46, 0x93, 0x38,
-    0x2f, 0x58, 0x19, 0xb9, 0x8b, 0xf2, 0xb2, 0xf3, 0xcc, 0x15, 0xb9, 0x69,
-    0x3c, 0x63, 0x91, 0x7b, 0x93, 0xb0, 0xe5, 0x3c, 0xcb, 0x4b, 0xd7, 0x19,
-    0x65, 0x69, 0xc9, 0x52, 0xa8, 0xb5, 0x4c, 0xc6, 0xe5, 0x24, 0x1a, 0xb3,
-    0x9b, 0x64, 0xc4, 0x3a, 0x94, 0x08, 0x92, 0x34, 0x29, 0x93, 0x78, 0xda,
-    0x29, 0x46, 0xf1, 0x94, 0x45, 0x7b, 0xd0, 0x45, 0x99, 0x94, 0x53, 0x76,
-    0xf2, 0xfd, 0xef, 0x65, 0x79, 0xb0, 0xbf, 0x7f, 0x15, 0x97, 0x6c, 0x19,
-    0xdf, 0x1d, 0xef, 0xf2, 0xdc, 0xe3, 0xa2, 0xbc, 0x83, 0x3f, 0xbb, 0x5f,
-    0x6f, 0xfd, 0xe5, 0xdd, 0x22, 0x67, 0xce, 0xcd, 0x5e, 0xb7, 0xd7, 0xdd,
-    0xfb, 0xcb, 0xcb, 0x6c, 0x7e, 0x97, 0x27, 0x57, 0x93, 0xd2, 0xe9, 0xf7,
-    0xf6, 0xf6, 0x9d, 0x5f, 0xe3, 0x49, 0x96, 0x6d, 0xfd, 0xe5, 0x0d, 0x8c,
-    0x92, 0x16, 0x6c, 0xec, 0x2c, 0xd2, 0x31, 0xcb, 0x9d, 0x72, 0xc2, 0x9c,
-    0x17, 0xef, 0x5f, 0x39, 0x22, 0xbb, 0xfb, 0x97, 0x49, 0x59, 0xce, 0x8b,
-    0x70, 0x77, 0xf7, 0x2a, 0x29, 0x27, 0x8b, 0x8b, 0xee, 0x28, 0x9b, 0xed,
-    0xce, 0xa1, 0xd3, 0xce, 0xa8, 0x28, 0xe8, 0x63, 0xf7, 0x62, 0x9a, 0x5d,
-    0xec, 0xce, 0xe2, 0xa2, 0x64, 0xf9, 0xee, 0x9b, 0xd7, 0x2f, 0x4f, 0xdf,
-    0xbe, 0x3f, 0xed, 0xce, 0xc6, 0x7f, 0xf9, 0x7a, 0x17, 0xc7, 0x4f, 0xb3,
-    0x7c, 0x16, 0x4f, 0x93, 0x3f, 0x58, 0x17, 0xea, 0x3b, 0x37, 0xff, 0xda,
-    0xef, 0xf6, 0x9c, 0x95, 0xf3, 0xfd, 0xeb, 0x0f, 0x72, 0x00, 0x48, 0x41,
-    0xcf, 0xdd, 0x24, 0xdb, 0xad, 0xaa, 0x2a, 0x13, 0xf5, 0x46, 0xbe, 0xf3,
-    0x36, 0x19, 0x65, 0xd3, 0xb8, 0x70, 0xfe, 0x1e, 0x4f, 0xa7, 0xf1, 0xd5,
-    0x04, 0xe6, 0x18, 0xa7, 0x63, 0xe7, 0x1f, 0x59, 0x1a, 0x97, 0x93, 0x38,
-    0x75, 0xde, 0xb2, 0x78, 0xca, 0x07, 0x73, 0x8c, 0xc1, 0x60, 0xac, 0xee,
-    0xbe, 0x6d, 0x34, 0xb9, 0x8e, 0x94, 0x51, 0xcf, 0xbb, 0x7a, 0xbb, 0xaf,
-    0x77, 0x71, 0x2b, 0xef, 0x2f, 0x61, 0x3b, 0x3a, 0x97, 0xf1, 0x2c, 0x99,
-    0xde, 0x85, 0x45, 0x9c, 0x16, 0x9d, 0x82, 0xe5, 0xc9, 0xe5, 0xa0, 0x33,
-    0x2b, 0x3a, 0x25, 0xbb, 0x2d, 0x3b, 0x05, 0xd4, 0xef, 0xc4, 0xe3, 0xeb,
-    0x45, 0x51, 0x86, 0x7b, 0xbd, 0xde, 0x5f, 0x07, 0x9d, 0x25, 0xbb, 0xf8,
-    0x9c, 0x94, 0xf6, 0xd2, 0xf5, 0x45, 0x36, 0xbe, 0xbb, 0x9f, 0xc5, 0xf9,
-    0x55, 0x92, 0x86, 0xbd, 0x75, 0x9c, 0x97, 0xc9, 0x68, 0xca, 0x82, 0xb8,
-    0x48, 0xc6, 0x2c, 0x18, 0x03, 0x3a, 0x24, 0xd3, 0x22, 0xb8, 0x4c, 0xae,
-    0x46, 0xf1, 0xbc, 0x4c, 0xb2, 0x14, 0x3f, 0x01, 0xb6, 0xc1, 0x65, 0x96,
-    0x01, 0x58, 0x03, 0xc4, 0x25, 0xfc, 0x73, 0x95, 0x67, 0x8b, 0x79, 0x30,
-    0x8b, 0x93, 0x34, 0x98, 0xb1, 0x74, 0x11, 0xa4, 0xf1, 0x4d, 0x50, 0xb0,
-    0x11, 0xb5, 0x28, 0x16, 0x33, 0xe8, 0xfe, 0xee, 0x7e, 0x9c, 0x14, 0xf3,
-    0x69, 0x7c, 0x17, 0xc2, 0xb6, 0x8c, 0x3e, 0xaf, 0xe3, 0xc5, 0x38, 0xc9,
-    0x82, 0x51, 0x9c, 0xde, 0xc4, 0x45, 0x30, 0xcf, 0xb3, 0xab, 0x9c, 0x15,
-    0x45, 0x70, 0x03, 0xa3, 0x66, 0x55, 0xcd, 0x24, 0x9d, 0x26, 0x29, 0xeb,
-    0x50, 0x83, 0xc1, 0x0d, 0xc3, 0xa9, 0x01, 0xaa, 0x01, 0x40, 0xae, 0xd2,
-    0xf0, 0x22, 0x2e, 0x18, 0x96, 0xf2, 0x8e, 0xc2, 0x34, 0x2b, 0xbd, 0x33,
-    0x44, 0xd4, 0x3c, 0x9b, 0x16, 0xe7, 0x7e, 0xd5, 0x45, 0x9a, 0xa5, 0x6c,
-    0x30, 0x61, 0xb8, 0x67, 0xb0, 0xba, 0xb3, 0x49, 0x32, 0x1e, 0xb3, 0xf4,
-    0x3c, 0x28, 0xd9, 0x0c, 0x8a, 0x4b, 0xa6, 0xd5, 0x5b, 0xc7, 0xf7, 0x17,
-    0xf1, 0xe8, 0x33, 0xae, 0x25, 0x1d, 0x77, 0x60, 0x07, 0xb2, 0x3c, 0x2c,
-    0x73, 0x80, 0xf0, 0x3c, 0xce, 0x01, 0xff, 0xd7, 0x71, 0x18, 0xc3, 0x8a,
-    0x6e, 0x00, 0x38, 0xe1, 0x24, 0x83, 0xe9, 0xdc, 0x67, 0x8b, 0x12, 0xa7,
-    0x80, 0x60, 0xbb, 0xb8, 0xc8, 0xcf, 0x08, 0xc7, 0xcf, 0xef, 0x2f, 0xb2,
-    0x1c, 0x60, 0xd2, 0xb9, 0xc8, 0xca, 0x32, 0x9b, 0x85, 0x7b, 0xf3, 0x5b,
-    0x67, 0x0c, 0x9f, 0x6c, 0xbc, 0xbe, 0x08, 0x0a, 0x98, 0x5e, 0x7a, 0xc5,
-    0x77, 0x70, 0xc9, 0x27, 0xf5, 0xb4, 0xd7, 0x5b, 0x8f, 0x2f, 0x53, 0x9e,
-    0x47, 0xe4, 0x11, 0x26, 0x25, 0x2c, 0x71, 0xb4, 0x9e, 0xec, 0x89, 0x4c,
-    0xd8, 0xb1, 0xb0, 0xcf, 0x66, 0x03, 0xb1, 0x49, 0xdd, 0xa3, 0xa7, 0x6c,
-    0xe6, 0xf4, 0xd6, 0x90, 0xfc, 0xac, 0x4c, 0x38, 0xfc, 0xea, 0xf2, 0xb2,
-    0x37, 0xe0, 0xb3, 0xfe, 0xaa, 0x07, 0xbd, 0x16, 0x80, 0x3a, 0x53, 0xa5,
-    0x8b, 0x67, 0xb0, 0xd9, 0xc5, 0x02, 0x26, 0xb1, 0x98, 0x2b, 0xb9, 0x4f,
-    0x0f, 0xff, 0x3a, 0x20, 0x28, 0x4b, 0x20, 0x0d, 0xe6, 0x59, 0x91, 0xe0,
-    0xc6, 0x85, 0x39, 0x03, 0x10, 0xc1, 0x7a, 0x5b, 0x41, 0x8f, 0x3d, 0x95,
-    0xd9, 0x3c, 0xec, 0x74, 0x0f, 0xd9, 0x0c, 0xfb, 0xbe, 0x17, 0x8b, 0xee,
-    0x74, 0xfb, 0x98, 0x93, 0xcc, 0xae, 0x04, 0x34, 0x00, 0x44, 0xc5, 0xcd,
-    0x15, 0xed, 0x52, 0x98, 0x03, 0xea, 0xf8, 0xf7, 0x08, 0xc0, 0xcb, 0x69,
-    0xb6, 0x0c, 0xf9, 0x96, 0xac, 0x39, 0x5e, 0x49, 0x44, 0xdc, 0x83, 0x15,
-    0x1e, 0xf4, 0xe6, 0xb7, 0xeb, 0x49, 0x7e, 0x2f, 0xd1, 0xf7, 0x22, 0xbb,
-    0xc5, 0x29, 0x27, 0xe9, 0x55, 0x28, 0x38, 0x12, 0x66, 0x0d, 0x5a, 0xb2,
-    0xab, 0x3d, 0x9f, 0x43, 0xaf, 0xd5, 0x60, 0xf1, 0xa2, 0xcc, 0xd6, 0xa3,
-    0x0c, 0x50, 0xfb, 0xf3, 0xc5, 0x18, 0xd0, 0x8e, 0x05, 0x45, 0x3c, 0x9b,
-    0x6b, 0x24, 0x35, 0xcb, 0xd2, 0x0c, 0x76, 0x7c, 0xc4, 0x82, 0xea, 0x6b,
-    0x50, 0x83, 0x0b, 0x26, 0xb6, 0xbe, 0x58, 0xc0, 0x22, 0x53, 0x60, 0x7d,
-    0xf3, 0x45, 0x19, 0x64, 0xf3, 0x92, 0x23, 0x3f, 0xc0, 0x04, 0x10, 0x3e,
-    0x40, 0x22, 0x03, 0x74, 0x89, 0xef, 0xf9, 0x4e, 0x24, 0x29, 0xf0, 0x85,
-    0xa4, 0xa4, 0x1e, 0xaa, 0x44, 0x45, 0x6d, 0xbc, 0xa7, 0x7a, 0x7a, 0x37,
-    0x49, 0x91, 0x5c, 0x4c, 0x99, 0x1c, 0x81, 0x77, 0x79, 0x4f, 0x74, 0x4b,
-    0x88, 0x78, 0x09, 0xfc, 0x80, 0xa3, 0xaa, 0xa8, 0x41, 0xbc, 0x9d, 0x26,
-    0x72, 0x86, 0x1c, 0x3f, 0xe2, 0xd9, 0xe7, 0x81, 0x92, 0x05, 0x74, 0xc5,
-    0x4a, 0x2d, 0x07, 0x36, 0x6a, 0x96, 0x94, 0xe7, 0x15, 0x60, 0xe3, 0xf9,
-    0x9c, 0xc5, 0xd0, 0xfd, 0x88, 0x85, 0xbc, 0xfd, 0x60, 0xb4, 0xc8, 0x0b,
-    0x98, 0xfc, 0x3c, 0x4b, 0x00, 0xa0, 0xb9, 0x18, 0xec, 0x0c, 0x68, 0x25,
-    0x86, 0xd9, 0x8d, 0xcf, 0xd5, 0x61, 0xab, 0xcc, 0x7b, 0xd1, 0x68, 0xcc,
-    0x2e, 0xe3, 0xc5, 0xb4, 0x14, 0x8d, 0xc2, 0xb0, 0x33, 0xcb, 0xfe, 0xe8,
-    0x5c, 0x66, 0xa3, 0x45, 0xd1, 0x49, 0xd2, 0x14, 0x98, 0x05, 0xb5, 0x6b,
-    0xe6, 0x57, 0x98, 0x32, 0x98, 0xc7, 0xe3, 0x31, 0x6e, 0x67, 0x6f, 0x4d,
-    0x55, 0xef, 0x55, 0xf4, 0xe4, 0x1c, 0x71, 0xad, 0xac, 0x66, 0x34, 0x61,
-    0xa3, 0xcf, 0xb0, 0xe3, 0xfa, 0xa2, 0x63, 0x60, 0x0a, 0xe7, 0x36, 0xd4,
-    0xa9, 0xa8, 0x53, 0xc3, 0x1c, 0x25, 0xd7, 0x18, 0x9d, 0xf7, 0x97, 0x2e,
-    0x66, 0x17, 0x2c, 0x3f, 0x87, 0x59, 0x8b, 0x1e, 0x69, 0xca, 0x9d, 0x62,
-    0x9e, 0xa4, 0x1d, 0x15, 0x1d, 0x5a, 0x6a, 0x03, 0xa3, 0xd0, 0x6b, 0xdf,
-    0x8b, 0xe5, 0x10, 0x3e, 0xaa, 0x5b, 0x03, 0x1b, 0x31, 0x9a, 0x58, 0xb7,
-    0x06, 0xb1, 0xe0, 0x32, 0x61, 0xd3, 0xf1, 0xe0, 0x4f, 0x11, 0x84, 0x65,
-    0x94, 0x7a, 0x7e, 0x3c, 0xa3, 0x33, 0xc2, 0x81, 0xa6, 0x96, 0x05, 0xb5,
-    0x35, 0x18, 0x83, 0x9c, 0xca, 0x63, 0x64, 0x16, 0xb6, 0x19, 0x13, 0xa2,
-    0xd2, 0x94, 0x01, 0x03, 0xe5, 0xf6, 0x22, 0x3f, 0x2c, 0xb2, 0x69, 0x32,
-    0x76, 0x8a, 0x64, 0x0a, 0x78, 0x5f, 0x11, 0x83, 0xd3, 0x9f, 0xd7, 0xc0,
-    0xef, 0xee, 0x03, 0xff, 0x70, 0xba, 0x47, 0x7d, 0xfa, 0xf3, 0x14, 0x99,
-    0xc9, 0x94, 0x5d, 0xb1, 0x74, 0x6c, 0xc3, 0x92, 0x8a, 0xe4, 0x74, 0x32,
-    0x97, 0x94, 0xd9, 0x60, 0xb7, 0x25, 0x22, 0xac, 0x64, 0xd3, 0x40, 0xa6,
-    0xd3, 0x78, 0x5e, 0xb0, 0x50, 0x7e, 0x0c, 0x44, 0x01, 0x52, 0xbe, 0xe8,
-    0x7f, 0x1c, 0x94, 0x93, 0xfb, 0x7a, 0xbc, 0x2e, 0x67, 0x59, 0x81, 0x94,
-    0x26, 0x9a, 0x10, 0xd9, 0x4a, 0x66, 0xa8, 0x35, 0xc5, 0x20, 0x2f, 0xba,
-    0xa4, 0x8e, 0x20, 0x13, 0x9c, 0xc5, 0xb7, 0x5c, 0x5f, 0xe2, 0x02, 0x59,
-    0xd9, 0xfc, 0x81, 0x2e, 0x15, 0x79, 0x93, 0xab, 0xfb, 0x29, 0x2b, 0x4b,
-    0x65, 0x0e, 0x9d, 0xee, 0x3e, 0x30, 0x9e, 0x01, 0x31, 0x02, 0x10, 0x45,
-    0x30, 0x3d, 0xcc, 0x85, 0x05, 0x26, 0x33, 0x60, 0x4a, 0xc5, 0x9c, 0xb1,
-    0xf1, 0x40, 0xe5, 0x61, 0xdf, 0xe6, 0x8c, 0xbd, 0x07, 0x7e, 0x11, 0x7c,
-    0x93, 0x27, 0xb3, 0x2c, 0x70, 0x5f, 0xe5, 0x19, 0x00, 0x1c, 0x73, 0xdc,
-    0xe0, 0x3b, 0x06, 0x60, 0x47, 0x76, 0x8e, 0x85, 0xf1, 0x34, 0x50, 0x54,
-    0x08, 0x39, 0x17, 0x05, 0xc1, 0x1a, 0x79, 0x97, 0x53, 0xa6, 0x64, 0x82,
-    0xce, 0x81, 0x19, 0x6a, 0x45, 0xaa, 0xa0, 0xa2, 0x68, 0x96, 0x27, 0x80,
-    0x83, 0x20, 0x32, 0xf3, 0xe4, 0x0f, 0x98, 0x63, 0x3c, 0xd5, 0x4a, 0xc7,
-    0x49, 0xce, 0xf5, 0x04, 0x41, 0xda, 0x03, 0x75, 0xa0, 0x0e, 0xed, 0x66,
-    0x9e, 0x2d, 0x9d, 0x65, 0x1e, 0xcf, 0x07, 0x72, 0x38, 0x23, 0xdb, 0x56,
-    0x53, 0x62, 0x23, 0x0a, 0xac, 0x8e, 0x20, 0x03, 0x9a, 0x1a, 0xc8, 0x58,
-    0xd0, 0x71, 0xea, 0xae, 0x88, 0xb9, 0x00, 0x98, 0x3f, 0x87, 0xbc, 0xa0,
-    0xad, 0xc5, 0xfa, 0x7f, 0xcd, 0xd8, 0x38, 0x89, 0x1d, 0x90, 0xa9, 0xa4,
-    0xe6, 0x79, 0xd8, 0xc3, 0x04, 0xf6, 0x91, 0xea, 0xe6, 0xa0, 0x65, 0xd2,
-    0xf6, 0xfb, 0x81, 0xa5, 0x80, 0xab, 0x0d, 0xfe, 0x3d, 0x21, 0x9e, 0x23,
-    0xf7, 0x58, 0xdf, 0xf9, 0x75, 0x37, 0x9b, 0xb3, 0x3c, 0xee, 0x64, 0xe9,
-    0xf4, 0xce, 0x09, 0x3b, 0x59, 0x07, 0x84, 0x13, 0x71, 0xc7, 0x40, 0xd6,
-    0x5f, 0x02, 0x5e, 0x2a, 0x18, 0x71, 0xb0, 0x0f, 0x44, 0xc1, 0xcb, 0x16,
-    0x76, 0x8d, 0xe9, 0x8f, 0x0c, 0xf5, 0x8f, 0x81, 0x81, 0x4b, 0x02, 0xcc,
-    0x5a, 0x6f, 0x22, 0xcf, 0x90, 0xf3, 0x20, 0xda, 0x4d, 0x94, 0x23, 0xc2,
-    0x12, 0x13, 0x72, 0xce, 0x46, 0xa0, 0xa3, 0x16, 0x5f, 0x47, 0x7c, 0x0e,
-    0xe7, 0x2d, 0x8a, 0xa9, 0x9c, 0x63, 0x67, 0x2f, 0xa8, 0xbe, 0xf4, 0xef,
-    0xbe, 0x92, 0xd0, 0xbe, 0x0f, 0x94, 0xc4, 0xbe, 0xf2, 0xad, 0xe6, 0x1f,
-    0x2a, 0xdf, 0x47, 0xca, 0xf7, 0xb3, 0xfa, 0xbb, 0xa7, 0xf5, 0xa4, 0x0f,
-    0xa8, 0x8f, 0xd2, 0xd7, 0x52, 0xfb, 0x5a, 0xea, 0x40, 0x4b, 0x1d, 0x6a,
-    0xa9, 0x23, 0x2d, 0xf5, 0x54, 0x4b, 0x3d, 0xd3, 0x52, 0xcf, 0xd5, 0x54,
-    0x5f, 0x4f, 0xec, 0x2b, 0xdf, 0xf5, 0xb2, 0xfa, 0xda, 0xf4, 0xfb, 0xda,
-    0x84, 0xfb, 0x7a, 0x0f, 0xda, 0x84, 0xfb, 0xda, 0x84, 0xf7, 0xf5, 0x84,
-    0xfa, 0x7d, 0xa8, 0x7c, 0xd7, 0x50, 0xd3, 0x5a, 0x1f, 0x28, 0x95, 0x0e,
-    0x55, 0xf8, 0x69, 0x60, 0x38, 0xd4, 0x6a, 0x1d, 0x29, 0xdf, 0x75, 0xb7,
-    0x1a, 0xa4, 0x9e, 0xaa, 0x5d, 0x3d, 0xd5, 0x4b, 0xea, 0x26, 0x1a, 0x00,
-    0x11, 0x7e, 0xff, 0x09, 0x6c, 0xe7, 0xf8, 0x78, 0xcf, 0x99, 0xf8, 0x41,
-    0x77, 0xef, 0xe8, 0xe8, 0xe9, 0x5f, 0xd7, 0x56, 0x1c, 0xee, 0xd7, 0xf5,
-    0x9e, 0x75, 0xf7, 0xe1, 0xff, 0xd4, 0x7a, 0xcf, 0xb4, 0x0d, 0x11, 0xd5,
-    0xf6, 0xfa, 0xdd, 0x43, 0xb5, 0xd2, 0x91, 0xb6, 0x09, 0xb2, 0xd2, 0x51,
-    0xf7, 0xc8, 0x18, 0xf4, 0x50, 0x14, 0xf5, 0x7b, 0x75, 0xee, 0x61, 0xdd,
-    0xa2, 0xdf, 0xeb, 0x3e, 0x33, 0x86, 0x3f, 0xd0, 0xf6, 0x41, 0xd6, 0x53,
-    0x06, 0x7f, 0xaa, 0x64, 0x3f, 0x6f, 0xac, 0x72, 0x5f, 0xdb, 0x13, 0x51,
-    0x6f, 0x7f, 0xdf, 0x58, 0xa5, 0x8a, 0x45, 0xcf, 0x95, 0x7a, 0x4f, 0xd5,
-    0x55, 0xf6, 0xab, 0xd9, 0x1f, 0x28, 0xb3, 0xd7, 0x49, 0x15, 0x31, 0x4d,
-    0x56, 0xda, 0x33, 0x57, 0xaf, 0x6e, 0xc7, 0x61, 0x63, 0xa1, 0x7d, 0x9d,
-    0xa6, 0x45, 0xc5, 0x43, 0x75, 0x28, 0x65, 0x03, 0x0e, 0x1b, 0x1b, 0x7a,
-    0x60, 0xa2, 0xa9, 0xac, 0xf9, 0xac, 0xb1, 0x58, 0xb9, 0x8e, 0x23, 0xb5,
-    0x73, 0x83, 0x2e, 0x9e, 0xc9, 0x3a, 0xfa, 0x4e, 0x1f, 0x19, 0xf4, 0x2f,
-    0x6b, 0x35, 0xb6, 0x5a, 0xd9, 0x96, 0xa7, 0x8d, 0x5d, 0x7d, 0x66, 0x90,
-    0xb6, 0xac, 0xa8, 0x8e, 0xa4, 0xec, 0xc3, 0x53, 0x73, 0x5f, 0x0f, 0xaa,
-    0x25, 0x3c, 0x53, 0x96, 0xd0, 0x37, 0xb6, 0xe2, 0x48, 0xd6, 0x31, 0xb7,
-    0x5b, 0xe7, 0x48, 0x4f, 0xab, 0xb5, 0x3e, 0xd3, 0xf6, 0x5b, 0x67, 0xbb,
-    0x7d, 0x65, 0x53, 0x9e, 0x9b, 0x5b, 0xdb, 0x57, 0x76, 0xe6, 0x79, 0x63,
-    0x6b, 0xad, 0x42, 0x44, 0xe7, 0x75, 0x87, 0xd5, 0x82, 0xc8, 0xc1, 0xc1,
-    0xb3, 0x85, 0xde, 0xbd, 0x91, 0x75, 0x34, 0xec, 0x8c, 0xc1, 0x72, 0x92,
-    0x94, 0x8c, 0x18, 0x07, 0xaa, 0xb3, 0xa4, 0x5a, 0x18, 0x6c, 0x63, 0x06,
-    0x3a, 0xe0, 0x94, 0x71, 0xce, 0xc1, 0x73, 0x46, 0x0c, 0x8d, 0x26, 0xc3,
-    0x86, 0xaa, 0x34, 0x92, 0x05, 0x08, 0xc5, 0xce, 0x38, 0x8f, 0xaf, 0xb8,
-    0x6b, 0x42, 0xcb, 0xe6, 0xf6, 0x9e, 0x28, 0x40, 0xf3, 0xc8, 0x92, 0x5b,
-    0x34, 0x33, 0x9b, 0xb5, 0xbe, 0xdc, 0xec, 0xd1, 0xa0, 0x64, 0x31, 0xce,
-    0x2a, 0xed, 0x77, 0x50, 0x19, 0xf4, 0x6a, 0x8b, 0x0e, 0xd7, 0xb4, 0xbf,
-    0x5c, 0x6d, 0x7d, 0x48, 0xed, 0xd1, 0xba, 0x6f, 0xd7, 0x80, 0xd4, 0x6a,
-    0x8e, 0xb6, 0xe1, 0xff, 0x4d, 0xf2, 0x40, 0xf4, 0xae, 0xaa, 0x3c, 0xaa,
-    0xa9, 0x2f, 0x9c, 0x05, 0xa8, 0xec, 0x57, 0x26, 0x0d, 0x9a, 0x32, 0x08,
-    0x0e, 0xe1, 0xa2, 0x39, 0x38, 0x38, 0x10, 0x9f, 0xf9, 0xd5, 0x45, 0xec,
-    0xf5, 0x02, 0xfc, 0xaf, 0xfb, 0xcc, 0x1f, 0x34, 0x0c, 0xa5, 0xaf, 0x9e,
-    0x3f, 0x7f, 0x2e, 0x73, 0x71, 0x7f, 0x1d, 0xc5, 0x29, 0x35, 0x68, 0x78,
-    0xac, 0xbe, 0x62, 0x47, 0xf8, 0x1f, 0x9f, 0x7b, 0x6d, 0xa0, 0x71, 0xcc,
-    0x10, 0x1b, 0x8e, 0xe6, 0xf1, 0xa2, 0x08, 0xc1, 0xe2, 0xd2, 0xe1, 0x47,
-    0x6e, 0x2d, 0x0d, 0xf2, 0x61, 0x73, 0x33, 0x84, 0xf3, 0x4b, 0x19, 0x38,
-    0x99, 0xc5, 0x57, 0xac, 0xb2, 0x10, 0xae, 0xb0, 0x77, 0x98, 0x9a, 0x87,
-    0xf4, 0x14, 0xe7, 0xc1, 0x94, 0x5d, 0x96, 0x0e, 0x40, 0x93, 0x7f, 0x70,
-    0x0f, 0x51, 0x70, 0x99, 0x67, 0x33, 0x4f, 0x59, 0x87, 0x1f, 0xd0, 0xec,
-    0x41, 0xd7, 0xce, 0xe6, 0x1e, 0x88, 0x84, 0x40, 0x05, 0x4a, 0xef, 0xd0,
-    0xf7, 0x83, 0x32, 0xf3, 0xd4, 0xbc, 0x3d, 0xdf, 0xf7, 0x07, 0xad, 0x73,
-    0xe0, 0x43, 0xd7, 0x53, 0x51, 0x46, 0x32, 0x7b, 0x76, 0xcc, 0xd1, 0xf6,
-    0x6c, 0x1d, 0xff, 0x9b, 0x1d, 0xae, 0x9b, 0x30, 0x55, 0xbc, 0x87, 0xda,
-    0x1e, 0x08, 0x1f, 0xa3, 0xd6, 0x80, 0xe7, 0xe9, 0xee, 0x8c, 0x49, 0x3c,
-    0x06, 0x8b, 0xa7, 0xe7, 0xe0, 0x7f, 0x88, 0x2b, 0xda, 0x88, 0x30, 0x8b,
-    0x24, 0x05, 0xab, 0x3b, 0xc0, 0xd2, 0x23, 0xa3, 0xb4, 0x2f, 0x0a, 0x07,
-    0xff, 0x75, 0xfd, 0x48, 0x53, 0x5a, 0xfa, 0x1e, 0xb5, 0x15, 0x49, 0x17,
-    0x51, 0x60, 0xcd, 0x0d, 0x2d, 0x0b, 0xae, 0x0b, 0x2d, 0xbc, 0xa0, 0x2a,
-    0x6b, 0x62, 0xab, 0xe2, 0x8d, 0x52, 0xe8, 0xa5, 0xb9, 0x9b, 0x94, 0x9b,
-    0x21, 0xf9, 0x97, 0x77, 0x61, 0xf7, 0x40, 0xf2, 0xea, 0x34, 0x43, 0x1e,
-    0x0e, 0x86, 0x24, 0x33, 0x9c, 0x2c, 0x1c, 0x46, 0x82, 0x82, 0xf4, 0xb4,
-    0xe0, 0xef, 0x1d, 0x76, 0x03, 0xa8, 0x50, 0x70, 0x9f, 0x87, 0x4e, 0x53,
-    0xe4, 0x24, 0xd0, 0x1d, 0xcd, 0x5a, 0x85, 0x39, 0xd8, 0xe8, 0x71, 0x7e,
-    0xa7, 0x2f, 0x92, 0xb3, 0x73, 0x80, 0x59, 0x6c, 0xad, 0x1b, 0x5b, 0x2b,
-    0x37, 0xdd, 0xd7, 0xb0, 0x19, 0x4f, 0x9f, 0xb1, 0xa7, 0x92, 0xe7, 0x5c,
-    0x5e, 0x5e, 0x3e, 0xc8, 0x30, 0xa5, 0x3f, 0xc6, 0xe0, 0x15, 0x75, 0x9a,
-    0xe4, 0xa3, 0xc2, 0x9d, 0xf6, 0xf6, 0xf6, 0xda, 0xca, 0x74, 0x6c, 0x79,
-    0x68, 0xe8, 0xf0, 0x32, 0xc9, 0x8b, 0xb2, 0x33, 0x9a, 0x24, 0x53, 0xe9,
-    0xe7, 0xe9, 0x00, 0x3b, 0xe8, 0x20, 0xdf, 0x50, 0x58, 0xd6, 0x40, 0x73,
-    0xb0, 0x9b, 0xa5, 0x0f, 0x0e, 0x02, 0x36, 0xab, 0x65, 0x0c, 0x9a, 0x79,
-    0xfb, 0x20, 0x6d, 0xc5, 0xb9, 0x50, 0x16, 0xaa, 0x3d, 0x45, 0x0f, 0xad,
-    0xea, 0x90, 0x25, 0xc0, 0x9f, 0x07, 0xf6, 0xc2, 0x71, 0x5c, 0xb2, 0x4d,
-    0x65, 0x20, 0x27, 0x59, 0x07, 0x34, 0x94, 0x78, 0xfa, 0x50, 0xad, 0xb6,
-    0x72, 0x36, 0x8b, 0x93, 0xd6, 0xc6, 0x33, 0x10, 0x54, 0x93, 0xb6, 0x42,
-    0xe1, 0xc3, 0x6c, 0x29, 0x9d, 0x83, 0xe1, 0x8f, 0x32, 0xb4, 0xad, 0x5c,
-    0x38, 0x0c, 0x5b, 0x4a, 0x4b, 0x36, 0x6d, 0x2f, 0xba, 0x2d, 0x5b, 0xcb,
-    0x36, 0x2c, 0x74, 0x91, 0xb7, 0x76, 0xb9, 0x64, 0xec, 0xb3, 0x56, 0x26,
-    0x3c, 0xf5, 0x4a, 0x4e, 0xe5, 0x41, 0xd4, 0x84, 0x75, 0xf7, 0x08, 0xa4,
-    0xb5, 0x55, 0x61, 0x6c, 0x8a, 0xe8, 0xd1, 0x68, 0x64, 0x63, 0x19, 0xc4,
-    0x1f, 0x05, 0x63, 0xdd, 0x87, 0xff, 0x7d, 0x35, 0x1e, 0x8f, 0x07, 0x0f,
-    0x97, 0xab, 0x84, 0x77, 0x00, 0xd8, 0x66, 0xd7, 0x39, 0xff, 0xbc, 0x9a,
-    0x57, 0x83, 0x88, 0x1f, 0x9c, 0x21, 0x9c, 0xce, 0xfd, 0xff, 0xa9, 0xab,
-    0xff, 0xaf, 0x58, 0xa7, 0x4a, 0x8d, 0xf5, 0x3a, 0xfb, 0xb8, 0xce, 0xc3,
-    0x4a, 0x8b, 0xb4, 0x57, 0xd7, 0x64, 0x90, 0x95, 0x84, 0x1f, 0xac, 0xa1,
-    0x10, 0xf2, 0xa3, 0xea, 0x6e, 0xae, 0xc5, 0x89, 0x7a, 0x63, 0x15, 0x4e,
-    0xda, 0x1b, 0xab, 0xc8, 0x43, 0x8a, 0x4d, 0x75, 0x2a, 0x32, 0xdf, 0x58,
-    0x4b, 0x9e, 0x0e, 0x6c, 0xaa, 0x83, 0x24, 0xff, 0x40, 0x05, 0x20, 0xfc,
-    0xcd, 0x35, 0x1e, 0x04, 0x0c, 0x32, 0x81, 0x8d, 0x15, 0x88, 0x15, 0x34,
-    0x6b, 0x08, 0xdb, 0xa9, 0x91, 0x2f, 0xd9, 0x82, 0xa9, 0xb0, 0x19, 0x0a,
-    0xcf, 0x5e, 0xff, 0xf9, 0x25, 0x8b, 0x37, 0x92, 0xd6, 0x9f, 0xeb, 0xc1,
-    0x38, 0xe0, 0xda, 0xb8, 0xb4, 0xcb, 0x64, 0xfa, 0x00, 0x74, 0xf8, 0x99,
-    0x98, 0x31, 0x93, 0x72, 0x92, 0xa4, 0x95, 0x20, 0xa7, 0x59, 0x0c, 0x64,
-    0x11, 0x52, 0x25, 0x5a, 0x3c, 0x8e, 0x65, 0x7a, 0xfc, 0x53, 0xce, 0x2c,
-    0x68, 0x94, 0xd0, 0x58, 0x52, 0x95, 0x20, 0x76, 0xd2, 0xb3, 0x9e, 0x74,
-    0xd8, 0x29, 0x4e, 0x39, 0x69, 0xdc, 0x40, 0x75, 0x8f, 0xaa, 0xa5, 0x50,
-    0xde, 0xa3, 0xeb, 0x3f, 0x5c, 0x93, 0x53, 0xe0, 0x83, 0xd5, 0x38, 0x15,
-    0x3e, 0x58, 0x4d, 0x50, 0xe2, 0x83, 0xf5, 0x2a, 0x6a, 0x7c, 0xb0, 0xa6,
-    0xa0, 0xc8, 0x07, 0xeb, 0x21, 0x55, 0x3e, 0xa2, 0x12, 0x50, 0xe6, 0xc3,
-    0xb5, 0x1e, 0x05, 0x38, 0xa4, 0xd0, 0x07, 0x2b, 0x11, 0x95, 0xda, 0x6b,
-    0x71, 0x4a, 0xb5, 0x97, 0x49, 0x6a, 0x6d, 0x1e, 0x49, 0xab, 0x7a, 0xbd,
-    0xc5, 0x5e, 0x8e, 0xd9, 0x18, 0x0a, 0x44, 0x6a, 0x14, 0x8f, 0xfb, 0xe3,
-    0xfd, 0x8d, 0xc4, 0xfc, 0xdf, 0x32, 0xc0, 0x19, 0xcc, 0x7c, 0x8c, 0x5e,
-    0x10, 0xdb, 0x7a, 0xad, 0x65, 0xd5, 0x7a, 0xab, 0x52, 0x8b, 0xfe, 0xcf,
-    0x18, 0x93, 0x03, 0x3f, 0x7d, 0xfa, 0xd4, 0x60, 0x3b, 0x20, 0xb6, 0x9b,
-    0x0b, 0x25, 0xfe, 0x00, 0xa2, 0xf9, 0x06, 0x74, 0x8d, 0x71, 0x1b, 0x97,
-    0xb4, 0x95, 0xeb, 0xdc, 0x52, 0xd6, 0x10, 0x71, 0x10, 0x5f, 0x5d, 0x3c,
-    0x3f, 0x88, 0x0f, 0x9e, 0x19, 0x13, 0x60, 0xcf, 0xf7, 0xfb, 0xfd, 0xf1,
-    0xe3, 0xf8, 0x9e, 0xec, 0xf0, 0xb1, 0x5c, 0xf0, 0x51, 0xf5, 0x55, 0x9e,
-    0xa8, 0x37, 0x90, 0x1c, 0xb2, 0x7d, 0xaa, 0x22, 0x3a, 0x43, 0x38, 0x0c,
-    0xfb, 0x14, 0xf2, 0xd2, 0xa2, 0x1b, 0x35, 0xf7, 0xa5, 0xb6, 0xc4, 0xd4,
-    0x7d, 0x9e, 0x2d, 0xa6, 0x65, 0x32, 0xc7, 0x20, 0x22, 0x35, 0x3e, 0x40,
-    0xa9, 0x37, 0x8d, 0x2f, 0xd8, 0x54, 0xe7, 0xab, 0x0e, 0x6a, 0x31, 0x6a,
-    0x9d, 0xea, 0xc4, 0xbd, 0xb2, 0xe4, 0xf4, 0x53, 0xf5, 0x1e, 0x3f, 0x50,
-    0x37, 0x1d, 0x79, 0xbc, 0x7f, 0x7e, 0xc8, 0xae, 0xb1, 0xea, 0x81, 0x72,
-    0x72, 0x5d, 0xf7, 0x44, 0x2c, 0x9d, 0x8f, 0x20, 0x43, 0x9d, 0x30, 0x53,
-    0x22, 0xdb, 0xfe, 0xfe, 0xfe, 0xa0, 0x19, 0x08, 0x25, 0x40, 0xc2, 0x0e,
-    0xf1, 0x3f, 0x65, 0x5c, 0x3c, 0x62, 0x1d, 0x7d, 0x66, 0xe3, 0x8d, 0x96,
-    0x93, 0xad, 0x92, 0x69, 0x41, 0xb5, 0xd5, 0xb1, 0x5b, 0x52, 0x9b, 0x6a,
-    0x3f, 0x54, 0xaf, 0x61, 0x59, 0xd9, 0x2a, 0x11, 0x3a, 0x3e, 0x50, 0xa7,
-    0x61, 0x85, 0xd9, 0x2a, 0x35, 0xad, 0x31, 0x5b, 0x2d, 0x9b, 0x55, 0x66,
-    0xab, 0xd7, 0xb4, 0xce, 0x6c, 0xb5, 0x0c, 0x2b, 0xcd, 0x5e, 0x45, 0xb7,
-    0xd6, 0xac, 0x75, 0x1e, 0x01, 0x4c, 0xc3, 0x7a, 0xb3, 0x55, 0x31, 0xad,
-    0xb8, 0xaa, 0x0e, 0x91, 0x84, 0xad, 0xa0, 0x61, 0xe6, 0x55, 0x25, 0x95,
-    0xb9, 0xa7, 0xe3, 0xb9, 0x24, 0x2b, 0x0a, 0x3a, 0xe9, 0xb5, 0xa2, 0xa7,
-    0x66, 0x32, 0x3d, 0xb6, 0x07, 0x32, 0xdc, 0xa0, 0x07, 0x9e, 0x35, 0x61,
-    0xd3, 0x79, 0x87, 0xdb, 0x54, 0x81, 0xa5, 0x12, 0x8f, 0x2c, 0xb3, 0x14,
-    0x34, 0x97, 0x24, 0x4b, 0xe4, 0x92, 0xd4, 0xb2, 0x19, 0x2b, 0x8a, 0xf8,
-    0x8a, 0x89, 0x81, 0x1e, 0x15, 0x55, 0xc9, 0x2d, 0xcb, 0xf5, 0x86, 0x01,
-    0xee, 0x9b, 0x6e, 0xf2, 0xf6, 0x75, 0x8a, 0x80, 0x4c, 0xe1, 0xbe, 0x37,
-    0xb8, 0x85, 0x6e, 0x77, 0x6d, 0x6a, 0x29, 0xd8, 0x9e, 0x72, 0xc6, 0x42,
-    0x7e, 0x97, 0xc1, 0xe3, 0x57, 0x54, 0xf1, 0xb0, 0x3a, 0x8c, 0xb2, 0x87,
-    0xce, 0x78, 0xf4, 0x7a, 0x3e, 0x38, 0x89, 0xa2, 0x8a, 0x4a, 0x14, 0x1c,
-    0x17, 0x9a, 0xee, 0xe9, 0x3c, 0x57, 0x84, 0xfa, 0xe0, 0xbe, 0x75, 0x88,
-    0xcf, 0xb3, 0x71, 0x43, 0xe2, 0x58, 0xea, 0xdc, 0x1b, 0xfe, 0x78, 0x98,
-    0x9d, 0x79, 0x5c, 0xd0, 0x1c, 0x85, 0x83, 0xc4, 0xe0, 0xf2, 0x15, 0x97,
-    0xed, 0xcd, 0x6f, 0xdb, 0x9a, 0x98, 0x68, 0xa5, 0x15, 0xb6, 0xd0, 0x84,
-    0x9c, 0x0e, 0xf6, 0x5b, 0x43, 0xae, 0xe7, 0x74, 0xf6, 0x14, 0x27, 0x98,
-    0xf4, 0x10, 0x36, 0x23, 0x47, 0x29, 0x3a, 0x74, 0xef, 0x81, 0x29, 0x35,
-    0x25, 0xb4, 0x6d, 0x62, 0x42, 0x2c, 0xff, 0x01, 0x10, 0x1c, 0xb3, 0xdb,
-    0x70, 0xff, 0x81, 0x2e, 0x6b, 0x57, 0xe2, 0xc3, 0x1d, 0x2b, 0x6e, 0x47,
-    0x9c, 0x70, 0x73, 0x69, 0x07, 0x20, 0xbb, 0xf0, 0x7f, 0xbd, 0x4a, 0xe6,
-    0xe9, 0x62, 0x73, 0xe3, 0xf8, 0x8a, 0xc7, 0xf1, 0x4b, 0xa6, 0xa2, 0x3a,
-    0x2a, 0x5b, 0x67, 0xf5, 0xc8, 0xd9, 0x7c, 0xc1, 0x0c, 0x8c, 0x51, 0x3b,
-    0xfd, 0xe6, 0x3e, 0x03, 0x18, 0x04, 0x40, 0x1e, 0x1c, 0x5e, 0xf7, 0x29,
-    0x0b, 0xfd, 0xa3, 0x8d, 0x70, 0xf6, 0x9a, 0xa7, 0xb6, 0x8d, 0x3a, 0xb6,
-    0xf3, 0xed, 0x46, 0x25, 0xf5, 0x28, 0xbd, 0xb5, 0xd2, 0x5e, 0xa7, 0xdf,
-    0x08, 0x0b, 0xb0, 0x54, 0xda, 0xaf, 0xc2, 0x1c, 0x36, 0x54, 0x6a, 0x86,
-    0x52, 0x28, 0x95, 0x5a, 0x98, 0xfd, 0x63, 0xb8, 0xb3, 0xa0, 0x3e, 0xf2,
-    0x71, 0x6b, 0xea, 0xd5, 0xd1, 0xd1, 0x51, 0x0b, 0xa3, 0xab, 0x4f, 0x1f,
-    0xbb, 0xcf, 0x9e, 0x1a, 0x2c, 0x56, 0x0c, 0x69, 0x90, 0xb8, 0xd2, 0x65,
-    0xa3, 0xb1, 0x08, 0x7a, 0xa3, 0xd3, 0xd9, 0x62, 0x94, 0x33, 0x96, 0xf2,
-    0xe0, 0xb7, 0x2a, 0xa0, 0xd1, 0x09, 0x0f, 0x9e, 0x01, 0x6b, 0xf0, 0xef,
-    0x95, 0x65, 0x8b, 0xb3, 0x18, 0x2d, 0xd6, 0x58, 0x62, 0xc0, 0xd3, 0x06,
-    0xcf, 0x6d, 0x0a, 0xd5, 0xe0, 0xff, 0xbb, 0xd2, 0xff, 0x5f, 0x71, 0xa5,
-    0xab, 0xf6, 0x88, 0x66, 0x06, 0x58, 0xc3, 0x5a, 0x15, 0x8e, 0xd4, 0xdc,
-    0x6e, 0xa5, 0xd4, 0xb2, 0xdf, 0x8d, 0x52, 0x75, 0xc3, 0xad, 0x85, 0xcd,
-    0x1d, 0x6f, 0xad, 0xd6, 0x5a, 0x41, 0xdb, 0xf3, 0x46, 0xa9, 0xb6, 0xe9,
-    0x8d, 0x52, 0x7d, 0xd7, 0x1b, 0xc5, 0xe6, 0xb6, 0x37, 0x2a, 0xe8, 0xfb,
-    0xde, 0x28, 0x56, 0x36, 0xde, 0x52, 0x56, 0xef, 0x7c, 0xb3, 0x70, 0xd3,
-    0x82, 0x95, 0xbd, 0x6f, 0x94, 0xd1, 0xe6, 0x1b, 0x7b, 0xdd, 0xfb, 0x32,
-    0x0d, 0xce, 0x82, 0x28, 0x8a, 0x52, 0x87, 0x5c, 0x6e, 0xd0, 0x66, 0x7a,
-    0xfe, 0x19, 0x2d, 0xad, 0xf7, 0xa5, 0xcc, 0xf8, 0x11, 0xfc, 0x99, 0xcf,
-    0x4b, 0x61, 0x94, 0x64, 0x4b, 0x6b, 0x27, 0x0a, 0x60, 0x60, 0x3f, 0x03,
-    0xde, 0x29, 0x06, 0xc7, 0xfb, 0x50, 0xf7, 0x7f, 0xfe, 0x08, 0x03, 0x9b,
-    0x77, 0x2e, 0x93, 0x5b, 0x50, 0x16, 0x2b, 0xf5, 0x8a, 0x92, 0x03, 0x12,
-    0x0a, 0x3d, 0x52, 0xb1, 0x7a, 0x03, 0x53, 0x2d, 0xa2, 0x66, 0x49, 0xc9,
-    0x66, 0x81, 0x92, 0x9e, 0x26, 0x45, 0x79, 0xdf, 0x50, 0xd2, 0xd6, 0x66,
-    0x0d, 0xfc, 0x47, 0x5c, 0x45, 0xa2, 0x23, 0xee, 0x86, 0x1f, 0xa1, 0x67,
-    0x0e, 0xa2, 0x84, 0x07, 0x55, 0x95, 0x85, 0x07, 0x43, 0xd9, 0x3b, 0xaa,
-    0x8e, 0x37, 0xc6, 0xa0, 0xa6, 0x3e, 0xad, 0xf4, 0xb3, 0x01, 0x5f, 0x6b,
-    0xf0, 0x4a, 0x33, 0x18, 0x4b, 0xeb, 0xb8, 0x8a, 0x2f, 0x57, 0xd4, 0x88,
-    0x47, 0xb7, 0x71, 0x4c, 0x20, 0xd8, 0xe4, 0xf1, 0xc3, 0x4d, 0x2d, 0xab,
-    0xb3, 0x57, 0x34, 0xb7, 0xc6, 0x5e, 0xab, 0x60, 0xf3, 0x18, 0x20, 0x90,
-    0xe5, 0x1b, 0xe3, 0xd6, 0x36, 0xd9, 0x70, 0xd5, 0x60, 0xe6, 0xe0, 0xf7,
-    0x36, 0x0e, 0x4d, 0xa5, 0xa4, 0xfc, 0xe5, 0x46, 0xc8, 0x42, 0xad, 0xdb,
-    0xc7, 0x17, 0x45, 0x36, 0x5d, 0x94, 0x8c, 0xe3, 0x1f, 0x01, 0x99, 0xa3,
-    0x60, 0x13, 0x4d, 0xec, 0x58, 0x69, 0x5f, 0x6a, 0x35, 0xaa, 0x82, 0xd6,
-    0x74, 0x41, 0x82, 0x6f, 0xa6, 0x08, 0xae, 0x52, 0xfb, 0xe1, 0x71, 0x23,
-    0x27, 0x96, 0x3e, 0x54, 0xc0, 0x92, 0x5b, 0x96, 0x07, 0x36, 0xf1, 0x80,
-    0x91, 0x93, 0x4d, 0x4b, 0x15, 0x6a, 0x97, 0xb9, 0x56, 0x6d, 0xfa, 0x71,
-    0x51, 0xb5, 0x3b, 0x31, 0xb0, 0x38, 0x8c, 0x2f, 0xcb, 0x3a, 0x58, 0x4e,
-    0xa8, 0x6d, 0x87, 0xa4, 0xb6, 0xf1, 0xfb, 0x04, 0xee, 0xc7, 0xfe, 0xe1,
-    0x8b, 0x67, 0xae, 0xc2, 0x3f, 0xe8, 0x96, 0xde, 0x23, 0x10, 0xeb, 0xe1,
-    0x51, 0xb5, 0x31, 0x4e, 0x5d, 0xb5, 0x4f, 0x50, 0xdd, 0xf0, 0x76, 0x0b,
-    0x5e, 0x7b, 0x91, 0x77, 0x64, 0x3a, 0x77, 0x21, 0xcf, 0x1d, 0x54, 0x39,
-    0xb7, 0xf2, 0x2e, 0x9e, 0xb5, 0x65, 0x2b, 0x85, 0x6c, 0x20, 0x8d, 0x2f,
-    0xeb, 0xe8, 0x61, 0x52, 0xb3, 0x2f, 0xc9, 0x12, 0xa4, 0xa9, 0xac, 0x92,
-    0xaf, 0x49, 0x5d, 0x25, 0xa1, 0x55, 0x75, 0x35, 0x4b, 0xe6, 0xf3, 0x0e,
-    0x11, 0x6f, 0xcb, 0x6c, 0x31, 0x9a, 0xe8, 0x86, 0x78, 0xef, 0xf1, 0x08,
-    0x6c, 0xa5, 0xdf, 0xc0, 0x4a, 0xd4, 0x4d, 0xb7, 0x30, 0x3a, 0x8b, 0x25,
-    0xe3, 0xac, 0xcd, 0x2b, 0xee, 0x6d, 0x5d, 0x7f, 0x01, 0xbb, 0x10, 0x1c,
-    0x70, 0x5e, 0xdd, 0x83, 0xdc, 0x23, 0x61, 0x5b, 0x19, 0xf0, 0xdd, 0x3a,
-    0x74, 0xf2, 0xcf, 0x2e, 0xc9, 0xea, 0x24, 0x56, 0xfc, 0xd5, 0x2a, 0x3f,
-    0x34, 0xaf, 0x30, 0x2e, 0xe6, 0x73, 0x96, 0x8f, 0xe2, 0xa2, 0x3a, 0x9b,
-    0x38, 0x3c, 0x3a, 0x1c, 0x1f, 0x1d, 0xac, 0x4d, 0xa1, 0x50, 0x9f, 0x5c,
-    0x58, 0x19, 0xd4, 0x26, 0xb7, 0x3a, 0xd5, 0x34, 0x22, 0xcf, 0x36, 0x0a,
-    0xa0, 0x16, 0xc7, 0x8b, 0xd6, 0xcf, 0x7d, 0x15, 0x33, 0x76, 0x68, 0x2b,
-    0x76, 0x4c, 0xc2, 0x6c, 0x44, 0x4a, 0x36, 0x2f, 0x15, 0x6f, 0x64, 0x68,
-    0xd8, 0x89, 0x39, 0x51, 0xcd, 0x5b, 0xf2, 0xe0, 0x50, 0x78, 0x00, 0xa4,
-    0xd1, 0xb3, 0x08, 0x15, 0xdb, 0x34, 0x4a, 0x5b, 0x1d, 0xba, 0x9e, 0x8a,
-    0x61, 0x66, 0x8d, 0x40, 0xbf, 0x2f, 0xbc, 0x51, 0x37, 0x60, 0xb3, 0x79,
-    0x79, 0xd7, 0x19, 0xb1, 0xe9, 0xb4, 0x08, 0x8b, 0x49, 0xb6, 0xb4, 0x1d,
-    0x9b, 0x5c, 0xe0, 0x7f, 0x6a, 0xff, 0x8e, 0xb8, 0x82, 0xae, 0x0c, 0x2f,
-    0xae, 0xd5, 0xd2, 0x7d, 0x69, 0xe7, 0xd9, 0xe1, 0x5f, 0x77, 0xf7, 0x9c,
-    0xd8, 0xbc, 0xd4, 0x56, 0x79, 0xb0, 0xe8, 0xc4, 0xa2, 0x11, 0xa7, 0xad,
-    0x8d, 0x50, 0x4a, 0x4c, 0x11, 0xc9, 0x89, 0x5c, 0x13, 0x97, 0x75, 0xe6,
-    0xec, 0xe4, 0xc2, 0x38, 0xee, 0x57, 0x21, 0x94, 0x0a, 0x77, 0x37, 0x6f,
-    0xfc, 0x0e, 0xcc, 0xab, 0xbe, 0x6d, 0xfe, 0x3e, 0x39, 0x01, 0x40, 0x56,
-    0xdb, 0xa6, 0xf6, 0xf0, 0x3f, 0xe5, 0xb2, 0x77, 0x43, 0x8d, 0x36, 0xaf,
-    0x6c, 0x93, 0xc6, 0x6d, 0xac, 0xf5, 0x31, 0x88, 0x49, 0x75, 0x3b, 0xd9,
-    0x78, 0x6c, 0xad, 0xff, 0xd5, 0x65, 0x1f, 0xff, 0xd3, 0xea, 0x16, 0x65,
-    0x9e, 0xcc, 0xd1, 0x61, 0x9c, 0x87, 0x60, 0x1e, 0x71, 0x62, 0xf5, 0xfa,
-    0x69, 0x67, 0xcf, 0x7f, 0x74, 0x17, 0x1c, 0xac, 0x8c, 0x8f, 0xd9, 0x76,
-    0x88, 0xd4, 0x44, 0x10, 0xa5, 0x1d, 0x3e, 0x6a, 0x70, 0x02, 0x33, 0xa8,
-    0xbd, 0x59, 0x27, 0x66, 0x5f, 0x72, 0xd7, 0xb4, 0x1e, 0x14, 0x3e, 0xa8,
-    0xe3, 0x82, 0x56, 0x52, 0xa1, 0x45, 0xbd, 0xf1, 0x38, 0xb1, 0xde, 0xe0,
-    0x4b, 0x26, 0xab, 0x76, 0xf8, 0x25, 0xd3, 0x3d, 0xde, 0xe5, 0x8f, 0x68,
-    0xfc, 0x0f, 0x79, 0x4b, 0x43, 0x78, 0x88, 0x34, 0xe7, 0x10, 0x98, 0x78,
-    0xc2, 0x69, 0x76, 0x88, 0x68, 0x2d, 0x9d, 0x43, 0xc0, 0x59, 0x66, 0xca,
-    0xa5, 0x0d, 0x4c, 0x34, 0x92, 0x7d, 0x3d, 0x6d, 0x26, 0x0f, 0xf4, 0xf4,
-    0xbe, 0x9e, 0x34, 0x4a, 0x0f, 0xf5, 0xe4, 0x91, 0x9e, 0x7c, 0xa6, 0x25,
-    0x7b, 0x66, 0xdf, 0x8d, 0xb9, 0x34, 0x46, 0xef, 0x9b, 0x19, 0xfb, 0x66,
-    0xc6, 0x81, 0x99, 0x71, 0x68, 0x66, 0x1c, 0x99, 0x19, 0x4f, 0xcd, 0x8c,
-    0x67, 0x66, 0xc6, 0x73, 0x23, 0xa3, 0xdf, 0x48, 0xef, 0xeb, 0x49, 0x0d,
-    0x0c, 0x7d, 0x73, 0xa1, 0x7d, 0x73, 0x5d, 0xfd, 0x46, 0x87, 0xe6, 0xba,
-    0xfa, 0xe6, 0xba, 0xf6, 0x1b, 0x69, 0x23, 0x79, 0xa8, 0x27, 0x35, 0xd0,
-    0x9b, 0x9d, 0x1d, 0xe8, 0xb5, 0x0f, 0x8d, 0x7d, 0x30, 0x41, 0x78, 0x68,
-    0x56, 0x3f, 0xd2, 0x93, 0xda, 0x58, 0x26, 0xb8, 0x9f, 0x1a, 0x9d, 0x3f,
-    0x6d, 0x94, 0x6b, 0xcd, 0xcd, 0xbd, 0xf8, 0xcf, 0x5d, 0x46, 0x14, 0xd4,
-    0xd0, 0x72, 0x1f, 0xd1, 0x42, 0x4a, 0x1b, 0x6e, 0x25, 0x36, 0xa9, 0xa1,
-    0xf5, 0x6e, 0x62, 0x93, 0x8e, 0x36, 0xdd, 0x50, 0xe4, 0x44, 0x68, 0xb9,
-    0xa4, 0x28, 0xb6, 0xb1, 0xed, 0x9e, 0x62, 0x93, 0x96, 0x5b, 0x6e, 0x2b,
-    0x8a, 0x1d, 0x6b, 0xbb, 0xb0, 0xd8, 0x64, 0x11, 0x9b, 0xae, 0x2d, 0x36,
-    0x31, 0xb3, 0xf5, 0xf2, 0x22, 0x27, 0x2b, 0xcb, 0xfd, 0x45, 0x1b, 0x27,
-    0xd9, 0x74, 0x8b, 0x51, 0xf2, 0x95, 0xb6, 0x8b, 0x8c, 0x16, 0x1e, 0xd8,
-    0x72, 0x9d, 0x51, 0xf2, 0x9f, 0xb6, 0x1b, 0x8d, 0x36, 0x76, 0xb4, 0xe9,
-    0x5e, 0x23, 0x27, 0x5b, 0xcb, 0xd5, 0x46, 0x1b, 0x1b, 0x6b, 0xbb, 0xe0,
-    0x68, 0xe3, 0x70, 0x1b, 0xae, 0x39, 0x4a, 0xfe, 0xd7, 0x76, 0xd3, 0xd1,
-    0xc6, 0x0e, 0xed, 0xf7, 0x1d, 0x25, 0x9f, 0x6c, 0xbb, 0xf2, 0xc8, 0xd9,
-    0x8c, 0xe5, 0xd6, 0xa3, 0x8d, 0x43, 0x6e, 0xb8, 0xfb, 0x68, 0xe3, 0x9f,
-    0x6d, 0x37, 0x20, 0x6d, 0x42, 0x65, 0xe3, 0x3d, 0x48, 0xc9, 0x7a, 0xdb,
-    0xae, 0x42, 0x3e, 0x20, 0x4c, 0x1b, 0x5c, 0xda, 0xb8, 0x16, 0xb9, 0xde,
-    0x28, 0xb9, 0x0f, 0x9e, 0xa9, 0x72, 0x7b, 0x36, 0x56, 0xfa, 0xc6, 0x44,
-    0x23, 0xd9, 0xd7, 0xd3, 0x66, 0xf2, 0x40, 0x4f, 0xef, 0xeb, 0x49, 0xa3,
-    0xf4, 0x50, 0x4f, 0x1e, 0xe9, 0xc9, 0x67, 0x5a, 0xb2, 0x67, 0xf6, 0xdd,
-    0x98, 0x4b, 0x63, 0xf4, 0xbe, 0x99, 0xb1, 0x6f, 0x66, 0x1c, 0x98, 0x19,
-    0x87, 0x66, 0xc6, 0x91, 0x99, 0xf1, 0xd4, 0xcc, 0x78, 0x66, 0x66, 0x3c,
-    0x37, 0x32, 0xfa, 0x8d, 0xf4, 0xbe, 0x9e, 0xd4, 0xc0, 0xd0, 0x37, 0x17,
-    0xda, 0x37, 0xd7, 0xd5, 0x6f, 0x74, 0x68, 0xae, 0xab, 0x6f, 0xae, 0x6b,
-    0xbf, 0x91, 0x36, 0x92, 0x87, 0x7a, 0x52, 0x03, 0xbd, 0xd9, 0xd9, 0x81,
-    0x5e, 0xfb, 0xd0, 0xd8, 0x07, 0x13, 0x84, 0x87, 0x66, 0xf5, 0x23, 0x3d,
-    0xa9, 0x8d, 0x65, 0x82, 0xfb, 0xa9, 0xd1, 0xf9, 0xd3, 0x46, 0xb9, 0xd6,
-    0xdc, 0xdc, 0x8b, 0xff, 0x9c, 0xdc, 0x16, 0xd4, 0xd0, 0x22, 0xb7, 0x2d,
-    0xa4, 0xb4, 0x41, 0x6e, 0x37, 0xa9, 0xa1, 0x55, 0x6e, 0x37, 0xe9, 0x68,
-    0x93, 0xdc, 0xe6, 0x44, 0x68, 0x91, 0xdb, 0x62, 0x1b, 0xdb, 0xe4, 0x76,
-    0x93, 0x96, 0x5b, 0xe4, 0xb6, 0xd8, 0xb1, 0x36, 0xb9, 0xdd, 0x64, 0x11,
-    0x9b, 0xe4, 0x76, 0x13, 0x33, 0x5b, 0xe5, 0x36, 0x27, 0x2b, 0x8b, 0xdc,
-    0xb6, 0x71, 0x92, 0x4d, 0x72, 0x5b, 0xf2, 0x95, 0x36, 0xb9, 0x6d, 0xe1,
-    0x81, 0x2d, 0x72, 0x5b, 0xf2, 0x9f, 0x36, 0xb9, 0x6d, 0x63, 0x47, 0x9b,
-    0xe4, 0x36, 0x27, 0x5b, 0x8b, 0xdc, 0xb6, 0xb1, 0xb1, 0x36, 0xb9, 0x6d,
-    0xe3, 0x70, 0x1b, 0xe4, 0xb6, 0xe4, 0x7f, 0x6d, 0x72, 0xdb, 0xc6, 0x0e,
-    0xed, 0x72, 0x5b, 0xf2, 0xc9, 0x36, 0xb9, 0xcd, 0xd9, 0x8c, 0x45, 0x6e,
-    0xdb, 0x38, 0xe4, 0x06, 0xb9, 0x6d, 0xe3, 0x9f, 0x6d, 0x72, 0xdb, 0x26,
-    0x54, 0x36, 0xca, 0x6d, 0xc9, 0x7a, 0xdb, 0xe4, 0xf6, 0x03, 0xc2, 0xb4,
-    0xc1, 0xa5, 0xbf, 0x48, 0x6e, 0x1f, 0x1d, 0xa8, 0x72, 0x7b, 0x7a, 0xa5,
-    0xf4, 0x8d, 0x89, 0x46, 0xb2, 0xaf, 0xa7, 0xcd, 0xe4, 0x81, 0x9e, 0xde,
-    0xd7, 0x93, 0x46, 0xe9, 0xa1, 0x9e, 0x3c, 0xd2, 0x93, 0xcf, 0xb4, 0x64,
-    0xcf, 0xec, 0xbb, 0x31, 0x97, 0xc6, 0xe8, 0x7d, 0x33, 0x63, 0xdf, 0xcc,
-    0x38, 0x30, 0x33, 0x0e, 0xcd, 0x8c, 0x23, 0x33, 0xe3, 0xa9, 0x99, 0xf1,
-    0xcc, 0xcc, 0x78, 0x6e, 0x64, 0xf4, 0x1b, 0xe9, 0x7d, 0x3d, 0xa9, 0x81,
-    0xa1, 0x6f, 0x2e, 0xb4, 0x6f, 0xae, 0xab, 0xdf, 0xe8, 0xd0, 0x5c, 0x57,
-    0xdf, 0x5c, 0xd7, 0x7e, 0x23, 0x6d, 0x24, 0x0f, 0xf5, 0xa4, 0x06, 0x7a,
-    0xb3, 0xb3, 0x03, 0xbd, 0xf6, 0xa1, 0xb1, 0x0f, 0x26, 0x08, 0x0f, 0xcd,
-    0xea, 0x47, 0x7a, 0x52, 0x1b, 0xcb, 0x04, 0xf7, 0x53, 0xa3, 0xf3, 0xa7,
-    0x8d, 0x72, 0xad, 0xb9, 0xb9, 0x17, 0xff, 0x39, 0xb9, 0x2d, 0xa8, 0xa1,
-    0x45, 0x6e, 0x5b, 0x48, 0x69, 0x83, 0xdc, 0x6e, 0x52, 0x43, 0xab, 0xdc,
-    0x6e, 0xd2, 0xd1, 0x26, 0xb9, 0xcd, 0x89, 0xd0, 0x22, 0xb7, 0xc5, 0x36,
-    0xb6, 0xc9, 0xed, 0x26, 0x2d, 0xb7, 0xc8, 0x6d, 0xb1, 0x63, 0x6d, 0x72,
-    0xbb, 0xc9, 0x22, 0x36, 0xc9, 0xed, 0x26, 0x66, 0xb6, 0xca, 0x6d, 0x4e,
-    0x56, 0x16, 0xb9, 0x6d, 0xe3, 0x24, 0x9b, 0xe4, 0xb6, 0xe4, 0x2b, 0x6d,
-    0x72, 0xdb, 0xc2, 0x03, 0x5b, 0xe4, 0xb6, 0xe4, 0x3f, 0x6d, 0x72, 0xdb,
-    0xc6, 0x8e, 0x36, 0xc9, 0x6d, 0x4e, 0xb6, 0x16, 0xb9, 0x6d, 0x63, 0x63,
-    0x6d, 0x72, 0xdb, 0xc6, 0xe1, 0x36, 0xc8, 0x6d, 0xc9, 0xff, 0xda, 0xe4,
-    0xb6, 0x8d, 0x1d, 0xda, 0xe5, 0xb6, 0xe4, 0x93, 0x6d, 0x72, 0x9b, 0xb3,
-    0x19, 0x8b, 0xdc, 0xb6, 0x71, 0xc8, 0x0d, 0x72, 0xdb, 0xc6, 0x3f, 0xdb,
-    0xe4, 0xb6, 0x4d, 0xa8, 0x6c, 0x94, 0xdb, 0x92, 0xf5, 0xb6, 0xc9, 0xed,
-    0x07, 0x84, 0x69, 0x83, 0x4b, 0x7f, 0x91, 0xdc, 0x7e, 0xd6, 0x53, 0xe5,
-    0xf6, 0xed, 0x54, 0xe9, 0x1b, 0x13, 0x8d, 0x64, 0x5f, 0x4f, 0x9b, 0xc9,
-    0x03, 0x3d, 0xbd, 0xaf, 0x27, 0x8d, 0xd2, 0x43, 0x3d, 0x79, 0xa4, 0x27,
-    0x9f, 0x69, 0xc9, 0x9e, 0xd9, 0x77, 0x63, 0x2e, 0x8d, 0xd1, 0xfb, 0x66,
-    0xc6, 0xbe, 0x99, 0x71, 0x60, 0x66, 0x1c, 0x9a, 0x19, 0x47, 0x66, 0xc6,
-    0x53, 0x33, 0xe3, 0x99, 0x99, 0xf1, 0xdc, 0xc8, 0xe8, 0x37, 0xd2, 0xfb,
-    0x7a, 0x52, 0x03, 0x43, 0xdf, 0x5c, 0x68, 0xdf, 0x5c, 0x57, 0xbf, 0xd1,
-    0xa1, 0xb9, 0xae, 0xbe, 0xb9, 0xae, 0xfd, 0x46, 0xda, 0x48, 0x1e, 0xea,
-    0x49, 0x0d, 0xf4, 0x66, 0x67, 0x07, 0x7a, 0xed, 0x43, 0x63, 0x1f, 0x4c,
-    0x10, 0x1e, 0x9a, 0xd5, 0x8f, 0xf4, 0xa4, 0x36, 0x96, 0x09, 0xee, 0xa7,
-    0x46, 0xe7, 0x4f, 0x1b, 0xe5, 0x5a, 0x73, 0x73, 0x2f, 0xfe, 0x73, 0x72,
-    0x5b, 0x50, 0x43, 0x8b, 0xdc, 0xb6, 0x90, 0xd2, 0x06, 0xb9, 0xdd, 0xa4,
-    0x86, 0x56, 0xb9, 0xdd, 0xa4, 0xa3, 0x4d, 0x72, 0x9b, 0x13, 0xa1, 0x45,
-    0x6e, 0x8b, 0x6d, 0x6c, 0x93, 0xdb, 0x4d, 0x5a, 0x6e, 0x91, 0xdb, 0x62,
-    0xc7, 0xda, 0xe4, 0x76, 0x93, 0x45, 0x6c, 0x92, 0xdb, 0x4d, 0xcc, 0x6c,
-    0x95, 0xdb, 0x9c, 0xac, 0x2c, 0x72, 0xdb, 0xc6, 0x49, 0x36, 0xc9, 0x6d,
-    0xc9, 0x57, 0xda, 0xe4, 0xb6, 0x85, 0x07, 0xb6, 0xc8, 0x6d, 0xc9, 0x7f,
-    0xda, 0xe4, 0xb6, 0x8d, 0x1d, 0x6d, 0x92, 0xdb, 0x9c, 0x6c, 0x2d, 0x72,
-    0xdb, 0xc6, 0xc6, 0xda, 0xe4, 0xb6, 0x8d, 0xc3, 0x6d, 0x90, 0xdb, 0x92,
-    0xff, 0xb5, 0xc9, 0x6d, 0x1b, 0x3b, 0xb4, 0xcb, 0x6d, 0xc9, 0x27, 0xdb,
-    0xe4, 0x36, 0x67, 0x33, 0x16, 0xb9, 0x6d, 0xe3, 0x90, 0x1b, 0xe4, 0xb6,
-    0x8d, 0x7f, 0xb6, 0xc9, 0x6d, 0x9b, 0x50, 0xd9, 0x28, 0xb7, 0x25, 0xeb,
-    0x6d, 0x93, 0xdb, 0x0f, 0x08, 0xd3, 0x06, 0x97, 0x36, 0xe5, 0xb6, 0x71,
-    0xe0, 0x3e, 0xe9, 0xcb, 0x30, 0x66, 0x0c, 0x51, 0xc4, 0xbb, 0xb7, 0x93,
-    0x3d, 0x4b, 0x60, 0xb3, 0x7c, 0xaf, 0x5a, 0xa9, 0x4b, 0xd1, 0x1d, 0x18,
-    0xa5, 0x17, 0x27, 0xf8, 0xa4, 0x5e, 0xfd, 0xd4, 0xfd, 0xba, 0x3b, 0xcd,
-    0xae, 0x3a, 0x75, 0x89, 0xfa, 0xa8, 0xff, 0xe8, 0x12, 0xff, 0x93, 0x61,
-    0x5c, 0x07, 0x78, 0x81, 0x2d, 0x67, 0x14, 0x5b, 0x22, 0x59, 0x61, 0x1d,
-    0x42, 0x02, 0xb6, 0xbf, 0x16, 0xf0, 0x3a, 0x87, 0x25, 0x69, 0xe1, 0x70,
-    0x96, 0x17, 0xec, 0x9a, 0x57, 0x8a, 0xf8, 0xcf, 0x44, 0xc8, 0x67, 0xc1,
-    0x30, 0x88, 0x61, 0xaf, 0xf1, 0xf0, 0xd7, 0xba, 0x5b, 0xdc, 0x15, 0x25,
-    0x9b, 0x75, 0x2e, 0xca, 0x54, 0x9f, 0x6e, 0xbc, 0x3f, 0xda, 0x1f, 0xa9,
-    0xef, 0x4d, 0x55, 0xe0, 0xdb, 0xe5, 0x3f, 0x3c, 0x42, 0xb1, 0x0e, 0xc7,
-    0xa0, 0x05, 0x25, 0xf3, 0xf2, 0x64, 0xeb, 0x72, 0x91, 0xd2, 0xeb, 0xcf,
-    0x5e, 0x19, 0x30, 0xff, 0xde, 0x95, 0x49, 0x37, 0x8a, 0x30, 0xe6, 0x3c,
-    0xbb, 0x74, 0xc6, 0xec, 0x12, 0x60, 0xb2, 0xbd, 0xcd, 0xff, 0x76, 0xe3,
-    0xd9, 0x78, 0xc8, 0x3f, 0xbd, 0xaa, 0xa9, 0x7f, 0x9f, 0xb3, 0x72, 0x91,
-    0xa7, 0x0e, 0xf3, 0x4a, 0x7f, 0xed, 0x87, 0xf4, 0xc7, 0x2b, 0x27, 0x49,
-    0x11, 0x54, 0x75, 0x46, 0xfe, 0xfd, 0x4d, 0x9c, 0x3b, 0x3f, 0x5d, 0x07,
-    0xe3, 0x48, 0x69, 0x28, 0x3f, 0x9d, 0x05, 0xb4, 0x91, 0xdd, 0xa4, 0x8b,
-    0xe9, 0x14, 0xc6, 0x1f, 0xbe, 0x2f, 0x51, 0xa0, 0x40, 0x41, 0xf8, 0xc7,
-    0xd9, 0x77, 0x5d, 0x80, 0xf4, 0x14, 0xbe, 0xcf, 0x57, 0x2b, 0x37, 0xbb,
-    0xb8, 0x66, 0xa3, 0xd2, 0x5d, 0x57, 0xad, 0xe3, 0xba, 0xb5, 0xba, 0x04,
-    0xec, 0xb4, 0xae, 0x94, 0x19, 0x43, 0x6c, 0x45, 0xe5, 0xf6, 0x76, 0x09,
-    0x03, 0x75, 0x97, 0x49, 0x0a, 0xc0, 0xae, 0x6b, 0x16, 0xd6, 0x9a, 0xdd,
-    0x34, 0x1b, 0xb3, 0x0f, 0x18, 0x89, 0x0f, 0x4d, 0x5e, 0xfd, 0xf0, 0xf2,
-    0xa7, 0xef, 0x4f, 0xdf, 0x7e, 0xf8, 0xf4, 0xf6, 0x87, 0x57, 0xa7, 0x75,
-    0xcb, 0x44, 0x99, 0x88, 0x98, 0xa5, 0x39, 0x8d, 0xa9, 0xd2, 0x39, 0x56,
-    0xdf, 0xde, 0xde, 0xca, 0xe8, 0xcf, 0x0f, 0x54, 0xbf, 0x7b, 0xc5, 0xca,
-    0x77, 0x79, 0x56, 0x66, 0x08, 0xff, 0x1f, 0x2e, 0xa1, 0x24, 0x8a, 0x44,
-    0xc9, 0x5c, 0x66, 0xd7, 0x9d, 0x4d, 0xb0, 0x33, 0x04, 0x2c, 0x8b, 0xb6,
-    0xb6, 0x60, 0x92, 0xee, 0x94, 0xa5, 0x57, 0xe5, 0xc4, 0x4d, 0x52, 0x87,
-    0xa6, 0xcc, 0x93, 0x41, 0x1a, 0x2d, 0xbb, 0xd8, 0x10, 0x6a, 0x0f, 0x4c,
-    0x30, 0x6d, 0x45, 0x69, 0x35, 0x05, 0xcf, 0x8d, 0xf3, 0x3c, 0xbe, 0x83,
-    0x39, 0xa7, 0xab, 0x55, 0x2f, 0x8a, 0x22, 0x06, 0xd0, 0xe6, 0x17, 0x29,
-    0x6a, 0x8c, 0x00, 0x64, 0xe8, 0x1d, 0xc3, 0x3f, 0xac, 0xb3, 0xe7, 0xe0,
-    0x38, 0xca, 0xda, 0x2e, 0x95, 0xb5, 0x95, 0xdd, 0x9c, 0x81, 0xc2, 0x31,
-    0x62, 0xde, 0x6e, 0x18, 0xee, 0x5e, 0x05, 0xee, 0xae, 0xeb, 0xd7, 0x59,
-    0xde, 0xd9, 0x37, 0x9d, 0xdf, 0xce, 0x77, 0x7c, 0xfe, 0xf7, 0x2c, 0xee,
-    0xfc, 0x71, 0xee, 0x63, 0xa5, 0x27, 0x7b, 0x9f, 0x9e, 0xf4, 0xf5, 0x8a,
-    0x50, 0xf6, 0x71, 0x7c, 0x2e, 0x6a, 0xda, 0x2b, 0x7d, 0xc2, 0xdc, 0x0e,
-    0xe4, 0x94, 0xd9, 0x9b, 0x6c, 0xc9, 0xf2, 0x97, 0x71, 0xc1, 0x3c, 0x65,
-    0x5e, 0xa9, 0x3a, 0x2f, 0x9c, 0x34, 0x1b, 0xb2, 0xb3, 0xf2, 0x3c, 0xc4,
-    0x7f, 0xa2, 0x94, 0x2d, 0x9d, 0x1f, 0xd9, 0xd5, 0xe9, 0xed, 0xdc, 0x73,
-    0xbd, 0x7f, 0xad, 0x3e, 0x7e, 0x2c, 0x7c, 0x77, 0xa7, 0xdc, 0x71, 0x3d,
-    0xf8, 0x5a, 0x3d, 0xf1, 0x5d, 0xa5, 0x9f, 0x39, 0x27, 0x13, 0x01, 0x42,
-    0x01, 0x98, 0xad, 0x0a, 0x30, 0xab, 0xd5, 0xab, 0x33, 0x04, 0xc1, 0xf9,
-    0x90, 0x85, 0x6c, 0xc7, 0x9d, 0xdf, 0x2a, 0x28, 0x9a, 0x2b, 0x98, 0x21,
-    0x03, 0x28, 0x69, 0x9b, 0x86, 0x6f, 0x04, 0x6a, 0x77, 0x65, 0xb6, 0x1f,
-    0x2e, 0xbb, 0xb3, 0x78, 0x2e, 0x73, 0xde, 0x02, 0xda, 0x29, 0x94, 0x54,
-    0xaf, 0x64, 0x0f, 0x11, 0x51, 0x22, 0xe5, 0xb0, 0x0c, 0x6f, 0xf0, 0x91,
-    0xf9, 0xde, 0x5a, 0x99, 0xef, 0x98, 0xcf, 0x17, 0x11, 0x24, 0x0d, 0x72,
-    0x20, 0x29, 0x89, 0x11, 0x21, 0x86, 0xee, 0xe5, 0x5e, 0x1a, 0xf5, 0x06,
-    0xe9, 0x71, 0x3e, 0x48, 0x77, 0x76, 0x7c, 0xa4, 0xd7, 0xb3, 0xf4, 0x3c,
-    0x2a, 0xe1, 0x9f, 0x01, 0x26, 0x44, 0xd5, 0x28, 0x0f, 0x28, 0xc5, 0xa3,
-    0x12, 0xb3, 0x9c, 0x70, 0x42, 0x59, 0xd8, 0xb5, 0x0a, 0x13, 0x41, 0xbb,
-    0x6c, 0xb8, 0x44, 0xb2, 0xc5, 0x7f, 0xba, 0x97, 0xc9, 0x14, 0x74, 0x4b,
-    0x8f, 0x29, 0xd3, 0x9a, 0x61, 0x93, 0x00, 0x66, 0x54, 0x35, 0x8b, 0xa1,
-    0x7c, 0xc8, 0x04, 0x20, 0xa8, 0x24, 0x54, 0xb0, 0xfc, 0x86, 0xd7, 0xf7,
-    0xef, 0x79, 0xef, 0xe9, 0x10, 0x71, 0x6b, 0x06, 0x4c, 0xf5, 0x9b, 0x12,
-    0x58, 0x04, 0x30, 0x52, 0x06, 0xcd, 0xc3, 0x12, 0xa6, 0x58, 0x2a, 0x39,
-    0xd0, 0xa0, 0xee, 0xe2, 0x4a, 0x81, 0x04, 0x40, 0x8d, 0x5e, 0x4e, 0x7f,
-    0x1b, 0xcf, 0x68, 0x2d, 0x00, 0x19, 0x20, 0x81, 0xb4, 0x8b, 0xbf, 0xab,
-    0xf2, 0x73, 0x0c, 0xd4, 0x1e, 0xdd, 0x0e, 0x24, 0x47, 0x03, 0x1a, 0xb8,
-    0x1d, 0xe6, 0xc3, 0xaa, 0x30, 0x4c, 0x09, 0xcc, 0x9e, 0x92, 0x15, 0xb1,
-    0x50, 0xe9, 0x30, 0x52, 0x17, 0x7a, 0xe7, 0xe1, 0xab, 0xf3, 0xf9, 0x5d,
-    0xc5, 0x20, 0x87, 0x6e, 0x99, 0x2f, 0x98, 0xcb, 0x09, 0xeb, 0x32, 0x9e,
-    0x16, 0x0c, 0xd0, 0x87, 0x21, 0xe1, 0xe1, 0xd2, 0x30, 0x7f, 0x88, 0x1f,
-    0xe1, 0x0e, 0xa0, 0x0f, 0xa5, 0x76, 0x58, 0xb8, 0xfb, 0xaf, 0xb3, 0x8f,
-    0x67, 0x1f, 0xef, 0xcf, 0x77, 0xbb, 0x25, 0x2b, 0x4a, 0x04, 0xd4, 0xb2,
-    0x3b, 0xc7, 0xdf, 0x8d, 0xfa, 0xc7, 0xfb, 0x1f, 0xde, 0xe2, 0xc2, 0xf1,
-    0xff, 0xd7, 0xa3, 0xb8, 0x1c, 0x4d, 0x14, 0xe4, 0x60, 0xeb, 0x35, 0x2e,
-    0xf6, 0x36, 0xb8, 0x08, 0x96, 0xc1, 0x69, 0xf0, 0x22, 0x78, 0x1f, 0x7c,
-    0x88, 0xce, 0xce, 0x83, 0x97, 0xd1, 0x07, 0x94, 0x81, 0x50, 0x3d, 0x78,
-    0x0b, 0x9f, 0x7c, 0x77, 0x82, 0x37, 0xf0, 0x59, 0x4c, 0x93, 0x11, 0x0b,
-    0xde, 0x45, 0xa3, 0xee, 0x38, 0x1b, 0x2d, 0x66, 0xf8, 0xb2, 0xe6, 0x0f,
-    0xd1, 0xfd, 0x3a, 0x60, 0xf8, 0xcf, 0xab, 0xe8, 0xde, 0x05, 0xa1, 0xb2,
-    0x98, 0xe1, 0xdb, 0xfc, 0x8b, 0xb4, 0x74, 0xc3, 0xbd, 0x80, 0xa7, 0x0b,
-    0xf8, 0x72, 0x95, 0x9f, 0x78, 0xc0, 0x12, 0x57, 0x79, 0xca, 0x17, 0xd3,
-    0x32, 0x6c, 0x17, 0x4a, 0xc4, 0x95, 0x04, 0xcc, 0xe5, 0xc6, 0xc7, 0x3a,
-    0xf8, 0x26, 0xda, 0xfd, 0xd7, 0xc7, 0xe2, 0xeb, 0x63, 0xef, 0xe3, 0x72,
-    0x67, 0xb5, 0xe5, 0x9f, 0xfd, 0xeb, 0xe4, 0xfc, 0xeb, 0x93, 0xdd, 0xe0,
-    0x35, 0x64, 0x53, 0x9e, 0x0f, 0x85, 0x1f, 0x77, 0x87, 0x27, 0xde, 0x30,
-    0x3c, 0xfe, 0xb8, 0xfb, 0x71, 0xef, 0x64, 0xe5, 0x3f, 0xd9, 0x0d, 0x9e,
-    0x44, 0xbb, 0xc7, 0xde, 0x70, 0x0b, 0x2f, 0xcd, 0xae, 0x2e, 0xf2, 0x15,
-    0x4c, 0x66, 0xc5, 0x80, 0x1e, 0xc7, 0xab, 0x49, 0xbe, 0x4a, 0x66, 0x57,
-    0x2b, 0xba, 0x39, 0xb5, 0xc2, 0xb8, 0xd9, 0x15, 0xfe, 0xaa, 0xd6, 0x0a,
-    0xc3, 0xa6, 0x67, 0xbe, 0xe7, 0x9d, 0x7d, 0x5c, 0x86, 0xc0, 0x78, 0x68,
-    0x14, 0xff, 0xe3, 0xee, 0xc9, 0xee, 0x55, 0x12, 0x7c, 0x86, 0xa1, 0xa0,
-    0x77, 0x14, 0x8d, 0x2b, 0xfc, 0x6d, 0x15, 0xe8, 0x3f, 0x09, 0x7e, 0x8c,
-    0x76, 0x6b, 0x9e, 0xf3, 0x53, 0x74, 0xe6, 0xde, 0xc4, 0x53, 0x37, 0x70,
-    0x47, 0x45, 0x01, 0xff, 0x62, 0x2d, 0xf8, 0x83, 0xb2, 0x1a, 0xfe, 0x8c,
-    0xe3, 0x32, 0x86, 0x3f, 0xa4, 0xb5, 0x60, 0x21, 0x5f, 0x78, 0xe0, 0x66,
-    0x97, 0x97, 0x80, 0x93, 0xee, 0x79, 0x50, 0x46, 0xef, 0xba, 0x23, 0x98,
-    0x69, 0xc9, 0x4e, 0xa7, 0x0c, 0x41, 0xeb, 0xb9, 0x14, 0x85, 0xe8, 0xfa,
-    0xc1, 0xb7, 0x96, 0xa2, 0x1c, 0xf2, 0x7f, 0x8b, 0x00, 0x73, 0xc2, 0x66,
-    0x19, 0x4e, 0x12, 0x8a, 0xe9, 0x6f, 0x58, 0x06, 0x14, 0xa2, 0x8a, 0x7f,
-    0xf1, 0x17, 0xa1, 0xf0, 0xef, 0x38, 0xfc, 0x16, 0x32, 0xe1, 0x1f, 0xf7,
-    0x6b, 0xb7, 0xd9, 0x7c, 0x9c, 0xdc, 0x00, 0x43, 0x0b, 0xbe, 0x8f, 0x76,
-    0x47, 0xd9, 0x6c, 0x0e, 0x76, 0x1f, 0x5b, 0x4d, 0xb3, 0x78, 0x0c, 0x60,
-    0xa3, 0x67, 0x34, 0x79, 0x08, 0xf4, 0x6e, 0xf0, 0x7b, 0x84, 0x58, 0xb7,
-    0xec, 0x9c, 0x7f, 0x0d, 0x90, 0xfe, 0x03, 0x11, 0xe0, 0xbb, 0xe8, 0x0f,
-    0xe0, 0xae, 0x5c, 0x24, 0x07, 0x9f, 0x30, 0xe7, 0xe7, 0xc8, 0xde, 0x7b,
-    0xf0, 0x8f, 0x08, 0x7f, 0x69, 0x81, 0xdf, 0x3c, 0xc1, 0x65, 0xbe, 0xa6,
-    0x0d, 0x0f, 0xe4, 0x33, 0x39, 0xa1, 0x8b, 0x5f, 0x3f, 0xc0, 0x97, 0x1b,
-    0x00, 0x13, 0x0a, 0x09, 0x96, 0xdf, 0x66, 0xb9, 0x1b, 0x10, 0x11, 0x85,
-    0x6e, 0x45, 0x4b, 0x6e, 0x30, 0x8b, 0x6f, 0x05, 0xc3, 0x72, 0xe1, 0xf3,
-    0x0d, 0x17, 0x6e, 0x01, 0x05, 0x2e, 0x0b, 0xbb, 0xd4, 0xc5, 0xc4, 0x7b,
-    0x9e, 0xe0, 0x25, 0x52, 0x1d, 0xa3, 0x92, 0x77, 0x3c, 0x01, 0xa3, 0x67,
-    0x4b, 0x68, 0x92, 0xc2, 0xe0, 0xd9, 0x12, 0xaa, 0xa7, 0x2e, 0xa2, 0x2f,
-    0xcf, 0x81, 0x0f, 0x9e, 0xb3, 0x28, 0x18, 0xf0, 0xdd, 0xd0, 0x85, 0xbf,
-    0xdf, 0xc7, 0x73, 0x98, 0x1d, 0x60, 0x0c, 0x13, 0xa1, 0xd1, 0x2e, 0x25,
-    0x5e, 0x50, 0x02, 0xdb, 0xd2, 0x5d, 0x0f, 0x36, 0x4e, 0x68, 0x1b, 0xb1,
-    0x0f, 0xca, 0x38, 0x15, 0x19, 0xee, 0x3a, 0xf8, 0x25, 0xfa, 0x06, 0x65,
-    0x69, 0x37, 0x29, 0xe8, 0xef, 0x6a, 0x65, 0xe1, 0xe0, 0x28, 0x8b, 0x8a,
-    0x12, 0x7f, 0xac, 0x05, 0xc4, 0x07, 0x55, 0x5b, 0x4b, 0xce, 0xf3, 0x09,
-    0x44, 0x00, 0x50, 0x34, 0x2b, 0x22, 0x5d, 0x45, 0x4b, 0x2e, 0xbd, 0x2d,
-    0x60, 0x1e, 0x5b, 0xe5, 0x6a, 0xb5, 0xb7, 0xa5, 0x0a, 0x00, 0x9f, 0x37,
-    0xdc, 0xda, 0x1b, 0x48, 0x26, 0x27, 0x3a, 0x58, 0xad, 0x40, 0xc3, 0xa1,
-    0xcb, 0x16, 0xdf, 0xf3, 0x8c, 0xf7, 0x82, 0x93, 0x63, 0xc1, 0x2c, 0xfb,
-    0xc3, 0x92, 0x9b, 0xd9, 0x6a, 0xea, 0x59, 0x03, 0x98, 0x48, 0xea, 0x4b,
-    0xae, 0x2f, 0x39, 0x37, 0xf3, 0x69, 0xf4, 0x3c, 0x48, 0x60, 0x7c, 0x1e,
-    0xc8, 0x8c, 0xe2, 0x2b, 0xc8, 0xa2, 0xad, 0x44, 0xae, 0x2c, 0x03, 0x76,
-    0x97, 0x44, 0x3f, 0xfb, 0x5d, 0xfc, 0xa9, 0x9a, 0x74, 0xfc, 0x92, 0x02,
-    0x94, 0x4b, 0x1f, 0xb8, 0xf0, 0xff, 0xf9, 0xd4, 0xfd, 0xbd, 0x88, 0xbd,
-    0x04, 0xba, 0xe9, 0x12, 0xfa, 0x90, 0xfe, 0x13, 0x40, 0x83, 0x9f, 0x05,
-    0xc3, 0xaf, 0x2b, 0xaf, 0x83, 0x17, 0x91, 0x0d, 0xa2, 0xb5, 0x52, 0xd0,
-    0xd9, 0xf1, 0xba, 0xfe, 0x10, 0x68, 0x57, 0x07, 0x60, 0xc5, 0x8a, 0x19,
-    0xe0, 0xf3, 0x4f, 0x78, 0x11, 0x82, 0x6b, 0x0b, 0x21, 0x08, 0x35, 0xa0,
-    0x8c, 0xf7, 0x75, 0xaf, 0x69, 0x55, 0xf9, 0x2d, 0x5f, 0x5f, 0x6a, 0xef,
-    0x2a, 0x55, 0x26, 0x0b, 0x3c, 0x1b, 0x7b, 0xf9, 0xd4, 0x05, 0x74, 0xb9,
-    0x42, 0xa2, 0xd0, 0xb6, 0x0f, 0x65, 0x98, 0x80, 0x4f, 0x90, 0x49, 0x78,
-    0xbc, 0xe6, 0x7c, 0x9d, 0xf4, 0xaf, 0x3c, 0x5a, 0x7a, 0x26, 0x55, 0x71,
-    0xdd, 0xa4, 0xfb, 0x04, 0x5f, 0x5c, 0x0e, 0x60, 0x2b, 0xbc, 0x6a, 0x8d,
-    0xd0, 0xa0, 0x8c, 0xea, 0x15, 0x3f, 0x09, 0xdc, 0xe3, 0x27, 0x7b, 0xa0,
-    0xe8, 0x3f, 0xe9, 0x9f, 0xb8, 0x50, 0x97, 0x84, 0x17, 0xd4, 0x61, 0xd1,
-    0x37, 0xf5, 0x10, 0x75, 0x6f, 0x01, 0x43, 0x4d, 0xe8, 0x37, 0xe8, 0x90,
-    0x45, 0xc0, 0x2b, 0xfc, 0xc0, 0xcb, 0xa2, 0xdf, 0xce, 0xd8, 0x39, 0xc2,
-    0x1e, 0xac, 0xa0, 0xef, 0x3e, 0x7c, 0xff, 0x26, 0x72, 0x41, 0x13, 0x82,
-    0x8d, 0x59, 0x76, 0x59, 0x0c, 0xd2, 0x45, 0x68, 0x2a, 0x99, 0xa2, 0x97,
-    0xf8, 0x81, 0xa2, 0xcd, 0x67, 0xfa, 0x2e, 0x81, 0xd6, 0x00, 0xe6, 0x80,
-    0x1f, 0x00, 0xe0, 0x7c, 0xda, 0xf3, 0xa5, 0x97, 0xfb, 0x81, 0xe8, 0xcb,
-    0x84, 0x65, 0x67, 0xef, 0xf8, 0x27, 0x05, 0x8e, 0xc3, 0x04, 0x54, 0x33,
-    0x14, 0x6e, 0x49, 0x37, 0x06, 0x91, 0x4e, 0x75, 0xb0, 0xaf, 0x1c, 0x61,
-    0xfb, 0x5b, 0x64, 0xdf, 0x07, 0x50, 0xe4, 0xb8, 0xc6, 0x83, 0x95, 0x92,
-    0xe2, 0xb7, 0xe8, 0x21, 0x92, 0x83, 0xae, 0xa8, 0x6a, 0x9a, 0x94, 0x46,
-    0x97, 0x42, 0x65, 0x42, 0x2c, 0xdf, 0x2a, 0xfd, 0x8a, 0x26, 0x7f, 0xf3,
-    0x7c, 0xcc, 0x72, 0x0b, 0xe2, 0x83, 0xb5, 0x4e, 0x5c, 0xfa, 0x98, 0x7b,
-    0x0c, 0x19, 0xb4, 0x23, 0x50, 0x3a, 0xf3, 0x7c, 0xff, 0xac, 0x77, 0xbe,
-    0xbd, 0x5d, 0xc1, 0xde, 0x4f, 0xa3, 0x1a, 0x2d, 0x60, 0x94, 0x6a, 0x27,
-    0x60, 0x3c, 0x10, 0x10, 0x28, 0xf7, 0x07, 0x0c, 0x34, 0x02, 0x24, 0x71,
-    0x86, 0x4a, 0x88, 0x1c, 0x76, 0x09, 0x70, 0x00, 0x41, 0x9d, 0x22, 0xe2,
-    0x0f, 0xb0, 0x13, 0x24, 0x92, 0x77, 0x01, 0x28, 0xde, 0xb2, 0x3a, 0xda,
-    0x3f, 0x75, 0xed, 0x77, 0xa8, 0x19, 0xc7, 0xe3, 0x3b, 0xac, 0x0e, 0x85,
-    0x04, 0x0a, 0xa5, 0x42, 0x89, 0x99, 0xbf, 0x50, 0x46, 0x04, 0xba, 0x56,
-    0x24, 0x90, 0x3b, 0xb7, 0xa9, 0x98, 0xc2, 0xfa, 0x59, 0xfb, 0x34, 0x33,
-    0x07, 0x1a, 0x26, 0x7c, 0x25, 0xb0, 0x3b, 0xea, 0x9c, 0xb1, 0xa4, 0x6d,
-    0xa1, 0x02, 0x1a, 0xff, 0x15, 0xeb, 0x5d, 0x2b, 0x1b, 0x91, 0x62, 0x46,
-    0xe0, 0x2d, 0xed, 0xb8, 0xc0, 0x37, 0x55, 0xa0, 0x4d, 0x17, 0xa4, 0x34,
-    0x70, 0x9a, 0xba, 0x66, 0xb5, 0xc1, 0x65, 0x24, 0x70, 0x3a, 0xce, 0xaf,
-    0x48, 0xe5, 0x29, 0x82, 0xbd, 0xca, 0x44, 0xba, 0xc8, 0xb2, 0x29, 0x8b,
-    0x53, 0xcd, 0xf2, 0x01, 0x95, 0x99, 0x01, 0x61, 0x81, 0xae, 0x39, 0x49,
-    0x2e, 0x4b, 0x0f, 0xdf, 0x45, 0xef, 0x82, 0x10, 0x3b, 0x45, 0x94, 0x56,
-    0xe1, 0x57, 0x19, 0xd6, 0x4e, 0xe9, 0x09, 0x55, 0x17, 0x15, 0xee, 0x0b,
-    0x24, 0x39, 0x60, 0x9b, 0xd0, 0x11, 0x50, 0xc5, 0xd9, 0xc5, 0xb9, 0xbf,
-    0x5a, 0xfd, 0xc2, 0x3f, 0xfc, 0xa1, 0xcc, 0x02, 0x73, 0x6c, 0xea, 0x31,
-    0xfe, 0x45, 0x7f, 0x41, 0xda, 0xfa, 0xc1, 0x2f, 0x55, 0xe1, 0x2f, 0x7a,
-    0xe1, 0xd9, 0x39, 0x4c, 0x82, 0x3e, 0x03, 0xac, 0x01, 0x43, 0xf9, 0x21,
-    0x7e, 0x6c, 0x09, 0xea, 0xc7, 0x3a, 0xd4, 0x74, 0x0d, 0x33, 0x29, 0x51,
-    0x2b, 0x06, 0xd2, 0x47, 0xb4, 0x07, 0xb0, 0xda, 0xb1, 0x3e, 0x72, 0xbf,
-    0x42, 0xe5, 0x13, 0xd0, 0x17, 0xf8, 0xf8, 0x16, 0x4c, 0xd6, 0xed, 0xca,
-    0x74, 0x16, 0x01, 0x07, 0x4a, 0x80, 0x77, 0x92, 0xb6, 0xe8, 0xed, 0x81,
-    0xea, 0x19, 0xc4, 0xd1, 0xef, 0x7c, 0xeb, 0x33, 0x09, 0x3a, 0x87, 0xcc,
-    0x58, 0xc1, 0xc0, 0x5e, 0xdc, 0xbd, 0x1e, 0x6f, 0x6f, 0xc7, 0xdb, 0xdb,
-    0xf9, 0xd0, 0x43, 0xb1, 0xa4, 0x97, 0x40, 0x23, 0x7f, 0x08, 0x26, 0x47,
-    0x78, 0x76, 0x1e, 0xea, 0x02, 0x6d, 0x7b, 0xfb, 0xb9, 0x91, 0xde, 0xd3,
-    0x2b, 0x0c, 0xa1, 0x89, 0xdc, 0x3e, 0x00, 0x4b, 0x8e, 0x06, 0x6f, 0xdd,
-    0x79, 0xf1, 0xe2, 0xee, 0xa5, 0x54, 0x24, 0x86, 0xc9, 0xb0, 0xad, 0x08,
-    0xc6, 0x0f, 0x8d, 0xb2, 0x0f, 0xf1, 0x15, 0x95, 0x90, 0x4d, 0xf1, 0xfb,
-    0x82, 0xe5, 0x77, 0x52, 0xe8, 0x7d, 0x03, 0x43, 0x31, 0x1f, 0xd0, 0x6e,
-    0x29, 0xfd, 0x48, 0x05, 0x28, 0x41, 0x52, 0x5d, 0x16, 0x3d, 0x54, 0x45,
-    0x43, 0x2b, 0x66, 0x96, 0xb0, 0x06, 0x86, 0x53, 0x95, 0xd5, 0xd0, 0x34,
-    0x0a, 0xf5, 0xaa, 0x88, 0x2a, 0x03, 0x46, 0xac, 0x9b, 0x29, 0x62, 0xd4,
-    0x1f, 0x20, 0x9b, 0x41, 0xb6, 0x2e, 0x59, 0xd2, 0x56, 0x6f, 0x20, 0xc5,
-    0x3e, 0x4e, 0x8a, 0xbf, 0x21, 0x00, 0x1f, 0x49, 0xf1, 0xad, 0xe8, 0x30,
-    0x8a, 0x29, 0xf9, 0x4f, 0x72, 0x71, 0x44, 0x19, 0x25, 0x48, 0xd3, 0x88,
-    0x7e, 0xa1, 0xef, 0x77, 0x53, 0x98, 0x03, 0x77, 0x30, 0x44, 0x53, 0xca,
-    0x39, 0xc5, 0xcb, 0x61, 0x22, 0x47, 0x45, 0x69, 0x72, 0x33, 0x90, 0xd9,
-    0xc8, 0xb8, 0xdd, 0x5f, 0x29, 0x1c, 0x72, 0x2e, 0x6b, 0x6a, 0xff, 0x16,
-    0x80, 0x91, 0x27, 0xa3, 0x66, 0xdb, 0xe8, 0x2d, 0x19, 0xcc, 0x28, 0xbe,
-    0xd3, 0x8a, 0x71, 0x0e, 0x4c, 0x3f, 0x4b, 0x45, 0x76, 0xe4, 0x98, 0xa8,
-    0x58, 0xed, 0x16, 0xba, 0x24, 0xa4, 0xf9, 0x8a, 0x54, 0x00, 0x03, 0xc5,
-    0x68, 0xfe, 0x6c, 0x6f, 0xc3, 0x62, 0x91, 0xd8, 0x71, 0xc3, 0x40, 0x31,
-    0x22, 0x40, 0x24, 0x29, 0x5f, 0xa3, 0x29, 0x7c, 0xc5, 0x60, 0x1f, 0xa4,
-    0xa4, 0xe1, 0xd8, 0x23, 0xc8, 0x02, 0x77, 0x15, 0xf6, 0x7d, 0x8a, 0xfa,
-    0x40, 0xf4, 0x02, 0xc1, 0x09, 0x8c, 0x2b, 0x6a, 0xe1, 0x8a, 0xe8, 0xa0,
-    0x72, 0xdd, 0x90, 0x2b, 0xc4, 0xb5, 0x6b, 0x86, 0xda, 0x48, 0x5f, 0x15,
-    0xf6, 0xb8, 0x58, 0x24, 0xe3, 0xa8, 0x07, 0x1f, 0xc5, 0x62, 0x8e, 0x3f,
-    0x4c, 0x87, 0x9a, 0x33, 0x88, 0xc0, 0xdb, 0x79, 0xce, 0xbf, 0xd2, 0x2c,
-    0x9b, 0xab, 0x1e, 0x31, 0xcc, 0x03, 0x25, 0xd4, 0x4e, 0x98, 0xa8, 0x36,
-    0x00, 0xb9, 0x9d, 0x9d, 0x23, 0x0b, 0x47, 0x6b, 0xcf, 0xc7, 0xed, 0xc8,
-    0xc1, 0x8a, 0xcf, 0x8f, 0x25, 0x6c, 0x06, 0x39, 0x18, 0xf3, 0x1c, 0x9a,
-    0xc8, 0xac, 0xbc, 0xf2, 0x2c, 0x27, 0x9e, 0x00, 0x24, 0xd8, 0x9d, 0x2f,
-    0x0a, 0x90, 0xbc, 0x82, 0x99, 0x63, 0xd3, 0x84, 0xef, 0xa4, 0x56, 0x3d,
-    0x01, 0xaa, 0xd7, 0xab, 0x8b, 0x65, 0xf7, 0x8e, 0x41, 0x43, 0x88, 0x7d,
-    0x31, 0x0e, 0x58, 0xa1, 0x97, 0xa9, 0x30, 0x25, 0x51, 0x95, 0x9b, 0xde,
-    0x79, 0x60, 0x5e, 0x02, 0x35, 0x65, 0x6b, 0x21, 0xe3, 0xdb, 0x45, 0x2a,
-    0x4d, 0xfd, 0xbe, 0xf6, 0x40, 0x54, 0x73, 0x47, 0x47, 0x04, 0x8a, 0xdc,
-    0x3d, 0xf4, 0x3d, 0x09, 0x30, 0x02, 0x73, 0x00, 0x06, 0x8a, 0x7f, 0x6a,
-    0x11, 0xb6, 0xae, 0x56, 0x90, 0xf3, 0x15, 0x34, 0x1a, 0xe1, 0xa2, 0x03,
-    0xfc, 0xa3, 0xc8, 0xbd, 0xaa, 0x35, 0x4c, 0xf0, 0x0a, 0xb4, 0x26, 0xbb,
-    0xe8, 0x78, 0x5b, 0x2b, 0xb3, 0xeb, 0x60, 0xd4, 0x45, 0x2b, 0x1b, 0xf0,
-    0x50, 0xb1, 0xb9, 0x23, 0xfc, 0x87, 0x27, 0x2b, 0x75, 0xc6, 0x7d, 0xc1,
-    0xb1, 0xd6, 0xe1, 0x38, 0xee, 0x70, 0xbc, 0x70, 0x24, 0x15, 0x72, 0xe5,
-    0xde, 0x79, 0x05, 0x6a, 0x9d, 0xf0, 0x35, 0x39, 0x9c, 0xc2, 0x9c, 0xd3,
-    0x3c, 0x07, 0xd3, 0xa7, 0x5b, 0xcc, 0xa7, 0x20, 0xae, 0x5c, 0xc7, 0xf5,
-    0x0d, 0xbd, 0xe8, 0x8f, 0x33, 0xf7, 0x8c, 0x7b, 0x12, 0x1d, 0x17, 0xbd,
-    0x02, 0xe7, 0xee, 0x79, 0xc4, 0x0c, 0x3f, 0x17, 0xce, 0xe2, 0x32, 0x8d,
-    0xf0, 0x06, 0x3a, 0x50, 0xcb, 0x02, 0x39, 0x55, 0x08, 0x22, 0x32, 0x90,
-    0xbe, 0x9e, 0x40, 0x48, 0xa8, 0xf0, 0x83, 0x94, 0x55, 0x60, 0x8c, 0x8d,
-    0x17, 0x23, 0x06, 0x19, 0xfc, 0x23, 0xc0, 0xad, 0x86, 0x14, 0xfe, 0x09,
-    0x0a, 0x40, 0x53, 0xf8, 0xc6, 0x3f, 0x01, 0xce, 0x8b, 0xea, 0xf1, 0x8f,
-    0x40, 0xd0, 0x4d, 0x58, 0x51, 0x50, 0xc0, 0x31, 0x20, 0x54, 0x50, 0x18,
-    0x37, 0x9a, 0xe8, 0x0d, 0x11, 0x15, 0xf7, 0xa8, 0x84, 0x4d, 0x2e, 0x8f,
-    0x2b, 0x11, 0x2b, 0x37, 0xbb, 0x84, 0xcd, 0x66, 0x51, 0x95, 0x8d, 0x2a,
-    0x45, 0x8a, 0x0e, 0x39, 0xae, 0xb0, 0x90, 0x43, 0xa8, 0xcc, 0x08, 0x70,
-    0xa0, 0x9d, 0x33, 0xb9, 0x7b, 0x2f, 0x05, 0xb2, 0x09, 0xb5, 0x06, 0x95,
-    0xcc, 0x21, 0x39, 0xa8, 0xea, 0xba, 0xe4, 0x7a, 0x46, 0x82, 0x46, 0x6b,
-    0xce, 0xa2, 0xce, 0x2f, 0x3d, 0xe1, 0x60, 0xd3, 0x5c, 0xd4, 0xba, 0x4a,
-    0x2f, 0x71, 0x00, 0xb5, 0x0c, 0xe4, 0xf8, 0x24, 0xef, 0xc2, 0xa6, 0xcf,
-    0x7b, 0x09, 0x5a, 0x31, 0x9f, 0x10, 0xf5, 0x56, 0xad, 0x06, 0xdb, 0x90,
-    0x16, 0x16, 0x5a, 0x18, 0xc8, 0xf7, 0x5c, 0x5e, 0xbe, 0xe3, 0x7a, 0xda,
-    0xfb, 0x12, 0xd0, 0x02, 0x08, 0xee, 0x5d, 0x17, 0x6d, 0xfa, 0x61, 0xe9,
-    0x2d, 0x7d, 0x30, 0xdc, 0xc1, 0x70, 0x3d, 0xc5, 0xdf, 0xb4, 0x78, 0x93,
-    0x14, 0xa0, 0xbc, 0x00, 0xdb, 0x74, 0x5f, 0xfd, 0xf0, 0xfd, 0x4b, 0x6e,
-    0x66, 0xbe, 0x21, 0x93, 0xdd, 0x55, 0x75, 0x6f, 0x6c, 0xb5, 0x0e, 0xb6,
-    0x40, 0xad, 0xc7, 0x79, 0xac, 0x03, 0x90, 0x68, 0xb6, 0x91, 0x4b, 0x72,
-    0x68, 0x49, 0x97, 0x23, 0x02, 0x8f, 0xa0, 0x75, 0xd6, 0x3b, 0x46, 0xef,
-    0x60, 0x58, 0xee, 0x28, 0x9e, 0xbf, 0xf3, 0x75, 0x20, 0x60, 0x6a, 0x59,
-    0x37, 0xd5, 0x83, 0x41, 0x3c, 0x84, 0x0d, 0x1e, 0x87, 0xb4, 0x54, 0xe1,
-    0x5d, 0x21, 0x2c, 0xd0, 0x32, 0x68, 0xab, 0xc5, 0x34, 0xfd, 0x89, 0x3b,
-    0xfa, 0x40, 0x1a, 0x60, 0x51, 0x2d, 0xfe, 0x40, 0x68, 0xea, 0x19, 0x36,
-    0x73, 0x63, 0x1d, 0x60, 0x5f, 0xb6, 0x5d, 0xff, 0xd0, 0x65, 0x37, 0x20,
-    0xcb, 0xeb, 0xa5, 0x5b, 0xb7, 0x7e, 0x0b, 0x75, 0x0c, 0x63, 0xfb, 0x05,
-    0x48, 0xb9, 0xaf, 0x2c, 0x54, 0xb5, 0x48, 0xd5, 0x7d, 0x49, 0x93, 0xc3,
-    0x77, 0x95, 0xaa, 0x0f, 0x50, 0x15, 0xc2, 0xa5, 0xf7, 0xd6, 0x3a, 0xa2,
-    0xa2, 0xa9, 0x0a, 0xcb, 0x5a, 0xda, 0x38, 0xeb, 0x00, 0xb6, 0x3e, 0xb4,
-    0xa2, 0xe5, 0xd2, 0x7b, 0xcf, 0x7b, 0xe7, 0x44, 0xe7, 0x2d, 0xa9, 0xd4,
-    0xc7, 0x36, 0x49, 0x61, 0xdb, 0xee, 0xde, 0xb1, 0xb2, 0x09, 0xdb, 0xdb,
-    0xca, 0x58, 0xb4, 0xe9, 0xe7, 0xa4, 0x43, 0xc3, 0x54, 0xc3, 0x86, 0x6a,
-    0x2c, 0x84, 0x4c, 0x4c, 0x12, 0x96, 0x73, 0x55, 0xd2, 0xd1, 0x2d, 0xdb,
-    0x05, 0xc3, 0x31, 0x65, 0x8d, 0x25, 0x48, 0xe1, 0x94, 0xcb, 0x0e, 0xb1,
-    0x27, 0x5c, 0xcd, 0x27, 0xc3, 0x37, 0x6a, 0x98, 0x4e, 0x8c, 0x03, 0xae,
-    0x72, 0x13, 0x87, 0x13, 0x1a, 0x12, 0x06, 0xee, 0xe2, 0x3b, 0x29, 0xbe,
-    0x44, 0x56, 0x86, 0xb0, 0x04, 0x15, 0x88, 0xd7, 0xb6, 0xa8, 0xdc, 0xb9,
-    0x62, 0x3e, 0x1e, 0xf7, 0xd0, 0xa1, 0xcb, 0xe7, 0x80, 0x48, 0x51, 0xc1,
-    0x0f, 0xb9, 0xc2, 0x24, 0xb6, 0xc2, 0x4a, 0x9d, 0x46, 0x13, 0x4d, 0xd1,
-    0xee, 0x19, 0xd6, 0x6a, 0x9f, 0x5c, 0x2a, 0xfa, 0xb8, 0x71, 0x91, 0xd2,
-    0x5e, 0xe9, 0x22, 0x2d, 0x78, 0x1c, 0x0f, 0x7f, 0xb7, 0x8c, 0xd2, 0x41,
-    0x21, 0x55, 0xf2, 0x25, 0x73, 0x15, 0xba, 0xe4, 0x14, 0x28, 0x53, 0xc1,
-    0x4e, 0xb9, 0xb3, 0xe7, 0x23, 0xb2, 0xe5, 0x45, 0x93, 0xab, 0x46, 0x62,
-    0xdf, 0x2a, 0x51, 0x86, 0x8a, 0x10, 0xce, 0xac, 0x24, 0x67, 0xfb, 0x3a,
-    0xc0, 0x1b, 0xcc, 0x2d, 0xad, 0x14, 0x4c, 0xe8, 0xec, 0xb5, 0xf7, 0x80,
-    0x0b, 0x09, 0x4d, 0xdd, 0x2d, 0xa5, 0x2e, 0xaa, 0x36, 0xc3, 0xfa, 0x70,
-    0x4b, 0xea, 0x71, 0x43, 0xd5, 0xd9, 0x6f, 0x4c, 0x80, 0x69, 0xad, 0x51,
-    0xb2, 0xcc, 0x58, 0xd3, 0xa3, 0x52, 0x63, 0xb9, 0x02, 0x65, 0x22, 0x89,
-    0xb5, 0x1f, 0xe2, 0x59, 0x47, 0x3d, 0x7f, 0x18, 0x8c, 0x5b, 0x85, 0x35,
-    0x1a, 0x0b, 0x28, 0x22, 0x5b, 0x6f, 0x6e, 0x5e, 0x5d, 0x99, 0xe8, 0x19,
-    0x56, 0x8a, 0xa2, 0x7d, 0x9a, 0x15, 0x4c, 0x85, 0x16, 0x59, 0x69, 0x38,
-    0xdf, 0x04, 0x1d, 0xe5, 0x59, 0xd4, 0x58, 0x24, 0xe8, 0xa3, 0x4b, 0x45,
-    0x1f, 0xb2, 0x91, 0x82, 0xaa, 0xbd, 0x6f, 0x79, 0xd9, 0x10, 0xf8, 0x6a,
-    0x56, 0xe1, 0x25, 0xa0, 0x70, 0x4d, 0x81, 0xa8, 0x8f, 0x82, 0x42, 0x0f,
-    0x1a, 0x3e, 0xd0, 0x15, 0xd8, 0x2e, 0x5b, 0x85, 0x20, 0xb5, 0x9a, 0xbf,
-    0x61, 0x27, 0x89, 0xd2, 0x1a, 0xb1, 0x3a, 0xe1, 0x58, 0xcd, 0x48, 0xea,
-    0x7b, 0x09, 0xac, 0x83, 0xd7, 0xd7, 0x51, 0x1a, 0xa7, 0xc0, 0x21, 0x0f,
-    0x2b, 0x11, 0x9b, 0xd7, 0x3b, 0x4e, 0xa5, 0xe4, 0xf5, 0xf1, 0x40, 0x10,
-    0x41, 0x65, 0x83, 0x3f, 0x79, 0x30, 0x14, 0xa3, 0x83, 0xa6, 0x56, 0xd2,
-    0xd4, 0x54, 0x02, 0x1b, 0x02, 0x81, 0x0a, 0x02, 0x43, 0x3a, 0x90, 0x87,
-    0x4f, 0x12, 0x38, 0xd7, 0x1e, 0xf1, 0x4e, 0x31, 0x3b, 0x1b, 0xbd, 0x5d,
-    0x4b, 0x66, 0x36, 0x9f, 0x2e, 0x46, 0x9f, 0x3d, 0xb7, 0x1e, 0x12, 0x9d,
-    0x57, 0xd8, 0x56, 0x1e, 0x88, 0xd9, 0x5b, 0x6f, 0xd8, 0xef, 0x5c, 0x72,
-    0x1e, 0xde, 0x0d, 0x17, 0x9a, 0x45, 0x9b, 0xf0, 0xb1, 0xf7, 0x21, 0xf9,
-    0x2c, 0x36, 0x7d, 0x25, 0x2c, 0xbc, 0xd5, 0x4a, 0x91, 0x9c, 0xaa, 0x17,
-    0x6c, 0x4d, 0x52, 0xf0, 0x02, 0x9f, 0xaf, 0x29, 0x1e, 0x3b, 0x5b, 0x8b,
-    0xce, 0x99, 0x7b, 0x9a, 0xb9, 0x67, 0x23, 0x0e, 0x32, 0x1f, 0xd7, 0x72,
-    0x69, 0xf4, 0x90, 0xc7, 0x63, 0x85, 0x2a, 0x65, 0xaa, 0xbe, 0x3d, 0x9c,
-    0x35, 0x01, 0xdf, 0x26, 0xd3, 0xac, 0x2a, 0x52, 0x3d, 0xc0, 0x19, 0x3b,
-    0xa7, 0x45, 0x4f, 0xb2, 0xe5, 0x63, 0xc7, 0xaf, 0xf4, 0xc2, 0x81, 0x8b,
-    0x4f, 0x5a, 0xb9, 0x82, 0xa4, 0x29, 0x3c, 0xa1, 0x2b, 0xc2, 0xd3, 0xd0,
-    0xa5, 0xd9, 0xc8, 0x84, 0xa9, 0xfa, 0x81, 0x6c, 0x03, 0x3a, 0xc7, 0xcb,
-    0x6c, 0x36, 0x5f, 0x94, 0x6c, 0xfc, 0x1e, 0x2b, 0xf1, 0x29, 0x42, 0x0d,
-    0x71, 0x72, 0x3e, 0x67, 0x79, 0x79, 0xf7, 0x73, 0x3c, 0x5d, 0x30, 0x3c,
-    0x8f, 0xa0, 0xf6, 0xae, 0x6f, 0xef, 0xd6, 0xe3, 0x9c, 0x91, 0x1c, 0x0a,
-    0x68, 0xf1, 0x07, 0x3f, 0x80, 0xfa, 0x49, 0xfe, 0x50, 0xd3, 0x07, 0x0b,
-    0x38, 0xce, 0xb5, 0x33, 0xcd, 0x69, 0xcd, 0xd0, 0x90, 0x6d, 0xcc, 0x87,
-    0x3d, 0x34, 0x99, 0x80, 0xb5, 0xe9, 0x30, 0xac, 0x5e, 0x66, 0x4a, 0xbe,
-    0x26, 0x97, 0xc2, 0xf4, 0xa0, 0xc9, 0x0f, 0x74, 0x52, 0xcd, 0xff, 0xfa,
-    0x84, 0x6e, 0xc2, 0xeb, 0xfb, 0xcf, 0xa4, 0x9c, 0xb4, 0x4a, 0xb3, 0x0b,
-    0x06, 0x8c, 0x00, 0x45, 0x8c, 0x18, 0x05, 0xd9, 0x1e, 0x06, 0xa4, 0x58,
-    0xc4, 0x3d, 0x0a, 0x7a, 0x14, 0xf8, 0x82, 0xa3, 0x02, 0xd1, 0xa7, 0x3e,
-    0x97, 0xd8, 0xe4, 0x8e, 0x43, 0x4d, 0xaf, 0xe7, 0x07, 0x49, 0x94, 0x2b,
-    0x73, 0x5f, 0xad, 0xf6, 0x54, 0xfd, 0x62, 0x13, 0x5f, 0xf4, 0xef, 0xa5,
-    0xa0, 0xc4, 0xf1, 0xd1, 0x8f, 0x92, 0x0e, 0x75, 0xa5, 0x21, 0x4c, 0x86,
-    0x79, 0x17, 0x78, 0x72, 0xca, 0xb0, 0x6b, 0x6f, 0xab, 0xe7, 0x87, 0x39,
-    0x2d, 0x54, 0x34, 0xd0, 0x16, 0x59, 0x4f, 0x54, 0x76, 0x8c, 0x9f, 0xd5,
-    0x7a, 0x23, 0x14, 0x46, 0xfe, 0xa0, 0xe2, 0x82, 0x03, 0x0f, 0x5d, 0x76,
-    0x92, 0x9d, 0x78, 0xbe, 0x5f, 0x31, 0xc2, 0x12, 0x8c, 0x29, 0x12, 0xb5,
-    0x9e, 0x3f, 0x20, 0x09, 0xc6, 0xf7, 0x57, 0xf0, 0x0f, 0x65, 0x41, 0x7c,
-    0x1e, 0xaf, 0x91, 0x7a, 0xea, 0x99, 0x24, 0x1c, 0x7a, 0x60, 0x15, 0xc3,
-    0xe7, 0xe6, 0xe5, 0x73, 0x6e, 0x2c, 0x80, 0x00, 0x68, 0xc3, 0x24, 0x6f,
-    0x29, 0x3c, 0x3c, 0xfa, 0xc8, 0x86, 0x89, 0x01, 0x8d, 0x81, 0xe4, 0xd6,
-    0xc3, 0xb4, 0x82, 0x19, 0x1e, 0x8b, 0xcb, 0x19, 0x72, 0xe0, 0x2c, 0x52,
-    0x7d, 0x3f, 0xf5, 0xfd, 0xe7, 0x5b, 0xe5, 0xf9, 0x0d, 0x52, 0x94, 0x9b,
-    0xa1, 0x20, 0x91, 0x27, 0xf3, 0x14, 0x30, 0x55, 0xaa, 0x2f, 0xed, 0xcb,
-    0x9f, 0xe1, 0x9f, 0xea, 0x7e, 0xe2, 0x7c, 0x27, 0xc9, 0xb8, 0xb5, 0x9f,
-    0x51, 0x51, 0xd4, 0x54, 0x22, 0x08, 0xc1, 0x47, 0x1b, 0xe4, 0xea, 0x6a,
-    0xca, 0x6c, 0x2c, 0xaa, 0x9d, 0xcb, 0x48, 0x40, 0x0f, 0x3c, 0x7e, 0x82,
-    0x5f, 0x31, 0x1c, 0x7d, 0x10, 0x3c, 0x3b, 0x1f, 0xa2, 0x2f, 0x37, 0x5b,
-    0xa2, 0xd9, 0xd8, 0xc5, 0xd9, 0x71, 0xe5, 0x6d, 0x9e, 0xb3, 0x1b, 0x1b,
-    0x59, 0x2d, 0x75, 0x91, 0x05, 0xb5, 0x92, 0x6c, 0x51, 0x08, 0x36, 0xf1,
-    0x9e, 0x4b, 0x00, 0x10, 0x5f, 0x52, 0x11, 0x02, 0x89, 0x81, 0x47, 0x2b,
-    0xa0, 0x63, 0xb3, 0xdb, 0xf2, 0xe1, 0xfe, 0xb0, 0xd6, 0xc3, 0x7d, 0xe1,
-    0x79, 0xa9, 0xcd, 0xc0, 0xe9, 0xa1, 0x2b, 0xa4, 0x32, 0x40, 0x87, 0x9b,
-    0xf0, 0x50, 0x17, 0x05, 0x03, 0xb9, 0xf5, 0x24, 0x4e, 0xbc, 0x8a, 0x08,
-    0x66, 0x1c, 0x1b, 0xd3, 0x80, 0xac, 0x0c, 0xd0, 0x9b, 0x68, 0x04, 0xcc,
-    0x1b, 0x0a, 0x92, 0xab, 0xfb, 0x08, 0xd1, 0x64, 0x83, 0xcd, 0xd2, 0xd6,
-    0xf9, 0xa7, 0xe6, 0xa6, 0x8c, 0xca, 0xed, 0x7a, 0xe8, 0x52, 0xd8, 0xbd,
-    0x42, 0xfb, 0x57, 0x72, 0x22, 0x19, 0x70, 0xe2, 0xba, 0xa1, 0xeb, 0xee,
-    0xb0, 0xc6, 0x24, 0x25, 0x68, 0x95, 0x36, 0xc0, 0x9d, 0xaf, 0xb3, 0x24,
-    0xf5, 0x80, 0x4d, 0x8b, 0x59, 0xe3, 0x11, 0x93, 0x82, 0x60, 0xf2, 0x98,
-    0x4e, 0x7a, 0x8c, 0x6a, 0x1f, 0x64, 0x1d, 0xe9, 0xb3, 0xf7, 0x98, 0x05,
-    0x01, 0x9b, 0x22, 0x7d, 0x5f, 0x0a, 0x19, 0x3a, 0xa7, 0xa5, 0x43, 0x14,
-    0xc6, 0x5d, 0x77, 0x74, 0x1e, 0xc0, 0xfc, 0x1b, 0xbe, 0xe4, 0x8b, 0x80,
-    0x1c, 0xfb, 0xdc, 0x3d, 0x27, 0xf2, 0x58, 0x60, 0xc2, 0xe3, 0x4a, 0x8b,
-    0x72, 0xf1, 0xf5, 0x8d, 0xd9, 0xde, 0x16, 0x9a, 0x32, 0x6e, 0x4e, 0xed,
-    0x39, 0x17, 0x0e, 0xbe, 0xca, 0x7e, 0x68, 0x74, 0x02, 0xea, 0xff, 0xad,
-    0x34, 0xd2, 0xbf, 0xd1, 0xa0, 0x51, 0x6e, 0x26, 0xb7, 0xc6, 0xfa, 0xd0,
-    0xb5, 0x5d, 0x7b, 0xb3, 0xac, 0x96, 0xda, 0x4d, 0xa5, 0x8a, 0x07, 0x95,
-    0xd5, 0x3e, 0x07, 0x61, 0x69, 0x6c, 0x41, 0x15, 0x83, 0xf3, 0x0f, 0x50,
-    0x36, 0x56, 0x2b, 0x16, 0x3c, 0x0a, 0xe6, 0xb4, 0x42, 0x76, 0x6e, 0xa2,
-    0x11, 0x1e, 0x6c, 0xae, 0xa5, 0xb3, 0xe3, 0x9c, 0xbb, 0x12, 0xe0, 0x03,
-    0xd5, 0x18, 0xb1, 0xec, 0x77, 0xda, 0x0c, 0x54, 0x97, 0xc9, 0x3f, 0x48,
-    0x2d, 0x10, 0xe0, 0x37, 0x01, 0x30, 0x66, 0x18, 0x45, 0xe1, 0x70, 0x13,
-    0x8b, 0x74, 0x22, 0x8c, 0x06, 0x09, 0x2d, 0xbe, 0xcf, 0x88, 0xe2, 0x44,
-    0x3a, 0xee, 0x4e, 0x7d, 0x64, 0xfb, 0x63, 0xe0, 0x76, 0x9e, 0xec, 0x99,
-    0x81, 0x6b, 0x20, 0x0f, 0x6c, 0x4b, 0xa5, 0x83, 0xd0, 0x34, 0x60, 0xc2,
-    0xd4, 0xe1, 0x49, 0x5f, 0x77, 0xa0, 0x47, 0xf9, 0xf0, 0x0e, 0xc5, 0x04,
-    0x6c, 0xe6, 0x4d, 0x3c, 0xb5, 0x31, 0x4d, 0x83, 0x12, 0x3d, 0x41, 0x40,
-    0x74, 0xd8, 0x80, 0x7a, 0x56, 0x3b, 0x54, 0xbb, 0x37, 0xa8, 0xc8, 0x48,
-    0xc0, 0x32, 0x89, 0x8f, 0x94, 0x8b, 0x8e, 0x8b, 0x1a, 0xb8, 0x52, 0x22,
-    0x77, 0xe5, 0x0f, 0xea, 0x0c, 0x15, 0x21, 0x4d, 0x96, 0xb2, 0x9b, 0xd1,
-    0x5b, 0x72, 0xae, 0xdf, 0x6e, 0x71, 0x2b, 0x51, 0x67, 0x6c, 0xbc, 0xf6,
-    0x25, 0x21, 0xd3, 0x70, 0x6e, 0x35, 0x98, 0x1c, 0x3e, 0xe0, 0xb1, 0x36,
-    0xf5, 0x8a, 0x33, 0x22, 0xbf, 0xcc, 0xff, 0x22, 0xa9, 0x2c, 0xd6, 0x96,
-    0x21, 0xc7, 0xeb, 0xf2, 0x1e, 0xf1, 0x8c, 0x2f, 0x8f, 0x64, 0xea, 0x9d,
-    0x94, 0xa8, 0xb2, 0x10, 0x54, 0x22, 0x7a, 0xa8, 0x3f, 0xed, 0xd2, 0xcf,
-    0x98, 0x76, 0xe5, 0x0f, 0x2d, 0x87, 0x28, 0xbe, 0xf1, 0x97, 0x51, 0xe9,
-    0xcf, 0x7a, 0x00, 0x3c, 0x24, 0x2e, 0x93, 0x91, 0x4b, 0x2e, 0x6a, 0x94,
-    0x41, 0xf2, 0x91, 0x53, 0x52, 0x4e, 0xc1, 0xaa, 0x13, 0xc9, 0xc8, 0x95,
-    0xef, 0x02, 0x93, 0xa2, 0x88, 0x55, 0x13, 0x74, 0xa1, 0xd0, 0x41, 0x74,
-    0xad, 0x6b, 0xf9, 0xca, 0xae, 0x63, 0x59, 0xe3, 0x14, 0x6a, 0xab, 0x62,
-    0x03, 0xa0, 0xca, 0x29, 0x16, 0x75, 0xa3, 0x62, 0x20, 0x37, 0x46, 0x74,
-    0x49, 0xab, 0xe9, 0xf1, 0x35, 0xf4, 0xd6, 0x03, 0xcd, 0xed, 0x80, 0x6c,
-    0xe3, 0x05, 0x06, 0x1a, 0x03, 0x37, 0x7c, 0x39, 0xc5, 0x1f, 0x62, 0xfe,
-    0x11, 0x76, 0xc7, 0x93, 0x38, 0xc8, 0xdf, 0x8e, 0x2d, 0x69, 0xc5, 0x3b,
-    0x23, 0xd0, 0x3e, 0xae, 0xd8, 0x2f, 0x3f, 0x10, 0x9c, 0x02, 0xec, 0xb4,
-    0x44, 0xe0, 0x88, 0xfc, 0x5f, 0x45, 0x3e, 0x0f, 0xf4, 0xfe, 0x3e, 0x2e,
-    0x27, 0x5d, 0x8a, 0x60, 0xf6, 0x30, 0x1a, 0x17, 0xb2, 0xfc, 0x40, 0x44,
-    0x5c, 0x6b, 0x45, 0x3c, 0xcf, 0x5f, 0x83, 0x42, 0x52, 0x14, 0x61, 0x23,
-    0x30, 0xc6, 0xf4, 0x30, 0x1f, 0xf7, 0x55, 0xef, 0x05, 0xba, 0x4d, 0xec,
-    0x67, 0xf7, 0x14, 0x54, 0x23, 0x83, 0x59, 0x2a, 0x7a, 0xe2, 0xc6, 0xc2,
-    0xd9, 0x0b, 0x1e, 0x74, 0xdc, 0x50, 0xf3, 0x53, 0xbb, 0x9a, 0x0f, 0xb3,
-    0x93, 0xc7, 0xeb, 0x7a, 0xb7, 0x5c, 0x99, 0xbe, 0x5f, 0x03, 0xc2, 0xd8,
-    0xfb, 0x1a, 0x54, 0x86, 0x17, 0xa1, 0x69, 0x69, 0xba, 0x27, 0x91, 0xa9,
-    0xd5, 0x93, 0x62, 0x38, 0xa9, 0xa4, 0x39, 0x3e, 0x39, 0x06, 0x72, 0x1e,
-    0xfc, 0x97, 0x01, 0x41, 0xeb, 0x4b, 0xc6, 0x50, 0x64, 0x9f, 0x89, 0xd8,
-    0xde, 0x61, 0x16, 0xa1, 0x29, 0xbf, 0x03, 0x92, 0x73, 0x87, 0x47, 0xb6,
-    0x86, 0xed, 0x76, 0x23, 0xb7, 0x9c, 0x6a, 0x4e, 0x89, 0x23, 0x7a, 0xd8,
-    0x5c, 0xfa, 0xf7, 0x9c, 0x4a, 0x9e, 0x95, 0x7e, 0x09, 0x62, 0x8c, 0x0f,
-    0x82, 0x5f, 0xc3, 0x6c, 0x07, 0x06, 0xba, 0x90, 0x03, 0x5d, 0x04, 0x98,
-    0x09, 0xa9, 0x81, 0xfb, 0xe5, 0xe3, 0x5d, 0xd0, 0x78, 0x0f, 0x5a, 0xb9,
-    0xbc, 0x35, 0x20, 0xc9, 0x07, 0x10, 0xfb, 0x3b, 0x11, 0x0c, 0xb5, 0x93,
-    0x21, 0x6b, 0xe6, 0x41, 0x69, 0x36, 0x26, 0x3f, 0x14, 0x2a, 0x11, 0x77,
-    0x70, 0xa0, 0x29, 0x80, 0x34, 0x11, 0xea, 0x6a, 0x74, 0xad, 0x1a, 0xd7,
-    0xae, 0x10, 0x41, 0x3d, 0xe4, 0x56, 0xa4, 0x53, 0x65, 0x4b, 0xf7, 0x14,
-    0x9b, 0xad, 0xfa, 0xbd, 0x5a, 0xcd, 0x6a, 0xae, 0xde, 0x80, 0x39, 0x72,
-    0x45, 0xa0, 0x0d, 0x52, 0xfe, 0x27, 0x1e, 0x8f, 0x8d, 0xbe, 0x6b, 0xf9,
-    0x98, 0xb6, 0x2b, 0x1f, 0x4a, 0x28, 0x9d, 0xd0, 0x0f, 0xfc, 0xfb, 0x53,
-    0xf4, 0xec, 0x72, 0xbe, 0x77, 0x25, 0x94, 0x64, 0x4d, 0xcf, 0x13, 0xc2,
-    0x7b, 0xf7, 0x63, 0xb1, 0xb3, 0x7b, 0x65, 0x97, 0xdf, 0x52, 0x5d, 0x94,
-    0x2b, 0xf6, 0xd0, 0xe5, 0x7b, 0x5a, 0xb9, 0x5b, 0xb9, 0x50, 0x0f, 0x4e,
-    0x2b, 0xb7, 0xf3, 0x95, 0x90, 0x18, 0x3b, 0x1e, 0xe8, 0x69, 0x0e, 0x2a,
-    0x6a, 0xfe, 0xce, 0xa9, 0xd0, 0xc1, 0x40, 0x47, 0x00, 0x7a, 0xe6, 0x80,
-    0x96, 0x92, 0xd8, 0x58, 0xea, 0x46, 0x85, 0xbf, 0x7d, 0xa1, 0xe2, 0xa8,
-    0xbc, 0x0a, 0x2b, 0xb9, 0xaa, 0x3c, 0x05, 0x83, 0x53, 0xb9, 0xf4, 0x40,
-    0x11, 0x66, 0xa7, 0x8f, 0x59, 0xfa, 0x69, 0x74, 0x5a, 0x09, 0x6f, 0xcc,
-    0x08, 0x70, 0x01, 0x40, 0x71, 0xa2, 0xf3, 0x53, 0x19, 0xfa, 0xb3, 0x5e,
-    0x57, 0x96, 0x8b, 0xb9, 0x71, 0x4a, 0xd8, 0x73, 0x3a, 0x7c, 0x84, 0x58,
-    0x52, 0xb7, 0x47, 0x4c, 0xfb, 0x31, 0x33, 0xf5, 0x72, 0xb2, 0x7c, 0xb6,
-    0x98, 0xba, 0x4d, 0x60, 0x52, 0x83, 0xd9, 0x2d, 0xb1, 0x09, 0x33, 0x2a,
-    0x07, 0x84, 0xc8, 0x58, 0xfb, 0xd5, 0x66, 0xf0, 0x17, 0x99, 0x3f, 0x18,
-    0x5a, 0x91, 0x30, 0xbd, 0xa5, 0x1c, 0x12, 0x73, 0x75, 0xab, 0xca, 0x72,
-    0x03, 0x54, 0x2f, 0x35, 0xcd, 0x84, 0x55, 0x46, 0x43, 0xdd, 0xb1, 0xcc,
-    0x51, 0x44, 0x82, 0xc2, 0x13, 0xd8, 0xb0, 0x41, 0xd7, 0xb2, 0x65, 0x54,
-    0xae, 0xc3, 0xb6, 0x42, 0x4f, 0x49, 0xfd, 0x42, 0x0e, 0xdf, 0xb5, 0x5c,
-    0xcc, 0x1b, 0x14, 0x50, 0x8f, 0x5e, 0x0d, 0xd6, 0x7e, 0xf4, 0x72, 0xa8,
-    0x6b, 0x75, 0x3d, 0xbf, 0x3c, 0x7a, 0x3d, 0xd8, 0x74, 0xf3, 0x82, 0x02,
-    0x25, 0xfd, 0x2b, 0x5f, 0x50, 0xfd, 0x6b, 0x04, 0x75, 0x2b, 0xdb, 0x6a,
-    0x2a, 0xe1, 0x1d, 0x08, 0xb3, 0x4f, 0x57, 0x64, 0x84, 0x77, 0xb8, 0xd6,
-    0x67, 0xf2, 0xe8, 0xb3, 0x08, 0x34, 0x97, 0x26, 0x04, 0x92, 0x95, 0x3f,
-    0xd4, 0xf5, 0x82, 0xb0, 0x56, 0x8f, 0x6a, 0x81, 0x89, 0x1a, 0x50, 0x44,
-    0xe7, 0xe2, 0xdf, 0x4e, 0x33, 0x7e, 0x3c, 0xe5, 0x73, 0x65, 0xa7, 0xbe,
-    0x85, 0x05, 0xe4, 0x0e, 0x92, 0x21, 0x10, 0xda, 0xd1, 0xc6, 0xda, 0x58,
-    0x43, 0x54, 0x27, 0xbd, 0x6a, 0x47, 0xaf, 0xcd, 0x48, 0x9b, 0xa4, 0x06,
-    0xca, 0x0f, 0xc9, 0xf3, 0x18, 0x6c, 0xd9, 0x8a, 0x34, 0x91, 0x87, 0x9a,
-    0xd1, 0x4c, 0xd4, 0x76, 0x8f, 0x51, 0xe8, 0xd6, 0x52, 0xe3, 0x7c, 0x67,
-    0x38, 0xb8, 0x37, 0xfa, 0x46, 0xa4, 0x47, 0xaa, 0x6c, 0x6e, 0xc5, 0x6a,
-    0xc5, 0x3d, 0x8c, 0x03, 0x3c, 0x91, 0x11, 0x5b, 0x50, 0xd6, 0xf0, 0xdf,
-    0xde, 0xae, 0x35, 0xc8, 0x1a, 0x52, 0xb5, 0x12, 0x89, 0xae, 0xac, 0x52,
-    0xeb, 0xb0, 0x0e, 0x77, 0x40, 0x74, 0xa1, 0x68, 0x8d, 0x31, 0x2b, 0x31,
-    0x2e, 0x83, 0xbe, 0x39, 0xd9, 0x07, 0x67, 0x66, 0xd4, 0xfa, 0x79, 0x93,
-    0x9b, 0x54, 0xc7, 0x22, 0x79, 0x1d, 0x5d, 0xdb, 0xdd, 0xb5, 0xbb, 0x85,
-    0x01, 0x67, 0xb4, 0xb0, 0x5a, 0x90, 0xd6, 0x38, 0xdc, 0x59, 0x7e, 0xde,
-    0x08, 0xbf, 0x2b, 0x83, 0xd4, 0x3c, 0xcf, 0xe2, 0xde, 0x9a, 0x0c, 0xa4,
-    0xdb, 0x30, 0x3d, 0x73, 0xc9, 0xb9, 0xe0, 0xee, 0x24, 0xe7, 0x61, 0x41,
-    0x39, 0xa6, 0xea, 0x7a, 0x26, 0xe8, 0x94, 0xaa, 0x78, 0xa5, 0x8e, 0xc8,
-    0x00, 0x31, 0x0c, 0xff, 0x08, 0xed, 0x1c, 0xd6, 0x4b, 0x25, 0x7b, 0xe5,
-    0x90, 0xcc, 0x55, 0x49, 0x80, 0xb3, 0xf5, 0xc8, 0xb0, 0x06, 0x36, 0x0e,
-    0x10, 0xa2, 0xf7, 0xfd, 0x01, 0x42, 0x73, 0x58, 0x3d, 0x4b, 0xc7, 0xf0,
-    0xc5, 0x1d, 0x8d, 0xf0, 0xc1, 0x3d, 0x25, 0x36, 0xa0, 0xb1, 0x20, 0xe6,
-    0xcb, 0x2c, 0xa2, 0xf8, 0xaf, 0x7d, 0x0e, 0x04, 0x76, 0x1e, 0x19, 0x9e,
-    0x2a, 0x0a, 0xea, 0x11, 0x87, 0x31, 0x75, 0x0c, 0x62, 0x53, 0x16, 0x9c,
-    0x49, 0x10, 0x55, 0x37, 0xb4, 0x60, 0x05, 0xa4, 0xcd, 0x0d, 0x3d, 0x7b,
-    0x04, 0x62, 0x15, 0x89, 0x27, 0x0d, 0xf3, 0x2d, 0xe2, 0x5a, 0x52, 0x4a,
-    0x87, 0xcb, 0xee, 0x1f, 0x6c, 0x5e, 0x66, 0x22, 0x38, 0x74, 0xc8, 0xb8,
-    0x47, 0x12, 0x4f, 0x95, 0x4b, 0x7e, 0xae, 0xcf, 0xcf, 0x74, 0x3c, 0xa5,
-    0x40, 0x8d, 0xea, 0x24, 0xf0, 0xa0, 0xca, 0x58, 0x9f, 0x92, 0xa5, 0xab,
-    0x95, 0x8c, 0x8c, 0x2a, 0x43, 0xad, 0x2e, 0xd4, 0xcc, 0x22, 0xab, 0xaf,
-    0x38, 0x91, 0xaa, 0xfa, 0x1e, 0xb1, 0xd3, 0xb0, 0xed, 0x4c, 0x2d, 0x8f,
-    0x0a, 0xbc, 0x54, 0xa5, 0xc6, 0x94, 0xb3, 0x08, 0x14, 0xcc, 0x18, 0x56,
-    0x84, 0x5e, 0x33, 0xe1, 0x2e, 0xc3, 0x73, 0x42, 0xcc, 0x22, 0x97, 0x2e,
-    0xf9, 0xd4, 0xc3, 0x3e, 0xe5, 0x90, 0xa3, 0x47, 0x44, 0xc6, 0x6f, 0xb4,
-    0x86, 0x72, 0x30, 0xb5, 0xac, 0xf0, 0x24, 0x63, 0xb2, 0xa4, 0xbb, 0x43,
-    0x8a, 0x4f, 0xb3, 0x8a, 0x7e, 0xdd, 0xca, 0xeb, 0xf0, 0x55, 0xc5, 0xdf,
-    0x3e, 0xc0, 0x53, 0xe9, 0x02, 0x94, 0xd7, 0x17, 0xc2, 0x35, 0x8d, 0xc1,
-    0xaf, 0xe9, 0xf6, 0xb6, 0x1e, 0x1e, 0xea, 0xdf, 0x23, 0x51, 0x54, 0xfe,
-    0xea, 0x3c, 0xea, 0x01, 0x52, 0x30, 0xe5, 0x80, 0xa9, 0x82, 0xda, 0x71,
-    0x42, 0xf1, 0x5d, 0xd0, 0x4a, 0x29, 0xc5, 0x60, 0xa7, 0x14, 0xaf, 0x5c,
-    0x06, 0xc6, 0x84, 0xb7, 0x84, 0x75, 0x5f, 0xf3, 0x91, 0xd5, 0xca, 0x7d,
-    0xff, 0xf2, 0xc7, 0xd7, 0xef, 0x3e, 0xb8, 0x5b, 0x6a, 0xb6, 0x4e, 0xb3,
-    0x18, 0x68, 0x57, 0x92, 0x2b, 0x87, 0xdc, 0x66, 0xbb, 0xd7, 0xf1, 0x4d,
-    0xcc, 0x2f, 0x8c, 0xf2, 0x56, 0x58, 0x86, 0x75, 0x8a, 0x7c, 0xe4, 0x57,
-    0x1e, 0xc5, 0x6e, 0xb6, 0x04, 0x6a, 0x95, 0x27, 0x65, 0x43, 0x23, 0x0d,
-    0xac, 0xe7, 0x32, 0x5e, 0x4c, 0xcb, 0x9f, 0x13, 0xb6, 0x0c, 0x47, 0x03,
-    0xd6, 0x65, 0x60, 0xb7, 0x57, 0xd1, 0x77, 0xb5, 0x1b, 0x91, 0x14, 0x27,
-    0xee, 0xf6, 0x47, 0x82, 0x81, 0x4d, 0xdf, 0x71, 0x3f, 0x64, 0xa0, 0x32,
-    0x72, 0x28, 0xba, 0x3b, 0x5e, 0x3c, 0x74, 0x39, 0x2c, 0x21, 0xf3, 0x1b,
-    0x22, 0x4c, 0xff, 0x3c, 0xb2, 0x7b, 0x56, 0x7d, 0x20, 0x38, 0xa1, 0xe7,
-    0x91, 0x46, 0x03, 0x68, 0xf8, 0xa9, 0xfb, 0x5b, 0x1d, 0xac, 0x17, 0x8d,
-    0x95, 0x6f, 0x1c, 0x0f, 0x8a, 0x17, 0x69, 0xf2, 0x7b, 0xf4, 0x1e, 0x3e,
-    0x00, 0xae, 0x0c, 0xdf, 0xb2, 0x4f, 0xfe, 0x60, 0x64, 0x59, 0x45, 0x77,
-    0x81, 0x20, 0x99, 0xe8, 0x53, 0xb0, 0x5c, 0xd7, 0x72, 0x6f, 0xd4, 0xfd,
-    0x8d, 0x72, 0xc7, 0x01, 0x3f, 0x03, 0x05, 0x16, 0x36, 0xea, 0x3e, 0x01,
-    0xa3, 0x1e, 0xfe, 0x8d, 0xc6, 0xca, 0x21, 0xde, 0x54, 0xb9, 0xef, 0x3a,
-    0xd1, 0x48, 0xf4, 0xd3, 0x1f, 0xc9, 0x98, 0x02, 0xfb, 0xf1, 0x23, 0x62,
-    0xb0, 0xc1, 0xda, 0xdd, 0x56, 0x79, 0x59, 0x0e, 0x76, 0x14, 0xc8, 0x11,
-    0x4f, 0x82, 0xfd, 0x6e, 0x5a, 0xf8, 0x9c, 0x27, 0x7b, 0x19, 0x60, 0x4a,
-    0x0a, 0xea, 0xa1, 0x7a, 0x8d, 0x71, 0x18, 0xfe, 0x6b, 0xe5, 0xf8, 0x60,
-    0xf4, 0x54, 0x0c, 0x1b, 0xf4, 0x54, 0xd0, 0x55, 0xbb, 0x5f, 0x3b, 0x43,
-    0x50, 0xbe, 0xb1, 0x82, 0x43, 0x77, 0x1b, 0xf9, 0x7d, 0x0d, 0x79, 0x17,
-    0xc1, 0x3b, 0x3d, 0x9b, 0x70, 0x73, 0xf7, 0xec, 0xbc, 0xe9, 0x99, 0x51,
-    0x66, 0x0c, 0xab, 0x03, 0xc5, 0x92, 0x90, 0x80, 0xa1, 0x47, 0x03, 0xe5,
-    0x13, 0xe6, 0xa4, 0x05, 0x1a, 0xa5, 0x52, 0x76, 0x15, 0x3e, 0x65, 0x03,
-    0x5f, 0x98, 0x20, 0x93, 0x4a, 0x7d, 0x00, 0x0d, 0x06, 0x14, 0x52, 0x2e,
-    0x5d, 0x2a, 0x29, 0x18, 0x60, 0x27, 0x9d, 0x64, 0xe8, 0x77, 0x48, 0x39,
-    0x4e, 0x79, 0x78, 0xfd, 0x40, 0xea, 0xba, 0x6e, 0xb7, 0x32, 0x91, 0xef,
-    0x81, 0x13, 0xa0, 0x42, 0x93, 0x16, 0x61, 0x1d, 0x88, 0x4c, 0xf1, 0x6a,
-    0x9e, 0x5f, 0x9b, 0x15, 0xeb, 0x96, 0x7b, 0x9b, 0x0e, 0x22, 0xe3, 0x14,
-    0x0f, 0xb8, 0xd0, 0x55, 0x49, 0xb1, 0xac, 0x30, 0x97, 0xad, 0x2d, 0xa6,
-    0xdd, 0x9b, 0xac, 0x6a, 0xbf, 0x20, 0xe7, 0x1f, 0xd4, 0xcd, 0xb9, 0x17,
-    0x50, 0xbd, 0xf9, 0x98, 0xa0, 0xc5, 0x84, 0x21, 0x99, 0x41, 0x11, 0x2c,
-    0xa4, 0xaf, 0x61, 0xe2, 0x25, 0x7e, 0x30, 0x8a, 0x4e, 0xcf, 0x52, 0x3c,
-    0x4b, 0xc4, 0x3f, 0x18, 0xa2, 0x3d, 0x28, 0x6b, 0x9d, 0x7d, 0xd7, 0x6f,
-    0xe3, 0x30, 0x74, 0x35, 0x0a, 0xb9, 0x7b, 0x75, 0xe7, 0x60, 0xea, 0x49,
-    0x0e, 0x25, 0xa3, 0xfa, 0xc5, 0x1d, 0x9b, 0x94, 0x8c, 0xf7, 0x41, 0x8a,
-    0x91, 0x7f, 0x80, 0x1f, 0x04, 0xca, 0x18, 0xfe, 0xd2, 0x82, 0x5e, 0x90,
-    0x3b, 0xcf, 0xe2, 0xf7, 0xef, 0x92, 0x77, 0x89, 0x8d, 0x3f, 0x80, 0xb0,
-    0x61, 0x52, 0x45, 0xc0, 0x0b, 0x45, 0x4c, 0x38, 0x8c, 0x30, 0xf8, 0xdc,
-    0x88, 0x72, 0x61, 0x28, 0x7a, 0x41, 0x63, 0xb0, 0x86, 0xb9, 0xd5, 0x07,
-    0xff, 0x9c, 0x73, 0x79, 0xa8, 0x65, 0x4c, 0xa3, 0x02, 0x98, 0x08, 0x83,
-    0xc9, 0x01, 0x7d, 0xdd, 0xde, 0x45, 0x0d, 0xb6, 0x54, 0x46, 0x37, 0x28,
-    0x42, 0x40, 0xf8, 0xbc, 0x9e, 0xd1, 0xb3, 0x3c, 0x25, 0x19, 0xf9, 0xf1,
-    0x15, 0xfd, 0xdc, 0xd4, 0x7b, 0xd0, 0xb9, 0xe6, 0x6c, 0x0c, 0x22, 0xe8,
-    0x1e, 0xf6, 0x2a, 0x2e, 0xe3, 0x28, 0x13, 0x16, 0x6b, 0x2e, 0x26, 0x01,
-    0x80, 0xef, 0x7e, 0x82, 0x49, 0x14, 0x51, 0x74, 0x37, 0xc4, 0x9b, 0xbc,
-    0xf0, 0xbf, 0x5a, 0x7c, 0x51, 0x89, 0xef, 0x57, 0xa1, 0xd1, 0x11, 0xf7,
-    0x6f, 0xe2, 0x0d, 0x6a, 0x86, 0x21, 0x75, 0xaf, 0x38, 0x2f, 0xf2, 0x30,
-    0x78, 0xbf, 0x80, 0xb1, 0x94, 0xa1, 0xd1, 0xdb, 0xc7, 0x40, 0x5d, 0x4a,
-    0xbb, 0x09, 0x50, 0xb1, 0xb8, 0x3e, 0x3d, 0x92, 0x91, 0xb0, 0x20, 0xef,
-    0x8d, 0xa8, 0x3c, 0x34, 0x0f, 0x12, 0x8c, 0xca, 0x68, 0x84, 0xeb, 0x8d,
-    0x01, 0x12, 0xc8, 0xeb, 0x39, 0x08, 0x02, 0x8c, 0xb5, 0x58, 0xf8, 0x1a,
-    0xa6, 0xcf, 0x78, 0xe0, 0x31, 0x6a, 0x00, 0xf2, 0x1c, 0x11, 0x03, 0x3b,
-    0x06, 0x74, 0xd2, 0xe3, 0xfa, 0x0f, 0xe2, 0x4b, 0x2c, 0xdb, 0xdb, 0x8b,
-    0x85, 0x63, 0xfa, 0xf4, 0x2c, 0x3b, 0x3f, 0x03, 0x0e, 0x7b, 0x1e, 0xb8,
-    0x5c, 0x28, 0x35, 0xe6, 0x8f, 0x77, 0xb9, 0xbb, 0x96, 0x32, 0x0f, 0x5d,
-    0x6e, 0x78, 0x57, 0xa3, 0x5a, 0x42, 0x89, 0x91, 0xc1, 0x6b, 0x6d, 0x11,
-    0x37, 0x1e, 0x4d, 0x5f, 0xf0, 0x8f, 0x04, 0x08, 0x09, 0x24, 0x5e, 0x21,
-    0x20, 0xfc, 0x8e, 0xc3, 0x9b, 0x8d, 0xc9, 0xc7, 0x09, 0xd4, 0x00, 0x2a,
-    0xa4, 0x1f, 0x4c, 0xed, 0x0e, 0x2e, 0x8e, 0xd4, 0x78, 0xef, 0x67, 0x80,
-    0xa4, 0x16, 0xd9, 0x35, 0x6a, 0xd4, 0xa1, 0x8a, 0x80, 0xee, 0xeb, 0x4a,
-    0x54, 0xa8, 0x91, 0x71, 0x1d, 0x90, 0x97, 0xec, 0x3d, 0xba, 0xc0, 0xba,
-    0xf8, 0x43, 0x7b, 0xef, 0xcb, 0x78, 0x36, 0x87, 0x71, 0x95, 0x54, 0x84,
-    0x41, 0xb8, 0x20, 0xf8, 0x96, 0xb8, 0xd5, 0x5e, 0x22, 0x05, 0x53, 0x35,
-    0xd5, 0x2d, 0x44, 0xa9, 0x66, 0x36, 0xde, 0x5a, 0xc4, 0x49, 0x90, 0x2c,
-    0xa0, 0x5d, 0x1f, 0x12, 0x62, 0x25, 0x5d, 0x25, 0x3f, 0x14, 0x0e, 0x39,
-    0x15, 0xcb, 0x10, 0x39, 0x1a, 0x99, 0xa4, 0x9e, 0x7a, 0x36, 0x48, 0x01,
-    0xe5, 0xa0, 0xff, 0x4e, 0xbd, 0xb8, 0x2c, 0x88, 0x17, 0xb4, 0xe5, 0xfb,
-    0x2c, 0x4f, 0xc0, 0x32, 0x8a, 0xa7, 0xb4, 0x4f, 0x61, 0xb9, 0x56, 0xc3,
-    0xf1, 0x13, 0x79, 0x3f, 0x18, 0x98, 0x14, 0x42, 0x01, 0xd6, 0x01, 0x2b,
-    0x27, 0xa5, 0x13, 0xd3, 0x95, 0xbc, 0xba, 0xe1, 0x57, 0x67, 0xb0, 0xcf,
-    0x3b, 0x50, 0xa2, 0xf6, 0x82, 0x5b, 0x71, 0x53, 0xb1, 0x0e, 0x62, 0xe7,
-    0x57, 0x81, 0x2f, 0xa2, 0xa9, 0x72, 0x91, 0x20, 0x58, 0x5a, 0xa4, 0x6c,
-    0xd3, 0x99, 0xba, 0x0e, 0x4e, 0xd1, 0xc9, 0x99, 0xe1, 0x3f, 0x69, 0xe4,
-    0x66, 0x29, 0xfd, 0x5c, 0x4e, 0x42, 0x77, 0xdd, 0x47, 0x60, 0x5c, 0xde,
-    0x53, 0x3a, 0x74, 0x65, 0x76, 0x70, 0x31, 0x5d, 0xe4, 0x22, 0x99, 0x2d,
-    0x4a, 0x17, 0xef, 0xf5, 0xdd, 0xcf, 0xb2, 0x45, 0xc1, 0xe8, 0xe7, 0x61,
-    0x42, 0x97, 0xbe, 0xf1, 0x01, 0x0d, 0x37, 0xa0, 0xcf, 0x29, 0x8b, 0x6f,
-    0x98, 0xcc, 0xc6, 0x06, 0x83, 0x0c, 0x54, 0xb2, 0x64, 0xf4, 0x39, 0xca,
-    0xba, 0x94, 0x39, 0x06, 0xc5, 0x43, 0x7e, 0x2f, 0xe6, 0xf2, 0x0b, 0xb1,
-    0x3b, 0x72, 0xbf, 0xc7, 0x4f, 0x02, 0x5e, 0xe1, 0x22, 0x1e, 0xe2, 0x57,
-    0x74, 0x8f, 0xf1, 0x96, 0xd7, 0x32, 0x42, 0x75, 0xb6, 0x86, 0x02, 0x93,
-    0x6d, 0xd5, 0xf8, 0xd9, 0xd7, 0x8e, 0x4f, 0xb6, 0xb7, 0x6f, 0xcd, 0xfb,
-    0x43, 0x7d, 0xf2, 0xd5, 0x5f, 0x90, 0x03, 0x98, 0xb3, 0x44, 0x0b, 0x22,
-    0x0b, 0xdc, 0x85, 0x3d, 0x1d, 0xca, 0x18, 0x7a, 0xcf, 0xec, 0x09, 0x14,
-    0x70, 0x05, 0xb3, 0xe5, 0xee, 0xe5, 0x5c, 0x47, 0x98, 0xf0, 0x4b, 0x90,
-    0x09, 0xba, 0x2a, 0x59, 0x15, 0xe2, 0x9e, 0x0e, 0x81, 0xe9, 0x2c, 0x52,
-    0x7e, 0x37, 0x09, 0x37, 0x1d, 0x36, 0x5a, 0xae, 0x46, 0x0c, 0x89, 0x0a,
-    0x21, 0x46, 0x9e, 0x85, 0x22, 0x5b, 0x56, 0x1b, 0x94, 0x93, 0x3c, 0x5b,
-    0xd2, 0x1d, 0x3a, 0x34, 0x16, 0x28, 0x2c, 0xdd, 0x73, 0xd9, 0xed, 0x9c,
-    0x8e, 0x5f, 0x9c, 0xea, 0xb9, 0x08, 0x8c, 0x31, 0x44, 0x61, 0x80, 0xf7,
-    0x7b, 0xdb, 0xae, 0x57, 0x70, 0x3b, 0x4c, 0xe6, 0x8a, 0x06, 0x8b, 0xb4,
-    0xd1, 0xc4, 0x68, 0x70, 0x79, 0x29, 0x82, 0xee, 0xa9, 0x3e, 0x28, 0xd9,
-    0x46, 0xff, 0x8a, 0xe3, 0x4c, 0x1b, 0x01, 0x18, 0xe8, 0x9e, 0xcf, 0x4f,
-    0x2a, 0x8a, 0x26, 0xb0, 0xf1, 0x5a, 0xca, 0x7b, 0x4b, 0xf6, 0x1e, 0x7a,
-    0xe2, 0x77, 0xff, 0xc5, 0xaf, 0x78, 0xaf, 0x14, 0x22, 0x7e, 0xb2, 0x9a,
-    0xc6, 0x77, 0x2c, 0x3f, 0xfb, 0xe5, 0xd7, 0xf3, 0x27, 0x2b, 0x71, 0x71,
-    0x16, 0x10, 0x83, 0x0c, 0x4e, 0xcc, 0xf3, 0x77, 0x03, 0xc0, 0x19, 0x5d,
-    0x94, 0x80, 0x7e, 0xda, 0xa0, 0x64, 0x37, 0x40, 0xd9, 0x62, 0x93, 0x6f,
-    0x58, 0x7b, 0x83, 0xdc, 0xe3, 0x0d, 0x8d, 0xfa, 0x96, 0x6a, 0xeb, 0xc1,
-    0x94, 0x1b, 0xf5, 0x53, 0x06, 0x05, 0xec, 0xa1, 0xdd, 0x90, 0xb7, 0x5c,
-    0xc4, 0x6e, 0x3c, 0xae, 0x19, 0xec, 0x89, 0xd6, 0x6e, 0x9a, 0xdc, 0x30,
-    0xfb, 0x1e, 0xd6, 0x8a, 0x0a, 0xb9, 0x31, 0xfc, 0x6a, 0x5e, 0x9e, 0xf6,
-    0x7c, 0x04, 0xf9, 0x98, 0x45, 0x54, 0x09, 0x9f, 0x7e, 0xf2, 0xd8, 0x0e,
-    0xeb, 0x39, 0x3f, 0xd0, 0x65, 0x96, 0x2a, 0xbe, 0x86, 0x20, 0x01, 0x0c,
-    0xc9, 0x2a, 0x63, 0x3c, 0x58, 0xe0, 0x43, 0x18, 0x4a, 0x38, 0x2a, 0x06,
-    0x6a, 0x22, 0x0d, 0x0d, 0x3d, 0x21, 0x97, 0x98, 0x79, 0xf0, 0xc2, 0x11,
-    0x0d, 0xbb, 0x41, 0x9b, 0x1e, 0x65, 0x8b, 0x1f, 0x7a, 0x18, 0x7b, 0xb9,
-    0x5a, 0x5d, 0x80, 0x4d, 0x88, 0x77, 0x8e, 0x80, 0xd9, 0x66, 0xc0, 0x6c,
-    0xb3, 0x28, 0x05, 0xa6, 0x97, 0x00, 0x62, 0xdd, 0xd1, 0x75, 0x5a, 0x62,
-    0xc1, 0x54, 0x4a, 0x37, 0x60, 0x79, 0x31, 0x14, 0xf1, 0x06, 0x94, 0xf3,
-    0x1e, 0x45, 0x95, 0x69, 0xf0, 0x02, 0xa2, 0xc7, 0x50, 0x5a, 0xd8, 0xec,
-    0x9a, 0x19, 0x08, 0x5c, 0x6e, 0x82, 0x05, 0x19, 0x98, 0xd5, 0x76, 0xad,
-    0x0c, 0x26, 0x09, 0x5a, 0x89, 0xb7, 0x68, 0xaa, 0x80, 0x30, 0x01, 0x7c,
-    0x6b, 0xa4, 0x24, 0xfd, 0xcf, 0xef, 0x8a, 0x20, 0x58, 0x90, 0xa2, 0xb9,
-    0x0c, 0xf2, 0xaa, 0xfc, 0x79, 0x20, 0x63, 0xe9, 0x40, 0x19, 0x34, 0xc9,
-    0xa9, 0xb8, 0x42, 0x49, 0xc7, 0x12, 0xc1, 0xfd, 0x68, 0x91, 0xa3, 0x19,
-    0xce, 0x95, 0xc8, 0x30, 0x0d, 0x10, 0x2b, 0xbe, 0x4d, 0x72, 0x90, 0x92,
-    0x39, 0x8c, 0xec, 0x81, 0x11, 0x90, 0xf9, 0x92, 0xdf, 0x04, 0xc0, 0x5f,
-    0xda, 0x58, 0x5c, 0x80, 0x77, 0x9a, 0x6b, 0x15, 0x32, 0xb8, 0x86, 0xb5,
-    0xa1, 0x3e, 0x9d, 0x02, 0xb4, 0x17, 0xab, 0x55, 0xc1, 0xc3, 0xe1, 0xf9,
-    0x9e, 0x5e, 0x5e, 0xaa, 0x68, 0x92, 0x4a, 0x8e, 0xac, 0x6f, 0x66, 0x49,
-    0x9b, 0x59, 0xd6, 0x9b, 0x59, 0x36, 0x37, 0x93, 0xd8, 0x4c, 0x1a, 0xb0,
-    0x7a, 0x27, 0x53, 0xda, 0x49, 0x26, 0x77, 0x92, 0x51, 0x08, 0xa0, 0xba,
-    0x55, 0xfc, 0x74, 0xdc, 0xb2, 0x55, 0xfe, 0xbd, 0x70, 0x1b, 0x09, 0x56,
-    0x57, 0x4d, 0x17, 0xc4, 0xe2, 0xd5, 0x15, 0xcb, 0xad, 0x98, 0x2d, 0xe2,
-    0xd3, 0x56, 0xab, 0xa9, 0x7e, 0xff, 0x0e, 0xe7, 0x3d, 0xed, 0x92, 0x74,
-    0x42, 0x07, 0x0d, 0xd7, 0x90, 0xb9, 0x96, 0xcb, 0xec, 0xb1, 0x07, 0x1c,
-    0x0f, 0xc8, 0x82, 0x01, 0x5b, 0xbd, 0xf9, 0x78, 0x13, 0x0f, 0x4a, 0xa0,
-    0x4a, 0xe7, 0x43, 0x35, 0x81, 0xd7, 0xdd, 0x31, 0x08, 0x0a, 0x63, 0x91,
-    0x69, 0x40, 0x57, 0x8b, 0x99, 0xd1, 0x8a, 0x70, 0x2e, 0xe2, 0xae, 0x88,
-    0x5c, 0xd6, 0x77, 0x71, 0x3a, 0x9e, 0x32, 0x79, 0x2b, 0x5b, 0x5f, 0xb2,
-    0x28, 0x8b, 0x2c, 0x61, 0xd5, 0xf5, 0x9d, 0xf7, 0x36, 0x37, 0x0f, 0x28,
-    0x88, 0x57, 0xb4, 0x21, 0x15, 0x20, 0x52, 0x3f, 0x4c, 0x2b, 0x30, 0x80,
-    0xaa, 0x29, 0x30, 0x17, 0x20, 0x22, 0x76, 0x18, 0xb5, 0xe0, 0x54, 0xb8,
-    0x24, 0x52, 0xdf, 0x7e, 0x9d, 0x07, 0x4d, 0x64, 0x2e, 0xed, 0xc0, 0x34,
-    0xdb, 0x4a, 0x1e, 0x32, 0x3b, 0xb6, 0xb7, 0xab, 0xa7, 0x74, 0x80, 0xc2,
-    0xd6, 0x81, 0x54, 0x56, 0x1c, 0xa9, 0xa5, 0xf0, 0x0f, 0x07, 0x55, 0x17,
-    0x07, 0x9f, 0xcf, 0x70, 0xf8, 0x93, 0x60, 0x0e, 0x77, 0x47, 0x3a, 0x8b,
-    0x94, 0x32, 0x49, 0x2b, 0x71, 0xc6, 0x17, 0x53, 0xfe, 0x51, 0x29, 0x27,
-    0x8e, 0x50, 0x4d, 0x9c, 0x4a, 0x31, 0x71, 0x2a, 0x25, 0xc7, 0x91, 0x7a,
-    0x8d, 0x53, 0xeb, 0x40, 0x4e, 0xad, 0xf7, 0x38, 0xa3, 0x49, 0x9c, 0x5e,
-    0xc1, 0x40, 0xc4, 0xfa, 0x9c, 0xcf, 0xec, 0x8e, 0x3a, 0x84, 0xbf, 0x20,
-    0x8f, 0x8a, 0x02, 0x3f, 0xa0, 0x5f, 0x66, 0xde, 0x29, 0xb3, 0x78, 0x27,
-    0xfd, 0xfb, 0xa9, 0xe9, 0x91, 0x2c, 0x37, 0x46, 0x6b, 0xa1, 0xf4, 0xa6,
-    0x98, 0x6e, 0xee, 0xa3, 0x13, 0xbb, 0x8d, 0xe7, 0xcd, 0x6b, 0xd4, 0x31,
-    0x68, 0xb7, 0x0c, 0x74, 0xe7, 0x58, 0x0e, 0xe8, 0x8e, 0xe1, 0x97, 0x3e,
-    0xed, 0x91, 0xb4, 0x5d, 0x2b, 0xd6, 0x2e, 0xe2, 0x6c, 0x69, 0xaf, 0x33,
-    0xb2, 0xb0, 0x5d, 0xa1, 0x9f, 0xe1, 0x51, 0xc4, 0x56, 0x0f, 0x95, 0x29,
-    0xe6, 0x4b, 0xcf, 0x58, 0xc2, 0xe3, 0xa5, 0xdc, 0x8b, 0xc5, 0xc5, 0xc5,
-    0x94, 0x15, 0x80, 0xe9, 0xc9, 0x10, 0x6a, 0x6d, 0xb1, 0xb3, 0xe4, 0x3c,
-    0x4c, 0xe1, 0x9f, 0x08, 0xbf, 0x06, 0xca, 0xc3, 0x0c, 0x49, 0x29, 0x90,
-    0x18, 0xb4, 0x84, 0xad, 0x9e, 0x1f, 0xdc, 0xe0, 0x15, 0x90, 0xb5, 0xa7,
-    0xfa, 0x65, 0x5e, 0x4c, 0x14, 0xc7, 0xcc, 0xab, 0x49, 0x53, 0xd9, 0xe8,
-    0x5e, 0x4d, 0xb3, 0x8b, 0x78, 0x3a, 0x04, 0xec, 0x04, 0x24, 0xfb, 0x69,
-    0x12, 0x20, 0x23, 0x8f, 0x01, 0x1b, 0x8b, 0xe8, 0xc5, 0x44, 0xe0, 0x29,
-    0xf0, 0xe2, 0x17, 0x68, 0xf9, 0x57, 0x80, 0x01, 0x76, 0x0c, 0xb8, 0x56,
-    0x58, 0x54, 0x7c, 0xaf, 0x62, 0x79, 0x03, 0x41, 0x16, 0xe8, 0x40, 0xa8,
-    0x55, 0xfe, 0xbf, 0x4f, 0x54, 0x85, 0x53, 0x04, 0x8a, 0xde, 0x56, 0xc6,
-    0x3a, 0x5e, 0x50, 0x62, 0x22, 0xd4, 0xf5, 0x3d, 0xf0, 0x64, 0x79, 0x93,
-    0x02, 0xdb, 0x00, 0xfb, 0xc3, 0xe2, 0x57, 0x13, 0xba, 0x74, 0xee, 0xc6,
-    0xd7, 0xf1, 0xed, 0x8b, 0xaa, 0xa2, 0x1b, 0x9c, 0x41, 0x9d, 0x73, 0x89,
-    0xde, 0x6a, 0x25, 0xb5, 0xb8, 0x9e, 0xc8, 0x77, 0x0a, 0x2c, 0xb8, 0xb3,
-    0x29, 0x95, 0x93, 0xc1, 0xeb, 0x11, 0xc5, 0x62, 0x34, 0x02, 0xa4, 0x73,
-    0xc1, 0xcc, 0x17, 0x9f, 0x7c, 0x2a, 0xe8, 0x15, 0xc9, 0x50, 0x24, 0x03,
-    0x53, 0xc2, 0x13, 0x83, 0x22, 0x9b, 0xde, 0xf0, 0x10, 0xd3, 0x04, 0x87,
-    0xc8, 0x70, 0x90, 0xe0, 0x15, 0x3e, 0x01, 0x91, 0x88, 0xd1, 0x45, 0x47,
-    0x20, 0x2a, 0xf0, 0x94, 0x13, 0x4a, 0xff, 0x31, 0xf1, 0xb2, 0x40, 0x7f,
-    0xc1, 0xe9, 0x75, 0x35, 0x99, 0xda, 0x5c, 0xce, 0x6b, 0xd8, 0x74, 0x09,
-    0xe9, 0xc5, 0x03, 0x15, 0x24, 0xaa, 0x4b, 0x92, 0x81, 0x68, 0x9f, 0x21,
-    0x73, 0xa5, 0xf1, 0xb3, 0xe0, 0x8c, 0x4a, 0xf8, 0xf8, 0x39, 0x4c, 0x85,
-    0xc6, 0xe7, 0x77, 0x30, 0xb1, 0x0c, 0x44, 0xeb, 0x6a, 0xc5, 0xf8, 0x04,
-    0xf8, 0xc2, 0xeb, 0x09, 0xfc, 0x63, 0x62, 0x3c, 0xe1, 0x51, 0x43, 0x63,
-    0x80, 0x5f, 0xfc, 0x39, 0x1d, 0x09, 0x02, 0x1a, 0x5f, 0x5d, 0xe4, 0x4b,
-    0x51, 0x81, 0xaf, 0x12, 0x86, 0xf0, 0x72, 0xd0, 0x0a, 0x04, 0x6a, 0xc1,
-    0xbe, 0x75, 0x3a, 0x80, 0x4b, 0xfc, 0xfd, 0x9d, 0xed, 0x6d, 0x9a, 0x1d,
-    0xa9, 0xea, 0x1c, 0x40, 0x74, 0x70, 0x56, 0x4f, 0xe5, 0xcd, 0x04, 0x6f,
-    0x0a, 0x57, 0xc9, 0xb7, 0x13, 0xed, 0x5d, 0x32, 0x7a, 0x38, 0xaa, 0x0c,
-    0xbd, 0x72, 0xc7, 0xdd, 0x76, 0x77, 0x98, 0xf2, 0x4e, 0xda, 0xd9, 0xf6,
-    0xf0, 0xfc, 0x7e, 0x2f, 0xe8, 0xaf, 0x77, 0x03, 0x77, 0xa8, 0x76, 0xf8,
-    0xae, 0x89, 0xf5, 0x30, 0x9b, 0xda, 0xf8, 0xa3, 0xab, 0x29, 0x38, 0xe1,
-    0x80, 0xbf, 0x7f, 0xc0, 0xd1, 0x17, 0x51, 0x5e, 0xad, 0x84, 0x72, 0x54,
-    0x54, 0x92, 0x15, 0xee, 0x17, 0xf9, 0x34, 0x2c, 0x79, 0x48, 0x1c, 0x0b,
-    0x04, 0x9a, 0x80, 0xc6, 0x80, 0x19, 0x68, 0x67, 0x84, 0x22, 0x54, 0xe5,
-    0xc7, 0x49, 0xf0, 0x7e, 0x12, 0x7c, 0x98, 0x44, 0x3b, 0x68, 0x81, 0xa0,
-    0x89, 0x1e, 0xfc, 0x34, 0x51, 0x9f, 0xa2, 0xfa, 0x79, 0x12, 0xed, 0x8a,
-    0x57, 0x0b, 0x3f, 0x5e, 0x9c, 0xfd, 0xeb, 0xf8, 0xfc, 0x6b, 0x6f, 0x18,
-    0x7a, 0xc3, 0xad, 0xe3, 0x8f, 0xbb, 0xe2, 0x2d, 0x43, 0xff, 0x98, 0xb2,
-    0xfd, 0xaf, 0xeb, 0x2c, 0x7c, 0xdb, 0xe9, 0x9f, 0x13, 0xfe, 0xb8, 0x13,
-    0xee, 0xd3, 0x0a, 0x75, 0x92, 0x64, 0x44, 0xdc, 0xde, 0xff, 0xa8, 0xf8,
-    0xb5, 0x77, 0x93, 0xe0, 0x97, 0xf6, 0x7a, 0xb7, 0xb3, 0x29, 0x54, 0xf8,
-    0x75, 0x12, 0xb9, 0x4a, 0xfe, 0xee, 0x75, 0x01, 0xa2, 0x36, 0xf8, 0x0d,
-    0x72, 0xc9, 0x49, 0xce, 0x5f, 0x84, 0x7a, 0x32, 0xe1, 0x8f, 0x59, 0x3d,
-    0xd9, 0x0d, 0x3e, 0x4d, 0xa2, 0x9f, 0x26, 0xe6, 0x0b, 0x49, 0xb1, 0xeb,
-    0x0f, 0x3e, 0x4d, 0xba, 0x93, 0x9c, 0x5d, 0xa2, 0x7f, 0x29, 0xe3, 0x7d,
-    0x51, 0x3a, 0xa8, 0xf6, 0x3f, 0xea, 0xd1, 0x37, 0x6c, 0x3c, 0xde, 0x34,
-    0x7e, 0x67, 0x88, 0x52, 0x72, 0xa0, 0xb9, 0xc8, 0x4c, 0x5d, 0x7a, 0x4c,
-    0xc2, 0xaf, 0x37, 0x0c, 0x9b, 0x60, 0x48, 0xa0, 0x64, 0x2b, 0x25, 0xa0,
-    0x28, 0x4e, 0x73, 0xfe, 0x12, 0x90, 0x12, 0x9f, 0x89, 0x04, 0xae, 0xe5,
-    0xe9, 0x7b, 0x86, 0x37, 0xbf, 0x30, 0xf6, 0x19, 0xb6, 0xce, 0x25, 0x3f,
-    0xb6, 0xbb, 0xf3, 0x61, 0xb2, 0xb3, 0x03, 0xac, 0xad, 0x39, 0x79, 0x71,
-    0x06, 0xe0, 0x07, 0x8b, 0x68, 0x74, 0x16, 0xe3, 0x81, 0xb2, 0x2a, 0x3b,
-    0x80, 0xfd, 0x35, 0x35, 0x04, 0x97, 0xcb, 0x22, 0x24, 0x2b, 0x37, 0xbe,
-    0xc8, 0xf2, 0x92, 0x0c, 0x48, 0x30, 0xb9, 0xf1, 0x3b, 0x64, 0xb5, 0x59,
-    0x8b, 0xac, 0x02, 0x44, 0xf4, 0x2c, 0x29, 0x98, 0x37, 0x25, 0x5e, 0x0a,
-    0x9d, 0x41, 0xc7, 0x2e, 0x89, 0x52, 0xd1, 0x8b, 0x2e, 0x5e, 0x46, 0x20,
-    0x12, 0xf3, 0x0f, 0xc9, 0x0c, 0xc5, 0xa5, 0xe0, 0xbf, 0x05, 0x05, 0xe6,
-    0x79, 0xf5, 0xf9, 0x4b, 0x20, 0x26, 0xb0, 0x15, 0xc9, 0x23, 0x8d, 0x64,
-    0x08, 0x6c, 0x2d, 0x41, 0xf7, 0xf1, 0x94, 0x3f, 0x34, 0x07, 0x8c, 0x85,
-    0x28, 0x0d, 0xcf, 0x46, 0xc4, 0x38, 0xbc, 0x24, 0xc0, 0x45, 0x46, 0x0b,
-    0xe4, 0x22, 0x3a, 0xcc, 0x16, 0x40, 0x0c, 0x0b, 0xea, 0x03, 0x41, 0x91,
-    0x44, 0x95, 0xfe, 0x4a, 0xca, 0x22, 0xb0, 0x6f, 0xb4, 0xb0, 0x87, 0xcc,
-    0x93, 0x2b, 0x0e, 0x3d, 0xea, 0x49, 0x3d, 0xa8, 0xaf, 0xaf, 0x3d, 0xaf,
-    0x83, 0x02, 0x0f, 0x52, 0x60, 0xa7, 0x80, 0x54, 0x6a, 0x52, 0xfd, 0x38,
-    0xf4, 0xba, 0x3b, 0x7e, 0xf4, 0x71, 0x88, 0xa4, 0xfa, 0x64, 0x2f, 0x72,
-    0x77, 0x40, 0x9c, 0xc0, 0x96, 0xe0, 0x73, 0x5f, 0xda, 0x25, 0x94, 0xc2,
-    0x0f, 0xf0, 0x66, 0x57, 0xc9, 0xe1, 0x40, 0x36, 0x45, 0xc1, 0x4a, 0x09,
-    0x16, 0x65, 0x4c, 0x98, 0x8f, 0xa8, 0x44, 0x01, 0xe9, 0xb2, 0x05, 0xbe,
-    0x2a, 0x34, 0x5d, 0x4b, 0x84, 0x7b, 0xcf, 0xca, 0x12, 0x2f, 0x31, 0x45,
-    0xf7, 0x08, 0xad, 0xd0, 0xfd, 0xfb, 0xe9, 0x07, 0x37, 0xa8, 0x65, 0x4d,
-    0xf8, 0x66, 0x52, 0x11, 0x31, 0x7c, 0x12, 0xb8, 0xf0, 0x43, 0x72, 0x3f,
-    0xfe, 0x4d, 0x3c, 0x91, 0x4e, 0xdc, 0x02, 0xce, 0xde, 0xc2, 0xad, 0x5e,
-    0x70, 0x3b, 0xc9, 0x2d, 0x87, 0xe4, 0x48, 0xed, 0xa3, 0xee, 0x2f, 0xdf,
-    0xbf, 0xf9, 0xae, 0x2c, 0xe7, 0x3f, 0xb2, 0xdf, 0x17, 0x60, 0x8c, 0xac,
-    0x83, 0x18, 0x46, 0x98, 0x97, 0x45, 0x78, 0xcf, 0x31, 0x2e, 0x34, 0x8f,
-    0xa1, 0x02, 0x47, 0x23, 0xc4, 0x96, 0xfc, 0xdb, 0x8e, 0x72, 0x70, 0x15,
-    0x20, 0x1d, 0x84, 0xbf, 0x4e, 0x02, 0x20, 0xe6, 0x50, 0xa3, 0x63, 0xc8,
-    0x08, 0x1c, 0x1a, 0xe0, 0x16, 0x29, 0x98, 0xa2, 0xeb, 0x7f, 0x9b, 0xf0,
-    0x48, 0x76, 0x3e, 0xf0, 0x1c, 0x75, 0x74, 0x77, 0x1d, 0x80, 0x76, 0x57,
-    0x14, 0xaf, 0xb2, 0x19, 0xa4, 0xc2, 0xad, 0xbd, 0x40, 0x00, 0x30, 0xec,
-    0x61, 0xf0, 0x32, 0x82, 0xe4, 0x15, 0x72, 0x39, 0x58, 0xea, 0x08, 0x54,
-    0x2d, 0x86, 0x1f, 0xc8, 0xe5, 0xbe, 0xe5, 0xb7, 0x86, 0xdf, 0x4c, 0x2a,
-    0x18, 0xd7, 0x88, 0xf0, 0xf9, 0x9a, 0x0b, 0x93, 0xe9, 0x75, 0x30, 0xbb,
-    0x0e, 0xde, 0x24, 0xc1, 0x35, 0x58, 0x99, 0xd7, 0xa8, 0x54, 0x08, 0x73,
-    0xeb, 0x7e, 0x1d, 0x7c, 0xbe, 0x5e, 0xad, 0xf0, 0xfd, 0x97, 0x8c, 0xf2,
-    0x41, 0x97, 0x00, 0xa0, 0xb3, 0x31, 0xa1, 0xa4, 0x4c, 0x78, 0xfc, 0xe8,
-    0xf0, 0xc7, 0x09, 0xb9, 0xfe, 0xf5, 0x8d, 0xf4, 0xab, 0x43, 0xa9, 0xf4,
-    0xfa, 0xec, 0xc7, 0x09, 0x06, 0xe7, 0xf2, 0x8f, 0xc8, 0xa8, 0x88, 0x79,
-    0xfe, 0xc0, 0xbb, 0x06, 0xb1, 0x76, 0x5d, 0x8b, 0x25, 0x68, 0x58, 0xb1,
-    0xa5, 0x9d, 0x1d, 0x12, 0x4c, 0x38, 0x47, 0x45, 0x32, 0xc5, 0x88, 0xe1,
-    0x30, 0xeb, 0xae, 0x02, 0x1d, 0x10, 0x03, 0xde, 0xf4, 0xda, 0xce, 0xfe,
-    0x7c, 0xce, 0xfc, 0xa0, 0x01, 0xe0, 0x7b, 0x30, 0xbd, 0xe6, 0x49, 0xf1,
-    0xd7, 0xe8, 0x27, 0x02, 0x56, 0x49, 0x5e, 0xc9, 0x51, 0x36, 0xdd, 0x71,
-    0x77, 0x77, 0xdd, 0x1d, 0xe4, 0x9d, 0x59, 0x51, 0x6e, 0x61, 0x03, 0xbd,
-    0x04, 0x7b, 0x80, 0x12, 0x9a, 0x0a, 0xf4, 0x8c, 0xae, 0x4f, 0xfa, 0x50,
-    0xd9, 0xac, 0x7c, 0xc0, 0x0e, 0x5d, 0xbf, 0x9d, 0xbd, 0x63, 0x6f, 0x76,
-    0x2d, 0xe6, 0x51, 0x85, 0xf3, 0xb9, 0x5f, 0xb9, 0xe4, 0x9a, 0x15, 0x6d,
-    0x45, 0x29, 0x3f, 0x63, 0xea, 0xc1, 0x26, 0xa1, 0xcf, 0xf8, 0x0d, 0x07,
-    0x91, 0xb2, 0xe9, 0xdb, 0xdb, 0x6f, 0x12, 0x3a, 0xa8, 0xa0, 0x28, 0x0d,
-    0x71, 0x57, 0x00, 0xe0, 0x46, 0x6f, 0xae, 0x8a, 0x22, 0xec, 0x55, 0x7c,
-    0x62, 0x11, 0x3d, 0x47, 0x28, 0x33, 0x60, 0xeb, 0x81, 0x71, 0xc6, 0x63,
-    0x8a, 0xe5, 0x88, 0xa7, 0x30, 0xc8, 0x96, 0x28, 0x59, 0xad, 0xb0, 0x88,
-    0x9f, 0xc5, 0x22, 0x2d, 0x6e, 0x45, 0x22, 0xad, 0x9f, 0xd8, 0x42, 0x29,
-    0xf1, 0x79, 0x5e, 0x2e, 0x85, 0x2b, 0xc0, 0x00, 0x52, 0xb8, 0x0e, 0xd0,
-    0x10, 0xf8, 0x57, 0x20, 0x67, 0x23, 0x3f, 0xa4, 0xa4, 0x26, 0x99, 0x31,
-    0x27, 0x78, 0xc8, 0xe6, 0xc1, 0xef, 0xd7, 0x11, 0xf0, 0xa1, 0xee, 0x0e,
-    0x72, 0x21, 0xee, 0x5c, 0xe6, 0xf0, 0x20, 0x0f, 0xe7, 0xef, 0xd7, 0xb0,
-    0x20, 0x68, 0x20, 0x06, 0x46, 0xe6, 0x87, 0x37, 0xe7, 0x61, 0xff, 0x10,
-    0xfb, 0xa1, 0xec, 0x33, 0x54, 0xd8, 0x42, 0xc4, 0xfb, 0x2c, 0xf2, 0x80,
-    0xbf, 0x56, 0xa7, 0xc8, 0xf3, 0x6b, 0x65, 0xca, 0xf3, 0x6b, 0xbf, 0xde,
-    0x2e, 0x98, 0xaa, 0xc0, 0x0d, 0xf7, 0x13, 0x70, 0x3d, 0xc5, 0x5b, 0x0f,
-    0xcc, 0x9c, 0xb7, 0x88, 0xb0, 0x85, 0x60, 0x20, 0xbf, 0x5f, 0xdb, 0x9a,
-    0xc2, 0x1f, 0xaa, 0x3a, 0x94, 0x1f, 0x3b, 0x6e, 0x34, 0x74, 0x43, 0xee,
-    0x8a, 0x91, 0x65, 0x78, 0x65, 0x64, 0x24, 0x04, 0x23, 0x94, 0xfa, 0xbe,
-    0x26, 0x75, 0xa1, 0x2b, 0xa0, 0x39, 0x71, 0xac, 0x75, 0x1d, 0x14, 0x04,
-    0x1a, 0xc1, 0x98, 0xce, 0xe6, 0xd7, 0xe7, 0x41, 0x79, 0x8d, 0x3e, 0xee,
-    0xc5, 0xb5, 0x61, 0xf4, 0x94, 0xd7, 0x68, 0x64, 0xab, 0xe1, 0xfc, 0xe7,
-    0x11, 0x29, 0xd6, 0xeb, 0xe0, 0xe6, 0x9a, 0x1c, 0x8e, 0xf8, 0xae, 0xe2,
-    0x4e, 0x08, 0x7a, 0xc5, 0xc7, 0x5d, 0x1d, 0xac, 0xc3, 0xea, 0x89, 0xac,
-    0x50, 0x41, 0x5a, 0x89, 0xe6, 0xc1, 0x92, 0xa6, 0x00, 0x7c, 0x14, 0xc4,
-    0xda, 0xed, 0x75, 0xb4, 0xbc, 0xc6, 0x07, 0x4f, 0x05, 0xcf, 0xfc, 0x0e,
-    0xc4, 0x02, 0xa3, 0xb7, 0x55, 0x32, 0x80, 0x6c, 0x76, 0x5d, 0xc9, 0xd2,
-    0xe5, 0x75, 0x93, 0x38, 0x17, 0xd7, 0x9e, 0xfb, 0x4b, 0x47, 0xb4, 0x64,
-    0xe3, 0x0e, 0xea, 0xc6, 0x6e, 0xe0, 0xea, 0x5c, 0x18, 0xc5, 0x3c, 0xd4,
-    0xfb, 0x86, 0x56, 0xec, 0xc2, 0xfa, 0xf1, 0xfa, 0xd1, 0x2e, 0xbd, 0x13,
-    0xc7, 0x61, 0x31, 0x03, 0xf6, 0xc7, 0xb1, 0xac, 0xb8, 0x46, 0xe4, 0x06,
-    0x82, 0x2a, 0xae, 0x6b, 0x42, 0x0a, 0x28, 0xb0, 0x1d, 0xaa, 0x42, 0xa6,
-    0xb0, 0x44, 0x03, 0x37, 0xe8, 0x53, 0x58, 0x2d, 0x2c, 0xa5, 0x8b, 0xd6,
-    0x6e, 0x9e, 0x8c, 0xd9, 0xf7, 0xa2, 0x9b, 0xed, 0x6d, 0x4b, 0x26, 0xb4,
-    0x47, 0x8a, 0xc3, 0x05, 0xf0, 0xbb, 0x3b, 0x7c, 0xc0, 0x0a, 0xd5, 0xea,
-    0xcc, 0xed, 0x6d, 0x81, 0xb9, 0x15, 0xa1, 0x40, 0xba, 0x49, 0x28, 0x28,
-    0xb9, 0x61, 0x55, 0xe2, 0x26, 0x50, 0x07, 0x5b, 0xba, 0x81, 0xd9, 0xbd,
-    0x2e, 0x1e, 0x3a, 0xcb, 0xe5, 0xb2, 0x03, 0xfc, 0x75, 0xd6, 0x81, 0x3d,
-    0x62, 0xe9, 0x28, 0xc3, 0xa7, 0x37, 0x08, 0xa8, 0x13, 0x02, 0x7a, 0x41,
-    0xd6, 0xe9, 0x7b, 0x62, 0xbe, 0x4a, 0x26, 0x0c, 0x03, 0x1a, 0x6d, 0x9d,
-    0x71, 0xf6, 0x1e, 0xf9, 0x2b, 0x3a, 0xec, 0x9b, 0xfb, 0x16, 0x2d, 0xae,
-    0x09, 0x24, 0x29, 0x9d, 0xf0, 0x62, 0x9c, 0x17, 0xe3, 0x86, 0x7e, 0xa4,
-    0x07, 0xf7, 0x1d, 0x44, 0xb8, 0xeb, 0xca, 0xa3, 0x21, 0xf7, 0xf6, 0x56,
-    0x28, 0x85, 0x55, 0xe5, 0x28, 0x17, 0x78, 0xfc, 0xe2, 0x3a, 0x78, 0x79,
-    0x1d, 0x6d, 0xed, 0xe1, 0x34, 0xfa, 0xbd, 0xde, 0x31, 0xe1, 0x10, 0xb4,
-    0x5b, 0x14, 0x04, 0x7d, 0xfe, 0x79, 0xbc, 0xdf, 0xeb, 0xad, 0x56, 0xfb,
-    0x3d, 0x3e, 0x18, 0xcf, 0xa3, 0x60, 0x6e, 0xa5, 0xb2, 0x7b, 0x99, 0xe0,
-    0xab, 0x97, 0x51, 0x74, 0x73, 0x4d, 0x13, 0x03, 0x3e, 0x30, 0x47, 0x42,
-    0xf4, 0x5e, 0x27, 0x3a, 0x6a, 0x40, 0x9b, 0x2b, 0x5c, 0x6c, 0x31, 0xcf,
-    0xd2, 0x82, 0xf1, 0xd5, 0x7a, 0xf2, 0xb5, 0xcc, 0x0e, 0x29, 0xb1, 0xc4,
-    0x6f, 0xa1, 0xdd, 0xeb, 0x44, 0xe2, 0xc9, 0xa0, 0xc2, 0x93, 0xd7, 0x09,
-    0x2f, 0x8b, 0x7e, 0x9b, 0x0c, 0xf9, 0x9b, 0xab, 0x21, 0xa6, 0x7e, 0x85,
-    0x14, 0xa9, 0xdf, 0xe1, 0x3f, 0x27, 0x9c, 0x82, 0x5e, 0x27, 0xfe, 0x50,
-    0x72, 0x97, 0xf0, 0x97, 0x3a, 0x13, 0xa6, 0x8a, 0x52, 0x1d, 0xb5, 0x5b,
-    0x7a, 0xab, 0x15, 0x8f, 0x70, 0xf1, 0xb0, 0xeb, 0x62, 0x71, 0x79, 0x49,
-    0x8f, 0x5a, 0x13, 0x3c, 0xf9, 0xec, 0xc4, 0xe6, 0xe3, 0x4f, 0xad, 0x37,
-    0x0b, 0xfc, 0x17, 0xd7, 0x6a, 0x16, 0x7f, 0xd2, 0x42, 0xcf, 0xc3, 0x58,
-    0xf3, 0x01, 0xbe, 0xf6, 0xfb, 0xe2, 0xba, 0xe1, 0x54, 0xc7, 0xd7, 0x32,
-    0xbb, 0xb5, 0x3a, 0x10, 0xc1, 0x16, 0xd5, 0xef, 0x12, 0x71, 0x3f, 0x66,
-    0x6a, 0x18, 0xfa, 0x8e, 0xda, 0x40, 0xbe, 0xd1, 0x47, 0x1e, 0x37, 0x0f,
-    0xf6, 0x71, 0x7e, 0x0d, 0xb8, 0x05, 0xab, 0x11, 0x6b, 0x46, 0x96, 0x38,
-    0xc4, 0x98, 0x1a, 0x28, 0xf3, 0x43, 0x5a, 0x33, 0x65, 0xe9, 0x33, 0x04,
-    0x0a, 0x0f, 0x39, 0xe0, 0x22, 0xe2, 0xc0, 0x50, 0x39, 0x7a, 0x22, 0x80,
-    0x05, 0xed, 0xf8, 0xdb, 0xc3, 0x5c, 0x38, 0x89, 0xe7, 0x85, 0x21, 0xd7,
-    0xaf, 0xdf, 0x16, 0x06, 0xe4, 0x29, 0xf1, 0xcc, 0xe9, 0x65, 0xc5, 0x7e,
-    0x41, 0x79, 0x7e, 0x79, 0x1d, 0xb8, 0xd4, 0x20, 0x17, 0xda, 0xf3, 0x12,
-    0xa7, 0x86, 0xbc, 0x73, 0x0d, 0x9a, 0xf6, 0x8b, 0x6b, 0x25, 0x4d, 0xc1,
-    0x52, 0xd0, 0xa4, 0xc2, 0x24, 0x04, 0x19, 0x8f, 0x1a, 0x0b, 0xaa, 0xbc,
-    0xa1, 0xd0, 0xc2, 0x43, 0xa1, 0x3e, 0x2b, 0xed, 0x11, 0x50, 0xaf, 0x93,
-    0x75, 0xa5, 0x67, 0x53, 0x49, 0xfd, 0xf2, 0x21, 0xf0, 0xe7, 0x0b, 0x0a,
-    0x02, 0x09, 0xa4, 0x4e, 0xdf, 0xe8, 0x02, 0xbe, 0x08, 0xdc, 0x77, 0x40,
-    0x06, 0xa0, 0x8e, 0x14, 0x77, 0xe9, 0x88, 0xac, 0x28, 0x94, 0x40, 0xc8,
-    0xdf, 0x31, 0x43, 0x10, 0x69, 0x06, 0x3a, 0xb6, 0x27, 0x98, 0x88, 0x50,
-    0x2a, 0x82, 0xbb, 0x6b, 0xfa, 0x82, 0xb5, 0xa6, 0x78, 0x5f, 0x1c, 0xbe,
-    0xe7, 0x71, 0x51, 0xe0, 0x0f, 0xa5, 0x10, 0x43, 0x00, 0xde, 0xfc, 0x6d,
-    0xc2, 0xa6, 0x63, 0x83, 0x25, 0xd4, 0xd9, 0xcb, 0x6b, 0x64, 0x03, 0x91,
-    0x9a, 0x87, 0x19, 0x83, 0xba, 0x7a, 0x79, 0xed, 0xdf, 0x5e, 0x0b, 0xdf,
-    0x39, 0xcc, 0xba, 0xbc, 0xe6, 0x7c, 0xa3, 0x7a, 0xcf, 0x05, 0x27, 0x54,
-    0xa9, 0xfa, 0xf9, 0x75, 0x8b, 0xae, 0xdf, 0xca, 0x16, 0x6c, 0x30, 0x92,
-    0x56, 0x81, 0x02, 0xe8, 0xa0, 0x1e, 0xc6, 0x27, 0x6e, 0x5d, 0xa0, 0x36,
-    0x2a, 0x38, 0xec, 0x50, 0xfc, 0x25, 0x0d, 0x1f, 0x4b, 0x49, 0xb3, 0x45,
-    0xa7, 0x6c, 0x53, 0xbf, 0x97, 0x46, 0xe9, 0xbb, 0x89, 0x7a, 0xfe, 0xa8,
-    0xbd, 0x92, 0x84, 0xf8, 0x06, 0x8a, 0x5b, 0xd4, 0xb8, 0xc3, 0xdb, 0xd6,
-    0xa6, 0x7e, 0x64, 0x90, 0x02, 0xb7, 0xdc, 0x77, 0x3f, 0xbc, 0x07, 0x23,
-    0x45, 0x8e, 0x54, 0xfa, 0x72, 0x3a, 0xf4, 0x56, 0xd7, 0x9f, 0xe8, 0x55,
-    0xea, 0x3f, 0x5c, 0xb5, 0x69, 0xf4, 0x8c, 0xa7, 0x60, 0x60, 0x93, 0xda,
-    0x48, 0xdc, 0x76, 0x43, 0x8b, 0x8e, 0x27, 0xaa, 0x47, 0x71, 0xe9, 0x76,
-    0x59, 0xa4, 0xc5, 0x02, 0x81, 0x4d, 0x2e, 0xdd, 0x2f, 0x3e, 0x98, 0xdd,
-    0xb1, 0x74, 0xa6, 0xc9, 0x09, 0xed, 0x1d, 0x67, 0xd5, 0x4d, 0x0a, 0x2f,
-    0x26, 0x45, 0x27, 0x43, 0xf3, 0x35, 0x87, 0x3f, 0x7b, 0xc0, 0x23, 0xab,
-    0x06, 0x7a, 0x98, 0x4d, 0x17, 0xd9, 0xa5, 0x97, 0x0f, 0xc1, 0x2a, 0x76,
-    0x8f, 0xc7, 0xc9, 0xcd, 0x89, 0xeb, 0xf3, 0xac, 0xfa, 0xf6, 0xe1, 0xcf,
-    0x13, 0xbc, 0x0d, 0x21, 0x6e, 0xe4, 0xe5, 0xe8, 0x04, 0x08, 0x80, 0xb7,
-    0x17, 0xd6, 0xc0, 0x0a, 0x09, 0x84, 0x58, 0x9c, 0xb4, 0xd1, 0x92, 0xe2,
-    0x24, 0xe2, 0x02, 0xf1, 0xa7, 0x1f, 0x5f, 0xa3, 0x7f, 0x2b, 0x4b, 0x31,
-    0xee, 0x58, 0x6a, 0xb7, 0xd6, 0xf3, 0xf3, 0x33, 0xc5, 0x3b, 0x1b, 0x8f,
-    0xcd, 0xf3, 0x60, 0x8b, 0xd3, 0x89, 0x45, 0x28, 0xb6, 0x03, 0xeb, 0x35,
-    0x45, 0x0a, 0xcb, 0x89, 0x13, 0xba, 0xc4, 0x84, 0x16, 0x72, 0xc2, 0x5f,
-    0x67, 0x54, 0xde, 0xfd, 0x47, 0x8e, 0x99, 0x04, 0x19, 0x1f, 0x3d, 0xe6,
-    0x0e, 0x5b, 0xf1, 0x00, 0x22, 0x9e, 0x64, 0x2d, 0x78, 0x5a, 0x3f, 0x84,
-    0xc1, 0x05, 0x58, 0x0f, 0x8f, 0xe2, 0x4a, 0xa7, 0x67, 0xf4, 0x2a, 0xb1,
-    0x57, 0x46, 0xc9, 0x30, 0x0b, 0xb3, 0x1d, 0xf7, 0xcc, 0xdd, 0xf1, 0x16,
-    0xf5, 0x2f, 0x53, 0x44, 0x51, 0x8c, 0x5a, 0x84, 0x88, 0xd4, 0x8d, 0x87,
-    0x25, 0x5d, 0x79, 0x71, 0xcf, 0x51, 0x4b, 0x86, 0x76, 0xc5, 0x30, 0xc7,
-    0xb5, 0x7b, 0xa0, 0xd8, 0x22, 0x17, 0x61, 0xe2, 0x0e, 0x63, 0x58, 0xb7,
-    0x00, 0x15, 0x07, 0x24, 0x9f, 0xd2, 0xdd, 0x30, 0xa5, 0xa3, 0xb1, 0x04,
-    0xfd, 0xef, 0xbc, 0xb1, 0x38, 0x7b, 0x11, 0x8e, 0x5f, 0xb0, 0xe7, 0x79,
-    0xe0, 0xdb, 0xb6, 0xfa, 0xbb, 0x08, 0x7f, 0xed, 0xf7, 0xf0, 0x97, 0x11,
-    0x76, 0x5c, 0xe1, 0xf2, 0xf6, 0x7e, 0xba, 0x8e, 0xc6, 0x3e, 0x62, 0x70,
-    0x15, 0xdb, 0x68, 0xbc, 0x93, 0x58, 0x47, 0x25, 0xd3, 0xd3, 0x31, 0x89,
-    0xfd, 0x8d, 0x65, 0x71, 0x9c, 0x30, 0xac, 0x23, 0x8f, 0x13, 0xe1, 0xd2,
-    0x16, 0xf1, 0xc5, 0xf7, 0xb8, 0xb0, 0x30, 0x0d, 0x68, 0x61, 0x21, 0x46,
-    0xa0, 0xab, 0x27, 0x3f, 0x74, 0x29, 0xf1, 0xa7, 0x6b, 0x01, 0x64, 0x71,
-    0x65, 0x82, 0x89, 0xf7, 0x37, 0xcd, 0x13, 0x1c, 0x7c, 0xed, 0x0e, 0x39,
-    0x30, 0xbe, 0x4e, 0x48, 0xf0, 0xf2, 0x49, 0xfd, 0x40, 0xd6, 0xc9, 0xd0,
-    0x92, 0x60, 0x6a, 0x10, 0xab, 0xa2, 0x75, 0x83, 0xf1, 0x41, 0x2f, 0x7d,
-    0xe0, 0x73, 0xdc, 0x63, 0xb4, 0xcb, 0x16, 0x17, 0xb3, 0x04, 0x1b, 0xe0,
-    0x51, 0x19, 0x08, 0x44, 0x26, 0xbf, 0xf9, 0x0f, 0xb1, 0x88, 0x04, 0xea,
-    0x35, 0xfc, 0xd3, 0x73, 0xd1, 0x20, 0xcb, 0x44, 0x3e, 0x98, 0x2f, 0xa3,
-    0xcf, 0x17, 0xd9, 0x2d, 0x26, 0x57, 0x2b, 0x0c, 0xbe, 0x85, 0x34, 0xc5,
-    0x35, 0x25, 0x00, 0x54, 0x7c, 0x21, 0x03, 0x65, 0xaf, 0x2f, 0xde, 0x56,
-    0x85, 0xb5, 0xa9, 0x30, 0x8e, 0x1a, 0xef, 0x21, 0xd5, 0x54, 0x20, 0x4e,
-    0xb2, 0xd5, 0xdd, 0xf0, 0xec, 0xf1, 0x5c, 0x02, 0xb4, 0x4d, 0x82, 0xc3,
-    0x50, 0x4b, 0x84, 0x0b, 0xd1, 0x80, 0xb5, 0x98, 0xe3, 0x17, 0x4d, 0xae,
-    0x46, 0x93, 0x6a, 0x9a, 0x04, 0x18, 0x33, 0x46, 0x4f, 0x3f, 0x02, 0xf2,
-    0xeb, 0x23, 0x20, 0x09, 0x48, 0x8c, 0x19, 0x91, 0xc1, 0xcf, 0x96, 0x2b,
-    0x34, 0xd0, 0x37, 0x3f, 0x18, 0x91, 0xf5, 0xc5, 0xdd, 0x7d, 0xf6, 0xbb,
-    0xd7, 0xf3, 0x95, 0xd3, 0x23, 0x98, 0x91, 0xed, 0x84, 0x64, 0xb5, 0xaa,
-    0x1e, 0x98, 0x83, 0xea, 0xbc, 0x0b, 0xcf, 0x78, 0x90, 0x43, 0x3d, 0x08,
-    0x05, 0xad, 0xab, 0x71, 0xab, 0x52, 0x58, 0xb6, 0xb5, 0xfa, 0xc2, 0x39,
-    0x90, 0x59, 0x6f, 0x30, 0xea, 0x9a, 0x59, 0xa6, 0x49, 0x57, 0xff, 0x82,
-    0x03, 0xcf, 0x69, 0xfc, 0xda, 0x02, 0x3d, 0x23, 0x00, 0xff, 0x07, 0x62,
-    0x75, 0xbc, 0xf6, 0x8f, 0xa5, 0xff, 0x59, 0x38, 0xac, 0x9d, 0x29, 0x88,
-    0xdf, 0xa8, 0x11, 0x4b, 0x7d, 0xf2, 0xc4, 0x7c, 0xb7, 0x22, 0x41, 0xaa,
-    0x43, 0x97, 0x58, 0xe6, 0xb9, 0x7f, 0xc7, 0x10, 0xbc, 0x78, 0xea, 0x80,
-    0xa9, 0x72, 0x99, 0x5c, 0xb9, 0xc1, 0x95, 0x4f, 0x21, 0xbe, 0xf8, 0xca,
-    0x3e, 0xbb, 0x49, 0x46, 0x8c, 0x3f, 0x90, 0x6f, 0xb9, 0x24, 0x87, 0x4f,
-    0x4b, 0xb9, 0x67, 0xdd, 0xce, 0xa7, 0x6f, 0x3a, 0xbf, 0xc5, 0x9d, 0x3f,
-    0x7a, 0x9d, 0xe7, 0xe7, 0x3b, 0x2e, 0x9e, 0x7d, 0xad, 0x03, 0x90, 0xff,
-    0x81, 0xfb, 0x61, 0xc2, 0x9c, 0x2b, 0xd1, 0x39, 0xe2, 0x8d, 0x43, 0x07,
-    0xc5, 0xcc, 0xe1, 0xdd, 0xba, 0xd5, 0x30, 0x23, 0x1a, 0xf8, 0x9d, 0xd0,
-    0x6f, 0xf4, 0xa1, 0x38, 0x24, 0x85, 0x8f, 0x70, 0x5e, 0x55, 0x11, 0x0f,
-    0xf8, 0xd3, 0xef, 0x1b, 0xd1, 0xef, 0x2f, 0x74, 0xf6, 0x1c, 0xde, 0x4d,
-    0x07, 0xdf, 0x72, 0x73, 0x83, 0x59, 0x92, 0x8a, 0x47, 0x29, 0x9f, 0xad,
-    0x83, 0x32, 0x7a, 0x02, 0xa2, 0x89, 0xea, 0x9d, 0xb8, 0xc1, 0x13, 0xe9,
-    0xf3, 0x4a, 0x83, 0xfb, 0x64, 0x0c, 0x96, 0xf9, 0xe5, 0x55, 0x07, 0xd0,
-    0x99, 0xb3, 0x48, 0x62, 0x27, 0xfc, 0x1b, 0x5f, 0x01, 0xcf, 0x1e, 0xdd,
-    0x72, 0xc7, 0xed, 0xd0, 0x04, 0x72, 0x18, 0x5c, 0xe9, 0x44, 0xc9, 0x5e,
-    0xe3, 0x43, 0x31, 0xf5, 0xef, 0xf7, 0xd4, 0x97, 0xf5, 0xdd, 0x41, 0xc9,
-    0x89, 0x7a, 0x2b, 0xca, 0xf8, 0x07, 0x7f, 0x92, 0x47, 0x42, 0xa4, 0x70,
-    0xc6, 0x59, 0xfa, 0xb7, 0xd2, 0xa1, 0x07, 0xbd, 0xb6, 0x50, 0x24, 0x55,
-    0xe8, 0x0a, 0xe8, 0xb4, 0x28, 0xca, 0x6c, 0xf6, 0x33, 0x10, 0xf5, 0x38,
-    0x29, 0xef, 0x30, 0x74, 0x34, 0xdb, 0x54, 0x2a, 0x11, 0xfb, 0x33, 0xbf,
-    0x20, 0xf0, 0xd9, 0xa3, 0xf3, 0xb3, 0x92, 0x1c, 0xe0, 0xb4, 0x4c, 0x37,
-    0x48, 0xb0, 0x0b, 0x3d, 0x7d, 0x86, 0x8f, 0xf6, 0x00, 0xfb, 0x8f, 0x05,
-    0xbf, 0x95, 0x6b, 0x73, 0x3c, 0xb1, 0x38, 0xdf, 0x45, 0xc7, 0x61, 0x30,
-    0xc2, 0xdb, 0xc2, 0x0a, 0xbd, 0x90, 0xba, 0x02, 0x10, 0xfc, 0x4a, 0x40,
-    0x8a, 0x33, 0x2f, 0x98, 0xa3, 0x92, 0xa7, 0x40, 0x48, 0x16, 0xaf, 0x25,
-    0xf6, 0xc4, 0x63, 0xd8, 0x47, 0x47, 0x6e, 0x3b, 0x5e, 0xfc, 0x25, 0x04,
-    0x5a, 0xb2, 0x0b, 0xe7, 0xa7, 0xd7, 0xf4, 0xab, 0x9a, 0x5d, 0xe7, 0x19,
-    0x1e, 0x55, 0xe3, 0xef, 0x49, 0xa0, 0x2d, 0x2c, 0x90, 0x0a, 0xb0, 0xfa,
-    0xfb, 0xff, 0xfd, 0xe1, 0x83, 0x05, 0xa5, 0x67, 0xbf, 0x97, 0xe5, 0x8b,
-    0x3c, 0xfb, 0x8c, 0x51, 0x7e, 0x73, 0x8e, 0xa6, 0x54, 0x93, 0xe7, 0x39,
-    0xe8, 0xd8, 0x73, 0x2d, 0x95, 0xdf, 0x91, 0x72, 0x7f, 0x09, 0x0d, 0xee,
-    0xf4, 0x06, 0xf3, 0x2c, 0x37, 0x1a, 0xfc, 0x54, 0x60, 0xdf, 0x85, 0xd2,
-    0xb7, 0xd4, 0xe2, 0x1d, 0x8f, 0xbf, 0x45, 0x10, 0x4f, 0x7d, 0xbd, 0x89,
-    0x0d, 0xf5, 0xab, 0xa7, 0x41, 0x34, 0x0c, 0xfc, 0x72, 0x42, 0xd8, 0x84,
-    0xe1, 0x0a, 0x95, 0xa4, 0xf5, 0x65, 0x67, 0x81, 0x1a, 0x72, 0xcf, 0xc5,
-    0x9e, 0xd6, 0xcb, 0xa9, 0xb6, 0xa3, 0x6d, 0x39, 0x3f, 0x32, 0x8c, 0xe9,
-    0x06, 0x1a, 0x0c, 0x6e, 0x82, 0x0f, 0x81, 0xcb, 0x93, 0x0e, 0xb5, 0x9d,
-    0x81, 0xf6, 0x18, 0x5f, 0xb1, 0xc2, 0xd8, 0xa7, 0x0f, 0xd9, 0x3c, 0x19,
-    0xb5, 0xec, 0xd6, 0x8f, 0x6c, 0xc4, 0x92, 0x1b, 0x46, 0x55, 0xdc, 0x60,
-    0x21, 0x58, 0x0b, 0x35, 0x28, 0x33, 0x67, 0xbe, 0xb8, 0x98, 0x26, 0xc5,
-    0xc4, 0xc9, 0x79, 0xad, 0xb1, 0x53, 0x24, 0x57, 0x30, 0x23, 0x7d, 0x42,
-    0x78, 0xa0, 0xd0, 0xd2, 0x1e, 0x48, 0x45, 0x34, 0x29, 0x30, 0x89, 0xd6,
-    0x87, 0x73, 0x99, 0x67, 0x33, 0xa3, 0x03, 0xb4, 0x6d, 0x1e, 0x98, 0x41,
-    0xcd, 0xd9, 0x1c, 0x32, 0x85, 0xf4, 0x1e, 0x7e, 0x06, 0xec, 0x04, 0x58,
-    0x3d, 0xa2, 0x0f, 0x11, 0xf2, 0x24, 0xfb, 0xba, 0xe1, 0x0d, 0x6b, 0x80,
-    0x1d, 0xec, 0xef, 0x7f, 0xff, 0xdd, 0x1f, 0xce, 0x8f, 0xdf, 0x5a, 0xe0,
-    0x95, 0x5f, 0x9e, 0x8e, 0x26, 0xd9, 0xf7, 0x12, 0xc8, 0x72, 0x07, 0x30,
-    0x13, 0x97, 0x56, 0x3a, 0xf9, 0x65, 0xb5, 0x05, 0x0e, 0x7a, 0x23, 0x5d,
-    0xa5, 0xa9, 0x00, 0x74, 0xfe, 0x0e, 0xf7, 0x6e, 0xcc, 0x51, 0x1d, 0x89,
-    0xf0, 0xef, 0xef, 0x5e, 0xff, 0xe0, 0xcc, 0x61, 0x07, 0x31, 0xaa, 0xa4,
-    0xa2, 0x41, 0xe8, 0x49, 0xc0, 0x3c, 0x6f, 0xe9, 0xe4, 0x1d, 0x88, 0xaa,
-    0x9f, 0xe6, 0xd5, 0x24, 0xbe, 0x41, 0xd7, 0x3e, 0x3e, 0x4b, 0x3c, 0x87,
-    0xfc, 0xc5, 0xdc, 0xc1, 0x9f, 0xaa, 0xaa, 0xfb, 0xa0, 0x01, 0xbc, 0x9c,
-    0xfd, 0xbe, 0xc0, 0xe8, 0x2e, 0x1a, 0xe5, 0xf0, 0x67, 0x07, 0x3d, 0x92,
-    0x8c, 0x33, 0xcc, 0x65, 0x52, 0xe2, 0x2e, 0x23, 0x38, 0x00, 0xce, 0x09,
-    0xbe, 0x5a, 0xa7, 0x8e, 0xfb, 0x21, 0x8f, 0xd3, 0x02, 0x44, 0x77, 0xf9,
-    0xd8, 0xf9, 0x03, 0xfc, 0xca, 0xba, 0x4d, 0x0d, 0xde, 0xd3, 0x94, 0xf4,
-    0x38, 0x2c, 0x97, 0xfe, 0xd0, 0x42, 0x07, 0xf1, 0xbb, 0x3a, 0xdb, 0x0c,
-    0x7a, 0xe3, 0xe2, 0x82, 0x6c, 0x20, 0x55, 0x42, 0x70, 0xb5, 0x49, 0xa3,
-    0xd5, 0x2b, 0x57, 0x25, 0xb8, 0x0c, 0xcf, 0xf0, 0x9f, 0x70, 0xbb, 0x87,
-    0x0e, 0xb2, 0xdd, 0x5d, 0x65, 0x70, 0xe5, 0x80, 0x4c, 0xf1, 0x1e, 0x86,
-    0x96, 0x33, 0x62, 0x79, 0x62, 0xa6, 0x4a, 0x50, 0x66, 0x8d, 0xc9, 0xe1,
-    0xa2, 0xc7, 0xc2, 0x5a, 0x2a, 0xfd, 0xb3, 0xfa, 0x91, 0x9c, 0x9a, 0x9b,
-    0xd4, 0x10, 0x69, 0x30, 0x97, 0x52, 0x4a, 0x3b, 0xe0, 0x33, 0x9c, 0xc5,
-    0x88, 0x45, 0x73, 0xc5, 0x1c, 0x84, 0xe9, 0x20, 0x93, 0xaf, 0x3d, 0x29,
-    0x30, 0x52, 0x41, 0xb2, 0x00, 0xd6, 0x25, 0x3e, 0x66, 0x63, 0xfc, 0x99,
-    0x4f, 0x47, 0xfb, 0xb9, 0x71, 0x47, 0xfb, 0x31, 0x54, 0x00, 0x9f, 0xda,
-    0xdd, 0x34, 0xbe, 0x60, 0x53, 0xb3, 0xc3, 0x6a, 0x29, 0x75, 0xdd, 0xb3,
-    0x34, 0x70, 0x1d, 0xb9, 0x81, 0xf8, 0xce, 0xf5, 0x39, 0xbf, 0x5e, 0x08,
-    0xe6, 0xe5, 0x9a, 0x87, 0x60, 0x55, 0x12, 0x9a, 0x51, 0xf4, 0xfa, 0x3d,
-    0xd7, 0xed, 0xb6, 0x30, 0xfe, 0xc7, 0xeb, 0xe1, 0x9d, 0xb4, 0xca, 0x42,
-    0x06, 0x9b, 0xcc, 0xfa, 0xa3, 0x0c, 0x4c, 0x15, 0x79, 0x29, 0x07, 0x09,
-    0x1d, 0xe2, 0xcc, 0x3d, 0x57, 0x68, 0xf3, 0x5c, 0x4b, 0xf2, 0xfd, 0x50,
-    0x71, 0xaa, 0xf0, 0xf1, 0x82, 0xbd, 0x5e, 0xcf, 0x5f, 0x07, 0xd6, 0xad,
-    0xea, 0xea, 0xe0, 0x0f, 0x65, 0x67, 0x15, 0x22, 0x35, 0xeb, 0xb8, 0xf2,
-    0x01, 0x3a, 0x7a, 0x6b, 0x58, 0x3c, 0xf3, 0xf6, 0xc4, 0x7c, 0x91, 0xb3,
-    0x56, 0xe9, 0x9e, 0x54, 0x06, 0xc6, 0xda, 0x0f, 0xcf, 0x80, 0xed, 0xbb,
-    0x35, 0x65, 0xbc, 0xc9, 0xae, 0x2c, 0x2c, 0x87, 0x5b, 0x14, 0x50, 0xf6,
-    0x06, 0x68, 0x73, 0xea, 0x82, 0x3d, 0x47, 0xac, 0x8d, 0x52, 0x44, 0x6c,
-    0xbc, 0x82, 0x33, 0xcd, 0xae, 0xae, 0xe8, 0x99, 0x31, 0xd9, 0x10, 0x84,
-    0xf8, 0x86, 0x56, 0xa2, 0x3a, 0x32, 0xc7, 0x5a, 0xe2, 0xd7, 0x8d, 0x8b,
-    0xbb, 0x62, 0xba, 0x61, 0x48, 0x2a, 0x6d, 0x0e, 0xc9, 0xf3, 0xbf, 0x43,
-    0x19, 0x2f, 0x85, 0xff, 0x7b, 0x5e, 0x15, 0x26, 0x89, 0x4c, 0xc8, 0x26,
-    0xd1, 0x78, 0x23, 0x4d, 0x01, 0x10, 0x8d, 0x50, 0xf6, 0x37, 0x9b, 0x00,
-    0xa4, 0xde, 0x93, 0x7b, 0xd1, 0x79, 0x73, 0xfa, 0x4a, 0x85, 0x14, 0x70,
-    0x95, 0xc7, 0xb1, 0xa6, 0xa2, 0x6e, 0xae, 0x36, 0x26, 0x06, 0xca, 0xbe,
-    0x4b, 0xae, 0x26, 0x15, 0x4f, 0xc5, 0x3e, 0x96, 0xf1, 0x1d, 0xa8, 0x2d,
-    0x4b, 0x6a, 0x09, 0x4d, 0x9c, 0xa4, 0x40, 0x05, 0x20, 0xe5, 0xd1, 0xf4,
-    0x02, 0x7c, 0xc4, 0x5c, 0xe9, 0x57, 0xe0, 0x68, 0x90, 0x8b, 0x45, 0x32,
-    0x2d, 0x41, 0x5d, 0x70, 0xa0, 0x57, 0x98, 0x36, 0x3e, 0xdc, 0x0a, 0x08,
-    0x50, 0xe0, 0x09, 0x6b, 0xd8, 0xb0, 0x20, 0x9f, 0xe0, 0xf5, 0x75, 0xfc,
-    0x25, 0x30, 0xbc, 0x4b, 0xc9, 0x9f, 0x6d, 0x0b, 0xaa, 0xb7, 0x01, 0xdd,
-    0xe3, 0xf9, 0xc9, 0x2b, 0x2e, 0xa8, 0x96, 0xc9, 0x74, 0x0a, 0x0c, 0xfa,
-    0x22, 0xcb, 0xca, 0xad, 0xe3, 0xdd, 0xf9, 0x09, 0x94, 0x7c, 0xc8, 0xef,
-    0x70, 0x06, 0xc0, 0xe3, 0xf9, 0x84, 0xd0, 0xd2, 0xdb, 0x3b, 0x04, 0x60,
-    0x43, 0x7a, 0x5c, 0x74, 0xb1, 0x16, 0xac, 0xb0, 0xc5, 0xb1, 0x48, 0xbf,
-    0x23, 0x51, 0x1f, 0x4e, 0xe5, 0x0c, 0x7d, 0x61, 0xf4, 0xba, 0x5f, 0xb0,
-    0x77, 0xc8, 0xf6, 0xe9, 0x61, 0x4a, 0x68, 0xfa, 0x69, 0x99, 0x5c, 0x26,
-    0x7f, 0x7a, 0xd6, 0x85, 0xf3, 0xcf, 0xd7, 0xdf, 0xbe, 0x86, 0x19, 0xf1,
-    0xa3, 0x69, 0x67, 0x39, 0x61, 0x39, 0x88, 0x60, 0x3c, 0xd2, 0x60, 0x63,
-    0xb9, 0x8c, 0x77, 0x90, 0x04, 0xc8, 0xd1, 0x32, 0x00, 0xfb, 0x81, 0xb5,
-    0x38, 0x49, 0x29, 0x66, 0x2f, 0x67, 0xc1, 0x8b, 0xfe, 0x8d, 0x79, 0x70,
-    0xca, 0x82, 0xdd, 0x2c, 0x1c, 0xea, 0xd1, 0xe9, 0x08, 0x60, 0x0a, 0x45,
-    0x40, 0x4e, 0xe6, 0xd7, 0x6c, 0xe1, 0xcc, 0xf0, 0xfe, 0xbc, 0x33, 0xc1,
-    0x30, 0x4d, 0x09, 0x5e, 0x31, 0x2f, 0xa2, 0x15, 0x00, 0x88, 0xac, 0xfd,
-    0x23, 0x41, 0xcd, 0xc1, 0x57, 0x22, 0x08, 0xf8, 0xbd, 0x0a, 0xf8, 0xdd,
-    0x7f, 0x03, 0xfc, 0xec, 0xc0, 0x5f, 0xaf, 0x07, 0xc6, 0x0f, 0xcf, 0x60,
-    0xbc, 0x5d, 0x22, 0xde, 0x93, 0x48, 0xe9, 0xf7, 0x09, 0xb9, 0xeb, 0xec,
-    0x32, 0xc6, 0xd0, 0xf9, 0xbb, 0x28, 0xe5, 0x49, 0x72, 0xf9, 0x45, 0xe2,
-    0x9d, 0x89, 0x4b, 0x06, 0x16, 0x4d, 0x94, 0xf1, 0xc4, 0x84, 0x4d, 0xe7,
-    0x51, 0xa2, 0xfe, 0x8c, 0x2a, 0x29, 0xc1, 0x8d, 0x0e, 0xab, 0x9f, 0xcf,
-    0x8d, 0xb6, 0x7a, 0xc6, 0x10, 0xea, 0x65, 0x56, 0x95, 0xa9, 0x29, 0x02,
-    0x82, 0xa2, 0x2d, 0x84, 0xfa, 0x4b, 0x3f, 0x0a, 0xa7, 0x2a, 0xc7, 0xea,
-    0x7d, 0xb3, 0x91, 0xd1, 0x03, 0xfe, 0x84, 0x9b, 0x29, 0x61, 0xe8, 0xb0,
-    0x4e, 0x28, 0x54, 0x6e, 0x20, 0xba, 0xc6, 0x75, 0xa8, 0x1d, 0xe5, 0xba,
-    0xbc, 0xe5, 0x11, 0xb5, 0x4a, 0x4f, 0x8f, 0x56, 0xd7, 0x15, 0x31, 0x86,
-    0x1d, 0x71, 0xc6, 0x83, 0x1d, 0x71, 0x19, 0xeb, 0x8a, 0x19, 0xb8, 0x6f,
-    0xf1, 0x09, 0xca, 0x35, 0x19, 0x59, 0xcd, 0x4a, 0x32, 0x4c, 0x8a, 0x6a,
-    0xf2, 0x78, 0xc4, 0xb6, 0xaa, 0xcb, 0x38, 0x4f, 0xe9, 0x27, 0xed, 0x78,
-    0xe5, 0x7f, 0x8a, 0x64, 0x5b, 0xf5, 0x24, 0xbd, 0xcc, 0x64, 0xdd, 0xd7,
-    0xf8, 0xdd, 0x56, 0x71, 0xcc, 0x2e, 0x16, 0x55, 0xaf, 0xaf, 0x28, 0xb1,
-    0xf6, 0xcf, 0x15, 0x75, 0x28, 0xad, 0xed, 0x8f, 0x54, 0xd8, 0x1f, 0xca,
-    0x4f, 0xe6, 0x12, 0xb2, 0xa9, 0xfa, 0x96, 0xa1, 0xc1, 0xf0, 0x9f, 0x4a,
-    0xfc, 0x72, 0xc3, 0x68, 0x1e, 0xa3, 0x26, 0x98, 0x86, 0x69, 0x20, 0xd5,
-    0xd0, 0xb0, 0xd4, 0xc1, 0xaf, 0x2a, 0x6c, 0xd5, 0x0c, 0x33, 0x73, 0x86,
-    0xf3, 0xcd, 0x2e, 0x92, 0xaf, 0xd5, 0x70, 0xc8, 0x85, 0x51, 0x97, 0x6b,
-    0x1b, 0xa4, 0x1d, 0x28, 0xbf, 0xe3, 0xfb, 0xd0, 0x8a, 0xc5, 0xef, 0xc3,
-    0xfe, 0xfb, 0xc6, 0x20, 0xac, 0x7d, 0x16, 0xdf, 0xa2, 0x1b, 0xf5, 0x71,
-    0x4b, 0xbd, 0xf4, 0xd4, 0x5b, 0x34, 0x2c, 0xd8, 0x0b, 0x8e, 0x0e, 0x0f,
-    0xf7, 0x0f, 0xb5, 0x1f, 0x86, 0xd5, 0x6b, 0xf4, 0x82, 0xbd, 0x23, 0xfd,
-    0x66, 0xea, 0x9f, 0xd4, 0x45, 0x1f, 0x22, 0x15, 0x03, 0x9b, 0xbe, 0x58,
-    0x49, 0xac, 0x7a, 0xa5, 0x25, 0x6b, 0x3f, 0xf0, 0xaa, 0xf3, 0x05, 0xe9,
-    0x21, 0x6e, 0x52, 0x34, 0xfe, 0x54, 0xf6, 0xdc, 0x54, 0x54, 0xe9, 0xc7,
-    0xc2, 0x0d, 0x46, 0x84, 0xb7, 0x39, 0x94, 0x0b, 0xfb, 0x6d, 0x5e, 0x13,
-    0xf5, 0x2e, 0x6c, 0xb3, 0x8e, 0xa1, 0x60, 0xaa, 0xd5, 0xf1, 0xd6, 0x11,
-    0xbd, 0x52, 0x25, 0x3d, 0x43, 0x54, 0xab, 0xf2, 0x0a, 0x55, 0xe7, 0x9a,
-    0x4c, 0xa8, 0x7e, 0xfa, 0xcf, 0xca, 0x8a, 0x42, 0x3a, 0x79, 0x7d, 0x9d,
-    0x96, 0xfc, 0x1e, 0x60, 0x5d, 0xe7, 0x83, 0x52, 0x87, 0x19, 0xb3, 0xe0,
-    0x07, 0xa9, 0x17, 0x18, 0xbe, 0x72, 0x0b, 0xff, 0xd4, 0x22, 0x03, 0x7d,
-    0x0c, 0x19, 0x5e, 0x2b, 0xe1, 0x07, 0x86, 0x16, 0xd3, 0x24, 0xe3, 0xc2,
-    0x01, 0x4f, 0x49, 0x2a, 0x15, 0x1c, 0x9f, 0xaa, 0xa6, 0x9f, 0xc4, 0xe1,
-    0xa1, 0x4f, 0xc9, 0xe5, 0x9d, 0x77, 0x71, 0x96, 0x11, 0x08, 0xcf, 0x7d,
-    0x28, 0x37, 0xca, 0x52, 0x7f, 0x78, 0x2b, 0x8b, 0xa3, 0x34, 0x14, 0xd7,
-    0x94, 0xab, 0x2c, 0x3c, 0xd4, 0xc0, 0xb1, 0xde, 0x05, 0xa7, 0xc1, 0x9b,
-    0xc8, 0x7b, 0xa7, 0x3d, 0x1b, 0xa3, 0x1b, 0x63, 0xfc, 0x37, 0xd0, 0xa5,
-    0x25, 0xc6, 0x8f, 0x01, 0xe9, 0x60, 0xd2, 0x18, 0x11, 0x10, 0xed, 0x4b,
-    0x2d, 0x34, 0xff, 0x3e, 0x3d, 0xc3, 0xc8, 0xfb, 0xd9, 0x2c, 0x4e, 0xc7,
-    0xe7, 0x1e, 0x7f, 0xcf, 0xeb, 0x34, 0xda, 0xda, 0x63, 0xfb, 0xaa, 0xdf,
-    0xf9, 0x74, 0xb5, 0xf2, 0xde, 0xd9, 0xaf, 0x60, 0x61, 0xed, 0x5e, 0x8b,
-    0x18, 0xc7, 0x8e, 0x50, 0x60, 0xef, 0xd3, 0x6b, 0x76, 0x68, 0x1f, 0xd4,
-    0x3f, 0xe7, 0xee, 0xfa, 0xfc, 0x3a, 0xab, 0x06, 0xfc, 0x37, 0xde, 0xbd,
-    0x98, 0x4b, 0xf8, 0x44, 0x5c, 0xc5, 0xc1, 0x85, 0xa2, 0x93, 0x96, 0x72,
-    0x5d, 0xba, 0x95, 0x4d, 0xfe, 0x3b, 0xe8, 0xa2, 0x43, 0x9a, 0x52, 0x07,
-    0x94, 0x61, 0x6b, 0x67, 0x58, 0x4b, 0xfb, 0xc1, 0x7b, 0xb7, 0x7a, 0xf9,
-    0x77, 0xad, 0xfd, 0x9e, 0xa3, 0xa2, 0x4a, 0xa4, 0x6d, 0x16, 0x2b, 0xe3,
-    0xab, 0xc7, 0x2b, 0xe4, 0xe2, 0x4e, 0xab, 0xa0, 0xfa, 0x33, 0x56, 0xed,
-    0x27, 0x61, 0x59, 0x70, 0xa1, 0x2a, 0x02, 0x89, 0x67, 0x6e, 0xe6, 0x48,
-    0xd8, 0x30, 0x5f, 0x6e, 0x56, 0x97, 0x02, 0x63, 0xf0, 0xa7, 0xb1, 0x70,
-    0x6d, 0x52, 0x6d, 0x24, 0xed, 0xae, 0xdd, 0xca, 0x66, 0x52, 0x41, 0xc1,
-    0x3b, 0xf7, 0xac, 0xd6, 0x5f, 0xf0, 0x0e, 0x2d, 0x67, 0x0d, 0x1f, 0x32,
-    0x3c, 0xee, 0xcc, 0xa2, 0xd4, 0x0f, 0x2b, 0x2b, 0x99, 0x7e, 0x3e, 0x0f,
-    0x66, 0x1f, 0xa8, 0x23, 0x91, 0xc6, 0xe1, 0x56, 0xe7, 0x14, 0x3a, 0x7c,
-    0xcc, 0x47, 0x07, 0xe4, 0xef, 0xb3, 0xd2, 0xcb, 0x8c, 0x86, 0x93, 0x1d,
-    0x94, 0xc1, 0x5b, 0xf2, 0x32, 0x83, 0x0d, 0xab, 0xfa, 0xf9, 0x79, 0xbe,
-    0xa9, 0xfd, 0xa1, 0x5b, 0x34, 0x6d, 0x1c, 0x7c, 0x45, 0x51, 0x74, 0xd1,
-    0xad, 0xdb, 0xea, 0x85, 0x3b, 0x2e, 0x35, 0x9f, 0xba, 0x52, 0x6e, 0xa5,
-    0x83, 0x54, 0xa3, 0x30, 0x3c, 0xc5, 0x16, 0x8e, 0x5f, 0xf5, 0xa4, 0x81,
-    0x34, 0x60, 0xce, 0x15, 0xc6, 0x5d, 0xe7, 0x15, 0x50, 0xfe, 0x1d, 0x68,
-    0xbc, 0xd3, 0xe4, 0xb3, 0xd0, 0x75, 0x49, 0x9f, 0x25, 0x67, 0x10, 0xfd,
-    0x0a, 0x67, 0xd5, 0x0e, 0xc3, 0xea, 0xe4, 0x25, 0xac, 0xfa, 0xe5, 0x8a,
-    0x5b, 0x65, 0x7e, 0xd5, 0x8c, 0x82, 0x32, 0x32, 0x17, 0xa8, 0x47, 0x78,
-    0xa6, 0x83, 0xaa, 0x00, 0xe0, 0x95, 0x5c, 0xd1, 0xfb, 0x7b, 0xf4, 0x28,
-    0xbf, 0x54, 0xe1, 0x95, 0x17, 0xfa, 0xbd, 0xbf, 0x1d, 0xc7, 0x0e, 0x85,
-    0x96, 0xba, 0x7f, 0xdb, 0x29, 0x77, 0xfe, 0xe6, 0x9e, 0xfc, 0x0d, 0xad,
-    0xfe, 0xe3, 0xdd, 0x18, 0xcd, 0x03, 0xe9, 0x6f, 0xdf, 0x84, 0x82, 0xef,
-    0x7e, 0x7a, 0x18, 0x05, 0x6d, 0xdc, 0xe6, 0xd6, 0xaf, 0xef, 0x39, 0x50,
-    0x4c, 0xf8, 0xba, 0x76, 0xac, 0x93, 0x66, 0xca, 0x0f, 0x1f, 0x6d, 0x94,
-    0xa9, 0xf0, 0x6b, 0xe3, 0xa1, 0x0a, 0xc4, 0x38, 0xec, 0x09, 0x4f, 0x98,
-    0xf4, 0x27, 0xa6, 0x74, 0xcd, 0xf8, 0x49, 0xe3, 0x0e, 0x6b, 0x25, 0x92,
-    0x48, 0xbf, 0x6b, 0x13, 0x4a, 0xfe, 0x5a, 0xb4, 0xbc, 0x97, 0x30, 0xff,
-    0x31, 0x5e, 0x86, 0xc2, 0xed, 0xe6, 0xc0, 0x37, 0x7a, 0xde, 0x84, 0x4a,
-    0x5d, 0x59, 0xf0, 0x01, 0xe7, 0x5a, 0xf8, 0x6b, 0x54, 0xa1, 0xfb, 0x5e,
-    0x5a, 0xbb, 0x22, 0x2e, 0x16, 0xcc, 0xdc, 0x69, 0x06, 0xc3, 0xf8, 0x60,
-    0x95, 0xb1, 0x9c, 0x80, 0x56, 0x90, 0x99, 0x8b, 0xc3, 0x08, 0x7b, 0x07,
-    0x7f, 0x62, 0x99, 0x61, 0x54, 0xd8, 0x5c, 0x69, 0x8f, 0x59, 0xce, 0x04,
-    0xf2, 0x60, 0xbc, 0x19, 0x90, 0xa7, 0x43, 0x3f, 0xdb, 0x24, 0x5b, 0xac,
-    0x6d, 0xce, 0x78, 0xb4, 0x71, 0x06, 0xb1, 0xdc, 0x79, 0x0f, 0x6f, 0x07,
-    0xe2, 0x15, 0x2d, 0x2f, 0x79, 0x94, 0xfa, 0xc2, 0x01, 0x53, 0x6b, 0x2f,
-    0x12, 0x50, 0x42, 0xcd, 0x04, 0xf6, 0xe2, 0xb7, 0x0a, 0xc4, 0x01, 0xd0,
-    0xea, 0xfd, 0xda, 0x3f, 0xab, 0xcc, 0xa1, 0xf3, 0x48, 0xfc, 0x36, 0x08,
-    0xc1, 0xd6, 0xf0, 0x1e, 0x4a, 0x15, 0xbb, 0xc6, 0x2f, 0x1b, 0x02, 0xa5,
-    0x8f, 0x16, 0x57, 0x23, 0xc9, 0xf5, 0x1f, 0xe3, 0xb8, 0xdb, 0xff, 0xb3,
-    0xce, 0xb9, 0x84, 0xf4, 0xae, 0x32, 0xf8, 0x02, 0x73, 0x2b, 0x43, 0xcb,
-    0x81, 0xfb, 0xf0, 0x36, 0x40, 0xe0, 0x4b, 0x98, 0x3c, 0x2e, 0xd5, 0xeb,
-    0x05, 0x15, 0x22, 0x5f, 0x4e, 0x63, 0xe4, 0xf0, 0xbe, 0x1a, 0xec, 0x21,
-    0xb1, 0x81, 0xb6, 0xdd, 0x14, 0x71, 0x88, 0x11, 0xc0, 0x9a, 0xfe, 0xc9,
-    0x2e, 0xde, 0x67, 0xb0, 0x35, 0xe8, 0xea, 0x2a, 0x42, 0x0a, 0x1c, 0x37,
-    0xd9, 0xe9, 0x8e, 0x1b, 0x3e, 0xdb, 0x73, 0x95, 0x53, 0xc1, 0x58, 0x95,
-    0x9a, 0xdc, 0x0d, 0x84, 0x4f, 0x76, 0xc3, 0x42, 0xf1, 0xfa, 0xa3, 0x42,
-    0x80, 0xc6, 0x9d, 0x14, 0xfc, 0x65, 0x9c, 0x96, 0x00, 0xad, 0x8c, 0x47,
-    0x54, 0xb9, 0x9f, 0x3e, 0xbd, 0x7b, 0xfd, 0xf6, 0xef, 0x9f, 0x3e, 0xb9,
-    0xed, 0x55, 0x41, 0xca, 0xd3, 0xa9, 0x56, 0x8a, 0x67, 0x8c, 0x19, 0xbf,
-    0xb1, 0xed, 0xf1, 0xc3, 0x40, 0xb2, 0x1a, 0x45, 0x04, 0x77, 0x90, 0xe2,
-    0xaf, 0x7b, 0xf4, 0xc9, 0x05, 0x43, 0x8e, 0x18, 0xac, 0x20, 0x76, 0x25,
-    0xb2, 0x49, 0x3f, 0x44, 0x3d, 0x92, 0x41, 0x30, 0x87, 0x1f, 0x68, 0x0e,
-    0xa8, 0xcb, 0xc9, 0xe3, 0xad, 0x44, 0xfe, 0xe4, 0x07, 0x45, 0x2b, 0x55,
-    0xcf, 0x6e, 0x46, 0x55, 0xea, 0x3b, 0x7a, 0x2e, 0xb0, 0x83, 0xef, 0xa1,
-    0xe1, 0x43, 0xd0, 0x3c, 0x39, 0x48, 0x6a, 0x39, 0xc9, 0x23, 0x64, 0xd4,
-    0x27, 0x3b, 0x37, 0xb5, 0x14, 0xc1, 0x81, 0x23, 0x5c, 0x44, 0xbd, 0x34,
-    0x75, 0xde, 0xf5, 0xd2, 0xab, 0x2b, 0x0d, 0x18, 0x03, 0x07, 0xe0, 0xe1,
-    0xf6, 0xb2, 0x1f, 0xd0, 0x4f, 0x56, 0x50, 0x6b, 0x8c, 0xdd, 0xdb, 0xa0,
-    0x38, 0xa2, 0x74, 0x03, 0x33, 0x9a, 0xfd, 0xbb, 0x4e, 0x7c, 0x62, 0xeb,
-    0xfc, 0x60, 0xa8, 0x73, 0xb9, 0xec, 0x54, 0x87, 0x42, 0x02, 0x37, 0xba,
-    0x22, 0x43, 0xf0, 0xff, 0x49, 0x32, 0xef, 0x24, 0xe3, 0xba, 0x14, 0x33,
-    0x5e, 0x8f, 0xfd, 0x41, 0x75, 0x9e, 0xf8, 0x15, 0xf4, 0x81, 0x4e, 0xc0,
-    0x71, 0x07, 0x25, 0x29, 0x46, 0x4c, 0x54, 0x92, 0x4d, 0xf2, 0xf5, 0x2e,
-    0x95, 0x7f, 0xc2, 0x72, 0x83, 0x11, 0x96, 0x1a, 0x6d, 0x27, 0xb5, 0x2d,
-    0x03, 0xe8, 0x0c, 0xe4, 0x9b, 0xae, 0xe5, 0x7b, 0x86, 0x31, 0x85, 0x3f,
-    0x73, 0x4f, 0x24, 0xa2, 0x14, 0x82, 0x7c, 0x8d, 0xaa, 0x5f, 0x1d, 0xb6,
-    0x00, 0xdc, 0xc4, 0x21, 0x0a, 0x8f, 0xdc, 0x9a, 0x82, 0x4e, 0x8e, 0x27,
-    0x7b, 0x27, 0x78, 0x2e, 0x78, 0xb0, 0xbf, 0x8f, 0x8f, 0x30, 0x2c, 0xe3,
-    0xbb, 0xe3, 0x5d, 0xc8, 0x3a, 0x9e, 0xf4, 0x4f, 0x5e, 0x0a, 0x57, 0x17,
-    0x01, 0x0c, 0x72, 0xfb, 0x27, 0xc7, 0xc8, 0x15, 0x9c, 0x98, 0xff, 0x06,
-    0xad, 0xfb, 0x95, 0xeb, 0x24, 0xe3, 0xc8, 0xd5, 0xf5, 0x25, 0x39, 0x44,
-    0xc5, 0x44, 0x9c, 0x9a, 0x9d, 0x00, 0x95, 0x91, 0x6c, 0xe2, 0x73, 0x51,
-    0xdb, 0x42, 0xd6, 0x2e, 0x72, 0x3b, 0xce, 0xd6, 0x1d, 0x1e, 0x02, 0x28,
-    0x62, 0x4c, 0xb4, 0x1e, 0x79, 0x5c, 0x8f, 0xa3, 0x7c, 0x77, 0xe6, 0x79,
-    0x32, 0x8b, 0xf3, 0x3b, 0xd7, 0xe1, 0x2f, 0xd9, 0xbb, 0xef, 0x79, 0xb3,
-    0x13, 0x47, 0xeb, 0x8c, 0xcb, 0x67, 0x4b, 0x5f, 0x55, 0x3b, 0xee, 0xbf,
-    0xe3, 0x6b, 0x32, 0xc4, 0x3a, 0xcc, 0x0e, 0x53, 0x04, 0x15, 0x72, 0xa2,
-    0x90, 0xbf, 0x9c, 0xb8, 0x15, 0x87, 0x0b, 0xf7, 0x15, 0xa6, 0x8c, 0xbb,
-    0x81, 0xb9, 0xb7, 0x90, 0xbb, 0xd2, 0xa5, 0xdf, 0x1d, 0xfd, 0x9e, 0x58,
-    0x86, 0xde, 0x1a, 0x79, 0x18, 0x5a, 0xd2, 0xb1, 0xbb, 0xbc, 0x20, 0xe2,
-    0x10, 0x0b, 0xac, 0xcf, 0x0c, 0xc1, 0x86, 0xc2, 0xd3, 0xba, 0xda, 0xb3,
-    0x8c, 0x87, 0x02, 0xc0, 0x46, 0x70, 0x4d, 0x80, 0xe6, 0xb1, 0x03, 0x9c,
-    0x1e, 0xf4, 0x2a, 0xf2, 0x3e, 0xda, 0xf6, 0x65, 0x2c, 0x27, 0xfa, 0x25,
-    0x1b, 0x53, 0x59, 0xd8, 0xd5, 0x16, 0x29, 0x8c, 0x59, 0xeb, 0xe2, 0xaa,
-    0xda, 0xb3, 0xdd, 0xba, 0x51, 0x0d, 0xa6, 0x7a, 0xb2, 0x36, 0x08, 0x15,
-    0x62, 0xf5, 0xda, 0xc9, 0x84, 0x13, 0x5f, 0x64, 0xdc, 0xcd, 0x5a, 0x30,
-    0xfa, 0xed, 0x05, 0xf4, 0x12, 0xa3, 0x93, 0x98, 0x7b, 0x58, 0x69, 0xac,
-    0x39, 0x3a, 0x84, 0x61, 0x56, 0xba, 0x1c, 0x90, 0x13, 0xd3, 0x73, 0x61,
-    0x3a, 0x50, 0x5d, 0xce, 0x12, 0x7a, 0x10, 0xc8, 0xc3, 0x11, 0x42, 0xee,
-    0xbe, 0x0d, 0x23, 0x70, 0x04, 0xdd, 0xe4, 0x3a, 0x79, 0x89, 0x9f, 0xa8,
-    0x24, 0x1d, 0xef, 0xf2, 0x5a, 0x27, 0x0e, 0x3f, 0x7a, 0x08, 0x1d, 0x92,
-    0x9f, 0xd5, 0xac, 0x84, 0x28, 0x39, 0x79, 0x9b, 0x95, 0xf5, 0xe1, 0x00,
-    0xac, 0x80, 0x84, 0x2c, 0x2d, 0x04, 0xc0, 0xf1, 0x9e, 0x74, 0x2c, 0x67,
-    0x31, 0x07, 0x7e, 0xcd, 0x38, 0x80, 0x16, 0xd3, 0x13, 0xa4, 0xf0, 0x97,
-    0xe2, 0x48, 0x5a, 0x70, 0x19, 0xb5, 0x77, 0x0b, 0x53, 0x3a, 0xa9, 0xfa,
-    0x85, 0xa6, 0xd8, 0xfc, 0x05, 0x72, 0x12, 0xd2, 0xd9, 0x43, 0xe8, 0x91,
-    0x9a, 0xe9, 0xfc, 0x07, 0xaa, 0xe2, 0x48, 0xb2, 0xfe, 0x4b, 0x60, 0x57,
-    0xce, 0xeb, 0x57, 0xda, 0x30, 0x82, 0xa5, 0xe9, 0x7d, 0x53, 0x2b, 0x0d,
-    0xcd, 0x6a, 0x86, 0x0b, 0x38, 0x5b, 0x4e, 0x32, 0x68, 0x8a, 0x21, 0xbf,
-    0xae, 0xc3, 0x80, 0x83, 0x11, 0x88, 0xf9, 0x0f, 0x45, 0xc4, 0x79, 0x49,
-    0x68, 0xd1, 0x41, 0xd9, 0xc4, 0x61, 0xcb, 0xd7, 0xdd, 0x82, 0x97, 0xae,
-    0xce, 0x05, 0x28, 0x78, 0x8f, 0x62, 0x9a, 0xe4, 0x37, 0xbf, 0xaf, 0x13,
-    0xb9, 0x18, 0xba, 0x66, 0x92, 0xb9, 0xe4, 0x19, 0xbc, 0xbe, 0x4c, 0x09,
-    0x0a, 0xff, 0x69, 0x4e, 0x16, 0xcd, 0xb7, 0xd5, 0xbc, 0x1f, 0xc9, 0x59,
-    0x54, 0xbc, 0x16, 0x3b, 0xf7, 0x0d, 0x46, 0xcb, 0x48, 0xcc, 0x7e, 0x2c,
-    0x62, 0x39, 0x8a, 0x43, 0xc0, 0xa1, 0x9f, 0x0d, 0x11, 0x96, 0x3e, 0xb1,
-    0x27, 0xba, 0x74, 0x77, 0xf2, 0x23, 0xff, 0xa8, 0xb1, 0xec, 0xbf, 0xa6,
-    0x73, 0x71, 0x78, 0x43, 0xfd, 0x03, 0xed, 0xfd, 0x13, 0xbe, 0xff, 0x1b,
-    0x86, 0x10, 0xb6, 0x96, 0x18, 0x84, 0xcb, 0x8f, 0x6a, 0x18, 0xc2, 0x7d,
-    0xc1, 0x31, 0xd0, 0xa6, 0x83, 0x3f, 0x18, 0xba, 0x7c, 0xf2, 0x7f, 0x01,
-    0xaa, 0x6f, 0x33, 0x06, 0x5b, 0xf3, 0x00, 0x00};
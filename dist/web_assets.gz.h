@@ -0,0 +1,1798 @@
+static const unsigned int index_html_gz_len = 835;
+static const char index_html_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x55,
+    0x5b, 0x8f, 0xdd, 0x26, 0x10, 0xfe, 0x2b, 0xb3, 0xf4, 0x35, 0x5e, 0x67,
+    0x2f, 0x0f, 0xab, 0x08, 0x53, 0xa5, 0x1b, 0x45, 0x8a, 0xb4, 0xa9, 0xd4,
+    0x6c, 0xa2, 0xaa, 0x4f, 0x15, 0x86, 0xb1, 0x4d, 0x83, 0x81, 0xc2, 0xf8,
+    0x58, 0xe7, 0xdf, 0x57, 0xc0, 0xf1, 0xb9, 0x44, 0x1b, 0x29, 0x95, 0xda,
+    0x17, 0x1b, 0x86, 0xb9, 0x7c, 0x33, 0xf3, 0x31, 0xf0, 0x2b, 0xed, 0x15,
+    0xed, 0x03, 0xc2, 0x44, 0xb3, 0x15, 0x3c, 0x7f, 0xc1, 0x4a, 0x37, 0x76,
+    0x0c, 0x1d, 0x13, 0x7c, 0x42, 0xa9, 0x05, 0x9f, 0x91, 0x24, 0xa8, 0x49,
+    0xc6, 0x84, 0xd4, 0xb1, 0x85, 0x86, 0xe6, 0x81, 0x1d, 0xa4, 0x4e, 0xce,
+    0xd8, 0xb1, 0x9d, 0xc1, 0x35, 0xf8, 0x48, 0x0c, 0x94, 0x77, 0x84, 0x8e,
+    0x3a, 0xb6, 0x1a, 0x4d, 0x53, 0xa7, 0x71, 0x67, 0x14, 0x36, 0x65, 0xf3,
+    0xca, 0x38, 0x43, 0x46, 0xda, 0x26, 0x29, 0x69, 0xb1, 0xbb, 0x61, 0x82,
+    0x93, 0x21, 0x8b, 0xe2, 0xe3, 0xdf, 0x44, 0xf7, 0x77, 0x77, 0xa3, 0x24,
+    0x5c, 0xe5, 0x9e, 0xb7, 0x55, 0xca, 0xad, 0x71, 0x5f, 0x21, 0xa2, 0xed,
+    0x58, 0xa2, 0xbd, 0xc5, 0x34, 0x21, 0x12, 0x83, 0x29, 0xe2, 0xd0, 0x31,
+    0x19, 0xc2, 0xb5, 0x4a, 0xe9, 0xe7, 0x5d, 0xf7, 0x70, 0xf7, 0x30, 0xbc,
+    0x1e, 0x74, 0xcf, 0x04, 0x6f, 0x2b, 0xda, 0xde, 0xeb, 0xbd, 0xe0, 0x49,
+    0x45, 0x13, 0x08, 0x52, 0x54, 0x55, 0xfb, 0xaf, 0xac, 0x7c, 0x7f, 0xdb,
+    0xab, 0x5e, 0xdf, 0xbf, 0xce, 0xca, 0x55, 0x41, 0x70, 0x6d, 0x76, 0xa0,
+    0xac, 0x4c, 0xa9, 0x63, 0x19, 0xbc, 0x34, 0x0e, 0x63, 0xce, 0xfc, 0x46,
+    0x7c, 0xfc, 0xed, 0xf3, 0xe7, 0x73, 0x5c, 0xd3, 0x8d, 0xe0, 0xd3, 0xad,
+    0x78, 0xf4, 0x6e, 0x30, 0xe3, 0x12, 0x25, 0x19, 0xef, 0x78, 0x3b, 0xdd,
+    0x0a, 0x3e, 0xf8, 0x38, 0x83, 0x54, 0x59, 0xd0, 0xb1, 0x9f, 0x18, 0x18,
+    0xdd, 0xb1, 0x84, 0x44, 0xc6, 0x8d, 0xa9, 0xc9, 0x87, 0x6c, 0x0b, 0x11,
+    0x96, 0x88, 0x45, 0x02, 0xc7, 0x55, 0x93, 0x48, 0xaa, 0xaf, 0xa8, 0x59,
+    0xc5, 0x72, 0x6e, 0x9b, 0x71, 0x6a, 0xb3, 0x13, 0xdc, 0xb8, 0xb0, 0x10,
+    0xe4, 0x46, 0x75, 0x2c, 0x2d, 0xfd, 0x6c, 0xe8, 0xd2, 0x63, 0xbf, 0x10,
+    0x79, 0x07, 0x67, 0xeb, 0x26, 0x44, 0x33, 0xcb, 0xb8, 0x67, 0xb0, 0x93,
+    0x76, 0xc1, 0x8e, 0x3d, 0x57, 0x33, 0x01, 0x17, 0xce, 0x22, 0x26, 0x7c,
+    0xd1, 0xd7, 0xd1, 0xee, 0x13, 0x5a, 0x2f, 0x75, 0xcd, 0x49, 0x0d, 0x63,
+    0x85, 0x5c, 0xcd, 0x04, 0x6f, 0xf3, 0xae, 0x54, 0xe5, 0x1d, 0xf6, 0xcb,
+    0x38, 0x1a, 0x37, 0xc2, 0x60, 0xe5, 0x98, 0x6a, 0x5d, 0x82, 0xf8, 0xc3,
+    0x2f, 0xe0, 0x10, 0x35, 0x90, 0x87, 0x49, 0xee, 0x10, 0x68, 0x42, 0x58,
+    0xb1, 0x7f, 0xf2, 0xe3, 0x13, 0xee, 0xd0, 0x42, 0x42, 0xca, 0x67, 0x1f,
+    0xdc, 0xe0, 0xf3, 0x7f, 0xcc, 0xdb, 0x09, 0x41, 0x6a, 0x6d, 0x72, 0x39,
+    0xa5, 0x05, 0x9d, 0x3d, 0xc3, 0x8c, 0x29, 0xc9, 0x11, 0x13, 0x68, 0xb4,
+    0x66, 0x87, 0xb1, 0xba, 0xcc, 0xaa, 0x4f, 0x7e, 0x04, 0xbf, 0x50, 0xce,
+    0x49, 0x46, 0x94, 0xd0, 0xa3, 0xf5, 0xeb, 0x35, 0x6f, 0xc3, 0xcb, 0x7d,
+    0xd1, 0x1b, 0xd0, 0x7f, 0xd3, 0x98, 0xc1, 0xa0, 0xd5, 0x09, 0xe9, 0xd4,
+    0xa2, 0xe2, 0xa6, 0xa4, 0x7a, 0xe9, 0x62, 0x3c, 0xf6, 0xac, 0x3d, 0x19,
+    0x9d, 0xca, 0x74, 0x02, 0xfb, 0x52, 0x85, 0xd2, 0x21, 0x7b, 0x76, 0x56,
+    0x21, 0x06, 0xb2, 0xf7, 0xb9, 0x70, 0xf9, 0x38, 0xd7, 0x2f, 0x13, 0x03,
+    0x26, 0x8c, 0x78, 0x55, 0x72, 0x2c, 0xb1, 0x42, 0xc4, 0x82, 0xca, 0xfa,
+    0xb1, 0x39, 0xb1, 0x78, 0x03, 0x76, 0x29, 0x15, 0xbc, 0x0d, 0x11, 0x37,
+    0x94, 0x41, 0xf0, 0x03, 0x79, 0x2a, 0x21, 0xb6, 0xee, 0xbf, 0xc4, 0x88,
+    0x1c, 0xa1, 0x27, 0xd7, 0x28, 0x8b, 0x32, 0x36, 0xd6, 0x8f, 0x4c, 0x3c,
+    0xe6, 0x25, 0x58, 0x3f, 0xf2, 0xb6, 0x6a, 0x09, 0x78, 0x26, 0x49, 0x4b,
+    0x7a, 0x03, 0x3c, 0x05, 0xe9, 0x8e, 0xa8, 0x52, 0x91, 0x32, 0xf1, 0xab,
+    0xa7, 0x3c, 0x24, 0x1c, 0x2a, 0x42, 0x7d, 0xc5, 0xdb, 0xac, 0x24, 0x4a,
+    0x22, 0xd3, 0xad, 0x78, 0xde, 0x27, 0xc2, 0x19, 0x96, 0xa0, 0x25, 0x61,
+    0x2d, 0xd0, 0x62, 0xf3, 0x24, 0x10, 0x8f, 0x4b, 0x8c, 0xe8, 0x08, 0x76,
+    0x18, 0x93, 0xf1, 0xee, 0xdc, 0xbb, 0xaa, 0x47, 0xcd, 0xb0, 0x36, 0x87,
+    0xd3, 0x72, 0xbd, 0xab, 0x5f, 0x6b, 0x8a, 0xf9, 0x2f, 0x8b, 0xb1, 0x1a,
+    0x56, 0x43, 0xd3, 0x1b, 0xbe, 0xd8, 0x62, 0x36, 0xac, 0x4d, 0x9f, 0xa5,
+    0x4d, 0x96, 0x66, 0x8b, 0x1c, 0x69, 0xd3, 0x7f, 0x9c, 0x4c, 0x80, 0x0f,
+    0xef, 0x2e, 0xc2, 0x4c, 0x26, 0x34, 0x46, 0x7f, 0xe3, 0xbb, 0x58, 0x5d,
+    0xd0, 0xac, 0x1d, 0x4c, 0x9c, 0x57, 0x19, 0x91, 0xc1, 0x8c, 0x34, 0x79,
+    0xdd, 0xb1, 0xe0, 0x13, 0x31, 0x40, 0xa7, 0x6a, 0x89, 0xe7, 0xc5, 0x92,
+    0x09, 0x32, 0x52, 0xa1, 0x45, 0xa3, 0x25, 0xc9, 0x5a, 0xdb, 0x9a, 0xf7,
+    0x77, 0x78, 0xc9, 0x2e, 0xa7, 0xc0, 0x60, 0x2c, 0xb2, 0xc3, 0xf8, 0xad,
+    0x6b, 0xa9, 0x14, 0x06, 0xea, 0xd8, 0x75, 0x6f, 0xdc, 0xb7, 0xd7, 0x7c,
+    0x9b, 0x19, 0x55, 0x7f, 0xdb, 0x1d, 0x6e, 0xf8, 0x97, 0x90, 0x6f, 0x38,
+    0xbc, 0x3f, 0xe2, 0xfe, 0xc1, 0xc9, 0x72, 0xce, 0xeb, 0x43, 0xe7, 0xde,
+    0xea, 0xd9, 0xb8, 0x8d, 0xd9, 0x3f, 0x4a, 0x2c, 0x48, 0xc5, 0xb8, 0xe9,
+    0xc9, 0x31, 0xc8, 0xd5, 0x68, 0x94, 0x9f, 0x67, 0xe9, 0x74, 0x19, 0x4f,
+    0x24, 0x23, 0x31, 0xf1, 0xa9, 0x2e, 0x4e, 0x2c, 0xfb, 0x6f, 0x9c, 0x23,
+    0xfd, 0xb9, 0x9a, 0xc1, 0x14, 0xff, 0x48, 0xf0, 0xbb, 0x19, 0xcc, 0xff,
+    0x10, 0x42, 0x95, 0x17, 0x63, 0x0b, 0x52, 0xdf, 0x8f, 0x63, 0x98, 0xc2,
+    0xfd, 0xc3, 0xc4, 0xa8, 0x4f, 0x57, 0x5b, 0xde, 0xe2, 0x7f, 0x00, 0x6e,
+    0xe3, 0x42, 0x87, 0x9b, 0x07, 0x00, 0x00};
+static const unsigned int app_css_gz_len = 5102;
+static const char app_css_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5d,
+    0x6d, 0x8f, 0xe3, 0x38, 0x72, 0xfe, 0x3e, 0xbf, 0x42, 0x3b, 0x83, 0x01,
+    0xa6, 0x07, 0x92, 0x5b, 0x96, 0x2c, 0xdb, 0x2d, 0xe3, 0x16, 0xc9, 0xdd,
+    0x6d, 0x92, 0x0b, 0x2e, 0x8b, 0x00, 0x9b, 0x2f, 0xc1, 0xa4, 0x03, 0xd0,
+    0x12, 0x6d, 0x2b, 0x23, 0x89, 0x82, 0x44, 0xf7, 0xcb, 0xf8, 0xfc, 0xdf,
+    0x03, 0xbe, 0xc9, 0x2c, 0xbe, 0xc8, 0xee, 0xc9, 0x1d, 0x26, 0x01, 0x82,
+    0xc6, 0xee, 0xaa, 0x8a, 0xa5, 0x22, 0x8b, 0xc5, 0x7a, 0x8a, 0xa4, 0x48,
+    0xef, 0xfd, 0xe7, 0x9f, 0xde, 0xfd, 0xeb, 0xb1, 0xc7, 0xc1, 0xd3, 0x7c,
+    0x16, 0xcf, 0xe6, 0xef, 0xfe, 0x40, 0xba, 0xd7, 0xbe, 0xda, 0x1f, 0x68,
+    0x90, 0xc4, 0xf3, 0x34, 0xf8, 0x77, 0x74, 0x20, 0xe4, 0xa7, 0x77, 0x7f,
+    0xae, 0x0a, 0xdc, 0x0e, 0xb8, 0x0c, 0x8e, 0x6d, 0x89, 0xfb, 0x80, 0x1e,
+    0x70, 0xf0, 0xfb, 0xdf, 0xfe, 0x18, 0x48, 0xf6, 0xec, 0xdd, 0x81, 0xd2,
+    0x6e, 0xc8, 0xef, 0xef, 0xf7, 0x15, 0x3d, 0x1c, 0xb7, 0xb3, 0x82, 0x34,
+    0xf7, 0xdd, 0xb1, 0xc7, 0x51, 0x31, 0x0c, 0xfc, 0xe1, 0x7e, 0x5b, 0x93,
+    0xed, 0x7d, 0x83, 0x06, 0x8a, 0xfb, 0xfb, 0x3f, 0xff, 0xe9, 0x0f, 0xbf,
+    0xfc, 0xfa, 0xdb, 0x2f, 0xb3, 0xa6, 0x7c, 0xf7, 0xf9, 0xfe, 0xfe, 0xf3,
+    0x4f, 0xef, 0x5a, 0xd2, 0x37, 0xa8, 0xae, 0xbe, 0xe1, 0x59, 0x31, 0x0c,
+    0xc1, 0xd3, 0x7f, 0xa6, 0xb3, 0x38, 0xf8, 0x4b, 0xf0, 0x2f, 0x7f, 0xfa,
+    0x37, 0x55, 0x41, 0xf0, 0x97, 0x60, 0x5f, 0xd1, 0x59, 0x45, 0xee, 0x47,
+    0x51, 0xad, 0xa1, 0x9f, 0x8a, 0xbb, 0xe0, 0xd7, 0xaa, 0x20, 0x35, 0x1a,
+    0x82, 0x7f, 0x44, 0x75, 0x8d, 0xf6, 0x07, 0xdc, 0x07, 0xa8, 0x2d, 0x83,
+    0x7f, 0x26, 0x2d, 0xa2, 0x07, 0xd4, 0x06, 0xbf, 0x62, 0x54, 0x8b, 0xca,
+    0x02, 0xa3, 0xb2, 0x74, 0x16, 0xcf, 0x52, 0x57, 0x6d, 0xca, 0x8e, 0x16,
+    0x73, 0xcd, 0xf7, 0xf0, 0xbd, 0xcf, 0xf7, 0x07, 0xda, 0xd4, 0xa7, 0x1d,
+    0x69, 0x69, 0xb4, 0x43, 0x4d, 0x55, 0xbf, 0xe6, 0x03, 0x6a, 0x87, 0x68,
+    0xc0, 0x7d, 0xb5, 0xdb, 0x44, 0xcd, 0x10, 0x51, 0xfc, 0x42, 0xa3, 0xa1,
+    0xfa, 0x86, 0x23, 0x54, 0xfe, 0xd7, 0x71, 0xa0, 0xf9, 0x3c, 0x8e, 0x3f,
+    0x6e, 0xa2, 0x67, 0xbc, 0xfd, 0x5a, 0x51, 0x77, 0xe9, 0x79, 0x4b, 0xca,
+    0xd7, 0x53, 0x83, 0xfa, 0x7d, 0xd5, 0xe6, 0xf1, 0x19, 0xf5, 0xb4, 0x2a,
+    0x6a, 0x1c, 0xa2, 0xa1, 0x2a, 0x71, 0x58, 0x62, 0x8a, 0xaa, 0x7a, 0x08,
+    0x77, 0xd5, 0xbe, 0x40, 0x1d, 0xad, 0x48, 0xcb, 0x1e, 0x8f, 0x3d, 0x0e,
+    0x77, 0x84, 0x50, 0xdc, 0x87, 0x07, 0x8c, 0x4a, 0xf6, 0x9f, 0x7d, 0x4f,
+    0x8e, 0x5d, 0xd8, 0xa0, 0xaa, 0x0d, 0x1b, 0xdc, 0x1e, 0xc3, 0x16, 0x3d,
+    0x85, 0x03, 0x2e, 0xf8, 0x1b, 0xc3, 0xb1, 0x69, 0x50, 0xff, 0x7a, 0x2a,
+    0xab, 0xa1, 0xab, 0xd1, 0x6b, 0xbe, 0xad, 0x49, 0xf1, 0xf5, 0x8c, 0x8e,
+    0x65, 0x45, 0xc2, 0x02, 0xb5, 0x4f, 0x68, 0x08, 0xbb, 0x9e, 0xec, 0x7b,
+    0x3c, 0x0c, 0xe1, 0x53, 0x55, 0x62, 0x32, 0x4a, 0x56, 0x6d, 0x5d, 0xb5,
+    0x38, 0xe2, 0x2f, 0x6c, 0x9e, 0x30, 0x6b, 0x1a, 0xaa, 0x23, 0x54, 0x57,
+    0xfb, 0x36, 0xdf, 0xa2, 0x01, 0xb3, 0x52, 0xa1, 0x28, 0x6f, 0x09, 0xfd,
+    0xf4, 0xa5, 0x20, 0x2d, 0xed, 0x49, 0x3d, 0x3c, 0xde, 0x8d, 0x2a, 0x5a,
+    0xd2, 0xe2, 0xcd, 0x01, 0x33, 0x9f, 0xe5, 0xf1, 0xf9, 0xcb, 0xa1, 0x2a,
+    0x4b, 0xdc, 0x3e, 0x86, 0x14, 0x37, 0x5d, 0x8d, 0x28, 0x06, 0x72, 0x67,
+    0x74, 0xda, 0xa2, 0xe2, 0x2b, 0xb3, 0xa5, 0x2d, 0xa3, 0x82, 0xd4, 0xa4,
+    0xcf, 0x69, 0x8f, 0xda, 0xa1, 0x43, 0x3d, 0x6e, 0xe9, 0x19, 0xe5, 0xa8,
+    0xa0, 0xd5, 0x13, 0x0e, 0x51, 0x7e, 0x20, 0x4f, 0xb8, 0x3f, 0x91, 0x23,
+    0x65, 0x4d, 0x60, 0xdd, 0xb6, 0xdd, 0xf6, 0x5f, 0x68, 0x45, 0x6b, 0xfc,
+    0x78, 0xda, 0x92, 0xbe, 0xc4, 0x7d, 0xb4, 0x25, 0x94, 0x92, 0x26, 0x9f,
+    0x77, 0x2f, 0x41, 0x49, 0x28, 0xc5, 0xe5, 0x79, 0x1b, 0x0e, 0xb4, 0x27,
+    0xed, 0x5e, 0x78, 0xf0, 0x59, 0x34, 0x6a, 0x15, 0xc7, 0xe7, 0x72, 0xd7,
+    0x0a, 0xde, 0x40, 0x5f, 0x6b, 0x9c, 0x57, 0x14, 0xd5, 0x55, 0x71, 0x3e,
+    0xcc, 0x25, 0xb3, 0xfa, 0x86, 0xf3, 0x04, 0x37, 0x1b, 0xe9, 0xa4, 0xd9,
+    0x72, 0x85, 0x9b, 0x20, 0x3e, 0x37, 0xa8, 0xff, 0xaa, 0x35, 0x38, 0xff,
+    0xb0, 0xdb, 0xc5, 0x1b, 0xd1, 0xea, 0x0f, 0x71, 0x1c, 0x9f, 0x87, 0x06,
+    0xd5, 0xb5, 0xa6, 0x62, 0x1d, 0x7f, 0x3c, 0x0f, 0xc7, 0x6d, 0x38, 0x1c,
+    0x3b, 0x8d, 0xbb, 0xca, 0x3e, 0x6e, 0x78, 0x2f, 0xab, 0x4e, 0xda, 0x74,
+    0x64, 0xa8, 0x98, 0xe3, 0xf2, 0x1e, 0xd7, 0x88, 0xd9, 0xeb, 0xed, 0x7a,
+    0xa6, 0x89, 0x92, 0x2e, 0x8f, 0x66, 0x19, 0x6e, 0x98, 0xee, 0x93, 0x34,
+    0x3a, 0x9a, 0x25, 0x8c, 0x53, 0x35, 0x7b, 0xd9, 0x1b, 0x79, 0x7c, 0x1e,
+    0x9e, 0xf6, 0xdc, 0x4b, 0x79, 0x4f, 0x08, 0xbd, 0x3b, 0xb1, 0x0e, 0xdc,
+    0xd5, 0xe4, 0x39, 0x17, 0x2e, 0x39, 0x8b, 0x71, 0xa5, 0x06, 0xe2, 0x1c,
+    0x37, 0xc1, 0x22, 0xee, 0x5e, 0xce, 0x87, 0xfe, 0xa4, 0x86, 0xef, 0x96,
+    0xbc, 0xb0, 0x26, 0x57, 0xed, 0x3e, 0x67, 0x8e, 0xc6, 0x2d, 0x67, 0x6d,
+    0x3c, 0xec, 0xd1, 0xe7, 0x5d, 0x8f, 0x2f, 0x95, 0xa1, 0x23, 0x25, 0xe7,
+    0x82, 0x94, 0x38, 0xfc, 0xba, 0x2d, 0xc3, 0xae, 0xc7, 0xe1, 0x80, 0x9a,
+    0x0e, 0x84, 0x54, 0x43, 0x5a, 0x32, 0x74, 0xa8, 0xc0, 0xe1, 0xf8, 0xb4,
+    0xb9, 0x74, 0xd7, 0x1c, 0x37, 0xe7, 0xed, 0x91, 0x52, 0xd2, 0x86, 0x55,
+    0xdb, 0x1d, 0x69, 0x48, 0x3a, 0x2a, 0x06, 0xff, 0x80, 0x6b, 0x5c, 0xd0,
+    0x90, 0x05, 0x19, 0xea, 0x31, 0x3a, 0x09, 0x4f, 0x54, 0xed, 0x01, 0xf7,
+    0x15, 0xe5, 0x1a, 0x46, 0x62, 0x8c, 0x36, 0xa1, 0xe9, 0xd2, 0xbc, 0xa7,
+    0x6a, 0xa8, 0xb6, 0x35, 0x56, 0x35, 0x08, 0x95, 0x27, 0x1e, 0xb7, 0x7c,
+    0x20, 0xee, 0x48, 0xdf, 0x88, 0xa1, 0x2a, 0x25, 0x18, 0x20, 0x04, 0xbc,
+    0x21, 0x5f, 0xe8, 0x6b, 0x87, 0x7f, 0x27, 0xd8, 0x8f, 0xa1, 0xc6, 0xea,
+    0xf1, 0x80, 0x29, 0xe0, 0x0c, 0xc7, 0x6d, 0x53, 0xd1, 0xc7, 0xb1, 0x63,
+    0x51, 0xd7, 0x61, 0xd4, 0xa3, 0xb6, 0xc0, 0xb9, 0x78, 0x7f, 0x53, 0x1c,
+    0xfb, 0x81, 0xf4, 0x79, 0x47, 0xaa, 0x96, 0xe2, 0x5e, 0x56, 0xf6, 0xa5,
+    0xac, 0x06, 0xb4, 0xad, 0x71, 0xf9, 0xa8, 0x57, 0x3b, 0x32, 0x4f, 0xf2,
+    0xa5, 0x12, 0xef, 0xd0, 0xb1, 0xa6, 0xf2, 0xa5, 0x3c, 0x8f, 0x1a, 0xf2,
+    0x2d, 0xda, 0x91, 0xe2, 0x38, 0x44, 0x55, 0xdb, 0xe2, 0x5e, 0xb4, 0xc4,
+    0xe6, 0x8f, 0x23, 0x65, 0xd3, 0xa1, 0xb2, 0x64, 0xee, 0x8c, 0xcf, 0x5c,
+    0xf4, 0xa4, 0x0f, 0x4f, 0x81, 0x88, 0x67, 0xcd, 0x9a, 0xe2, 0x80, 0x8b,
+    0xaf, 0x5b, 0xf2, 0x02, 0x8d, 0x46, 0x65, 0x45, 0x1e, 0x5d, 0x43, 0x67,
+    0x8c, 0x4e, 0x30, 0x72, 0x34, 0xae, 0x51, 0xbb, 0xd0, 0xd7, 0x1e, 0x9b,
+    0x2d, 0xee, 0x1f, 0xf3, 0x5c, 0x69, 0xe4, 0x4d, 0x8e, 0x86, 0xae, 0x6a,
+    0x23, 0x7d, 0x38, 0x78, 0xa4, 0xc9, 0x91, 0x42, 0xe9, 0x93, 0x34, 0x87,
+    0x8f, 0x47, 0xdd, 0x35, 0x18, 0xf5, 0xc5, 0xc1, 0xe9, 0x1a, 0x36, 0x0a,
+    0x76, 0x15, 0xae, 0xcb, 0xcd, 0x77, 0x05, 0x84, 0xa3, 0x96, 0x4b, 0xfb,
+    0x04, 0x23, 0x2a, 0x58, 0x45, 0xb5, 0xc3, 0x20, 0xdf, 0x0b, 0x25, 0x2e,
+    0x48, 0x8f, 0x18, 0x58, 0xb8, 0x5a, 0xcc, 0x07, 0x2a, 0x6f, 0xf2, 0x80,
+    0xa9, 0x72, 0x2f, 0xc3, 0xc3, 0x81, 0xd4, 0x55, 0x19, 0x0c, 0x55, 0xfd,
+    0x84, 0xfb, 0x31, 0x18, 0x82, 0xa4, 0xbb, 0x74, 0xfe, 0x2c, 0xcd, 0x70,
+    0x13, 0xcc, 0x96, 0x09, 0xff, 0xcf, 0x8a, 0x81, 0x49, 0x8d, 0xf7, 0xb8,
+    0x2d, 0x5d, 0xa3, 0x64, 0x0c, 0x39, 0x18, 0xe6, 0x2a, 0x32, 0x2d, 0xb8,
+    0xa5, 0x6c, 0xc0, 0x2a, 0x98, 0x2e, 0x48, 0x5d, 0xa3, 0x6e, 0xc0, 0xb9,
+    0x7a, 0xd8, 0xc8, 0x02, 0x16, 0xf9, 0x52, 0x7f, 0x19, 0xd2, 0xc3, 0xe9,
+    0x52, 0xdf, 0x4c, 0x40, 0x56, 0xa8, 0xb2, 0x09, 0x48, 0x22, 0x3f, 0x55,
+    0x4d, 0x47, 0x7a, 0x8a, 0x5a, 0x7a, 0x9e, 0xf1, 0xe9, 0x08, 0x03, 0xc1,
+    0x06, 0xbd, 0x44, 0xcf, 0x55, 0x49, 0x0f, 0x22, 0x21, 0x6b, 0xce, 0xdf,
+    0xc0, 0xac, 0x28, 0x5e, 0xd9, 0x9f, 0x6a, 0x4c, 0xa9, 0xd6, 0x86, 0x68,
+    0x96, 0xce, 0x71, 0xb3, 0xe1, 0x40, 0xd0, 0x63, 0x36, 0x1d, 0x62, 0x5c,
+    0xd2, 0xd1, 0xaa, 0xa9, 0xbe, 0xe1, 0xa1, 0xc3, 0xb8, 0xdc, 0xe8, 0x18,
+    0xf6, 0x0f, 0x3d, 0xc6, 0xbf, 0xa1, 0x76, 0x08, 0xff, 0xbe, 0xaf, 0x1a,
+    0x12, 0xbe, 0xff, 0x63, 0x4f, 0xaa, 0x32, 0x60, 0x9c, 0xf7, 0xe1, 0x3f,
+    0xe1, 0xfa, 0x09, 0x33, 0x38, 0x67, 0x85, 0xa8, 0x0e, 0xb5, 0x29, 0x84,
+    0x6a, 0x8b, 0x36, 0xc0, 0x2c, 0xde, 0xae, 0xc6, 0x1a, 0xb3, 0x19, 0x38,
+    0x43, 0x17, 0xe4, 0x02, 0xfa, 0x10, 0x25, 0x7d, 0x85, 0x5b, 0x9a, 0x1f,
+    0x48, 0x5f, 0x7d, 0x23, 0x2d, 0x45, 0x35, 0x28, 0x2d, 0xab, 0x5e, 0xcc,
+    0x13, 0x64, 0x68, 0x6f, 0xf4, 0x8a, 0x22, 0xee, 0xcd, 0x9e, 0x3c, 0x07,
+    0xcf, 0x3d, 0xea, 0x36, 0xaa, 0x3a, 0x83, 0xed, 0x92, 0x54, 0xa3, 0x91,
+    0x25, 0xac, 0x48, 0x86, 0x01, 0x6f, 0x5a, 0x34, 0x50, 0xd4, 0xd3, 0x8b,
+    0x2a, 0x0e, 0x2e, 0x1d, 0x2a, 0xbe, 0xe6, 0xa2, 0xc0, 0xf7, 0xc6, 0xf9,
+    0xef, 0x1a, 0x5c, 0x56, 0x28, 0x40, 0x75, 0xcd, 0xa7, 0x79, 0x9f, 0x98,
+    0x86, 0x43, 0xb5, 0x3f, 0x70, 0xd9, 0x1e, 0x0d, 0x94, 0xbb, 0xff, 0x2e,
+    0x74, 0x14, 0x88, 0x69, 0xc3, 0xdd, 0x89, 0x0f, 0xbc, 0x40, 0xf9, 0x18,
+    0x7a, 0xfe, 0x3c, 0x23, 0x1d, 0xee, 0x51, 0x44, 0xda, 0xfa, 0x35, 0xc8,
+    0x23, 0x12, 0x75, 0x3d, 0xe6, 0xe8, 0x18, 0x2a, 0xf9, 0x67, 0xd2, 0x97,
+    0xda, 0x88, 0x58, 0xa4, 0xb8, 0x91, 0xe3, 0xe5, 0xe8, 0x9e, 0x31, 0x7d,
+    0x23, 0x6c, 0xfe, 0xb1, 0x31, 0xc6, 0x92, 0xec, 0x66, 0xa0, 0x4d, 0xf2,
+    0x8c, 0x3c, 0x4f, 0x49, 0x67, 0x0e, 0x39, 0x1e, 0x58, 0xb2, 0x41, 0xc1,
+    0x97, 0xa2, 0x46, 0xc3, 0xf0, 0xf9, 0x77, 0xa2, 0x0d, 0x8f, 0x9e, 0x89,
+    0xa9, 0x6a, 0x63, 0x34, 0x0f, 0xc7, 0x27, 0xf8, 0x9c, 0x68, 0x04, 0x78,
+    0x5e, 0x68, 0x44, 0xaa, 0x3d, 0xeb, 0xfc, 0x4c, 0x7b, 0x5e, 0x6a, 0xcf,
+    0xeb, 0xcb, 0x73, 0x0c, 0x34, 0xc1, 0x0a, 0x61, 0x2d, 0x09, 0xa0, 0x52,
+    0x40, 0x2d, 0x00, 0x95, 0x01, 0x6a, 0x09, 0xa8, 0x15, 0xa0, 0xd6, 0x80,
+    0x7a, 0xd0, 0xa9, 0x04, 0x12, 0xa9, 0xf6, 0x7c, 0x31, 0x2b, 0x01, 0xcd,
+    0x4f, 0x40, 0x83, 0x13, 0xa8, 0x01, 0x34, 0x38, 0x01, 0x0d, 0x4e, 0x21,
+    0xa1, 0x3f, 0x67, 0xda, 0xf3, 0xa5, 0xd7, 0xc0, 0xdb, 0x0b, 0x4d, 0x28,
+    0xd3, 0xfb, 0x0f, 0x74, 0x43, 0x06, 0xa4, 0x96, 0xda, 0xf3, 0x45, 0x2d,
+    0xe8, 0xa9, 0x95, 0xae, 0x6a, 0x05, 0x4b, 0x2e, 0xaf, 0x80, 0x0e, 0x64,
+    0xfd, 0xf7, 0x23, 0x46, 0xbb, 0x18, 0x8f, 0x27, 0x01, 0xe2, 0x8b, 0xd9,
+    0x7c, 0xb9, 0x5c, 0x7d, 0x3c, 0x3b, 0xc7, 0x70, 0x72, 0x91, 0x5b, 0xcf,
+    0xd2, 0x34, 0x4d, 0x75, 0xb9, 0x35, 0x70, 0x88, 0x14, 0x9b, 0x27, 0xb3,
+    0x4c, 0x17, 0x5a, 0x02, 0x27, 0x28, 0xa1, 0xe5, 0x6c, 0x69, 0x54, 0x9a,
+    0xc9, 0xa2, 0x24, 0xbe, 0x70, 0xb3, 0xcb, 0x1b, 0x49, 0x3c, 0x5b, 0x1b,
+    0xd5, 0x2f, 0x80, 0x1f, 0x94, 0x9c, 0x56, 0xf9, 0x4a, 0x63, 0x3f, 0x58,
+    0x56, 0xa6, 0xc0, 0x27, 0x52, 0x2e, 0x4d, 0x0d, 0x2b, 0xf5, 0x51, 0xf4,
+    0xa0, 0xc9, 0xad, 0x74, 0x2b, 0x93, 0xb1, 0xf5, 0x0b, 0xad, 0xf5, 0x30,
+    0x54, 0xd9, 0x48, 0x53, 0x42, 0x73, 0xd3, 0x7a, 0xdd, 0x1d, 0x99, 0x65,
+    0x68, 0x02, 0x63, 0x5a, 0x0a, 0x66, 0x7a, 0x55, 0x9a, 0x03, 0x32, 0xcb,
+    0xa1, 0x0b, 0x73, 0x98, 0x2a, 0xc9, 0xb5, 0x65, 0xac, 0xb2, 0x63, 0xa9,
+    0x2b, 0x37, 0xe2, 0x62, 0xad, 0x64, 0xa0, 0xa7, 0x97, 0x46, 0xfc, 0x2b,
+    0x29, 0xcb, 0xd5, 0x9a, 0x5b, 0x56, 0x96, 0x57, 0xd7, 0x46, 0x68, 0x2b,
+    0x41, 0xbd, 0x26, 0xcd, 0x0f, 0x2b, 0xd3, 0xaf, 0x8b, 0xd1, 0x84, 0xb5,
+    0x66, 0x42, 0x62, 0xb8, 0x62, 0xa9, 0x64, 0x4c, 0x77, 0x43, 0x44, 0x5a,
+    0x8d, 0xb6, 0xae, 0x81, 0xbf, 0x21, 0xec, 0x26, 0x9a, 0x53, 0x1e, 0x4c,
+    0xd7, 0x26, 0x9a, 0x67, 0x1e, 0x2c, 0xd7, 0x3a, 0x93, 0x08, 0xc4, 0xba,
+    0x6c, 0x34, 0x88, 0x6f, 0x70, 0x08, 0xb6, 0x9c, 0x77, 0x4f, 0x42, 0x87,
+    0xb5, 0xce, 0xd8, 0x3c, 0x1f, 0x2a, 0x8a, 0x39, 0x70, 0xb0, 0xe9, 0x2c,
+    0x9f, 0x5a, 0x18, 0xb0, 0xd1, 0x54, 0x65, 0x59, 0x63, 0x81, 0x1c, 0x82,
+    0x53, 0x60, 0xb6, 0x68, 0x32, 0xd6, 0x50, 0xe3, 0x8c, 0xe4, 0x38, 0xe0,
+    0x3e, 0x2a, 0x7b, 0xb4, 0x17, 0x5b, 0x13, 0x80, 0x2d, 0xd6, 0x7b, 0xb2,
+    0x80, 0x2d, 0x8f, 0x1c, 0xdc, 0xc1, 0x66, 0xda, 0x52, 0x6f, 0x5f, 0xf6,
+    0x80, 0x5e, 0x72, 0x2c, 0xce, 0xc6, 0xd9, 0xef, 0x66, 0x5c, 0xd0, 0xeb,
+    0x6f, 0x44, 0x62, 0xa6, 0xfd, 0xf6, 0x69, 0xeb, 0xb5, 0x69, 0x0f, 0x50,
+    0xef, 0x9f, 0x01, 0xe9, 0x62, 0x01, 0x70, 0xf8, 0xdf, 0x28, 0x1f, 0x48,
+    0xed, 0xfa, 0x94, 0x47, 0x5f, 0xea, 0xcb, 0xcd, 0x02, 0x36, 0xd9, 0x1f,
+    0x97, 0x34, 0x6c, 0x29, 0xc3, 0xba, 0x43, 0x6e, 0xd1, 0x2c, 0x16, 0x0b,
+    0xf9, 0xd8, 0xef, 0xb7, 0xe8, 0x53, 0x1c, 0xb2, 0xbf, 0xd9, 0xfa, 0x6e,
+    0x63, 0x2d, 0x94, 0x3e, 0x3c, 0x3c, 0x3c, 0x28, 0x2e, 0xf3, 0x6f, 0xa0,
+    0x6d, 0x4a, 0x6d, 0xac, 0x1d, 0xab, 0x0f, 0x78, 0xc9, 0xfe, 0x44, 0xdb,
+    0x2f, 0x0b, 0x34, 0x31, 0x32, 0xa4, 0xc3, 0xd9, 0xf2, 0xf8, 0x38, 0xe4,
+    0x49, 0x07, 0xfd, 0x1e, 0xf1, 0x6d, 0x2d, 0xd0, 0xf3, 0xb9, 0xed, 0x0c,
+    0xb9, 0xf9, 0xa5, 0x55, 0x5c, 0x35, 0x68, 0x8f, 0xc7, 0x15, 0xc2, 0x9e,
+    0x69, 0xc7, 0x2d, 0xfd, 0xc4, 0xe2, 0x09, 0xf5, 0x61, 0x8d, 0x77, 0x34,
+    0xa0, 0xa4, 0x13, 0x0f, 0x62, 0x87, 0x28, 0xdc, 0xf5, 0xa4, 0xf9, 0xa4,
+    0xd9, 0x71, 0x17, 0xf2, 0xd6, 0x47, 0x03, 0x25, 0xdd, 0xa7, 0x45, 0xfc,
+    0x31, 0xd4, 0x3b, 0x25, 0xce, 0xee, 0xee, 0x42, 0x4a, 0x3e, 0xe9, 0xbc,
+    0xf9, 0xdd, 0xdd, 0xdd, 0xc6, 0xdb, 0x06, 0x51, 0xf5, 0xa5, 0x29, 0x5a,
+    0x4d, 0xa6, 0xe6, 0xc0, 0xac, 0x6d, 0xee, 0x52, 0xfc, 0x3f, 0x54, 0x78,
+    0xb6, 0xfb, 0x54, 0xdb, 0x3d, 0x04, 0x3e, 0x90, 0x7b, 0x8c, 0xe0, 0x05,
+    0xc1, 0x83, 0xdb, 0x19, 0x07, 0x54, 0x92, 0xe7, 0x3c, 0x0e, 0xd8, 0x1f,
+    0x1b, 0x2b, 0xa0, 0xc6, 0xec, 0x2e, 0xa8, 0xda, 0x01, 0xd3, 0x90, 0x95,
+    0x2e, 0x8d, 0xd2, 0x44, 0x16, 0x6e, 0xfe, 0x7a, 0x7a, 0xd4, 0x52, 0x5a,
+    0xed, 0x3d, 0x02, 0x8b, 0xd4, 0x16, 0x51, 0xe8, 0xe4, 0xe6, 0x0e, 0x83,
+    0x2f, 0x85, 0x0e, 0x2c, 0x18, 0xcb, 0xec, 0xd1, 0xaa, 0xed, 0x46, 0x69,
+    0xf1, 0x62, 0x7b, 0x93, 0x73, 0x09, 0x0b, 0x7f, 0xfa, 0x9a, 0xcf, 0x16,
+    0x0a, 0xab, 0x5b, 0xc2, 0x30, 0xbc, 0x26, 0xcf, 0xd8, 0xd8, 0x64, 0x11,
+    0x7d, 0x24, 0x23, 0x08, 0xd2, 0x12, 0xdf, 0x23, 0xfc, 0x84, 0x5b, 0x3a,
+    0x88, 0x3d, 0x0f, 0x18, 0x53, 0x7c, 0x93, 0x00, 0x6e, 0x34, 0x03, 0x81,
+    0xae, 0xaf, 0xd8, 0xfe, 0x38, 0x34, 0x52, 0xc0, 0x39, 0x2e, 0x43, 0xe4,
+    0x94, 0x45, 0x4e, 0x61, 0x7b, 0xfb, 0xfa, 0x43, 0x1c, 0xaf, 0xd6, 0x78,
+    0xa5, 0x30, 0x67, 0xb7, 0xdb, 0x5d, 0x05, 0x4c, 0xb5, 0x1f, 0x63, 0x60,
+    0xc5, 0x85, 0xe6, 0xf9, 0x51, 0x43, 0xa7, 0xf9, 0x7c, 0xee, 0x2b, 0x83,
+    0xa3, 0xe5, 0x5a, 0xd5, 0xf9, 0xae, 0xea, 0x07, 0x1a, 0x15, 0x87, 0xaa,
+    0x56, 0xfb, 0x3c, 0x11, 0x25, 0x5d, 0xc4, 0x70, 0x43, 0x83, 0xac, 0x0d,
+    0xd8, 0x60, 0x37, 0x4b, 0xaf, 0x56, 0x52, 0x23, 0x57, 0x1d, 0xbc, 0xe5,
+    0xfe, 0x4a, 0x7c, 0xc5, 0xbd, 0x9c, 0x2c, 0x8c, 0x3e, 0x65, 0x3b, 0xb4,
+    0xfa, 0x86, 0x2c, 0xef, 0xf8, 0xc7, 0xd0, 0x5d, 0x58, 0x22, 0x8a, 0xa7,
+    0xca, 0x68, 0xd5, 0xe0, 0xa8, 0x26, 0x05, 0xaa, 0xaf, 0x49, 0xf9, 0xca,
+    0x71, 0x83, 0x2a, 0xef, 0xcb, 0x0d, 0x69, 0xe9, 0xc1, 0x57, 0x28, 0xf7,
+    0x30, 0x3d, 0xa5, 0x1d, 0x1a, 0x06, 0x96, 0x43, 0x7d, 0xe5, 0x72, 0xc3,
+    0xd0, 0x53, 0x4a, 0x71, 0xed, 0x2f, 0x7a, 0xa1, 0xde, 0xb2, 0x09, 0x43,
+    0x8f, 0xbd, 0x57, 0xe5, 0x33, 0xc6, 0x5f, 0x41, 0x99, 0xdc, 0xa9, 0xd7,
+    0x38, 0xe3, 0x0e, 0x22, 0x48, 0xd6, 0xb3, 0x25, 0x6e, 0x36, 0xce, 0x09,
+    0xa3, 0x9d, 0xa2, 0x8b, 0xa2, 0x70, 0x41, 0x06, 0xc7, 0x47, 0x09, 0xac,
+    0x69, 0xf7, 0x12, 0x7c, 0x28, 0xcb, 0x72, 0x73, 0xbd, 0x5c, 0x0f, 0xbc,
+    0x45, 0xf7, 0xe2, 0x99, 0x73, 0x7e, 0xff, 0x34, 0xef, 0xd2, 0x45, 0xe2,
+    0xc3, 0x19, 0xeb, 0xa7, 0xc7, 0xbb, 0xff, 0xad, 0xd6, 0xff, 0x35, 0xec,
+    0xd4, 0xa3, 0xf1, 0x62, 0x67, 0xc2, 0xec, 0xcc, 0xc6, 0x59, 0xa4, 0x5b,
+    0x1c, 0xe4, 0x20, 0x67, 0x08, 0x5f, 0x95, 0xd0, 0x02, 0xf9, 0x26, 0xd9,
+    0x69, 0x29, 0x11, 0xd4, 0x93, 0x22, 0x22, 0xb4, 0x27, 0x45, 0xd4, 0x47,
+    0x8a, 0x29, 0x99, 0x31, 0xcc, 0x27, 0xa5, 0xd4, 0xd7, 0x81, 0x29, 0x19,
+    0x16, 0xf2, 0x57, 0x04, 0x5e, 0xe8, 0x15, 0x89, 0xab, 0x1d, 0xc3, 0x40,
+    0x60, 0x52, 0x80, 0x43, 0x81, 0x2d, 0x21, 0xd7, 0x4e, 0x16, 0x5f, 0xc1,
+    0x82, 0x39, 0x61, 0x33, 0x26, 0x3c, 0xf3, 0xe4, 0x61, 0x87, 0xd1, 0x64,
+    0x68, 0x7d, 0x9f, 0x06, 0xe3, 0x03, 0xd7, 0xa4, 0x69, 0xbb, 0xaa, 0xbe,
+    0xd2, 0x3b, 0xe2, 0x9b, 0x98, 0xd1, 0x12, 0x7a, 0xa8, 0xda, 0x31, 0x91,
+    0xf3, 0x56, 0x6c, 0x54, 0x11, 0x8b, 0x4a, 0xb6, 0xe2, 0x09, 0x1c, 0xcd,
+    0x13, 0x8f, 0xaa, 0x65, 0xa1, 0x55, 0xc2, 0xeb, 0x52, 0x53, 0x09, 0x0e,
+    0x27, 0xb1, 0xf3, 0x4b, 0x87, 0x3b, 0xe2, 0xb4, 0x2f, 0x8d, 0x13, 0x51,
+    0x77, 0x93, 0x94, 0x16, 0x79, 0x37, 0xcb, 0x5f, 0x97, 0x14, 0x11, 0x78,
+    0x55, 0x4c, 0x44, 0xe1, 0x55, 0x31, 0x19, 0x89, 0x57, 0xe5, 0xc6, 0x68,
+    0xbc, 0x2a, 0x29, 0x23, 0xf2, 0xaa, 0x1c, 0x8b, 0xca, 0x1b, 0x84, 0x5e,
+    0xe8, 0x0d, 0x52, 0x37, 0x75, 0x1c, 0x8b, 0xd0, 0xab, 0x42, 0x3c, 0x4a,
+    0xdd, 0x52, 0x22, 0x52, 0xdd, 0x65, 0x2a, 0x5a, 0xed, 0x4f, 0xd2, 0xfa,
+    0xbc, 0xde, 0xb1, 0x5e, 0x46, 0xb8, 0xc4, 0xa5, 0x9a, 0x22, 0x17, 0xa8,
+    0x4c, 0xca, 0x74, 0x32, 0x98, 0xff, 0x26, 0x15, 0x7c, 0xe9, 0x31, 0x2a,
+    0xd9, 0x2e, 0x88, 0xcb, 0x5e, 0x67, 0xd9, 0x68, 0xef, 0x58, 0xea, 0x98,
+    0xff, 0x63, 0x8c, 0x55, 0xc5, 0xab, 0xd5, 0xca, 0x80, 0x9d, 0xa2, 0x28,
+    0x6c, 0x43, 0x39, 0x3e, 0xe4, 0x55, 0xfb, 0x84, 0xea, 0xaa, 0xf4, 0xa1,
+    0xa4, 0xab, 0x1c, 0xa2, 0xa5, 0x92, 0x90, 0xe7, 0x20, 0x3e, 0x6c, 0x1f,
+    0x16, 0x68, 0xb1, 0x36, 0x1a, 0x80, 0x1f, 0xd2, 0x24, 0x29, 0x6f, 0xc3,
+    0x3d, 0xa5, 0xf0, 0x56, 0x14, 0xbc, 0x49, 0x5e, 0xc7, 0x44, 0xf8, 0x82,
+    0x42, 0x48, 0x7f, 0x53, 0xe5, 0xe9, 0x0c, 0xb9, 0x61, 0x98, 0xf0, 0x23,
+    0x2f, 0x9e, 0xb9, 0x91, 0xed, 0x97, 0xcb, 0x4a, 0x4c, 0xf7, 0x73, 0x73,
+    0xac, 0x69, 0xd5, 0xb1, 0x43, 0x44, 0xfa, 0xf9, 0x00, 0x4d, 0xae, 0x46,
+    0x5b, 0x5c, 0x43, 0x5c, 0x0d, 0xd8, 0x2c, 0x46, 0x97, 0x19, 0xbf, 0xb8,
+    0x8f, 0x2b, 0x39, 0xf8, 0x55, 0x3d, 0x16, 0x1f, 0xd4, 0xcd, 0x8d, 0x3c,
+    0xa1, 0x5f, 0x7c, 0x64, 0x07, 0x50, 0xbd, 0xd1, 0xbe, 0x5c, 0x5f, 0x34,
+    0x71, 0x48, 0x17, 0x35, 0xa8, 0xa3, 0x4e, 0x8c, 0xa9, 0x06, 0x5b, 0x9a,
+    0xa6, 0x1b, 0xfb, 0x20, 0x94, 0xec, 0x12, 0x9c, 0xb1, 0x3f, 0xad, 0x5e,
+    0xf6, 0x89, 0xb5, 0xf8, 0x8a, 0xcb, 0xc9, 0x95, 0x93, 0x4b, 0xc8, 0x5c,
+    0x41, 0xf9, 0x64, 0xdc, 0x2b, 0xa9, 0x29, 0xe9, 0x6b, 0x72, 0xd6, 0xca,
+    0xca, 0x25, 0xc4, 0x87, 0xe3, 0x15, 0x19, 0x6b, 0x15, 0xe6, 0x12, 0xb2,
+    0x57, 0x63, 0x2e, 0x29, 0xd7, 0xaa, 0xcc, 0x25, 0x67, 0xaf, 0xce, 0x5c,
+    0x52, 0xc6, 0x2a, 0xcd, 0x2d, 0x02, 0x57, 0x6b, 0x4e, 0x99, 0x1b, 0x3a,
+    0xd3, 0x58, 0xbd, 0xb9, 0x44, 0xcc, 0x55, 0xdc, 0x28, 0xc3, 0x43, 0xc2,
+    0x55, 0x60, 0x2d, 0xf3, 0xc6, 0x92, 0x71, 0xb9, 0x07, 0xc7, 0xb9, 0x0a,
+    0x2b, 0x7e, 0xe8, 0x24, 0xf6, 0x0e, 0x4f, 0xb0, 0x64, 0xba, 0x55, 0x03,
+    0x5f, 0xb8, 0xe1, 0x52, 0x4e, 0x8f, 0x0e, 0xb8, 0xee, 0x22, 0xb1, 0xa6,
+    0x0a, 0x1d, 0x42, 0xe2, 0x64, 0x99, 0xa3, 0xc0, 0x36, 0x49, 0x95, 0x28,
+    0x93, 0xf4, 0xb2, 0x06, 0x0f, 0x03, 0xda, 0x63, 0x59, 0xd1, 0x4d, 0xa7,
+    0x2a, 0xc5, 0xca, 0xf2, 0x3c, 0x51, 0xc1, 0xc9, 0xde, 0x26, 0xf7, 0xdb,
+    0x29, 0x0f, 0x64, 0xca, 0xed, 0x7b, 0x03, 0x2d, 0xe0, 0xba, 0x6b, 0xea,
+    0x4d, 0x09, 0x7b, 0xda, 0x37, 0x16, 0xbe, 0xef, 0xb2, 0xb9, 0xdd, 0xa2,
+    0x11, 0xc3, 0x2e, 0xc7, 0x28, 0x63, 0xb6, 0x19, 0xcf, 0x76, 0x3d, 0xaf,
+    0x36, 0x62, 0x18, 0x4f, 0x25, 0x4a, 0xc4, 0x8d, 0x83, 0xf9, 0x1c, 0x62,
+    0xae, 0x3c, 0xea, 0xc3, 0xfc, 0x16, 0x71, 0x9c, 0xc7, 0xa5, 0x95, 0x71,
+    0x1c, 0x32, 0x27, 0x63, 0x3f, 0x1e, 0x37, 0xd6, 0xe7, 0x02, 0xbb, 0x16,
+    0xd1, 0x25, 0x06, 0xca, 0x8f, 0x28, 0x1b, 0x77, 0x2f, 0xbe, 0x57, 0xcc,
+    0x61, 0x05, 0x0a, 0x3d, 0x31, 0xa1, 0x9a, 0xc3, 0xf4, 0x5e, 0x7a, 0x2e,
+    0x0e, 0xa2, 0xb9, 0xb6, 0x09, 0xa6, 0x76, 0x08, 0xed, 0x93, 0xa3, 0xfc,
+    0x74, 0xe8, 0xfc, 0x4a, 0x93, 0xec, 0x0c, 0xed, 0x6a, 0x98, 0x4c, 0xcb,
+    0xdf, 0xa2, 0xaa, 0x2d, 0xf1, 0x4b, 0x9e, 0x5e, 0x51, 0x79, 0xd9, 0x4a,
+    0xbc, 0xae, 0x58, 0xdb, 0x76, 0x64, 0x0d, 0xb6, 0x4d, 0x5b, 0x74, 0x2f,
+    0x01, 0xfb, 0x27, 0x1e, 0x73, 0x1e, 0x4c, 0x9b, 0x93, 0xf5, 0x6b, 0x3b,
+    0x8e, 0x6f, 0x69, 0x8a, 0xbe, 0x51, 0xe9, 0x6d, 0xd5, 0x8d, 0xad, 0x79,
+    0x43, 0x0b, 0x8c, 0x5a, 0xa3, 0xc4, 0xf6, 0x73, 0x10, 0x07, 0xb2, 0x43,
+    0xae, 0x56, 0x0f, 0xf7, 0x94, 0xe5, 0xfc, 0xc3, 0x17, 0x38, 0x73, 0xfb,
+    0xab, 0xad, 0x25, 0xe3, 0xfa, 0xbe, 0x6d, 0x09, 0xe9, 0x9f, 0xd2, 0xbd,
+    0x42, 0xf3, 0x28, 0xb1, 0x8e, 0x05, 0x38, 0x84, 0xd2, 0xf1, 0x98, 0xc3,
+    0x84, 0x90, 0x7d, 0x94, 0x42, 0x13, 0xf2, 0x80, 0xfd, 0x2d, 0xe8, 0x2c,
+    0xa3, 0x8f, 0xef, 0x71, 0x83, 0xe9, 0xd5, 0x72, 0xb9, 0xf4, 0x00, 0xdd,
+    0xe5, 0xeb, 0xe3, 0x6c, 0xbd, 0x32, 0x20, 0x56, 0x56, 0x69, 0x84, 0xb8,
+    0xa6, 0xd2, 0x7a, 0x59, 0x1e, 0x7a, 0xe3, 0x5f, 0x67, 0x87, 0xa2, 0xc7,
+    0xb8, 0x15, 0x87, 0xdf, 0xc6, 0x03, 0x8d, 0x41, 0xbe, 0x58, 0xc7, 0xdd,
+    0xcb, 0xdd, 0x49, 0x33, 0x5b, 0x7e, 0x8b, 0x01, 0x67, 0x8d, 0xd5, 0x08,
+    0x58, 0x59, 0x98, 0x6b, 0x27, 0xd5, 0xf0, 0xff, 0xb7, 0xd2, 0xff, 0xaf,
+    0x6c, 0xa5, 0xeb, 0xeb, 0x11, 0xb0, 0x0c, 0x70, 0x1e, 0x6b, 0xd5, 0x10,
+    0xc9, 0x76, 0xb7, 0x56, 0xea, 0xf0, 0xb7, 0x55, 0xaa, 0x3b, 0xdc, 0x59,
+    0x68, 0x7b, 0xdc, 0x2b, 0xe6, 0x15, 0x00, 0x3e, 0xb7, 0x4a, 0x81, 0xd3,
+    0xad, 0x52, 0xe8, 0x75, 0xab, 0xd8, 0x74, 0xbb, 0x25, 0x00, 0xfd, 0x6e,
+    0x15, 0x6b, 0x8e, 0x77, 0x94, 0x5d, 0x3c, 0x6f, 0x17, 0x4e, 0x19, 0xac,
+    0xf9, 0xde, 0x2a, 0xe3, 0xce, 0x37, 0x7c, 0x1d, 0xbf, 0x6d, 0x06, 0xe7,
+    0x18, 0x28, 0xda, 0xa4, 0x8e, 0xa1, 0xdc, 0xc6, 0xb7, 0xf4, 0xfc, 0x9e,
+    0x59, 0x5a, 0xfc, 0x56, 0x30, 0xbe, 0x01, 0x9f, 0x45, 0xbb, 0x34, 0xa0,
+    0xe4, 0x6b, 0x69, 0xf0, 0x45, 0x21, 0x0e, 0x66, 0x6b, 0xdc, 0x9c, 0x65,
+    0xe5, 0xec, 0x3e, 0xd4, 0xe9, 0xfb, 0x3f, 0x61, 0xb0, 0xd7, 0xa3, 0x5d,
+    0xf5, 0x82, 0xcb, 0xd3, 0x38, 0xbd, 0xe2, 0xe4, 0x86, 0x27, 0x85, 0x98,
+    0x4f, 0xb1, 0xe2, 0x8d, 0x39, 0x2d, 0xe2, 0xaf, 0x55, 0x14, 0x37, 0xa1,
+    0x46, 0xd7, 0xd5, 0x40, 0x4f, 0xd6, 0x24, 0xed, 0x6c, 0x4a, 0xb0, 0x7f,
+    0xc9, 0xab, 0x48, 0xfc, 0x13, 0xb7, 0xb5, 0x8f, 0x10, 0x9b, 0x95, 0x68,
+    0xc7, 0x83, 0x46, 0x61, 0xb9, 0x83, 0xa1, 0xf9, 0x8e, 0x8b, 0xb3, 0x1b,
+    0x63, 0x55, 0xbb, 0x87, 0xcd, 0x6a, 0xbf, 0x1a, 0xfd, 0xeb, 0x3c, 0xbc,
+    0x62, 0x1f, 0xc6, 0x02, 0x8a, 0xc7, 0xf3, 0xe5, 0xda, 0x34, 0xe2, 0xe6,
+    0x77, 0x02, 0xb3, 0x13, 0x5c, 0xf9, 0xf8, 0xfa, 0xab, 0x0e, 0xeb, 0xdc,
+    0x82, 0xa6, 0x6b, 0xdc, 0x52, 0x03, 0xee, 0x50, 0x8f, 0x28, 0xe9, 0x27,
+    0xcf, 0xad, 0x4d, 0xad, 0xe1, 0xc6, 0xca, 0xcc, 0xca, 0x4f, 0x2e, 0x84,
+    0xe6, 0xa5, 0x7c, 0xf2, 0xd7, 0x1b, 0x47, 0x16, 0x2e, 0x73, 0x7b, 0xb4,
+    0x1d, 0x48, 0x7d, 0xa4, 0x58, 0x8c, 0x3f, 0xde, 0xc9, 0x62, 0x08, 0xda,
+    0xc3, 0xc4, 0x3d, 0x2a, 0xdd, 0xa6, 0x8e, 0xb5, 0x6a, 0xc3, 0x9a, 0x5f,
+    0x90, 0x10, 0xce, 0x94, 0x87, 0xab, 0x74, 0x3d, 0xe2, 0xdc, 0xc8, 0xcf,
+    0x0e, 0x1d, 0x7a, 0xc7, 0xf2, 0x6d, 0x59, 0x71, 0xb0, 0x49, 0x1c, 0x18,
+    0xf9, 0x79, 0xca, 0x54, 0x39, 0xed, 0x32, 0x6d, 0x05, 0xcd, 0x47, 0xc3,
+    0xf8, 0xde, 0xcf, 0xc6, 0x28, 0xce, 0xd1, 0x8e, 0x5e, 0x0e, 0xcb, 0xc9,
+    0x69, 0x5b, 0xc6, 0xa7, 0x6d, 0xe2, 0x3e, 0xc1, 0xfb, 0xff, 0x48, 0xb2,
+    0xdf, 0xaf, 0xdf, 0x6b, 0xf8, 0xc1, 0x6f, 0xe9, 0xdd, 0x30, 0xb0, 0xae,
+    0xd7, 0x0a, 0xea, 0xf8, 0xe5, 0xbd, 0xae, 0x73, 0x28, 0x7a, 0x76, 0xbb,
+    0x85, 0x5d, 0x7b, 0x51, 0x77, 0x64, 0xa2, 0xd7, 0x5c, 0x70, 0x37, 0x23,
+    0xe7, 0x45, 0xdd, 0xc5, 0x73, 0xbe, 0xe9, 0x8d, 0x90, 0x89, 0xd0, 0x78,
+    0x9b, 0xa2, 0xeb, 0xa1, 0xe6, 0x36, 0xc9, 0x71, 0x48, 0x53, 0xb3, 0x52,
+    0xd8, 0xa4, 0x5b, 0xc9, 0x87, 0xd5, 0x78, 0x35, 0x4b, 0xf1, 0x85, 0x42,
+    0x36, 0x6e, 0x29, 0x39, 0x16, 0x07, 0xb8, 0x10, 0x8f, 0x6f, 0x1f, 0xc0,
+    0xce, 0xf8, 0x0d, 0x9d, 0x41, 0x6d, 0x6f, 0x0b, 0xb3, 0xcd, 0x62, 0x05,
+    0x9c, 0x97, 0xe5, 0x95, 0xd8, 0x6d, 0x3d, 0xbf, 0x01, 0x2e, 0x24, 0x02,
+    0x76, 0xe3, 0x3d, 0xc8, 0x39, 0x4f, 0xb6, 0xe3, 0x02, 0x7e, 0x76, 0x39,
+    0x3a, 0xf9, 0xbd, 0x26, 0x39, 0x37, 0x89, 0xb5, 0xfd, 0x6a, 0x1d, 0x0f,
+    0xcd, 0x2b, 0x8c, 0xc7, 0xae, 0xc3, 0x7d, 0x81, 0x86, 0xf1, 0xdb, 0x44,
+    0xb6, 0xcc, 0xca, 0xe5, 0xe2, 0x6c, 0x26, 0x85, 0xcb, 0x97, 0x0b, 0x27,
+    0x40, 0x4d, 0x6d, 0xab, 0x73, 0x49, 0xe3, 0xe4, 0xd9, 0x64, 0x02, 0xf2,
+    0x6c, 0xbc, 0x00, 0x3d, 0xa7, 0xf1, 0xcc, 0x58, 0xe6, 0x2a, 0x0e, 0xcc,
+    0xc0, 0xb4, 0x4e, 0x4a, 0xda, 0x97, 0x8a, 0x27, 0x01, 0x8d, 0x29, 0x31,
+    0x1b, 0x0a, 0x76, 0x4b, 0xae, 0x56, 0xc5, 0x3e, 0x00, 0x81, 0x78, 0x96,
+    0x47, 0xc5, 0xa6, 0x6a, 0xf1, 0xc9, 0xf0, 0xeb, 0xa9, 0xec, 0x98, 0x99,
+    0x75, 0xd0, 0xef, 0x8d, 0x37, 0xea, 0x36, 0xb8, 0xe9, 0xe8, 0x6b, 0x54,
+    0xe0, 0xba, 0x1e, 0xf2, 0xe1, 0x40, 0x9e, 0x5d, 0x9f, 0x4d, 0xb6, 0xec,
+    0x4f, 0xd7, 0x1f, 0xc8, 0x2b, 0xe8, 0x5a, 0xf5, 0xf2, 0x5a, 0x2d, 0xbf,
+    0x2f, 0x1d, 0xac, 0xb3, 0x8f, 0xf7, 0xf3, 0x00, 0x99, 0x97, 0xda, 0xc6,
+    0x1d, 0x2c, 0xfe, 0xc5, 0xc2, 0x3a, 0xa7, 0x0d, 0x6a, 0xa0, 0x6a, 0xa4,
+    0x48, 0xf2, 0xa0, 0x6c, 0x12, 0xb9, 0xce, 0x6c, 0x9d, 0x32, 0x4c, 0x8c,
+    0xfd, 0xf1, 0x08, 0xa5, 0x86, 0xee, 0xe6, 0x8d, 0xdf, 0x8d, 0x79, 0xd5,
+    0xd7, 0xb7, 0xdf, 0xa7, 0x1a, 0x80, 0x91, 0xeb, 0x54, 0x1f, 0x8e, 0xd9,
+    0x9f, 0x76, 0xd9, 0xdb, 0x9a, 0x46, 0x9b, 0x57, 0xb6, 0xf9, 0x8c, 0xdb,
+    0xb0, 0xf5, 0x96, 0x81, 0xc9, 0x65, 0x23, 0x52, 0x96, 0x4e, 0xf9, 0x0f,
+    0xbb, 0x84, 0xfd, 0x01, 0xd9, 0x81, 0xf6, 0x55, 0xc7, 0x36, 0x8c, 0xfb,
+    0xbc, 0xa5, 0x07, 0x11, 0xac, 0x9f, 0x92, 0x36, 0x9a, 0xdf, 0xdd, 0xac,
+    0x42, 0x74, 0x2b, 0x16, 0x75, 0xfa, 0x3e, 0x22, 0xd9, 0x03, 0x44, 0x7b,
+    0x8f, 0xfd, 0xa8, 0xc1, 0xcf, 0xb4, 0xd7, 0x76, 0xb3, 0x7e, 0x36, 0x75,
+    0x29, 0xaf, 0x01, 0x0d, 0x1a, 0x0e, 0xc2, 0xb1, 0x00, 0x4a, 0xc6, 0x61,
+    0x71, 0x71, 0x3c, 0x6b, 0x58, 0xbc, 0x79, 0x4b, 0x63, 0x75, 0x85, 0x6f,
+    0x69, 0xee, 0xbb, 0xfb, 0x1f, 0xfc, 0xeb, 0x19, 0x72, 0x4f, 0x08, 0x6c,
+    0x07, 0x55, 0xad, 0x6c, 0x5f, 0x9a, 0xb1, 0x81, 0xac, 0xb6, 0x83, 0x8e,
+    0xd1, 0xd0, 0x68, 0xd7, 0x34, 0x18, 0x61, 0x91, 0x09, 0xa4, 0x4d, 0x72,
+    0x01, 0xe9, 0x14, 0x92, 0x46, 0x69, 0x06, 0xc9, 0x25, 0x24, 0xd7, 0x80,
+    0x8c, 0x4d, 0xdd, 0x56, 0x5b, 0xac, 0xda, 0x13, 0x93, 0x91, 0x9a, 0x8c,
+    0x85, 0xc9, 0xc8, 0x4c, 0xc6, 0xd2, 0x64, 0xac, 0x4c, 0xc6, 0xda, 0x64,
+    0x3c, 0x18, 0x8c, 0xc4, 0xa2, 0x53, 0x48, 0x82, 0x6e, 0x48, 0x4c, 0x43,
+    0x13, 0xd3, 0xae, 0xc4, 0x52, 0x68, 0xda, 0x95, 0x98, 0x76, 0xa5, 0x16,
+    0x6d, 0x90, 0x19, 0x24, 0x41, 0xd7, 0x9b, 0xca, 0x16, 0x50, 0x3a, 0x33,
+    0xfc, 0x60, 0x76, 0x61, 0x66, 0x8a, 0x2f, 0x21, 0x09, 0xea, 0x32, 0xbb,
+    0x7b, 0x65, 0x28, 0x5f, 0x59, 0xe5, 0xe0, 0x75, 0xd3, 0x17, 0x3f, 0xee,
+    0xfa, 0xa1, 0x8c, 0x06, 0xcf, 0x0d, 0x44, 0x47, 0x28, 0x4d, 0xdc, 0x43,
+    0xb4, 0xa3, 0xc1, 0x7b, 0x1b, 0xd1, 0x8e, 0xa3, 0xa9, 0x3b, 0x89, 0x22,
+    0x08, 0x1d, 0xd7, 0x12, 0xa5, 0x1b, 0x7d, 0x37, 0x13, 0xed, 0x58, 0xf6,
+    0xdc, 0x4f, 0x94, 0x1e, 0xf3, 0x5d, 0x51, 0xb4, 0x21, 0x62, 0xea, 0xa2,
+    0xa2, 0x3d, 0x32, 0xbd, 0xd7, 0x15, 0x45, 0x58, 0x39, 0x6e, 0x2c, 0xba,
+    0x90, 0x64, 0xea, 0xde, 0xa2, 0xc2, 0x15, 0xdf, 0xd5, 0x45, 0x07, 0x06,
+    0x7a, 0x2e, 0x30, 0x2a, 0xfc, 0xf1, 0xdd, 0x61, 0x74, 0xc1, 0xd1, 0xd4,
+    0x4d, 0x46, 0x11, 0xb6, 0x8e, 0xcb, 0x8c, 0x2e, 0x18, 0xf3, 0x5d, 0x69,
+    0x74, 0x21, 0xdc, 0xc4, 0xc5, 0x46, 0x85, 0x7f, 0xbe, 0xbb, 0x8d, 0x2e,
+    0x38, 0x74, 0xdf, 0x70, 0x54, 0x38, 0xe9, 0xbb, 0xe4, 0x28, 0x60, 0xc6,
+    0x71, 0xcf, 0xd1, 0x85, 0x90, 0x13, 0xb7, 0x1d, 0x5d, 0xf8, 0xe9, 0xbb,
+    0xf3, 0xe8, 0x4a, 0x2a, 0x93, 0x37, 0x1f, 0x15, 0xf4, 0xfa, 0x2e, 0x3f,
+    0x5e, 0x49, 0xa6, 0x16, 0x4a, 0x1b, 0x17, 0x21, 0xcf, 0x93, 0x99, 0x7b,
+    0xb1, 0xd6, 0xf3, 0x76, 0x53, 0x6a, 0xba, 0x19, 0x61, 0x91, 0x09, 0xa4,
+    0x4d, 0x72, 0x01, 0xe9, 0x14, 0x92, 0x46, 0x69, 0x06, 0xc9, 0x25, 0x24,
+    0xd7, 0x80, 0x8c, 0x4d, 0xdd, 0x56, 0x5b, 0xac, 0xda, 0x13, 0x93, 0x91,
+    0x9a, 0x8c, 0x85, 0xc9, 0xc8, 0x4c, 0xc6, 0xd2, 0x64, 0xac, 0x4c, 0xc6,
+    0xda, 0x64, 0x3c, 0x18, 0x8c, 0xc4, 0xa2, 0x53, 0x48, 0x82, 0x6e, 0x48,
+    0x4c, 0x43, 0x13, 0xd3, 0xae, 0xc4, 0x52, 0x68, 0xda, 0x95, 0x98, 0x76,
+    0xa5, 0x16, 0x6d, 0x90, 0x19, 0x24, 0x41, 0xd7, 0x9b, 0xca, 0x16, 0x50,
+    0x3a, 0x33, 0xfc, 0x60, 0x76, 0x61, 0x66, 0x8a, 0x2f, 0x21, 0x09, 0xea,
+    0x32, 0xbb, 0x7b, 0x65, 0x28, 0x5f, 0x59, 0xe5, 0xe0, 0x75, 0xd3, 0x17,
+    0x3f, 0x2e, 0x6f, 0xcb, 0x68, 0xf0, 0xe4, 0x6d, 0x47, 0x28, 0x4d, 0xe4,
+    0x6d, 0x3b, 0x1a, 0xbc, 0x79, 0xdb, 0x8e, 0xa3, 0xa9, 0xbc, 0x2d, 0x82,
+    0xd0, 0x91, 0xb7, 0xa5, 0x1b, 0x7d, 0x79, 0xdb, 0x8e, 0x65, 0x4f, 0xde,
+    0x96, 0x1e, 0xf3, 0xe5, 0x6d, 0x1b, 0x22, 0xa6, 0xf2, 0xb6, 0x3d, 0x32,
+    0xbd, 0x79, 0x5b, 0x84, 0x95, 0x23, 0x6f, 0xbb, 0x90, 0x64, 0x2a, 0x6f,
+    0x2b, 0x5c, 0xf1, 0xe5, 0x6d, 0x07, 0x06, 0x7a, 0xf2, 0xb6, 0xc2, 0x1f,
+    0x5f, 0xde, 0x76, 0xc1, 0xd1, 0x54, 0xde, 0x16, 0x61, 0xeb, 0xc8, 0xdb,
+    0x2e, 0x18, 0xf3, 0xe5, 0x6d, 0x17, 0xc2, 0x4d, 0xe4, 0x6d, 0x85, 0x7f,
+    0xbe, 0xbc, 0xed, 0x82, 0x43, 0x77, 0xde, 0x56, 0x38, 0xe9, 0xcb, 0xdb,
+    0x02, 0x66, 0x1c, 0x79, 0xdb, 0x85, 0x90, 0x13, 0x79, 0xdb, 0x85, 0x9f,
+    0xbe, 0xbc, 0xed, 0x4a, 0x2a, 0x93, 0x79, 0x5b, 0x41, 0xaf, 0x2f, 0x6f,
+    0x5f, 0x49, 0xa6, 0x16, 0x4a, 0xbf, 0x29, 0x6f, 0x2f, 0x17, 0x7a, 0xde,
+    0xae, 0xf7, 0x9a, 0x6e, 0x46, 0x58, 0x64, 0x02, 0x69, 0x93, 0x5c, 0x40,
+    0x3a, 0x85, 0xa4, 0x51, 0x9a, 0x41, 0x72, 0x09, 0xc9, 0x35, 0x20, 0x63,
+    0x53, 0xb7, 0xd5, 0x16, 0xab, 0xf6, 0xc4, 0x64, 0xa4, 0x26, 0x63, 0x61,
+    0x32, 0x32, 0x93, 0xb1, 0x34, 0x19, 0x2b, 0x93, 0xb1, 0x36, 0x19, 0x0f,
+    0x06, 0x23, 0xb1, 0xe8, 0x14, 0x92, 0xa0, 0x1b, 0x12, 0xd3, 0xd0, 0xc4,
+    0xb4, 0x2b, 0xb1, 0x14, 0x9a, 0x76, 0x25, 0xa6, 0x5d, 0xa9, 0x45, 0x1b,
+    0x64, 0x06, 0x49, 0xd0, 0xf5, 0xa6, 0xb2, 0x05, 0x94, 0xce, 0x0c, 0x3f,
+    0x98, 0x5d, 0x98, 0x99, 0xe2, 0x4b, 0x48, 0x82, 0xba, 0xcc, 0xee, 0x5e,
+    0x19, 0xca, 0x57, 0x56, 0x39, 0x78, 0xdd, 0xf4, 0xc5, 0x8f, 0xcb, 0xdb,
+    0x32, 0x1a, 0x3c, 0x79, 0xdb, 0x11, 0x4a, 0x13, 0x79, 0xdb, 0x8e, 0x06,
+    0x6f, 0xde, 0xb6, 0xe3, 0x68, 0x2a, 0x6f, 0x8b, 0x20, 0x74, 0xe4, 0x6d,
+    0xe9, 0x46, 0x5f, 0xde, 0xb6, 0x63, 0xd9, 0x93, 0xb7, 0xa5, 0xc7, 0x7c,
+    0x79, 0xdb, 0x86, 0x88, 0xa9, 0xbc, 0x6d, 0x8f, 0x4c, 0x6f, 0xde, 0x16,
+    0x61, 0xe5, 0xc8, 0xdb, 0x2e, 0x24, 0x99, 0xca, 0xdb, 0x0a, 0x57, 0x7c,
+    0x79, 0xdb, 0x81, 0x81, 0x9e, 0xbc, 0xad, 0xf0, 0xc7, 0x97, 0xb7, 0x5d,
+    0x70, 0x34, 0x95, 0xb7, 0x45, 0xd8, 0x3a, 0xf2, 0xb6, 0x0b, 0xc6, 0x7c,
+    0x79, 0xdb, 0x85, 0x70, 0x13, 0x79, 0x5b, 0xe1, 0x9f, 0x2f, 0x6f, 0xbb,
+    0xe0, 0xd0, 0x9d, 0xb7, 0x15, 0x4e, 0xfa, 0xf2, 0xb6, 0x80, 0x19, 0x47,
+    0xde, 0x76, 0x21, 0xe4, 0x44, 0xde, 0x76, 0xe1, 0xa7, 0x2f, 0x6f, 0xbb,
+    0x92, 0xca, 0x64, 0xde, 0x56, 0xd0, 0xeb, 0xcb, 0xdb, 0x57, 0x92, 0xa9,
+    0x85, 0xd2, 0x6f, 0xca, 0xdb, 0xeb, 0x58, 0xcf, 0xdb, 0x2f, 0xb5, 0xa6,
+    0x9b, 0x11, 0x16, 0x99, 0x40, 0xda, 0x24, 0x17, 0x90, 0x4e, 0x21, 0x69,
+    0x94, 0x66, 0x90, 0x5c, 0x42, 0x72, 0x0d, 0xc8, 0xd8, 0xd4, 0x6d, 0xb5,
+    0xc5, 0xaa, 0x3d, 0x31, 0x19, 0xa9, 0xc9, 0x58, 0x98, 0x8c, 0xcc, 0x64,
+    0x2c, 0x4d, 0xc6, 0xca, 0x64, 0xac, 0x4d, 0xc6, 0x83, 0xc1, 0x48, 0x2c,
+    0x3a, 0x85, 0x24, 0xe8, 0x86, 0xc4, 0x34, 0x34, 0x31, 0xed, 0x4a, 0x2c,
+    0x85, 0xa6, 0x5d, 0x89, 0x69, 0x57, 0x6a, 0xd1, 0x06, 0x99, 0x41, 0x12,
+    0x74, 0xbd, 0xa9, 0x6c, 0x01, 0xa5, 0x33, 0xc3, 0x0f, 0x66, 0x17, 0x66,
+    0xa6, 0xf8, 0x12, 0x92, 0xa0, 0x2e, 0xb3, 0xbb, 0x57, 0x86, 0xf2, 0x95,
+    0x55, 0x0e, 0x5e, 0x37, 0x7d, 0xf1, 0xe3, 0xf2, 0xb6, 0x8c, 0x06, 0x4f,
+    0xde, 0x76, 0x84, 0xd2, 0x44, 0xde, 0xb6, 0xa3, 0xc1, 0x9b, 0xb7, 0xed,
+    0x38, 0x9a, 0xca, 0xdb, 0x22, 0x08, 0x1d, 0x79, 0x5b, 0xba, 0xd1, 0x97,
+    0xb7, 0xed, 0x58, 0xf6, 0xe4, 0x6d, 0xe9, 0x31, 0x5f, 0xde, 0xb6, 0x21,
+    0x62, 0x2a, 0x6f, 0xdb, 0x23, 0xd3, 0x9b, 0xb7, 0x45, 0x58, 0x39, 0xf2,
+    0xb6, 0x0b, 0x49, 0xa6, 0xf2, 0xb6, 0xc2, 0x15, 0x5f, 0xde, 0x76, 0x60,
+    0xa0, 0x27, 0x6f, 0x2b, 0xfc, 0xf1, 0xe5, 0x6d, 0x17, 0x1c, 0x4d, 0xe5,
+    0x6d, 0x11, 0xb6, 0x8e, 0xbc, 0xed, 0x82, 0x31, 0x5f, 0xde, 0x76, 0x21,
+    0xdc, 0x44, 0xde, 0x56, 0xf8, 0xe7, 0xcb, 0xdb, 0x2e, 0x38, 0x74, 0xe7,
+    0x6d, 0x85, 0x93, 0xbe, 0xbc, 0x2d, 0x60, 0xc6, 0x91, 0xb7, 0x5d, 0x08,
+    0x39, 0x91, 0xb7, 0x5d, 0xf8, 0xe9, 0xcb, 0xdb, 0xae, 0xa4, 0x32, 0x99,
+    0xb7, 0x15, 0xf4, 0xfa, 0xf2, 0xf6, 0x95, 0x64, 0x6a, 0xa1, 0xb4, 0x99,
+    0xb7, 0xdf, 0x1d, 0x12, 0x75, 0x54, 0x99, 0x1d, 0x43, 0x64, 0xf7, 0x6b,
+    0x0f, 0x73, 0xc7, 0xe1, 0x65, 0xf5, 0x9b, 0xd4, 0x9a, 0x2c, 0x3f, 0xc1,
+    0xc1, 0x4e, 0xe2, 0xa1, 0x8a, 0xfd, 0x6c, 0xde, 0xe5, 0xe7, 0xec, 0xcf,
+    0xb3, 0x9a, 0xec, 0xa3, 0x4b, 0x89, 0xfe, 0xc3, 0xfd, 0xc5, 0x8e, 0xfd,
+    0xa9, 0xa3, 0x5a, 0x0b, 0x76, 0x49, 0xad, 0xc7, 0xfc, 0xfc, 0x88, 0x02,
+    0xbf, 0xcb, 0x31, 0x91, 0x05, 0x6e, 0xc0, 0xa1, 0xd6, 0xae, 0xc7, 0x11,
+    0x38, 0xf2, 0xe6, 0xf8, 0x95, 0x3a, 0xfb, 0xda, 0x90, 0xf8, 0x5f, 0x41,
+    0xa8, 0x9f, 0xfe, 0x62, 0x07, 0x15, 0xe6, 0xd6, 0x8f, 0x7b, 0x9d, 0x67,
+    0xc3, 0xeb, 0x40, 0x71, 0x13, 0x6d, 0x69, 0x0b, 0x9b, 0x8b, 0xd2, 0x22,
+    0x2d, 0xf4, 0xdf, 0x94, 0xfa, 0x6f, 0x6b, 0xc4, 0x9e, 0xa5, 0xd1, 0x63,
+    0x00, 0x00};
+static const unsigned int app_js_gz_len = 15550;
+static const char app_js_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x7d,
+    0x6b, 0x73, 0xdb, 0x38, 0xb6, 0xe0, 0x77, 0xff, 0x0a, 0x88, 0x93, 0x95,
+    0x89, 0x16, 0x4c, 0xdb, 0xe9, 0x99, 0xbb, 0x73, 0x29, 0x23, 0x2a, 0xbf,
+    0x92, 0x68, 0xae, 0x63, 0xfb, 0xda, 0x4e, 0x77, 0xba, 0x15, 0x75, 0x8a,
+    0x92, 0x20, 0x8b, 0x0a, 0x45, 0x2a, 0x24, 0x64, 0xd9, 0xb1, 0xb4, 0xbf,
+    0x7d, 0xeb, 0x1c, 0x00, 0x24, 0x28, 0x51, 0x8e, 0xdd, 0xd3, 0x5b, 0x77,
+    0xab, 0x52, 0xb1, 0x08, 0xe2, 0x71, 0x70, 0x70, 0x70, 0xde, 0x00, 0x6b,
+    0xc3, 0x59, 0xdc, 0x97, 0x61, 0x12, 0xbb, 0x92, 0x09, 0xfa, 0xe8, 0x98,
+    0x47, 0x87, 0x73, 0xf9, 0x30, 0x15, 0xc9, 0x90, 0x0c, 0xc4, 0x30, 0x8c,
+    0x45, 0xbd, 0xae, 0xfe, 0x7a, 0xc1, 0x64, 0xd0, 0x52, 0x3f, 0xdd, 0xbc,
+    0x29, 0x7d, 0x4c, 0x85, 0x9c, 0xa5, 0x31, 0x11, 0xae, 0xa4, 0x4b, 0xea,
+    0xe3, 0x1f, 0x57, 0x8e, 0xc2, 0x8c, 0xe5, 0x75, 0xfa, 0xf4, 0xf1, 0x2e,
+    0x48, 0xc9, 0xc7, 0x31, 0x1b, 0x70, 0xab, 0xa1, 0xf9, 0x49, 0x66, 0xae,
+    0xcc, 0xbb, 0x89, 0x67, 0x51, 0xc4, 0xb9, 0x6c, 0x5d, 0xcb, 0x34, 0x8c,
+    0x6f, 0x5d, 0x49, 0xfd, 0xef, 0x9d, 0xf7, 0x5e, 0x3f, 0x88, 0x22, 0x57,
+    0xd2, 0xee, 0x62, 0xe1, 0x24, 0xbd, 0xb1, 0xe8, 0x4b, 0x67, 0x99, 0xb7,
+    0x0e, 0x8a, 0xd6, 0xf6, 0x14, 0xa0, 0xd3, 0xa2, 0x52, 0xb2, 0x32, 0x44,
+    0x8d, 0xcb, 0x7a, 0x5d, 0x72, 0x2e, 0xbd, 0x79, 0x18, 0x0f, 0x92, 0x79,
+    0x51, 0x33, 0xab, 0xac, 0xe9, 0xc5, 0xc9, 0x40, 0xdc, 0x3c, 0x4c, 0x05,
+    0x34, 0x39, 0xb9, 0x38, 0xfe, 0xf8, 0xe1, 0xf4, 0xfc, 0xe6, 0xcb, 0xf9,
+    0xc5, 0xc9, 0x69, 0xd1, 0x32, 0xb4, 0x00, 0xd1, 0x50, 0xae, 0x82, 0x11,
+    0x59, 0x9d, 0x43, 0xf5, 0x7a, 0xbd, 0x96, 0xe0, 0x9f, 0x0b, 0xac, 0xef,
+    0xdd, 0x0a, 0x79, 0x99, 0x26, 0x32, 0x01, 0xfc, 0x5f, 0x0c, 0x5d, 0x49,
+    0x39, 0xd7, 0x6f, 0xa6, 0xa6, 0xb8, 0xe8, 0x6c, 0x04, 0x9d, 0x01, 0x62,
+    0x05, 0xaf, 0xd5, 0x64, 0xbd, 0xee, 0x44, 0x22, 0xbe, 0x95, 0x23, 0x27,
+    0x8c, 0x09, 0x82, 0xac, 0x1e, 0x59, 0xcc, 0xe7, 0x1e, 0x34, 0x74, 0x25,
+    0x6d, 0xae, 0xa2, 0xa9, 0xc6, 0xe3, 0x1c, 0x04, 0xd7, 0x09, 0xd2, 0x34,
+    0x78, 0x70, 0x38, 0x8f, 0x17, 0x8b, 0x3d, 0xce, 0xb9, 0x58, 0x2c, 0x9c,
+    0x78, 0x36, 0xe9, 0x89, 0xb4, 0xa0, 0x08, 0x51, 0xaf, 0xef, 0x1d, 0x88,
+    0x7a, 0x5d, 0xec, 0xec, 0x13, 0x18, 0xc7, 0x9a, 0xdb, 0xd0, 0x9a, 0x9b,
+    0xf4, 0x52, 0x31, 0x8d, 0x82, 0xbe, 0x70, 0x77, 0x7d, 0x7f, 0xf7, 0x96,
+    0x39, 0xbb, 0x0e, 0x2d, 0x8a, 0xdc, 0xce, 0xe1, 0xce, 0xef, 0xdd, 0x06,
+    0x55, 0x7f, 0x3b, 0xc1, 0xce, 0xf7, 0x2e, 0x85, 0x4a, 0xaf, 0xf6, 0xbf,
+    0xbc, 0x7a, 0x5d, 0xae, 0x18, 0xec, 0x7c, 0xff, 0x3c, 0xe8, 0xea, 0x9a,
+    0xd5, 0x95, 0xbe, 0x40, 0xe9, 0x8e, 0x43, 0x3d, 0x99, 0x9c, 0x25, 0x73,
+    0x91, 0x1e, 0x07, 0x99, 0x70, 0x2d, 0xb8, 0x62, 0x1b, 0x2e, 0x00, 0x5a,
+    0xb4, 0x44, 0x47, 0x76, 0x7d, 0xf8, 0x8f, 0xc7, 0x62, 0x4e, 0xae, 0xc4,
+    0xed, 0xe9, 0xfd, 0xd4, 0x75, 0xdc, 0x3f, 0x16, 0x9f, 0x3f, 0x67, 0xd4,
+    0x69, 0xc8, 0x86, 0xe3, 0x7e, 0xfe, 0x9c, 0x2d, 0x5e, 0x51, 0xc7, 0xea,
+    0x67, 0xaa, 0xb6, 0x89, 0x46, 0xa1, 0x46, 0x4c, 0x2d, 0x47, 0xcc, 0x62,
+    0x71, 0xd2, 0x01, 0x14, 0x74, 0x5b, 0xc2, 0x17, 0x0d, 0x67, 0x7a, 0x6f,
+    0x91, 0x68, 0x6a, 0x51, 0x46, 0x7f, 0x14, 0x46, 0x83, 0x54, 0xc4, 0xb8,
+    0x4c, 0xad, 0x33, 0x4d, 0xda, 0x9e, 0x29, 0xa6, 0xfe, 0xdc, 0x9b, 0x04,
+    0x53, 0x53, 0x72, 0x9e, 0x0c, 0x84, 0xb5, 0x93, 0x8a, 0x99, 0xec, 0x03,
+    0x21, 0x1a, 0xa2, 0x6c, 0x49, 0xff, 0x2e, 0x09, 0x07, 0x64, 0x6f, 0x69,
+    0xc1, 0x3b, 0x50, 0xf0, 0x02, 0x81, 0xc4, 0x2c, 0xe5, 0xb2, 0x65, 0x28,
+    0xc2, 0xdf, 0x6b, 0x0e, 0x93, 0xd4, 0x8d, 0xf9, 0x5e, 0x33, 0x3e, 0x48,
+    0x9b, 0x71, 0xa3, 0x41, 0x61, 0xbf, 0x76, 0xe2, 0x2e, 0x97, 0x9d, 0xb8,
+    0xdb, 0x84, 0x07, 0x5d, 0x95, 0xa7, 0x0c, 0x9f, 0x32, 0x11, 0x89, 0xbe,
+    0x4c, 0x52, 0xa4, 0x09, 0x6b, 0x62, 0x63, 0x1b, 0x27, 0x7a, 0xef, 0x8a,
+    0xd6, 0x1c, 0xb6, 0x2d, 0xfc, 0xe7, 0x0d, 0xc3, 0x48, 0x8a, 0xd4, 0x15,
+    0x16, 0x58, 0x13, 0x68, 0xc2, 0x62, 0x96, 0xe6, 0xcd, 0x02, 0x57, 0xd0,
+    0x96, 0xd0, 0x88, 0xc0, 0x37, 0xbe, 0x45, 0xe5, 0x77, 0xaa, 0x3e, 0x7d,
+    0x54, 0xbd, 0xc7, 0x2d, 0xa0, 0xad, 0x49, 0x72, 0x27, 0x0e, 0xa5, 0x4c,
+    0xc3, 0xde, 0x4c, 0x0a, 0x57, 0x50, 0x5f, 0x7a, 0x99, 0x90, 0x56, 0x09,
+    0x8b, 0xad, 0x21, 0x6f, 0x2d, 0x4c, 0x70, 0xe9, 0xf5, 0xa3, 0x20, 0xcb,
+    0xce, 0x83, 0x09, 0xce, 0x85, 0xa5, 0xb0, 0x05, 0x62, 0xaf, 0x17, 0x64,
+    0xe2, 0x97, 0x20, 0xaa, 0x71, 0x7e, 0xdf, 0x34, 0x1c, 0x8d, 0x73, 0x7e,
+    0xdf, 0x4a, 0x5b, 0xf9, 0x4b, 0x3f, 0x46, 0x34, 0xbb, 0x56, 0x11, 0x17,
+    0xbe, 0xd5, 0x21, 0xb7, 0x27, 0xfa, 0xe0, 0x0a, 0xfa, 0x28, 0xd3, 0x87,
+    0x9c, 0x41, 0xb6, 0x1c, 0x99, 0xce, 0x84, 0xa3, 0x36, 0xd6, 0x30, 0x88,
+    0x32, 0xe1, 0xd4, 0xb8, 0x80, 0x8d, 0x07, 0x53, 0x83, 0xf2, 0x16, 0xfc,
+    0xf0, 0x1b, 0xa2, 0xe1, 0xe0, 0x53, 0x43, 0xf8, 0xbb, 0x7f, 0x74, 0x3e,
+    0x77, 0x3e, 0x3f, 0x76, 0x77, 0x3d, 0x29, 0x32, 0x09, 0x88, 0x9a, 0x7b,
+    0xd3, 0x20, 0xcd, 0xc4, 0xbf, 0xae, 0x2f, 0xce, 0x61, 0xe2, 0xf0, 0x6f,
+    0xd9, 0x0f, 0x64, 0x7f, 0x64, 0x11, 0x87, 0x58, 0x2e, 0x61, 0xb2, 0xf7,
+    0xac, 0xc7, 0xe6, 0xec, 0x94, 0x1d, 0xb1, 0x6b, 0x76, 0xc3, 0x3b, 0x5d,
+    0x76, 0xcc, 0x6f, 0xbc, 0x7e, 0x12, 0xf7, 0x03, 0xc9, 0xce, 0xf9, 0x8d,
+    0x5e, 0x1d, 0x76, 0xc6, 0x6f, 0xbc, 0x2c, 0x0a, 0xfb, 0x82, 0x5d, 0xf2,
+    0xbe, 0x37, 0x48, 0xfa, 0xb3, 0x89, 0x88, 0x25, 0xbb, 0xe0, 0x8f, 0x4b,
+    0x26, 0xe0, 0xbf, 0x13, 0xfe, 0xe8, 0xf4, 0x93, 0x68, 0x36, 0x89, 0x77,
+    0xfa, 0xc9, 0x2c, 0x96, 0x8e, 0xbf, 0xcf, 0xd4, 0x73, 0xe6, 0xef, 0x33,
+    0x67, 0x98, 0xc4, 0x72, 0x67, 0x2e, 0xc2, 0xdb, 0x11, 0xbe, 0x71, 0xa2,
+    0x30, 0x16, 0x3b, 0xa3, 0xfc, 0x39, 0x99, 0x06, 0xfd, 0x50, 0x3e, 0xc0,
+    0x9b, 0xef, 0x3b, 0x61, 0x3c, 0x10, 0xf7, 0x50, 0xfa, 0x3d, 0x49, 0x26,
+    0xfe, 0xfe, 0x92, 0x1d, 0xf2, 0xdd, 0x3f, 0x3e, 0x67, 0x3f, 0x1d, 0xb8,
+    0x9f, 0xe7, 0x8d, 0x45, 0x8d, 0x76, 0xfe, 0x78, 0xd3, 0xfd, 0xe9, 0xcd,
+    0x2e, 0x6b, 0xf3, 0xdd, 0x3f, 0xb0, 0x8c, 0x7e, 0xce, 0x7e, 0xfa, 0xbc,
+    0xdb, 0x7a, 0xe3, 0xb6, 0xfc, 0x83, 0xcf, 0xbb, 0x9f, 0xf7, 0xdf, 0x2c,
+    0xe8, 0xab, 0x5d, 0xf6, 0x8a, 0xef, 0x1e, 0xb8, 0xad, 0x5a, 0x90, 0x8a,
+    0x60, 0xd1, 0x4b, 0x17, 0xfd, 0x24, 0x5a, 0x88, 0x49, 0x4f, 0x0c, 0x16,
+    0xa3, 0x74, 0x11, 0x4e, 0x6e, 0x17, 0x61, 0x3c, 0x9d, 0xc9, 0x45, 0x14,
+    0xc6, 0x5f, 0x17, 0x13, 0x21, 0x83, 0xc5, 0x34, 0x48, 0x83, 0x09, 0x75,
+    0xdd, 0xce, 0xe7, 0xb9, 0xdf, 0x6d, 0xa8, 0x51, 0xe8, 0xe7, 0xdd, 0x37,
+    0xbb, 0xb7, 0x21, 0xfb, 0xca, 0x77, 0xff, 0x70, 0x5b, 0x7e, 0x2f, 0x19,
+    0x3c, 0x2c, 0x46, 0x72, 0x12, 0xd1, 0x57, 0xbb, 0x21, 0xbb, 0xe2, 0xbb,
+    0x05, 0xcf, 0xf9, 0xc8, 0x3b, 0xce, 0x5d, 0x10, 0x39, 0xcc, 0xe9, 0x67,
+    0x99, 0xc3, 0x1c, 0xa8, 0xe5, 0x30, 0x47, 0x8a, 0x7b, 0xe9, 0x30, 0x67,
+    0x10, 0xc8, 0xc0, 0x61, 0xce, 0x3c, 0x1c, 0xc8, 0x11, 0xbc, 0x54, 0x13,
+    0x67, 0x4e, 0x32, 0x1c, 0x66, 0x42, 0x3a, 0x5d, 0x26, 0xf9, 0xa5, 0xd7,
+    0x4f, 0x45, 0x20, 0xc5, 0x69, 0x24, 0x00, 0xb5, 0xae, 0x23, 0x83, 0x5e,
+    0x24, 0x1c, 0xca, 0xde, 0x56, 0xbc, 0x4a, 0x1d, 0xca, 0x7e, 0xe7, 0x8f,
+    0x32, 0xf5, 0xd7, 0xdf, 0x01, 0x90, 0x0e, 0x65, 0xf8, 0xd7, 0x97, 0x4c,
+    0x8e, 0x44, 0x30, 0x80, 0xbf, 0xc3, 0x24, 0x91, 0xf0, 0x77, 0xe0, 0xbf,
+    0x65, 0x72, 0xe4, 0xbf, 0x65, 0xce, 0x4f, 0xce, 0x7a, 0xf3, 0x41, 0x78,
+    0xe7, 0xd0, 0x25, 0xfb, 0xc0, 0x77, 0xfb, 0xc9, 0x64, 0x1a, 0x09, 0x29,
+    0x16, 0x51, 0x12, 0x0c, 0xc4, 0x60, 0x11, 0xc6, 0x52, 0xa4, 0x41, 0x5f,
+    0x86, 0x77, 0x62, 0x97, 0x7d, 0xe3, 0x40, 0x75, 0xf3, 0x9d, 0xee, 0x4f,
+    0xaf, 0x76, 0xd9, 0x77, 0x20, 0x80, 0xf7, 0xfc, 0xbb, 0x27, 0x13, 0x25,
+    0x92, 0xd9, 0x17, 0x28, 0xf9, 0x85, 0x57, 0xf7, 0xce, 0xfe, 0xc5, 0x1f,
+    0x65, 0xd0, 0xc3, 0x65, 0xf6, 0x61, 0x9a, 0x6d, 0x5c, 0x70, 0x96, 0x8a,
+    0x60, 0x90, 0xc4, 0xd1, 0x83, 0xef, 0xc0, 0xaf, 0x8b, 0x38, 0x7a, 0x70,
+    0xd8, 0x30, 0x49, 0x7d, 0xc4, 0xe5, 0xdb, 0x24, 0x75, 0x18, 0x6e, 0x22,
+    0xdf, 0xc9, 0xf7, 0x92, 0xc3, 0x26, 0xc1, 0xbd, 0x66, 0x58, 0xce, 0x24,
+    0xb8, 0x3f, 0x53, 0xc2, 0x8d, 0xf5, 0x45, 0x14, 0x65, 0x40, 0x52, 0xf1,
+    0xad, 0xef, 0xc0, 0xc3, 0xb5, 0x7a, 0x50, 0x6f, 0xa6, 0xc1, 0x60, 0x90,
+    0xbf, 0xb9, 0x54, 0x0f, 0x0e, 0x4b, 0x93, 0x79, 0x36, 0x0d, 0x62, 0xdf,
+    0x49, 0x93, 0xf9, 0xf5, 0x34, 0x88, 0x1d, 0x20, 0x5f, 0x55, 0xd2, 0x4f,
+    0x22, 0x55, 0x32, 0xcb, 0xc4, 0x24, 0x98, 0xfa, 0xce, 0x2c, 0x13, 0x1f,
+    0x82, 0xa9, 0xc3, 0x86, 0x69, 0x30, 0x11, 0xbd, 0x24, 0x1d, 0x88, 0xd4,
+    0x77, 0xf0, 0xe1, 0x08, 0x1f, 0xa0, 0x6d, 0x2c, 0x45, 0x2c, 0xc5, 0x20,
+    0xc4, 0x65, 0x84, 0x3e, 0xb0, 0xe0, 0x54, 0x17, 0x38, 0x4b, 0xf6, 0x89,
+    0x1f, 0x82, 0x2c, 0xf5, 0xc2, 0x0c, 0xff, 0x2e, 0x16, 0x15, 0x1c, 0x1c,
+    0x64, 0x51, 0x26, 0x83, 0xb8, 0x0f, 0xe2, 0x03, 0xab, 0x2d, 0x0d, 0xe7,
+    0xf9, 0xe2, 0x4d, 0x60, 0x47, 0x8b, 0x8c, 0x97, 0x55, 0xb4, 0x70, 0xe8,
+    0xd6, 0xc4, 0x62, 0x51, 0x93, 0x8b, 0xc5, 0x7e, 0xcd, 0x16, 0x00, 0x54,
+    0x35, 0xac, 0xed, 0x37, 0x0d, 0x93, 0xd3, 0x1d, 0x2c, 0x16, 0xd2, 0x9b,
+    0x8b, 0xde, 0xd7, 0x50, 0x7e, 0x50, 0x05, 0xd7, 0x9a, 0x93, 0xc3, 0x8b,
+    0x49, 0xf2, 0xbd, 0xa2, 0x34, 0xa9, 0xaa, 0x59, 0x2e, 0x6a, 0x86, 0x43,
+    0x37, 0xa6, 0x86, 0xeb, 0x1b, 0xce, 0x2d, 0x28, 0x8e, 0x9e, 0xb2, 0x90,
+    0x4b, 0x60, 0x52, 0x22, 0x96, 0x20, 0xbe, 0x58, 0xc2, 0x6b, 0xa1, 0x99,
+    0x59, 0x52, 0xaf, 0xbb, 0x21, 0xff, 0x85, 0x7a, 0xc1, 0x74, 0x2a, 0xe2,
+    0xc1, 0x31, 0xc8, 0x38, 0x57, 0x52, 0x96, 0xf2, 0xff, 0xf3, 0xc5, 0xfb,
+    0x96, 0x05, 0x6e, 0xc8, 0x04, 0xf5, 0x90, 0x7c, 0x50, 0xff, 0x61, 0x49,
+    0xbd, 0xfe, 0x8b, 0x66, 0xf8, 0x45, 0xe5, 0x25, 0x3b, 0xe2, 0x55, 0x18,
+    0x2d, 0x94, 0x82, 0x9d, 0x86, 0xeb, 0xd1, 0xd6, 0xee, 0x2d, 0x2b, 0x23,
+    0x30, 0x67, 0xc5, 0xc2, 0x93, 0xc9, 0xc7, 0xe9, 0xd4, 0x68, 0x0b, 0xbe,
+    0xe3, 0x2c, 0xe9, 0x92, 0x5d, 0x17, 0xbd, 0xc6, 0x79, 0xe5, 0x73, 0x35,
+    0xbf, 0xb8, 0xba, 0xab, 0xd8, 0x02, 0x96, 0x73, 0x01, 0xbd, 0x7c, 0xf1,
+    0x86, 0x69, 0x70, 0x0b, 0x9b, 0xa2, 0xb4, 0x7c, 0x20, 0xc3, 0x34, 0x7e,
+    0x58, 0x62, 0xf0, 0xd1, 0x56, 0x7c, 0x1d, 0xf5, 0xaf, 0x94, 0xcf, 0xdd,
+    0xd5, 0x5d, 0xa5, 0x74, 0x13, 0xef, 0xd5, 0x3e, 0xa5, 0x94, 0xa5, 0x8b,
+    0x85, 0x9b, 0xcf, 0xb1, 0x5e, 0x77, 0x25, 0x2f, 0x66, 0xfc, 0x8a, 0x39,
+    0x07, 0xaf, 0xf6, 0xdf, 0x1c, 0xec, 0xbe, 0x7a, 0xfd, 0xc6, 0xa1, 0x94,
+    0xa1, 0xf0, 0xaa, 0xd7, 0x5d, 0xc1, 0x0f, 0x8b, 0x21, 0x8a, 0xde, 0x98,
+    0x00, 0x4d, 0xe8, 0xf7, 0xc5, 0xc2, 0x15, 0xdc, 0xf9, 0xc9, 0xa1, 0xcc,
+    0x4d, 0xf8, 0xef, 0x1d, 0xd1, 0x05, 0xdc, 0xc7, 0x22, 0x7d, 0x7f, 0xf3,
+    0xe1, 0x8c, 0x3b, 0x4e, 0x43, 0xb2, 0x94, 0xcf, 0x3d, 0x11, 0xf4, 0x47,
+    0xae, 0xd6, 0x54, 0x12, 0x4b, 0x2f, 0xa1, 0xcc, 0xd2, 0xe6, 0x93, 0xf2,
+    0x2a, 0x8d, 0xc2, 0x8c, 0x2e, 0x29, 0x65, 0x91, 0x1b, 0x53, 0x5c, 0xf3,
+    0xb9, 0x9b, 0x52, 0xa6, 0xfb, 0x5a, 0xc5, 0xe5, 0xce, 0xfe, 0xc1, 0x47,
+    0x0b, 0x8f, 0xad, 0xb0, 0x23, 0xbb, 0x20, 0xdc, 0x42, 0x2f, 0x90, 0x32,
+    0xc5, 0x3a, 0xd0, 0x57, 0x0a, 0xb8, 0xfd, 0x9d, 0x57, 0xaf, 0x83, 0x98,
+    0x6b, 0x8d, 0x07, 0x2a, 0x85, 0xd9, 0xef, 0xfc, 0x47, 0x5b, 0xee, 0x8b,
+    0xf7, 0x3b, 0x56, 0x8d, 0x43, 0xb9, 0xd2, 0xa5, 0x56, 0x99, 0x80, 0xca,
+    0x6b, 0x92, 0xe6, 0x7b, 0xf2, 0x77, 0x97, 0x42, 0x91, 0x93, 0x21, 0x1f,
+    0x2c, 0x74, 0x62, 0x49, 0xa1, 0xf4, 0xc0, 0xe1, 0x1c, 0x57, 0x44, 0xa6,
+    0xe1, 0xc4, 0xa5, 0xb4, 0xb3, 0xd7, 0xad, 0xd7, 0x73, 0xdc, 0xd3, 0x98,
+    0x17, 0x64, 0xe1, 0x4a, 0x96, 0xaf, 0x04, 0x13, 0x94, 0x49, 0x0e, 0x72,
+    0xbf, 0x29, 0xa2, 0x4c, 0xc0, 0x16, 0x17, 0xa0, 0x84, 0x98, 0x61, 0xe7,
+    0xae, 0x00, 0x35, 0x2a, 0x06, 0xc2, 0x6f, 0x42, 0x27, 0xb0, 0x49, 0x2e,
+    0x99, 0xa4, 0x4b, 0x53, 0x1d, 0xec, 0x9f, 0xa2, 0xf6, 0x25, 0x68, 0xc6,
+    0xc1, 0xe0, 0x01, 0xaa, 0x87, 0x43, 0x17, 0x51, 0x61, 0x55, 0x90, 0x50,
+    0xf8, 0x09, 0x0b, 0xb8, 0x64, 0x31, 0xd7, 0xc4, 0x9d, 0x56, 0xa9, 0x98,
+    0xda, 0xfa, 0x59, 0x52, 0x84, 0x8c, 0x84, 0x43, 0x37, 0x54, 0x33, 0xe9,
+    0xc8, 0xae, 0x0d, 0x33, 0xbc, 0xd9, 0x34, 0x51, 0x8d, 0x8d, 0xbf, 0x62,
+    0xbe, 0x4b, 0x6b, 0x21, 0x62, 0x28, 0x60, 0xee, 0xbc, 0x9a, 0x16, 0xd4,
+    0xa2, 0x6a, 0xb2, 0xf1, 0xc4, 0xbd, 0x14, 0xb1, 0x65, 0x78, 0xe6, 0x0b,
+    0x2c, 0xb9, 0xa6, 0xe9, 0x20, 0xbd, 0x45, 0x95, 0x27, 0x63, 0xfb, 0xb9,
+    0x89, 0xd4, 0x4b, 0x92, 0x48, 0x04, 0x71, 0xc9, 0xf2, 0x71, 0x63, 0x2e,
+    0x98, 0xe0, 0xd2, 0xcb, 0x46, 0xe1, 0x50, 0xba, 0x94, 0x32, 0xe9, 0x0d,
+    0x93, 0xf4, 0x14, 0x48, 0xda, 0xc6, 0x5f, 0x2d, 0xd7, 0x01, 0xa5, 0xab,
+    0x55, 0x5d, 0x50, 0xb8, 0x7b, 0xb0, 0xe5, 0x62, 0x9a, 0xd6, 0xeb, 0x6e,
+    0xe4, 0xc6, 0x9d, 0x5e, 0x97, 0x2e, 0x16, 0x9f, 0xd4, 0x0f, 0xda, 0x32,
+    0x45, 0xf5, 0x7a, 0x2d, 0x72, 0x85, 0xfa, 0x85, 0x7f, 0xf9, 0xe3, 0x92,
+    0xb2, 0x4f, 0xf9, 0xcb, 0x4f, 0xe5, 0x97, 0x9d, 0x2e, 0x65, 0x12, 0x7f,
+    0x32, 0xa8, 0xc1, 0x52, 0x4a, 0x7d, 0xf8, 0x51, 0xd3, 0xbb, 0x1f, 0xea,
+    0x60, 0xd3, 0xa5, 0x2b, 0x98, 0x04, 0xad, 0x98, 0x32, 0x01, 0x64, 0xff,
+    0x2d, 0x0b, 0xaa, 0xa9, 0x9e, 0x3b, 0x7f, 0x03, 0xe5, 0xb3, 0xb3, 0xd7,
+    0x65, 0x21, 0xaf, 0xa5, 0xf5, 0xba, 0xe3, 0x99, 0xe7, 0x84, 0xa7, 0x8b,
+    0x45, 0xd8, 0x12, 0x4a, 0x5b, 0x74, 0xf7, 0xa9, 0x2f, 0x58, 0xc0, 0xbf,
+    0xa9, 0xa5, 0x4f, 0x0c, 0xea, 0x08, 0x9a, 0xb1, 0x9a, 0x81, 0x1d, 0x3d,
+    0xb4, 0x07, 0xf5, 0x7a, 0x50, 0xaf, 0xa7, 0x2d, 0x17, 0xc4, 0x52, 0xf9,
+    0x8d, 0x9b, 0x50, 0xda, 0xea, 0xc4, 0x5d, 0xbf, 0xd3, 0xf5, 0xcb, 0x02,
+    0xad, 0x5e, 0xff, 0xcf, 0x95, 0xe7, 0xfd, 0x72, 0x85, 0x56, 0xa7, 0xeb,
+    0x9b, 0xe5, 0xab, 0xd7, 0x01, 0x4e, 0xbb, 0xf3, 0xec, 0xe8, 0xe1, 0xd8,
+    0x28, 0x12, 0xad, 0xb0, 0xb5, 0xe9, 0x95, 0x9b, 0x80, 0xe5, 0x50, 0x7a,
+    0x77, 0x13, 0xdc, 0xe2, 0x1b, 0xb4, 0x29, 0xbe, 0xcd, 0x44, 0xfa, 0x60,
+    0x84, 0xde, 0x61, 0x14, 0xb9, 0x82, 0xd2, 0x25, 0x9b, 0x83, 0x0e, 0x2d,
+    0x83, 0x30, 0xce, 0xf8, 0x65, 0xae, 0x2e, 0xeb, 0x1e, 0xf2, 0x57, 0xad,
+    0x4a, 0xca, 0x94, 0x35, 0x0e, 0x1a, 0x7f, 0x51, 0x0d, 0x4c, 0x23, 0xbf,
+    0x5c, 0x15, 0x48, 0xa5, 0x29, 0x90, 0x75, 0x0b, 0x4b, 0x8c, 0xd2, 0x26,
+    0xb0, 0x19, 0x60, 0xeb, 0x86, 0x25, 0xd5, 0xf6, 0x9a, 0x46, 0xec, 0x03,
+    0x50, 0x40, 0xa7, 0x7c, 0xc6, 0xe6, 0x5e, 0x98, 0xbd, 0xd5, 0x1d, 0xf2,
+    0x00, 0x1f, 0x7f, 0x45, 0x17, 0x07, 0x4f, 0xf0, 0x01, 0x35, 0x0d, 0xfe,
+    0x09, 0x7f, 0x5f, 0x46, 0x41, 0x18, 0x2b, 0x07, 0x03, 0x8f, 0xb0, 0xe4,
+    0x74, 0x32, 0x95, 0x0f, 0xba, 0xc4, 0x26, 0x69, 0x74, 0x33, 0xa0, 0xd9,
+    0x28, 0x94, 0xdd, 0x9f, 0x2b, 0x1c, 0x06, 0x96, 0x25, 0xb6, 0x3f, 0x9f,
+    0x4d, 0x44, 0x1a, 0xf6, 0xd7, 0xdb, 0xf2, 0x73, 0x34, 0x98, 0x41, 0x7c,
+    0xc7, 0x39, 0xe3, 0x6c, 0xae, 0xfa, 0x59, 0xf2, 0x6d, 0x87, 0x8e, 0x89,
+    0x9c, 0xd5, 0xd6, 0xc0, 0x25, 0x61, 0xcc, 0x57, 0xd8, 0x05, 0x61, 0x76,
+    0x1e, 0x80, 0xf9, 0x53, 0xaf, 0x87, 0xd9, 0x5b, 0xd8, 0xec, 0xb0, 0x60,
+    0x8b, 0x85, 0x42, 0x44, 0x18, 0xab, 0x39, 0xae, 0x0a, 0x5f, 0x3d, 0xd8,
+    0x8d, 0x91, 0x34, 0x8a, 0x7a, 0xf4, 0xb6, 0x80, 0x55, 0x0d, 0x26, 0x22,
+    0x02, 0x7d, 0x80, 0x1f, 0x01, 0x3a, 0xd3, 0x70, 0xc2, 0x37, 0x70, 0x45,
+    0x70, 0x50, 0x39, 0x8e, 0xaf, 0x14, 0xe2, 0xc2, 0x35, 0x83, 0x6d, 0x8c,
+    0xaf, 0x0a, 0x7a, 0x9c, 0xcd, 0xc2, 0x01, 0xdf, 0x63, 0x73, 0x2f, 0x9b,
+    0x4d, 0xa7, 0x49, 0x2a, 0x41, 0x73, 0x9e, 0x7b, 0xe2, 0x7e, 0x9a, 0xaa,
+    0x5f, 0x71, 0x92, 0x4c, 0x6d, 0x8f, 0x18, 0x94, 0x4d, 0x82, 0x69, 0xf5,
+    0xc6, 0x04, 0xb5, 0x81, 0x05, 0xbc, 0xd3, 0x05, 0x16, 0x0e, 0xd6, 0x1e,
+    0x85, 0xe5, 0x48, 0xf9, 0x5e, 0x33, 0x3d, 0x30, 0xb8, 0x69, 0xa6, 0x8d,
+    0x06, 0x55, 0xd8, 0x04, 0x66, 0xe5, 0xca, 0x4e, 0x8a, 0x3c, 0xa1, 0x5e,
+    0x0f, 0xbc, 0xe9, 0x2c, 0x1b, 0xb9, 0xb1, 0x66, 0xe6, 0xd0, 0x34, 0x54,
+    0x2b, 0x59, 0xaa, 0x1e, 0x76, 0x59, 0x58, 0xae, 0xae, 0xa7, 0xbd, 0x77,
+    0xe0, 0x26, 0x3c, 0xa0, 0x7a, 0x9c, 0xd6, 0xdc, 0x1b, 0xc6, 0xda, 0x94,
+    0x04, 0x55, 0x2e, 0x7a, 0x70, 0x3b, 0x5d, 0x96, 0x50, 0x3f, 0x59, 0x6a,
+    0x19, 0xbf, 0x59, 0xa4, 0x22, 0xe8, 0x8f, 0x85, 0x07, 0x22, 0x87, 0x1d,
+    0x1c, 0x11, 0x20, 0x72, 0xf7, 0xc1, 0xf7, 0xa4, 0xd1, 0xd8, 0x89, 0xbb,
+    0x2c, 0x66, 0xf0, 0xa7, 0x10, 0x61, 0xcb, 0x7c, 0x06, 0xa9, 0x9a, 0xc1,
+    0x5a, 0x23, 0x98, 0x34, 0x83, 0x3f, 0x96, 0xdc, 0xcb, 0x5b, 0xb3, 0xb9,
+    0x77, 0x9b, 0x8a, 0x69, 0xb5, 0xe8, 0x38, 0x2f, 0x94, 0xd9, 0x25, 0xeb,
+    0x7b, 0x60, 0x65, 0xd7, 0xeb, 0xae, 0x65, 0x73, 0x73, 0xf8, 0x4f, 0x3d,
+    0xe6, 0xea, 0x8c, 0x73, 0xa4, 0xa8, 0x96, 0x28, 0x1a, 0x27, 0x8a, 0x2e,
+    0x88, 0xd9, 0x85, 0x4a, 0xb9, 0x27, 0x27, 0x81, 0x14, 0xda, 0xd7, 0x44,
+    0xd4, 0x0e, 0x23, 0xa7, 0x69, 0x9a, 0xa4, 0x8e, 0x97, 0x4d, 0xa3, 0x50,
+    0xba, 0x0e, 0x71, 0xe8, 0x8a, 0x5e, 0xf4, 0xbd, 0xe3, 0x74, 0x94, 0x27,
+    0x91, 0x38, 0xe0, 0x15, 0xe8, 0x3a, 0x5d, 0x2e, 0x56, 0xfc, 0x5c, 0x00,
+    0xc5, 0x30, 0xe6, 0x8f, 0xfd, 0x24, 0xce, 0x64, 0x3a, 0x03, 0x4e, 0xe5,
+    0x7f, 0xf1, 0x7e, 0x67, 0xc6, 0xd7, 0xc3, 0xb4, 0x84, 0xf2, 0x6f, 0x8c,
+    0xac, 0x62, 0xa9, 0x18, 0xcc, 0xfa, 0xc2, 0xbf, 0xf1, 0xd4, 0x0f, 0x06,
+    0x4b, 0xed, 0xdf, 0xe0, 0x8a, 0xb3, 0x2c, 0x49, 0xa5, 0x7f, 0xe3, 0xc1,
+    0x1f, 0x06, 0x70, 0x61, 0x3d, 0xf5, 0x83, 0xe9, 0x7d, 0xe3, 0xe7, 0x3b,
+    0x88, 0x29, 0x0a, 0xf0, 0x2d, 0x12, 0x86, 0x85, 0xc6, 0xfd, 0x06, 0x84,
+    0x0a, 0x6b, 0x24, 0xf9, 0x5e, 0x53, 0x1e, 0xe4, 0x22, 0xd6, 0x2c, 0xb6,
+    0x6c, 0x34, 0xa8, 0xe0, 0x79, 0x31, 0xa8, 0x14, 0x31, 0x38, 0xe4, 0x94,
+    0xc2, 0x82, 0x0e, 0x21, 0x99, 0x20, 0xe2, 0x5c, 0xea, 0x0b, 0xb3, 0x7a,
+    0xc7, 0x9a, 0xd8, 0xb4, 0x5a, 0x03, 0x4a, 0x66, 0x0b, 0x1d, 0x54, 0x45,
+    0x5d, 0x74, 0x3d, 0xc3, 0x86, 0x06, 0x6b, 0xae, 0x42, 0x9d, 0x9f, 0xbb,
+    0xda, 0xc1, 0x56, 0x72, 0x51, 0x97, 0x55, 0x7a, 0x43, 0x03, 0xa0, 0x65,
+    0x00, 0xc7, 0x47, 0x79, 0xe7, 0xaf, 0xfb, 0xbc, 0xe7, 0xee, 0x99, 0x06,
+    0x08, 0x7b, 0xcb, 0x67, 0x03, 0x6d, 0x50, 0x0b, 0xf3, 0x2b, 0x18, 0xc8,
+    0x07, 0x25, 0x2f, 0x2f, 0x95, 0x9e, 0x76, 0x2d, 0x03, 0x09, 0x7c, 0xec,
+    0xd2, 0x03, 0x9b, 0xbe, 0x25, 0xdd, 0x39, 0xf5, 0x2f, 0xbd, 0x60, 0x30,
+    0x38, 0xbd, 0x13, 0xb1, 0x3c, 0x0b, 0x33, 0x29, 0x62, 0x91, 0xba, 0xce,
+    0xc9, 0xc5, 0x87, 0x63, 0x65, 0x66, 0x9e, 0xa1, 0xc9, 0xee, 0xd8, 0xba,
+    0x37, 0xb4, 0x5a, 0xb2, 0xda, 0x3e, 0x45, 0x6f, 0xdd, 0x92, 0xdd, 0x0a,
+    0x59, 0x35, 0xb2, 0x44, 0x87, 0x96, 0x71, 0x39, 0x02, 0xf2, 0x10, 0x5b,
+    0x9d, 0xbd, 0x03, 0xf0, 0x0e, 0xfa, 0xb2, 0x61, 0x79, 0xfe, 0xba, 0x4b,
+    0xa6, 0x71, 0x5a, 0x31, 0x6f, 0xac, 0x77, 0x2b, 0xa4, 0x0b, 0xb8, 0x09,
+    0xbf, 0x8b, 0x4d, 0x55, 0x54, 0x57, 0x80, 0x0b, 0xb0, 0x0c, 0x36, 0xd5,
+    0x12, 0x25, 0xfd, 0x49, 0x39, 0xfa, 0x6a, 0x1c, 0x5f, 0x15, 0xe2, 0xaf,
+    0x5e, 0x5f, 0x29, 0xa8, 0x32, 0x37, 0x96, 0x0c, 0xfa, 0xaa, 0x5a, 0xf5,
+    0x1b, 0x4f, 0xdc, 0x89, 0xf4, 0xa1, 0x98, 0x7a, 0xe5, 0xd2, 0xd7, 0x40,
+    0xc7, 0x58, 0x59, 0x7e, 0x8d, 0x52, 0xe5, 0x2b, 0xf3, 0x6d, 0x2d, 0xd2,
+    0x76, 0x5f, 0x22, 0x70, 0x71, 0x22, 0xdd, 0xfc, 0x87, 0xa0, 0xe0, 0x03,
+    0x3d, 0xaf, 0x1c, 0xd1, 0xd2, 0x54, 0xb5, 0x65, 0x6d, 0x6c, 0x9c, 0x25,
+    0x0b, 0x06, 0x03, 0xbf, 0x92, 0x2c, 0xe7, 0xee, 0xb5, 0xea, 0x5d, 0x6d,
+    0x3a, 0x77, 0x8e, 0x6f, 0x29, 0xb4, 0x09, 0xb3, 0xaa, 0xe5, 0xde, 0x3b,
+    0xb0, 0x16, 0xa1, 0x5e, 0xb7, 0xc6, 0xc2, 0x45, 0xef, 0xa2, 0x0e, 0x1d,
+    0x27, 0xd2, 0x5f, 0x53, 0x8d, 0xb5, 0x90, 0x09, 0x50, 0xc2, 0x2a, 0xae,
+    0x8a, 0x3a, 0x7a, 0xc5, 0x72, 0x49, 0xfa, 0x28, 0xac, 0x39, 0x4a, 0xba,
+    0x58, 0xc4, 0x4a, 0x76, 0xe8, 0x35, 0x51, 0x6a, 0x3e, 0x1a, 0xbe, 0x7c,
+    0xcd, 0x74, 0x12, 0x0a, 0x71, 0xb9, 0x9b, 0xd8, 0x1f, 0xe1, 0x90, 0x81,
+    0x2b, 0xbc, 0x50, 0x8a, 0x09, 0x35, 0xc4, 0x2a, 0x00, 0x97, 0x82, 0x2a,
+    0xd7, 0x74, 0x95, 0xca, 0x9d, 0x5a, 0xe6, 0xe3, 0xc1, 0x1e, 0x38, 0x74,
+    0x15, 0x0c, 0x40, 0x14, 0x39, 0xfe, 0x80, 0x2b, 0x8c, 0x82, 0x4a, 0x5c,
+    0xd9, 0x60, 0xac, 0x93, 0x29, 0xd8, 0x3d, 0xad, 0x42, 0xed, 0x33, 0x53,
+    0x05, 0x1f, 0x37, 0x4c, 0xd2, 0xd8, 0x2b, 0x1e, 0xec, 0x05, 0x57, 0xd1,
+    0xe1, 0xb7, 0x8a, 0x51, 0x76, 0x40, 0x48, 0x49, 0x35, 0x65, 0xa5, 0x42,
+    0x4b, 0xb5, 0x03, 0xcd, 0x13, 0x6b, 0xc8, 0xc6, 0x3e, 0x05, 0x62, 0x4b,
+    0xb3, 0x75, 0xae, 0xca, 0xf5, 0xba, 0xe5, 0xa2, 0x0c, 0x14, 0x21, 0x80,
+    0x4c, 0xa2, 0xb3, 0x7d, 0xc9, 0xa2, 0x60, 0x63, 0x2b, 0x8b, 0x12, 0x76,
+    0xf6, 0x37, 0xf7, 0x00, 0x13, 0xf1, 0x57, 0x75, 0xb7, 0x18, 0xbb, 0xc8,
+    0xdb, 0xb4, 0x8a, 0xe0, 0x96, 0xd1, 0xe3, 0x5a, 0xb6, 0xb3, 0x7f, 0x05,
+    0x00, 0x51, 0x6a, 0x0d, 0x92, 0x65, 0x22, 0xd6, 0x3d, 0x2a, 0x05, 0x95,
+    0x5b, 0x58, 0xc6, 0x2d, 0xb1, 0xa4, 0x3e, 0xc4, 0x3a, 0x0a, 0xf8, 0x5b,
+    0x73, 0x57, 0x59, 0x85, 0x05, 0x19, 0x6b, 0x2c, 0x02, 0x5b, 0x5f, 0x5f,
+    0xbc, 0xa2, 0x32, 0xee, 0x67, 0x7f, 0x0e, 0x5c, 0xab, 0x1f, 0x25, 0x99,
+    0xb0, 0xb1, 0x85, 0x56, 0x1a, 0xc0, 0x1b, 0x82, 0xa3, 0x3c, 0xe1, 0x6b,
+    0x93, 0x8c, 0xeb, 0xf5, 0xb9, 0xa5, 0x0f, 0x55, 0x6d, 0x05, 0x5b, 0x7b,
+    0xaf, 0xb9, 0x49, 0x6b, 0xef, 0x80, 0x27, 0x39, 0x5d, 0x0a, 0xea, 0x17,
+    0x3b, 0x10, 0xf4, 0x51, 0xda, 0xa4, 0x82, 0x83, 0xed, 0x9b, 0xd6, 0xeb,
+    0xb5, 0x4c, 0x6f, 0xb5, 0x82, 0xbf, 0x41, 0x27, 0xa1, 0xd5, 0x1a, 0xa8,
+    0x3a, 0x54, 0x54, 0x2d, 0x50, 0xea, 0xbb, 0x21, 0x5d, 0x32, 0x55, 0xbf,
+    0x4c, 0xd2, 0x00, 0x82, 0xc2, 0x7c, 0xa7, 0xcb, 0xf4, 0xe2, 0xed, 0x1d,
+    0xc4, 0x46, 0xf2, 0x52, 0x08, 0x08, 0x02, 0xaa, 0xaa, 0xf0, 0x8f, 0x1e,
+    0x0c, 0xcb, 0xe8, 0x40, 0xd0, 0x24, 0x82, 0x66, 0x6f, 0xb0, 0x96, 0x2b,
+    0xcc, 0x06, 0x83, 0x7d, 0x60, 0x82, 0x4f, 0x06, 0x39, 0x63, 0x17, 0x79,
+    0xa7, 0x86, 0xae, 0x6a, 0xbf, 0x8d, 0x0d, 0x33, 0x9b, 0x46, 0xb3, 0xfe,
+    0x57, 0xd7, 0x29, 0x86, 0x04, 0xe7, 0x15, 0xb4, 0x35, 0x01, 0xb1, 0xea,
+    0xd6, 0x4f, 0xac, 0x77, 0x6a, 0x38, 0x8f, 0xea, 0x46, 0x09, 0xcd, 0x6c,
+    0x93, 0xf0, 0xa9, 0xee, 0xc3, 0xf0, 0x59, 0x68, 0x7a, 0xa2, 0x2d, 0xbc,
+    0xc5, 0xc2, 0x92, 0x9c, 0xb6, 0x17, 0x6c, 0x89, 0x52, 0xb0, 0x17, 0x85,
+    0xf1, 0x6d, 0xf6, 0x5c, 0x68, 0x2b, 0x74, 0xce, 0xd4, 0x2d, 0x99, 0x7b,
+    0x55, 0x9b, 0x03, 0xcd, 0xc7, 0xa5, 0x99, 0x9a, 0x00, 0x5b, 0xed, 0xb9,
+    0x42, 0x15, 0x0b, 0x6d, 0xdf, 0x1e, 0x40, 0x8d, 0xc8, 0xaf, 0x92, 0x69,
+    0x95, 0x2a, 0x52, 0x31, 0x40, 0x47, 0x74, 0x71, 0xd2, 0xa3, 0x64, 0xfe,
+    0xdc, 0xf1, 0x73, 0xbd, 0xb0, 0xe9, 0xc4, 0x49, 0x0c, 0x51, 0x30, 0xc5,
+    0xf8, 0xe4, 0x43, 0x24, 0xbc, 0x41, 0x98, 0x4d, 0xa3, 0xe0, 0x01, 0x5c,
+    0x9a, 0x6b, 0x85, 0xdc, 0x71, 0x28, 0x33, 0x6d, 0x6e, 0x85, 0x3c, 0x4e,
+    0x26, 0xd3, 0x99, 0x14, 0x83, 0x6b, 0xa8, 0xa4, 0x40, 0x74, 0x1c, 0xaa,
+    0x23, 0xe7, 0x53, 0x91, 0xca, 0x87, 0x5f, 0x82, 0x68, 0x26, 0x20, 0x1e,
+    0x81, 0xed, 0x1d, 0x5a, 0xdd, 0xad, 0xab, 0x38, 0x23, 0x3a, 0x14, 0xc0,
+    0xe2, 0x67, 0x17, 0x1d, 0xd9, 0x45, 0x7f, 0xe8, 0xaa, 0x0f, 0x56, 0x52,
+    0xa6, 0xb4, 0xb3, 0x92, 0xd3, 0x5a, 0x80, 0x21, 0xbb, 0x06, 0x8f, 0xf8,
+    0x11, 0x30, 0x4c, 0x6c, 0xd2, 0x61, 0x44, 0x31, 0xcd, 0x18, 0x7d, 0x4d,
+    0x4e, 0x2f, 0x4a, 0xfa, 0x5f, 0x1d, 0x8a, 0x90, 0xf1, 0x58, 0xfd, 0xa5,
+    0x48, 0x6e, 0xda, 0xeb, 0xfb, 0x6b, 0x28, 0x47, 0x1b, 0xa5, 0x59, 0x4f,
+    0x0c, 0x93, 0x14, 0x44, 0x8c, 0x1e, 0x05, 0xd8, 0xde, 0x3c, 0xb5, 0x95,
+    0xe2, 0x5c, 0xdc, 0x83, 0xa0, 0x07, 0x81, 0xaf, 0x39, 0x6a, 0xbd, 0x5e,
+    0x8b, 0xa9, 0x92, 0xd8, 0xe8, 0x8e, 0x03, 0x4d, 0x6f, 0x8f, 0xb2, 0x90,
+    0xa7, 0x16, 0xec, 0x8b, 0xc5, 0xbe, 0xad, 0x5f, 0x3c, 0xc5, 0x17, 0xe9,
+    0xa3, 0x11, 0x94, 0x30, 0x3e, 0xf8, 0x51, 0xe2, 0x56, 0x59, 0x69, 0xf0,
+    0xc3, 0x56, 0xea, 0xf5, 0xa3, 0x24, 0x16, 0xd0, 0xb5, 0x5b, 0xdb, 0xa3,
+    0x7e, 0x8a, 0x13, 0xd5, 0x0d, 0x4a, 0x93, 0x2c, 0x00, 0x35, 0x1d, 0xc3,
+    0xcf, 0x7c, 0xbe, 0x1c, 0x84, 0x11, 0x6d, 0xe6, 0x5c, 0xb0, 0xe9, 0x82,
+    0xcb, 0xce, 0xb0, 0x13, 0x97, 0xd2, 0x9c, 0x11, 0x4a, 0x2e, 0x3c, 0x14,
+    0xb5, 0x2e, 0x6d, 0xa2, 0x04, 0x53, 0xeb, 0xab, 0xf9, 0x87, 0x35, 0x21,
+    0x05, 0x47, 0x1b, 0x76, 0x4f, 0x01, 0x49, 0xa8, 0xb0, 0x97, 0xf0, 0xc0,
+    0x0d, 0xe9, 0xd3, 0xd3, 0x57, 0xdc, 0x58, 0x23, 0x81, 0xc5, 0x60, 0xa8,
+    0x6a, 0xb6, 0xe4, 0x42, 0xe8, 0x23, 0x69, 0x85, 0x2b, 0xd8, 0x68, 0x1a,
+    0x6e, 0xdd, 0x8a, 0x73, 0x9c, 0x41, 0x58, 0xdc, 0x40, 0xa8, 0x90, 0x33,
+    0x8b, 0xcb, 0xeb, 0x59, 0x5e, 0x7f, 0xb5, 0x54, 0x2e, 0x5d, 0xdb, 0x8a,
+    0x66, 0x31, 0x2c, 0x22, 0x72, 0x4d, 0x99, 0x85, 0xa6, 0x5c, 0xf5, 0xc5,
+    0x75, 0xf9, 0x33, 0xfc, 0xd3, 0x5e, 0x4f, 0x80, 0x77, 0x14, 0x0e, 0x36,
+    0xf6, 0xd3, 0xcf, 0xb2, 0x62, 0x97, 0xe8, 0x8d, 0x40, 0xc1, 0x06, 0xb9,
+    0xbd, 0x8d, 0x44, 0x15, 0x8b, 0xda, 0xcc, 0x65, 0x0c, 0xa2, 0x9b, 0xae,
+    0x8a, 0xe0, 0xe7, 0x0c, 0xa7, 0x3c, 0x08, 0xc4, 0xce, 0x5b, 0xe0, 0xcb,
+    0x4d, 0xe6, 0x60, 0x36, 0x7a, 0x00, 0x9d, 0x52, 0xde, 0xa6, 0xa9, 0xb8,
+    0xab, 0xda, 0x56, 0xf3, 0xb2, 0xc8, 0x4a, 0xc5, 0x5d, 0x98, 0xcc, 0x32,
+    0xcd, 0x26, 0xae, 0x95, 0x04, 0x70, 0x68, 0xae, 0x08, 0xc9, 0xc5, 0x02,
+    0x42, 0x2b, 0x4b, 0x16, 0x8b, 0x7b, 0xf9, 0xe3, 0xfe, 0xa0, 0xd6, 0x8f,
+    0xfb, 0x82, 0x78, 0x69, 0x95, 0x81, 0xb3, 0x07, 0xae, 0x90, 0xdc, 0x00,
+    0x6d, 0x3d, 0x45, 0x87, 0x65, 0x51, 0xd0, 0x34, 0x4b, 0x8f, 0xe2, 0xc4,
+    0xcd, 0x37, 0xc1, 0x44, 0x51, 0x63, 0xcc, 0xd0, 0xca, 0x58, 0x52, 0x1f,
+    0x47, 0x80, 0xb2, 0x96, 0xde, 0x72, 0x45, 0x1f, 0x3e, 0x98, 0x6c, 0x4b,
+    0x26, 0x4b, 0xf3, 0xfc, 0x53, 0xb0, 0x59, 0xa3, 0x2a, 0xbb, 0x5e, 0xdc,
+    0x4b, 0x6d, 0xf7, 0x6a, 0xed, 0xdf, 0x2a, 0xe1, 0x26, 0xe1, 0xc4, 0x71,
+    0x7c, 0xc7, 0x69, 0x88, 0x35, 0x20, 0x0d, 0x6a, 0xad, 0x36, 0x0e, 0xf5,
+    0xc6, 0x49, 0x18, 0xbb, 0x8e, 0x43, 0x35, 0xd4, 0x10, 0x62, 0xb2, 0x08,
+    0xcc, 0x84, 0xe9, 0x8c, 0xc7, 0xa8, 0xf0, 0x41, 0x16, 0x99, 0x3e, 0xfb,
+    0xcf, 0x99, 0x50, 0x38, 0x74, 0x51, 0xdf, 0x37, 0x42, 0x06, 0xe3, 0xb4,
+    0x18, 0x44, 0x11, 0xca, 0x75, 0x87, 0xf1, 0x00, 0x41, 0xef, 0xd4, 0x94,
+    0x7b, 0x0c, 0x1d, 0xfb, 0xca, 0x3d, 0xa7, 0xcb, 0x04, 0x5b, 0xc5, 0xc7,
+    0x6d, 0x29, 0xcb, 0x85, 0x96, 0x17, 0xa6, 0x5e, 0xd7, 0x9a, 0x32, 0x2c,
+    0x4e, 0xe1, 0x39, 0xd7, 0x0e, 0xbe, 0xdc, 0x7e, 0x58, 0xeb, 0xa4, 0x25,
+    0xfd, 0x7b, 0x63, 0xa4, 0x1f, 0x96, 0xb0, 0x21, 0x9f, 0xde, 0x6e, 0x6b,
+    0xf3, 0x03, 0xd7, 0x76, 0xe1, 0xcd, 0xaa, 0xb4, 0xd4, 0xee, 0x72, 0x55,
+    0x9c, 0xe5, 0x56, 0xfb, 0x34, 0x4d, 0xa6, 0x2b, 0x4b, 0x90, 0xe7, 0xe0,
+    0xfc, 0xab, 0x23, 0xba, 0x8b, 0x85, 0x60, 0xcf, 0xc2, 0x39, 0xce, 0x50,
+    0x74, 0x57, 0xc9, 0x08, 0x02, 0x9b, 0x4b, 0xe3, 0xec, 0xe8, 0x2a, 0x57,
+    0x42, 0x67, 0xaf, 0x0b, 0x6a, 0x8c, 0x9e, 0xf6, 0x65, 0x09, 0x02, 0xdb,
+    0x65, 0xf2, 0x2f, 0x54, 0x0b, 0x34, 0xfa, 0x57, 0x11, 0x30, 0x10, 0x90,
+    0x45, 0x41, 0x94, 0x89, 0x85, 0x3a, 0x11, 0x64, 0x83, 0xf8, 0x15, 0xbe,
+    0x4f, 0x8e, 0x79, 0x22, 0x3b, 0x4e, 0xa3, 0x08, 0xd9, 0x5e, 0x31, 0x67,
+    0xe7, 0xd5, 0xfe, 0x6a, 0xe2, 0x1a, 0x4b, 0x79, 0xd5, 0x54, 0x31, 0x10,
+    0x1a, 0x33, 0xa1, 0x4d, 0x1d, 0xf5, 0x48, 0xcb, 0x0e, 0x74, 0x9e, 0xb6,
+    0x1e, 0x40, 0x4c, 0xdc, 0x2f, 0xd9, 0x5d, 0x10, 0x55, 0x31, 0xcd, 0x95,
+    0x9d, 0xe8, 0xea, 0x0d, 0x84, 0xc1, 0x06, 0xd0, 0xb3, 0x36, 0x63, 0xd5,
+    0xbb, 0x03, 0x45, 0xc6, 0x20, 0x56, 0x18, 0x7a, 0xc4, 0x52, 0x70, 0x5c,
+    0x14, 0xc8, 0x35, 0x12, 0xd9, 0x9b, 0xcc, 0x22, 0x19, 0x4e, 0x23, 0xcc,
+    0x07, 0x33, 0x42, 0x1a, 0x2d, 0x65, 0x27, 0x99, 0x62, 0xf6, 0x21, 0xdd,
+    0x6c, 0x71, 0x5b, 0x59, 0x67, 0x62, 0xb0, 0xa4, 0x66, 0x23, 0xe3, 0x70,
+    0x4e, 0x3e, 0x98, 0x19, 0x9e, 0xa9, 0x5c, 0x9b, 0x62, 0xc6, 0x09, 0x6e,
+    0xbf, 0x84, 0xbe, 0x48, 0x2a, 0xeb, 0xb9, 0x25, 0xc0, 0xf1, 0x3c, 0xd5,
+    0x23, 0xc4, 0xf8, 0x52, 0x6e, 0x9e, 0x2e, 0x8d, 0x44, 0x35, 0x2f, 0x59,
+    0xc8, 0x1f, 0x65, 0x32, 0xf5, 0x63, 0x4f, 0x26, 0xd3, 0x9d, 0x14, 0xfe,
+    0x67, 0x91, 0x18, 0x4a, 0x1f, 0xc4, 0xf7, 0x50, 0xee, 0xa4, 0xf8, 0x67,
+    0xd9, 0x74, 0x32, 0x19, 0xc8, 0xb0, 0xef, 0xa0, 0x8b, 0x1a, 0x64, 0xd0,
+    0x34, 0xc9, 0x42, 0x85, 0x02, 0x88, 0x8d, 0x7b, 0xe6, 0x91, 0x3b, 0xa9,
+    0x88, 0x02, 0xc8, 0xc2, 0x41, 0x45, 0x11, 0xaa, 0x86, 0xe0, 0x42, 0xc1,
+    0x40, 0x74, 0xa1, 0x6b, 0x51, 0x6b, 0xd5, 0xe1, 0xdd, 0x5a, 0x14, 0xaa,
+    0x96, 0xb3, 0x81, 0x7a, 0xbd, 0x66, 0x59, 0xd4, 0x6b, 0x15, 0x99, 0x59,
+    0x18, 0xdd, 0x25, 0xce, 0x66, 0x4f, 0xcd, 0x61, 0x6f, 0xd9, 0x2c, 0xb9,
+    0x1d, 0x80, 0x6d, 0x1c, 0x25, 0xb3, 0x18, 0x52, 0x6a, 0x8e, 0xa3, 0x50,
+    0xc4, 0xf2, 0x4a, 0xf4, 0x41, 0x75, 0xd2, 0x4d, 0xb1, 0x91, 0xc4, 0x19,
+    0x37, 0xfa, 0xde, 0x34, 0xb8, 0x15, 0x9f, 0x2e, 0x10, 0x4f, 0x0c, 0x3a,
+    0x95, 0x80, 0x1c, 0x5d, 0xfe, 0x9b, 0x2e, 0xc7, 0x94, 0x29, 0xff, 0x43,
+    0x20, 0x47, 0x5e, 0x0a, 0x1d, 0xbb, 0x90, 0x8d, 0x3b, 0x90, 0x23, 0xca,
+    0x54, 0x12, 0x55, 0xf9, 0x95, 0x2a, 0xa3, 0xcb, 0x25, 0xeb, 0x67, 0x99,
+    0xbf, 0x96, 0x18, 0xb3, 0xea, 0x61, 0x3e, 0x78, 0x6d, 0x7b, 0x2f, 0xc0,
+    0x6d, 0x52, 0x1d, 0xbb, 0xc7, 0xa4, 0x1a, 0x93, 0xcc, 0x92, 0xef, 0x27,
+    0x65, 0x2c, 0x74, 0x8e, 0x54, 0xd2, 0xf1, 0x9a, 0x9a, 0x1f, 0x57, 0xab,
+    0xf9, 0x92, 0x2e, 0x4d, 0x78, 0xbd, 0xdc, 0xad, 0x52, 0xa6, 0x1f, 0x97,
+    0x2c, 0xe4, 0xd5, 0x7d, 0x35, 0x73, 0xc3, 0x0b, 0xc9, 0x54, 0xae, 0xba,
+    0x27, 0x81, 0xa9, 0x15, 0x40, 0x09, 0x00, 0x2a, 0x5c, 0x1f, 0x1f, 0x1d,
+    0x03, 0xa9, 0x4a, 0xfe, 0x4b, 0xb8, 0xe3, 0x94, 0xa7, 0x0c, 0xa9, 0xc8,
+    0x54, 0xe8, 0xdc, 0xde, 0x56, 0xc2, 0xc1, 0x94, 0x6f, 0x38, 0xbe, 0xd3,
+    0x50, 0x99, 0xad, 0xfe, 0x66, 0xbb, 0x51, 0x59, 0x4e, 0x05, 0xa7, 0x84,
+    0x11, 0x5d, 0x68, 0x6e, 0xfc, 0x7b, 0x24, 0x97, 0x67, 0x92, 0xca, 0x4e,
+    0xaf, 0xab, 0x06, 0x81, 0x5f, 0xad, 0xa4, 0xc1, 0x87, 0x6e, 0xcf, 0x0c,
+    0xd4, 0x63, 0x50, 0x48, 0x1b, 0x4e, 0xd3, 0x79, 0xf9, 0x78, 0x3d, 0x1c,
+    0xef, 0x87, 0x56, 0xae, 0x6a, 0xdd, 0xcf, 0xb2, 0x1b, 0x71, 0x2f, 0x1b,
+    0xdc, 0x69, 0x3a, 0x8d, 0x04, 0x58, 0xb3, 0x4a, 0x4a, 0xab, 0x62, 0xf2,
+    0x2d, 0xad, 0x12, 0x29, 0x07, 0x07, 0x98, 0x02, 0xb0, 0x27, 0xfc, 0xb2,
+    0x1a, 0x5d, 0xa8, 0xc6, 0x85, 0x2b, 0x44, 0xef, 0x1e, 0x74, 0x2b, 0x62,
+    0x54, 0xb9, 0xa2, 0x7b, 0xcc, 0xcd, 0xb6, 0xfd, 0x5e, 0x1b, 0xcd, 0x6a,
+    0xa5, 0xde, 0x64, 0xd2, 0xbd, 0x45, 0xd4, 0xb2, 0x58, 0xfd, 0x09, 0x06,
+    0x83, 0x95, 0xbe, 0x0b, 0xf9, 0x18, 0x6f, 0x56, 0x3e, 0xac, 0x54, 0x3a,
+    0xad, 0x1f, 0xd0, 0xc7, 0x53, 0xf0, 0xec, 0x2a, 0xbe, 0x77, 0xab, 0x95,
+    0xe4, 0x92, 0x9e, 0xa7, 0x85, 0xf7, 0xee, 0xe7, 0xac, 0xb1, 0x7b, 0x5b,
+    0x2d, 0xbf, 0x8d, 0xba, 0x68, 0x66, 0xec, 0x82, 0xcb, 0xf7, 0x34, 0x77,
+    0xb7, 0x2a, 0xa1, 0xce, 0x4e, 0x73, 0xb7, 0xf3, 0xad, 0x96, 0x18, 0x0d,
+    0x57, 0xb4, 0x1c, 0x02, 0x8a, 0x1a, 0x6d, 0x9c, 0x6a, 0x1d, 0x8c, 0x38,
+    0x94, 0x2e, 0xb5, 0x60, 0x36, 0x92, 0x78, 0x65, 0xaa, 0x4f, 0x2a, 0xfc,
+    0x9b, 0x27, 0xaa, 0x43, 0xe5, 0x79, 0x5a, 0xc9, 0x6d, 0xee, 0x29, 0x68,
+    0x9e, 0x9a, 0xa9, 0x33, 0x4b, 0x98, 0x9d, 0x3e, 0x67, 0xea, 0xa7, 0xfc,
+    0x34, 0x17, 0xde, 0x50, 0xc0, 0x60, 0x02, 0x4b, 0xca, 0x74, 0xe7, 0xa7,
+    0x26, 0xf5, 0x67, 0xb9, 0xcc, 0x2d, 0x97, 0xd5, 0x85, 0xb3, 0xd2, 0x9e,
+    0xe3, 0xd6, 0x33, 0xc4, 0x92, 0xbd, 0x3c, 0x1a, 0xec, 0xe7, 0x40, 0xea,
+    0xa6, 0x68, 0xf9, 0xd4, 0x84, 0xbd, 0x4c, 0x7e, 0x0a, 0x51, 0x35, 0x43,
+    0x4d, 0x50, 0x90, 0x3b, 0x20, 0x74, 0xc1, 0x92, 0xe6, 0x8b, 0x91, 0xf5,
+    0xd3, 0x24, 0x8a, 0x6e, 0x56, 0xb4, 0x22, 0x6d, 0x7a, 0x1b, 0x39, 0xa4,
+    0x61, 0x75, 0xf2, 0xca, 0x66, 0x01, 0x6c, 0x2f, 0x35, 0x42, 0x22, 0x72,
+    0xa3, 0xa1, 0xe8, 0xd8, 0x94, 0x58, 0x22, 0xc1, 0xe2, 0x09, 0xa2, 0xb5,
+    0xb6, 0xaf, 0x4d, 0x4b, 0x2e, 0x97, 0xfe, 0xa6, 0x97, 0xae, 0xf5, 0xf4,
+    0x09, 0x1d, 0xbe, 0x4b, 0x33, 0x99, 0x33, 0x10, 0x50, 0xcf, 0x9e, 0x0d,
+    0xd4, 0x7e, 0xf6, 0x74, 0xb0, 0x6b, 0x7b, 0x3e, 0x9f, 0x9e, 0x3d, 0x1f,
+    0x68, 0xfa, 0xf4, 0x84, 0x98, 0xf5, 0xfc, 0x9b, 0x9a, 0x90, 0x51, 0x18,
+    0xec, 0x56, 0x55, 0xb3, 0xc9, 0x85, 0x37, 0xd3, 0x66, 0x5f, 0x59, 0x91,
+    0xd1, 0xde, 0xe1, 0x42, 0x9f, 0x49, 0xf9, 0x57, 0x9d, 0x68, 0x6e, 0x4c,
+    0x08, 0xd8, 0x56, 0xb4, 0x55, 0xd6, 0x0b, 0xfc, 0x42, 0x3d, 0x2a, 0x04,
+    0x26, 0x68, 0x40, 0x1c, 0xe3, 0xe2, 0x6f, 0xa3, 0x44, 0x85, 0xa7, 0xa8,
+    0x52, 0x76, 0x26, 0x41, 0x7a, 0x1b, 0xc6, 0x3b, 0x32, 0x99, 0x3a, 0x94,
+    0x2e, 0x16, 0x7b, 0x4c, 0x6b, 0x47, 0x4f, 0xd6, 0x86, 0x1a, 0xba, 0x3a,
+    0xea, 0x55, 0x8d, 0x72, 0x6d, 0x81, 0xda, 0x24, 0x36, 0x50, 0x39, 0xba,
+    0xd0, 0xfd, 0x8e, 0xca, 0xc1, 0x36, 0xad, 0x50, 0x13, 0xf9, 0x51, 0x33,
+    0x84, 0xc4, 0x6e, 0xf7, 0x1c, 0x85, 0x6e, 0x69, 0x34, 0xce, 0xcb, 0x15,
+    0x07, 0xf7, 0x93, 0xbe, 0x11, 0xe3, 0x91, 0x92, 0xeb, 0x4b, 0xb1, 0x58,
+    0x28, 0x0f, 0x63, 0x13, 0x22, 0x32, 0x7a, 0x09, 0x64, 0x81, 0xff, 0x7a,
+    0xbd, 0xd0, 0x20, 0x0b, 0x4c, 0x15, 0x4a, 0x24, 0xb8, 0xb2, 0x64, 0xa9,
+    0xc3, 0x22, 0xdd, 0x01, 0xc8, 0x05, 0xb3, 0x35, 0x06, 0x42, 0x42, 0x5e,
+    0x06, 0xfe, 0x56, 0xdb, 0x9e, 0x75, 0x56, 0xb3, 0xd6, 0xbb, 0xeb, 0xdc,
+    0x24, 0x0f, 0x8b, 0xa4, 0x45, 0x76, 0xad, 0xb7, 0x5b, 0xed, 0x16, 0xde,
+    0xeb, 0x96, 0xd3, 0x6a, 0x97, 0xb4, 0x09, 0xc3, 0x75, 0xd2, 0xee, 0x5a,
+    0xfa, 0x9d, 0x64, 0xf1, 0x6a, 0x3c, 0x4b, 0x79, 0x6b, 0x12, 0x37, 0xa6,
+    0xad, 0xb8, 0xe3, 0xa0, 0x73, 0xc1, 0x69, 0x84, 0x5d, 0x3f, 0xc3, 0x92,
+    0x55, 0xd5, 0xb5, 0xa3, 0xf7, 0x29, 0x56, 0x71, 0x65, 0x99, 0x90, 0x69,
+    0xbd, 0x0e, 0xe9, 0x1f, 0x7e, 0x35, 0x87, 0x75, 0x63, 0xc3, 0x5e, 0x15,
+    0x26, 0x53, 0x5b, 0x12, 0x00, 0xb4, 0x2e, 0x1a, 0xd6, 0xcb, 0x25, 0x65,
+    0x1d, 0x27, 0x18, 0x4a, 0x48, 0xfa, 0x06, 0x77, 0x0f, 0xf8, 0x45, 0x1c,
+    0xe6, 0x28, 0x47, 0xa3, 0xc3, 0x1c, 0xe5, 0x29, 0xa9, 0x42, 0x9a, 0x60,
+    0x81, 0x9a, 0x66, 0xc6, 0x83, 0xff, 0xf5, 0x5a, 0x21, 0x41, 0x74, 0xf9,
+    0x8a, 0xa7, 0x0a, 0x93, 0x7a, 0x74, 0x30, 0xa6, 0xc8, 0x41, 0x5c, 0x97,
+    0x05, 0x1d, 0x83, 0xa2, 0xfc, 0x84, 0x96, 0x1b, 0x2b, 0x6d, 0xae, 0xe5,
+    0x56, 0x67, 0x20, 0xe6, 0x99, 0x78, 0xc6, 0x30, 0xaf, 0x21, 0xd7, 0x32,
+    0x52, 0xda, 0x9f, 0x7b, 0xdf, 0xc5, 0x54, 0x26, 0x3a, 0x39, 0xb4, 0x25,
+    0x94, 0x47, 0x12, 0xa2, 0xca, 0x52, 0xc5, 0xf5, 0x55, 0x4c, 0xc7, 0xb5,
+    0x5e, 0xd8, 0x59, 0x9d, 0x88, 0x1e, 0x50, 0x19, 0x8b, 0x28, 0x59, 0xbc,
+    0x58, 0x98, 0xcc, 0x28, 0xe9, 0x97, 0xea, 0x2e, 0x29, 0x4b, 0x78, 0xa5,
+    0xaf, 0x38, 0x34, 0xaa, 0xfa, 0x3e, 0xb2, 0x53, 0x7f, 0x53, 0x4c, 0x2d,
+    0xe5, 0x19, 0x1c, 0xaa, 0xb2, 0x73, 0xca, 0x05, 0xdf, 0xe3, 0x3c, 0x68,
+    0x09, 0x0f, 0xbc, 0x66, 0xda, 0x5d, 0x06, 0x71, 0x42, 0x28, 0x42, 0x97,
+    0x2e, 0xfa, 0xd4, 0xfd, 0xd7, 0x58, 0x82, 0x8e, 0x1e, 0x9d, 0x19, 0xff,
+    0xa4, 0x35, 0x94, 0xd2, 0x66, 0x58, 0x89, 0x4f, 0x34, 0x26, 0x25, 0x9e,
+    0x1d, 0xb2, 0x7c, 0x9a, 0x79, 0xf6, 0x6b, 0x2d, 0x2d, 0xd2, 0x57, 0x2d,
+    0x7f, 0x7b, 0x13, 0xa2, 0xd2, 0x99, 0x48, 0xe5, 0x91, 0x76, 0x4d, 0x43,
+    0xf2, 0x6b, 0x5c, 0xaf, 0x97, 0xd3, 0x43, 0xe9, 0x23, 0x6c, 0x8a, 0xdc,
+    0x5f, 0x9d, 0xf2, 0x3d, 0x16, 0x02, 0xda, 0xf3, 0x00, 0x53, 0x8e, 0xb5,
+    0x83, 0x10, 0xf3, 0xbb, 0xa4, 0x6b, 0xbf, 0x85, 0x64, 0xa7, 0x18, 0x8e,
+    0x5c, 0xb2, 0x15, 0x80, 0x6b, 0xda, 0xba, 0x2f, 0xf8, 0xc8, 0x62, 0xe1,
+    0x5c, 0x1f, 0x5f, 0xb5, 0x2f, 0x6f, 0x9c, 0x9a, 0x5d, 0x5c, 0xde, 0xb3,
+    0x90, 0x68, 0x27, 0xd1, 0x95, 0x83, 0x6e, 0xb3, 0xdd, 0x71, 0x70, 0x17,
+    0x64, 0xfd, 0x34, 0x9c, 0x4a, 0xd5, 0x0a, 0xde, 0x41, 0x9d, 0x2c, 0xed,
+    0xd3, 0xdc, 0xa3, 0xe8, 0x25, 0xf3, 0x58, 0xa4, 0x26, 0x52, 0xd6, 0x5a,
+    0x79, 0xf6, 0x06, 0x62, 0x18, 0xcc, 0x22, 0xf9, 0x4b, 0x28, 0xe6, 0x7e,
+    0xbf, 0x29, 0x3c, 0x71, 0x17, 0x44, 0x79, 0xf6, 0x5d, 0xe1, 0x46, 0x44,
+    0xc5, 0x49, 0xb9, 0xfd, 0x61, 0xc3, 0x64, 0x2d, 0xd1, 0x70, 0x6e, 0x12,
+    0xc7, 0x77, 0x14, 0x16, 0x9d, 0x86, 0x1b, 0xb4, 0x1c, 0x85, 0x4b, 0xc7,
+    0x77, 0x0e, 0x71, 0x63, 0xd2, 0x2e, 0xaf, 0xf6, 0xac, 0xd2, 0x8e, 0xe8,
+    0x6a, 0x3d, 0x0f, 0x35, 0x9a, 0x25, 0x85, 0xe4, 0xf1, 0x22, 0x59, 0x8f,
+    0x0f, 0xac, 0xdf, 0x30, 0x1e, 0xfb, 0xe2, 0xcd, 0xe2, 0xf0, 0x1b, 0xbf,
+    0x66, 0x5f, 0xbc, 0x81, 0xc8, 0x44, 0x1a, 0x06, 0x51, 0xf8, 0x5d, 0xa0,
+    0x65, 0xc5, 0x1f, 0x98, 0xde, 0x32, 0xfc, 0x0b, 0x9b, 0x2f, 0x0b, 0xb9,
+    0xd7, 0xf7, 0x7e, 0xc7, 0xd2, 0x01, 0x53, 0x31, 0x50, 0xce, 0x79, 0xdf,
+    0x7b, 0x55, 0xaf, 0xbb, 0x7d, 0xef, 0x15, 0x1f, 0x58, 0x41, 0xbc, 0xc8,
+    0x3a, 0xef, 0x3a, 0x2a, 0x6d, 0xd1, 0x2f, 0xdf, 0xc3, 0x01, 0x26, 0xf6,
+    0xc3, 0x0f, 0x2e, 0x1a, 0x0d, 0x5a, 0x3a, 0xdb, 0x6a, 0x0e, 0xcb, 0x85,
+    0x43, 0xd7, 0x15, 0x1c, 0x22, 0xc1, 0xd4, 0x8b, 0x33, 0xaa, 0x78, 0xb2,
+    0x9b, 0x70, 0xe1, 0xc5, 0x19, 0x2b, 0x1d, 0x63, 0x6c, 0xf9, 0x7f, 0x2c,
+    0x08, 0x75, 0x1a, 0x49, 0xce, 0xb0, 0x1d, 0xe2, 0x30, 0x87, 0x78, 0x3f,
+    0x91, 0x96, 0x43, 0x1b, 0x50, 0x81, 0xe0, 0xd9, 0x46, 0x75, 0x5e, 0xc3,
+    0x9c, 0x45, 0x70, 0x4f, 0x3b, 0x23, 0x65, 0xee, 0x76, 0xba, 0xeb, 0x9e,
+    0x19, 0x0b, 0xe2, 0x7a, 0xdd, 0xad, 0x09, 0x0f, 0x89, 0x40, 0x80, 0x47,
+    0x03, 0xe4, 0x13, 0x94, 0xc4, 0x19, 0x18, 0xa5, 0x46, 0x76, 0x65, 0x14,
+    0x8b, 0xe3, 0xc5, 0x62, 0x04, 0x4c, 0x2a, 0xa6, 0x9c, 0x73, 0x48, 0x28,
+    0xc4, 0x52, 0x3c, 0x54, 0x92, 0x89, 0x88, 0x73, 0x8c, 0x64, 0x94, 0xcf,
+    0x90, 0x2a, 0x9a, 0x72, 0xe1, 0xf8, 0x81, 0xd1, 0x75, 0x1d, 0x2f, 0x37,
+    0x91, 0x1f, 0x85, 0x8f, 0xc9, 0xc8, 0x71, 0xe6, 0x17, 0x89, 0xc8, 0x98,
+    0xaf, 0xe6, 0xd2, 0xc2, 0xac, 0x58, 0x6e, 0x38, 0xb7, 0x49, 0x80, 0x18,
+    0x23, 0x08, 0x70, 0x81, 0xab, 0x12, 0x73, 0x59, 0xd3, 0xc5, 0xa2, 0x56,
+    0x13, 0xa5, 0x73, 0x93, 0x79, 0xed, 0x23, 0x74, 0xfe, 0xc5, 0xf5, 0x7a,
+    0xaa, 0xbc, 0x80, 0xf6, 0xc9, 0xc7, 0x10, 0x2c, 0x26, 0x48, 0xc9, 0x64,
+    0x19, 0x9b, 0x19, 0x5f, 0xc3, 0xc8, 0x0d, 0x29, 0xeb, 0xf3, 0xd3, 0x4e,
+    0x0c, 0xb1, 0x44, 0xf8, 0x03, 0x29, 0xda, 0x4d, 0x59, 0xe8, 0xec, 0xbb,
+    0x74, 0x13, 0x87, 0xc1, 0xa3, 0x51, 0xc0, 0xdd, 0xf3, 0x33, 0x07, 0x91,
+    0x6b, 0x38, 0x94, 0xc9, 0xea, 0xd7, 0x67, 0x6c, 0x62, 0x34, 0xde, 0x9b,
+    0x31, 0x64, 0xfe, 0x09, 0x16, 0x23, 0x2a, 0x03, 0x16, 0xab, 0x09, 0x1d,
+    0xa1, 0x3b, 0xaf, 0xc2, 0xef, 0xef, 0xa1, 0x77, 0x49, 0x0c, 0x6e, 0x82,
+    0xf4, 0x56, 0x18, 0x15, 0x01, 0x0e, 0x14, 0x09, 0xed, 0x30, 0x82, 0xe4,
+    0xf3, 0x95, 0x2c, 0x17, 0x01, 0xa2, 0x77, 0x18, 0x57, 0xa7, 0xb9, 0x15,
+    0x81, 0x7f, 0xc5, 0xb9, 0x5c, 0xd0, 0x32, 0x22, 0x9e, 0xd1, 0xc5, 0x42,
+    0x34, 0x63, 0xd8, 0x5f, 0xf7, 0x0f, 0x7c, 0x8d, 0x2d, 0x49, 0x7e, 0x07,
+    0x22, 0xc4, 0x0b, 0xb3, 0xf6, 0x64, 0x22, 0x06, 0x61, 0x20, 0xd1, 0xc8,
+    0x0f, 0x6e, 0x03, 0xa8, 0x76, 0x2d, 0x93, 0xe9, 0x54, 0x0c, 0x5c, 0x4a,
+    0x1f, 0xa5, 0x07, 0x3e, 0x53, 0x9e, 0x68, 0x8b, 0x35, 0xd5, 0x40, 0x84,
+    0x4c, 0x7a, 0x5f, 0x82, 0xf4, 0x36, 0xe3, 0xfc, 0xa1, 0x05, 0x27, 0x79,
+    0x3b, 0xb2, 0x5b, 0x88, 0x2f, 0x7c, 0x43, 0x69, 0x9e, 0x1a, 0xcd, 0x95,
+    0x7f, 0x13, 0x4e, 0x50, 0x0b, 0x48, 0xa9, 0x3b, 0x51, 0xbc, 0xc8, 0x85,
+    0xe4, 0xfd, 0x4c, 0x26, 0x53, 0x6b, 0x68, 0xf0, 0xf6, 0x89, 0xe5, 0x92,
+    0xc5, 0x5e, 0xc8, 0xfb, 0xe6, 0xf8, 0x74, 0xdf, 0x64, 0xc2, 0x32, 0x67,
+    0x35, 0x2b, 0x0f, 0xcc, 0x83, 0x10, 0xb2, 0x32, 0xd6, 0xd2, 0xf5, 0x06,
+    0x6e, 0xec, 0x01, 0xaf, 0x57, 0x28, 0x60, 0x90, 0x6b, 0x31, 0xa3, 0x25,
+    0x4a, 0x9f, 0xa8, 0xc4, 0x63, 0xd0, 0x00, 0x4c, 0x1c, 0x11, 0x12, 0x3b,
+    0x9a, 0x18, 0xe9, 0x71, 0xe8, 0x0f, 0xe9, 0x25, 0x30, 0xed, 0xab, 0x5f,
+    0x6b, 0xc7, 0xf4, 0x69, 0x27, 0xe9, 0x76, 0xa4, 0x17, 0x76, 0x99, 0xa3,
+    0x84, 0xd2, 0x1a, 0xfc, 0x70, 0x96, 0xdb, 0xab, 0x78, 0xe7, 0x82, 0xcb,
+    0x0d, 0xce, 0x6a, 0xe4, 0x53, 0x90, 0x90, 0x19, 0xbc, 0x2c, 0x4d, 0xe2,
+    0xce, 0x45, 0xf0, 0x35, 0xff, 0x08, 0x17, 0x8b, 0x5a, 0xea, 0x85, 0x99,
+    0xc6, 0xf0, 0xa5, 0xc2, 0xb7, 0x18, 0xa0, 0x8f, 0x73, 0xb1, 0x70, 0x43,
+    0x9e, 0x52, 0x16, 0x55, 0x3b, 0xb8, 0x14, 0x51, 0xc3, 0xb9, 0x9f, 0x26,
+    0x6c, 0x35, 0x5e, 0xad, 0x51, 0x83, 0x0e, 0x95, 0x31, 0x3c, 0xaf, 0x6b,
+    0x48, 0xa1, 0x20, 0xc6, 0x25, 0x43, 0x2f, 0xd9, 0x35, 0xb8, 0xc0, 0x3c,
+    0x19, 0x4e, 0xc4, 0xb5, 0x0c, 0x26, 0xd3, 0xc5, 0xc2, 0xb5, 0x9e, 0x38,
+    0x24, 0xe1, 0x7a, 0x31, 0x44, 0xfc, 0x28, 0x73, 0x43, 0x23, 0x98, 0x72,
+    0x50, 0x6b, 0x40, 0x52, 0xeb, 0xc5, 0x70, 0x6a, 0x11, 0x80, 0x40, 0x59,
+    0x80, 0xab, 0xde, 0x42, 0xc2, 0x0a, 0x3d, 0xab, 0xdc, 0xd7, 0x0e, 0x39,
+    0x9b, 0xca, 0x80, 0x38, 0xd6, 0x0a, 0x51, 0x3d, 0x75, 0xab, 0x30, 0xc5,
+    0x33, 0x3c, 0xe5, 0x64, 0x1f, 0x5c, 0xd6, 0x9b, 0x97, 0xc5, 0xfc, 0x31,
+    0x49, 0xc3, 0xdb, 0x30, 0x0e, 0x22, 0x5c, 0x27, 0x5f, 0x2e, 0xed, 0x74,
+    0xfc, 0xd0, 0x9c, 0x0f, 0x5e, 0x2c, 0x20, 0x3b, 0x83, 0x73, 0xfe, 0xb0,
+    0x58, 0xb8, 0xa8, 0x74, 0xc2, 0x73, 0x2e, 0xaf, 0xee, 0xd4, 0xd1, 0x19,
+    0xe8, 0xf3, 0x81, 0x09, 0xbe, 0xcf, 0xee, 0xf5, 0x49, 0xc5, 0x22, 0x89,
+    0x5d, 0x1d, 0x05, 0xee, 0xf1, 0xc8, 0x3a, 0x48, 0xc0, 0xe6, 0x15, 0x52,
+    0x76, 0xdd, 0x99, 0xba, 0x64, 0xa7, 0xe0, 0xe4, 0x4c, 0xe0, 0xbf, 0x98,
+    0x3b, 0x49, 0x3c, 0x4c, 0xfa, 0xb3, 0x2c, 0xc4, 0xb3, 0xee, 0x7d, 0x96,
+    0xf2, 0x47, 0x7c, 0xf6, 0x1d, 0x53, 0xcc, 0x7a, 0xd1, 0x2c, 0xd5, 0x8f,
+    0xc9, 0x4c, 0x3a, 0x70, 0xae, 0xef, 0x71, 0x92, 0xcc, 0x32, 0x01, 0xe8,
+    0x48, 0x7d, 0x07, 0x7f, 0x27, 0x77, 0xa0, 0x80, 0xe3, 0xcf, 0x48, 0x04,
+    0x77, 0xc2, 0x14, 0x43, 0x83, 0x66, 0xe2, 0xf5, 0xa3, 0xb0, 0xff, 0x95,
+    0x27, 0x1e, 0x16, 0x0e, 0x92, 0x79, 0x6c, 0x7e, 0xcf, 0xa6, 0xe6, 0x17,
+    0x50, 0x37, 0x77, 0x3e, 0xc0, 0x4f, 0x44, 0x5e, 0xe6, 0x00, 0x1d, 0xc2,
+    0x2f, 0xfe, 0x08, 0xf9, 0x96, 0x63, 0x93, 0xa1, 0x3a, 0x59, 0xb2, 0x68,
+    0x8d, 0x6d, 0x15, 0xf4, 0xf9, 0xba, 0x14, 0x3e, 0xa9, 0xd7, 0xef, 0x57,
+    0xcf, 0x0f, 0xbd, 0x46, 0x5f, 0x7d, 0x0f, 0x1d, 0xc0, 0x8a, 0x25, 0x56,
+    0x10, 0xb2, 0xa6, 0x5d, 0xc1, 0xe2, 0x96, 0xc9, 0xa1, 0x77, 0x57, 0x7b,
+    0xa2, 0xd4, 0xb7, 0x28, 0xdb, 0xac, 0x5e, 0xaa, 0x74, 0x84, 0x91, 0x3a,
+    0x04, 0x19, 0x82, 0xab, 0x52, 0xe4, 0x29, 0xee, 0x71, 0xcb, 0x8d, 0xbd,
+    0x59, 0xac, 0xce, 0x26, 0xc1, 0xa2, 0x33, 0x49, 0xcd, 0x6c, 0xf4, 0x90,
+    0xa0, 0x10, 0x42, 0xe6, 0x99, 0xaf, 0x8b, 0x4d, 0xb5, 0xa6, 0x1c, 0xa5,
+    0xc9, 0x1c, 0xcf, 0xd0, 0x81, 0xb1, 0x80, 0x69, 0xe9, 0xae, 0x23, 0xee,
+    0xa7, 0x18, 0x7e, 0x21, 0xf9, 0x75, 0x11, 0x90, 0x63, 0x08, 0xc2, 0x00,
+    0xce, 0xf7, 0x6e, 0x3a, 0x5e, 0xa1, 0xec, 0x30, 0x53, 0xaa, 0x1b, 0xcc,
+    0xe2, 0xb5, 0x26, 0x2b, 0x0d, 0x86, 0x43, 0x9d, 0x74, 0x8f, 0xf5, 0x93,
+    0x58, 0xac, 0xf4, 0x6f, 0x39, 0xce, 0x4a, 0x23, 0xb0, 0x94, 0xed, 0x53,
+    0x15, 0xa9, 0xc8, 0xd6, 0x91, 0x0d, 0xc7, 0x52, 0xae, 0x2b, 0x8a, 0xf7,
+    0xc1, 0x13, 0xbf, 0xfb, 0x87, 0x3a, 0xe2, 0xbd, 0xb0, 0x36, 0xf1, 0xab,
+    0x45, 0x14, 0x3c, 0x88, 0xb4, 0xf3, 0xe9, 0xb7, 0xee, 0xab, 0x85, 0x3e,
+    0x38, 0x9b, 0xdc, 0x29, 0x83, 0x13, 0xca, 0xe8, 0x2e, 0x93, 0xfc, 0xb1,
+    0x2c, 0x4a, 0x7c, 0x67, 0x7d, 0x27, 0x3b, 0x0c, 0x64, 0x4b, 0x95, 0x7c,
+    0x83, 0xda, 0x4f, 0xc8, 0x3d, 0xd5, 0x70, 0xa5, 0x7e, 0x45, 0xb5, 0x65,
+    0x33, 0x52, 0x46, 0x7d, 0x24, 0x6e, 0x03, 0x29, 0x7e, 0xb4, 0x1a, 0xe6,
+    0x94, 0x8b, 0x5e, 0x8d, 0xe7, 0x35, 0x1b, 0x0e, 0xcb, 0xed, 0xa2, 0xf0,
+    0x4e, 0x54, 0xaf, 0x61, 0xa1, 0xa8, 0xa0, 0x1b, 0x83, 0xe6, 0x70, 0xb9,
+    0xa5, 0xeb, 0x23, 0xd0, 0xc7, 0xac, 0xb3, 0x4a, 0x14, 0xf8, 0xe1, 0x73,
+    0x3b, 0x2c, 0x60, 0xfe, 0x41, 0x97, 0x49, 0x6c, 0xf9, 0x1a, 0x58, 0xc8,
+    0x62, 0x50, 0xd1, 0xb4, 0x31, 0xce, 0x66, 0x70, 0x11, 0x86, 0x95, 0x8e,
+    0x0a, 0x89, 0x9a, 0xb0, 0x87, 0x5a, 0xae, 0x96, 0x4b, 0x62, 0x35, 0xf0,
+    0xa2, 0x08, 0x0d, 0xba, 0x01, 0x9b, 0x1e, 0x64, 0x0b, 0xf5, 0x5d, 0xc8,
+    0xbd, 0x5c, 0x2c, 0x7a, 0x6e, 0x82, 0x67, 0x8e, 0x38, 0xe7, 0xc9, 0x62,
+    0xe1, 0x26, 0x3c, 0x66, 0x31, 0x0f, 0x59, 0xc8, 0x1f, 0xf0, 0x38, 0x2d,
+    0xb2, 0x60, 0x7c, 0x8b, 0x27, 0x60, 0xd5, 0xeb, 0x07, 0xca, 0x54, 0x03,
+    0x2c, 0xb9, 0x06, 0x51, 0xb5, 0x6a, 0xf0, 0xa6, 0xf4, 0x31, 0xa8, 0xd7,
+    0xdd, 0xac, 0xca, 0xae, 0x99, 0xb8, 0x29, 0x53, 0x26, 0x18, 0x4b, 0x28,
+    0x4b, 0xaa, 0xb5, 0xb2, 0x25, 0x65, 0x61, 0xbd, 0xee, 0xce, 0xd6, 0x55,
+    0x40, 0x16, 0x73, 0xb8, 0x6b, 0x44, 0xa2, 0xfe, 0x47, 0x3d, 0x9d, 0x04,
+    0xeb, 0x86, 0xa0, 0x45, 0xa8, 0x24, 0xaf, 0xdc, 0x9f, 0x57, 0xaf, 0xc7,
+    0x18, 0x50, 0x76, 0x05, 0x8f, 0xf4, 0x11, 0x4a, 0x0c, 0x4b, 0xb0, 0xc7,
+    0xfe, 0x2c, 0x05, 0x33, 0x5c, 0x29, 0x91, 0x7e, 0xcc, 0x80, 0x2a, 0xde,
+    0x86, 0xa9, 0x18, 0xf8, 0xe9, 0x92, 0x32, 0x37, 0x5b, 0x2c, 0x12, 0x6a,
+    0xf8, 0x0d, 0xeb, 0x88, 0xee, 0x26, 0x16, 0xc7, 0xe0, 0x4c, 0x73, 0xa1,
+    0x42, 0xb2, 0xb1, 0x9b, 0xa2, 0x3e, 0x1d, 0xb3, 0x90, 0xcd, 0x16, 0x8b,
+    0x4c, 0xa5, 0xc3, 0xab, 0x35, 0x1d, 0x0e, 0x6d, 0x32, 0x89, 0x0d, 0x47,
+    0x2e, 0x2f, 0xa6, 0xc4, 0xc5, 0x94, 0xc5, 0x62, 0xca, 0xf5, 0xc5, 0x44,
+    0x36, 0x13, 0x33, 0x51, 0xac, 0x64, 0x8c, 0x2b, 0x29, 0xcc, 0x4a, 0x0a,
+    0x4c, 0x01, 0xb4, 0x97, 0x4a, 0x45, 0xc7, 0x2b, 0x96, 0x8a, 0x3e, 0x6a,
+    0xb7, 0x91, 0x66, 0x75, 0x39, 0xb8, 0x32, 0x0d, 0x6f, 0x6f, 0x45, 0x5a,
+    0x49, 0xd9, 0x3a, 0x3f, 0x6d, 0xb1, 0x88, 0xca, 0xe7, 0xef, 0x00, 0xee,
+    0xc8, 0x43, 0xe9, 0x04, 0x0e, 0x1a, 0xa5, 0x21, 0x2b, 0x2d, 0x57, 0x54,
+    0xe7, 0x1e, 0x28, 0x3a, 0x40, 0x0b, 0xa6, 0x5e, 0xaf, 0xb8, 0xbc, 0x49,
+    0x25, 0x25, 0x60, 0xa5, 0x6e, 0xcb, 0x7e, 0x80, 0xe3, 0xee, 0x90, 0x04,
+    0x05, 0xb9, 0xc8, 0x38, 0xa0, 0x53, 0xca, 0x99, 0x29, 0xbd, 0x02, 0x58,
+    0xf4, 0x59, 0x11, 0x33, 0xad, 0xf7, 0x41, 0x3c, 0x88, 0x84, 0x39, 0x95,
+    0x5d, 0x9e, 0xb2, 0x7e, 0xc7, 0x2b, 0xd2, 0xaa, 0x8b, 0x33, 0xef, 0x9b,
+    0xdc, 0x3c, 0x6e, 0xc8, 0x6f, 0x71, 0x41, 0x72, 0x44, 0xc4, 0xd4, 0x8f,
+    0x73, 0x34, 0xa4, 0x2c, 0xd4, 0x94, 0xcb, 0x85, 0x51, 0x23, 0x41, 0x0b,
+    0x8e, 0xb5, 0x4b, 0x22, 0xa6, 0xd5, 0xc7, 0x79, 0xc0, 0x44, 0x56, 0xd2,
+    0x2e, 0xa4, 0xac, 0x16, 0xfe, 0xc8, 0xec, 0xa8, 0xd7, 0xf3, 0xab, 0x74,
+    0x28, 0x4b, 0x96, 0xcc, 0x28, 0x2b, 0xc4, 0x68, 0x29, 0xea, 0x07, 0x01,
+    0xd5, 0x85, 0xc0, 0xf5, 0x19, 0x24, 0x15, 0x90, 0xf7, 0x4f, 0x94, 0x3b,
+    0x92, 0xcc, 0x62, 0x2c, 0x44, 0xad, 0x84, 0x0c, 0x7a, 0x91, 0xfa, 0x91,
+    0x2b, 0x27, 0x44, 0xab, 0x26, 0x24, 0x57, 0x4c, 0x48, 0xae, 0xe4, 0x10,
+    0xa3, 0xd7, 0x90, 0x42, 0x07, 0x22, 0x85, 0xde, 0x43, 0xfa, 0xa3, 0x20,
+    0xbe, 0x15, 0x44, 0xb1, 0x3e, 0xf2, 0x55, 0x3c, 0x60, 0x87, 0x5f, 0xc5,
+    0xc3, 0x34, 0x15, 0x59, 0x06, 0x3f, 0x66, 0x53, 0x22, 0x56, 0xcf, 0x94,
+    0x55, 0x78, 0x27, 0xe9, 0x63, 0xb4, 0xea, 0x91, 0x94, 0x4f, 0x66, 0x6b,
+    0x81, 0xf4, 0xc6, 0x9c, 0x6e, 0xe5, 0xa3, 0xd3, 0xab, 0x0d, 0xf1, 0xe6,
+    0x25, 0xe8, 0x18, 0xb8, 0x5a, 0x2b, 0xe4, 0xae, 0xa8, 0xdc, 0x95, 0x1c,
+    0xd2, 0x2f, 0x29, 0xae, 0x91, 0xb1, 0x5d, 0x73, 0xd6, 0xae, 0xf3, 0x6c,
+    0x71, 0xad, 0x13, 0xb4, 0xb0, 0x1d, 0xad, 0x9f, 0x41, 0x28, 0xa2, 0xb6,
+    0x07, 0xca, 0x94, 0xa0, 0xc6, 0x33, 0x16, 0xaa, 0x7c, 0x29, 0xa7, 0x37,
+    0xeb, 0xf5, 0x22, 0x91, 0x39, 0x9c, 0x87, 0xad, 0x94, 0xd7, 0x6a, 0xa2,
+    0x13, 0x76, 0xfd, 0xb8, 0x13, 0x76, 0x39, 0xfc, 0x6a, 0x5a, 0x17, 0x33,
+    0x84, 0x52, 0x13, 0x31, 0x4b, 0x59, 0x6d, 0x8f, 0xb2, 0x3b, 0x38, 0x02,
+    0xb2, 0x74, 0x6d, 0xbf, 0xcc, 0xd1, 0xc8, 0x72, 0xcc, 0x9c, 0x8c, 0xd6,
+    0x95, 0x0d, 0xef, 0x36, 0x4a, 0x7a, 0x41, 0xd4, 0x72, 0x43, 0xe0, 0x0d,
+    0x1f, 0x47, 0x0c, 0x18, 0x79, 0xc0, 0x53, 0x96, 0xf1, 0xa3, 0x91, 0xa6,
+    0xd3, 0x84, 0xb2, 0x23, 0xb0, 0xfc, 0x73, 0xc4, 0x64, 0x2c, 0xa0, 0xac,
+    0x96, 0x55, 0xa8, 0xf8, 0x6e, 0xce, 0xf2, 0x9a, 0x7a, 0x5b, 0x80, 0x03,
+    0xa1, 0x50, 0xf9, 0xdf, 0x8d, 0x6c, 0x85, 0x53, 0x27, 0x8a, 0xde, 0xe7,
+    0xc6, 0x3a, 0x1c, 0x50, 0x12, 0x3a, 0xd5, 0xf5, 0x5a, 0xc4, 0x03, 0x73,
+    0x92, 0x02, 0xda, 0xd4, 0xeb, 0xf8, 0xfa, 0x64, 0x84, 0x87, 0xce, 0x9d,
+    0x60, 0x1c, 0xdc, 0x1f, 0xe5, 0x15, 0x1d, 0xd6, 0x91, 0x4c, 0x74, 0x0d,
+    0x79, 0xdb, 0x95, 0xec, 0xd7, 0x05, 0x20, 0xef, 0x2d, 0x5c, 0x28, 0x67,
+    0x53, 0x6c, 0x80, 0x81, 0xe3, 0x11, 0xd9, 0xac, 0xdf, 0x17, 0x59, 0xe6,
+    0x34, 0x63, 0x4f, 0xff, 0x54, 0xa0, 0x80, 0x57, 0x24, 0x01, 0x91, 0x9c,
+    0xd6, 0xeb, 0x10, 0x31, 0xc8, 0x92, 0xe8, 0x4e, 0xa5, 0x98, 0x86, 0x30,
+    0x44, 0x02, 0x83, 0xb0, 0x13, 0xb8, 0x02, 0x22, 0xd4, 0xa3, 0xeb, 0x8e,
+    0x58, 0x07, 0x06, 0x93, 0x5d, 0xca, 0xfe, 0x35, 0x72, 0x13, 0x56, 0xbe,
+    0xc1, 0xa9, 0x9d, 0x03, 0x53, 0x98, 0xcb, 0x69, 0x81, 0x1b, 0x0f, 0x89,
+    0x5e, 0x5f, 0x50, 0x81, 0xa2, 0x5a, 0xa2, 0x0c, 0x04, 0xfb, 0x0c, 0x98,
+    0x2b, 0x8e, 0x9f, 0xb0, 0x0e, 0xbe, 0x51, 0xe3, 0xa7, 0x2c, 0x51, 0xe3,
+    0xab, 0x33, 0x98, 0xf0, 0x2e, 0x65, 0x72, 0xb1, 0x10, 0x0a, 0x00, 0x35,
+    0xf1, 0x02, 0x80, 0x7f, 0x8d, 0x56, 0xae, 0xf0, 0x28, 0xb0, 0xd1, 0x84,
+    0x5f, 0xea, 0x3a, 0x1d, 0x83, 0x02, 0x1c, 0xdf, 0x9e, 0xe4, 0xb1, 0xae,
+    0xa0, 0x66, 0xd9, 0xa5, 0xcc, 0x4d, 0x79, 0x4c, 0x35, 0x69, 0xd5, 0xeb,
+    0xb5, 0x9d, 0x9d, 0xa3, 0x91, 0xa7, 0xee, 0xdf, 0xa9, 0xd7, 0x11, 0x3a,
+    0x54, 0xd5, 0x15, 0x82, 0x30, 0x70, 0x56, 0x80, 0x72, 0x36, 0x82, 0x93,
+    0xc2, 0xf9, 0xe3, 0xf9, 0xa8, 0x74, 0x2f, 0x19, 0x5e, 0x1c, 0x25, 0x7d,
+    0x57, 0x36, 0x9c, 0xba, 0xd3, 0x10, 0xd6, 0x3d, 0x69, 0x9d, 0x7a, 0xab,
+    0xfb, 0xb8, 0xcf, 0x5e, 0x2f, 0x77, 0x99, 0xd3, 0xb2, 0x3b, 0xbc, 0x5c,
+    0xa7, 0xfa, 0xa3, 0x91, 0x65, 0xfc, 0xe1, 0xd1, 0x14, 0x00, 0x98, 0xa9,
+    0xfb, 0x0f, 0x14, 0xf9, 0x02, 0xc9, 0xdb, 0x95, 0x40, 0x8e, 0xea, 0x4a,
+    0xa6, 0xc2, 0xe3, 0x2c, 0x8d, 0x7c, 0xa9, 0x52, 0xe2, 0x04, 0xd3, 0x64,
+    0xe2, 0xc7, 0x58, 0x00, 0x76, 0x86, 0xaf, 0x53, 0x55, 0xae, 0x46, 0xec,
+    0x7a, 0xc4, 0x6e, 0x46, 0xbc, 0x01, 0x16, 0x08, 0x98, 0xe8, 0xec, 0xe3,
+    0xc8, 0xbe, 0x8a, 0xea, 0x97, 0x11, 0xdf, 0x3d, 0x50, 0x4e, 0xe8, 0xcf,
+    0xbd, 0xce, 0x1f, 0x07, 0xdd, 0x9f, 0xdc, 0x96, 0xef, 0xb6, 0x6a, 0x07,
+    0x9f, 0x77, 0x55, 0xe9, 0x1b, 0x7a, 0x80, 0xc5, 0xf4, 0xa7, 0xa2, 0x08,
+    0xee, 0x76, 0xfa, 0x75, 0xa4, 0x2e, 0x77, 0x82, 0x75, 0x5a, 0x80, 0x4e,
+    0x12, 0xf6, 0x91, 0xdb, 0xd3, 0xcf, 0x96, 0x5f, 0x7b, 0x37, 0x64, 0x9f,
+    0x36, 0xd7, 0xbb, 0x9f, 0x44, 0xbb, 0x21, 0xfb, 0x6d, 0xc4, 0x1d, 0xab,
+    0x7c, 0x77, 0x9c, 0x25, 0xb1, 0xc3, 0x7e, 0x1f, 0x71, 0xe5, 0x24, 0x57,
+    0x37, 0x42, 0xbd, 0x1a, 0xa9, 0xcb, 0xac, 0x5e, 0xed, 0xb2, 0x2f, 0x23,
+    0xfe, 0x71, 0xb4, 0x7a, 0x43, 0x52, 0xe0, 0xd0, 0xe6, 0x97, 0x91, 0x37,
+    0x4a, 0xc5, 0x10, 0xfc, 0x4b, 0x89, 0xea, 0x0b, 0x9f, 0x59, 0xbe, 0xfe,
+    0x7c, 0x0f, 0x7f, 0x8f, 0x83, 0x7b, 0x38, 0x69, 0x7c, 0xb9, 0x22, 0x4a,
+    0xd1, 0x81, 0xe6, 0x00, 0x33, 0x75, 0xf0, 0x32, 0x09, 0x5a, 0x2c, 0x18,
+    0x34, 0x81, 0x94, 0x40, 0xc3, 0x56, 0x24, 0x8f, 0x3d, 0x00, 0x73, 0x7a,
+    0x1c, 0x44, 0x51, 0x2f, 0xe8, 0x7f, 0x65, 0x01, 0x77, 0xcb, 0x6b, 0x06,
+    0x27, 0xbf, 0x20, 0xf7, 0x99, 0x2e, 0x16, 0x0e, 0xfa, 0xb1, 0x9d, 0xc6,
+    0xcd, 0xa8, 0xd1, 0x60, 0x59, 0x05, 0xf0, 0x3a, 0x06, 0x40, 0xd9, 0x8c,
+    0xf7, 0x3b, 0x01, 0x04, 0x94, 0x6d, 0xd9, 0x71, 0x34, 0x72, 0xd7, 0x35,
+    0x04, 0x47, 0xc9, 0x22, 0xd8, 0x56, 0x4e, 0xd0, 0x4b, 0x52, 0x89, 0x06,
+    0x24, 0x7f, 0xc4, 0xdf, 0xbe, 0x28, 0xcc, 0x5a, 0x60, 0x15, 0xd3, 0x34,
+    0x99, 0x84, 0x99, 0x70, 0x23, 0xe4, 0xa5, 0x19, 0x05, 0xc5, 0xdb, 0x41,
+    0x51, 0xaa, 0x7b, 0x29, 0x8b, 0x97, 0x7e, 0x24, 0x82, 0xf4, 0x26, 0x9c,
+    0x80, 0xb8, 0xd4, 0xfc, 0x37, 0xc3, 0xc4, 0x3c, 0xb7, 0x88, 0xbf, 0x30,
+    0x0d, 0x40, 0x8d, 0x9b, 0x90, 0x46, 0xd8, 0x7a, 0x3f, 0x72, 0x43, 0x70,
+    0x1f, 0x47, 0xea, 0xa2, 0xb9, 0xf6, 0x48, 0x19, 0xc5, 0x10, 0x1b, 0xd1,
+    0xe3, 0xa8, 0x37, 0x0c, 0x26, 0xc9, 0x67, 0xc0, 0x45, 0xca, 0x38, 0x9b,
+    0xd1, 0x7a, 0x7d, 0x86, 0x7d, 0x00, 0x2a, 0x42, 0x9e, 0xeb, 0xaf, 0xa8,
+    0x2c, 0xbe, 0x1b, 0xb9, 0x60, 0x61, 0xb7, 0x84, 0x6b, 0x66, 0xec, 0xbb,
+    0xd8, 0x93, 0x1d, 0xa8, 0x2f, 0x8e, 0x3d, 0x2f, 0x59, 0x06, 0x81, 0x14,
+    0x1e, 0x7b, 0xb3, 0x34, 0x2a, 0xb6, 0xea, 0xe7, 0x96, 0xeb, 0x35, 0x28,
+    0xff, 0xdc, 0x82, 0xad, 0xfa, 0x6a, 0x9f, 0x3b, 0x8d, 0x80, 0xb2, 0x8f,
+    0x23, 0x0f, 0xae, 0xfb, 0x2a, 0x1d, 0x42, 0xc9, 0x28, 0x83, 0x93, 0x5d,
+    0x52, 0xe1, 0x01, 0x6d, 0x8a, 0x4c, 0x48, 0x83, 0x16, 0x6b, 0x4c, 0xe1,
+    0x3a, 0xba, 0x12, 0x26, 0xa4, 0x9b, 0x16, 0x70, 0xab, 0x50, 0xb4, 0x34,
+    0x04, 0x77, 0x2d, 0xa4, 0x84, 0x43, 0x4c, 0xfc, 0x11, 0xb0, 0xe5, 0x3b,
+    0xef, 0x4e, 0x6f, 0x1c, 0x56, 0xc8, 0x1a, 0xff, 0x6c, 0x94, 0x6f, 0xe2,
+    0xb3, 0x11, 0x43, 0x74, 0xc1, 0x0f, 0xc3, 0xfd, 0xd4, 0x6f, 0xe4, 0x89,
+    0x18, 0x71, 0x63, 0x8a, 0xbd, 0xf9, 0xb5, 0x3d, 0x76, 0x3f, 0x4a, 0x2b,
+    0x82, 0xe4, 0xb0, 0xdb, 0xfb, 0xde, 0xa7, 0x0f, 0x67, 0xef, 0xa5, 0x9c,
+    0x5e, 0x89, 0x6f, 0x33, 0x91, 0xc9, 0x25, 0x0b, 0xfa, 0x7d, 0x31, 0x95,
+    0x99, 0xff, 0xa8, 0x28, 0xce, 0x5f, 0x0d, 0x43, 0x31, 0x52, 0xda, 0x88,
+    0x1b, 0xca, 0xef, 0x77, 0xac, 0xc0, 0x15, 0x83, 0x7d, 0xe0, 0xff, 0x36,
+    0x62, 0xf7, 0x93, 0xc8, 0x2f, 0xed, 0xe3, 0xfb, 0x49, 0xc4, 0x08, 0x0e,
+    0x70, 0x0f, 0x3b, 0x18, 0xb3, 0xeb, 0x7f, 0x1f, 0xa9, 0x4c, 0x76, 0x35,
+    0xf0, 0x14, 0x74, 0x74, 0x67, 0xc9, 0xfa, 0x69, 0x92, 0x65, 0x27, 0xc9,
+    0x24, 0x08, 0x63, 0xbf, 0xb6, 0xcf, 0x34, 0x02, 0xfd, 0x3d, 0x48, 0x5e,
+    0x06, 0x94, 0x9c, 0x00, 0x97, 0xab, 0xed, 0xb1, 0x7e, 0xd0, 0x1f, 0x09,
+    0xf8, 0x01, 0x5c, 0xee, 0xad, 0x3a, 0x35, 0x7c, 0x36, 0xca, 0x71, 0x5c,
+    0x10, 0xc2, 0xd7, 0xb1, 0x12, 0x26, 0xd1, 0x98, 0x4d, 0xc6, 0xec, 0x2c,
+    0x64, 0xe3, 0x90, 0xc5, 0x63, 0x50, 0x2a, 0xb4, 0xb9, 0xf5, 0xb8, 0x64,
+    0x5f, 0xc7, 0x8b, 0x05, 0xdc, 0xff, 0x92, 0x60, 0xf9, 0x89, 0x18, 0x8a,
+    0x34, 0x15, 0x03, 0x24, 0x49, 0xf3, 0xe0, 0xaa, 0xd0, 0xe1, 0xd5, 0x08,
+    0x5d, 0xff, 0xe5, 0x85, 0xa4, 0x79, 0x50, 0x2a, 0x1e, 0x77, 0xae, 0x46,
+    0x90, 0x9c, 0xab, 0x7e, 0xf0, 0x95, 0x8a, 0x50, 0x46, 0x9b, 0xee, 0x38,
+    0xe4, 0xf1, 0xb8, 0x10, 0x4b, 0x7b, 0x9c, 0xe7, 0x6c, 0xa9, 0xd1, 0x40,
+    0xc1, 0x04, 0x30, 0x5a, 0x92, 0x29, 0x00, 0x0a, 0x67, 0xf1, 0xd8, 0xb3,
+    0xb0, 0xb3, 0x58, 0xb8, 0x6e, 0x34, 0xae, 0x66, 0x7f, 0x54, 0x31, 0xbf,
+    0x78, 0x0c, 0xf4, 0xce, 0xa2, 0xb1, 0x7a, 0xd4, 0x7f, 0x57, 0xfa, 0xe1,
+    0x5f, 0x46, 0xca, 0x2b, 0xd9, 0x4f, 0xa2, 0x86, 0xb3, 0xbb, 0xeb, 0x34,
+    0x80, 0x77, 0x26, 0x99, 0xac, 0x41, 0x83, 0xf2, 0x1b, 0xe8, 0x21, 0xc9,
+    0x24, 0x82, 0x32, 0x4b, 0x23, 0x70, 0x7d, 0xe2, 0x0f, 0x9b, 0xcd, 0x9a,
+    0x0b, 0xec, 0xc0, 0xf5, 0xbb, 0xb3, 0x7f, 0xe0, 0x4e, 0xc6, 0x1a, 0x8e,
+    0x3c, 0x9d, 0xcf, 0xf9, 0x9b, 0x83, 0xae, 0x59, 0xdd, 0x56, 0xbf, 0x55,
+    0x31, 0xa6, 0x3d, 0x36, 0x19, 0x83, 0xcf, 0xf8, 0x4c, 0xa1, 0xc8, 0x5a,
+    0xf4, 0x7a, 0xfd, 0x2c, 0xc4, 0x40, 0x05, 0x66, 0x69, 0xe8, 0xb3, 0x02,
+    0x47, 0x23, 0x75, 0xe7, 0xaa, 0x7e, 0x05, 0xbd, 0xea, 0x9f, 0xf0, 0x0a,
+    0xaf, 0x23, 0x34, 0x05, 0xec, 0x2c, 0xf4, 0x64, 0x1a, 0x0c, 0x30, 0x97,
+    0x23, 0x88, 0x28, 0x65, 0x35, 0xfd, 0x66, 0xb1, 0x80, 0x57, 0x2a, 0x16,
+    0x0b, 0x7b, 0xb1, 0xc6, 0xf5, 0x73, 0x39, 0x62, 0x5b, 0xaf, 0x3b, 0xc8,
+    0xe7, 0xd5, 0x7b, 0x23, 0x5c, 0x17, 0x0b, 0x18, 0x00, 0xe6, 0x71, 0x3e,
+    0xd2, 0xbf, 0x98, 0x81, 0xc6, 0xfc, 0x30, 0x92, 0x1a, 0x65, 0xc6, 0x14,
+    0xf1, 0x61, 0x9a, 0xb3, 0x6f, 0x63, 0xbe, 0xfb, 0xb9, 0xe5, 0x35, 0x80,
+    0x0b, 0x29, 0xe7, 0xb2, 0xc2, 0x07, 0x7a, 0x38, 0xbf, 0x8d, 0xeb, 0x75,
+    0x77, 0x3a, 0xe6, 0x7a, 0x60, 0x60, 0x7e, 0x70, 0x72, 0x7e, 0xec, 0x21,
+    0xf5, 0xd7, 0xeb, 0xee, 0xd7, 0x71, 0xbd, 0x5e, 0x03, 0xc2, 0xfb, 0xaa,
+    0xcb, 0x16, 0x0b, 0x27, 0x8f, 0x22, 0x4f, 0xc7, 0x16, 0xc8, 0xd3, 0x31,
+    0x2d, 0x96, 0xeb, 0x7c, 0xa4, 0x7f, 0x31, 0xe7, 0x0b, 0x77, 0x1a, 0x96,
+    0xb7, 0x9e, 0x32, 0xdd, 0x82, 0x43, 0x0b, 0xcd, 0x40, 0xbe, 0x8d, 0xab,
+    0x9a, 0xc6, 0x63, 0x25, 0xf7, 0x5a, 0xe6, 0x47, 0xc3, 0xe1, 0x2d, 0xc7,
+    0x57, 0xae, 0x18, 0xf3, 0x0e, 0x8e, 0x8c, 0xf4, 0xb5, 0x60, 0xe4, 0x2d,
+    0x38, 0x74, 0x6a, 0x4b, 0x5d, 0x37, 0x1e, 0xb3, 0x64, 0xac, 0xc3, 0x5a,
+    0x63, 0x96, 0x21, 0x6a, 0x34, 0x63, 0xea, 0x4c, 0xc7, 0x5d, 0x26, 0xc7,
+    0xe0, 0xe3, 0x9e, 0x8d, 0x57, 0x8c, 0x1e, 0x39, 0x06, 0x23, 0xdb, 0x4e,
+    0xe7, 0xef, 0x72, 0x54, 0xac, 0x97, 0xec, 0x6e, 0x8c, 0x0e, 0x47, 0xb8,
+    0x57, 0xb1, 0xe1, 0xd3, 0xcf, 0xbb, 0x9f, 0x77, 0xcb, 0x68, 0x6d, 0xe5,
+    0x57, 0x64, 0xf9, 0x16, 0xd1, 0x1a, 0x32, 0x67, 0x73, 0x04, 0xe1, 0x7e,
+    0x94, 0xba, 0x94, 0xdd, 0x8f, 0xf9, 0x7c, 0x0c, 0x17, 0x9e, 0x6a, 0x9e,
+    0xf9, 0x5e, 0x04, 0x03, 0x81, 0x77, 0xab, 0x24, 0xe3, 0x7a, 0x3d, 0x19,
+    0xe7, 0xb2, 0x74, 0x3e, 0x5e, 0xdf, 0x9c, 0xb3, 0xb1, 0xeb, 0x7c, 0xda,
+    0xd1, 0x2d, 0xc5, 0x60, 0x07, 0x74, 0x63, 0x87, 0x39, 0x65, 0x2e, 0x0c,
+    0x62, 0x7e, 0xec, 0x3a, 0x87, 0x38, 0x63, 0x87, 0x65, 0x63, 0x38, 0x7e,
+    0xb4, 0x8b, 0xf7, 0xc4, 0x29, 0x5c, 0x4c, 0xc2, 0x89, 0x50, 0x54, 0x96,
+    0x8d, 0x81, 0xb8, 0x77, 0xf6, 0x0f, 0xb2, 0x71, 0xb1, 0x91, 0x18, 0x26,
+    0xb6, 0x67, 0x63, 0x9e, 0x8d, 0x8d, 0x25, 0xca, 0x1c, 0xf6, 0x1a, 0xd3,
+    0x6a, 0xd9, 0x7c, 0xec, 0x81, 0xb5, 0x9b, 0x86, 0x03, 0xf1, 0x41, 0x77,
+    0x53, 0xaf, 0x57, 0x14, 0xba, 0x19, 0xee, 0x38, 0x98, 0x80, 0x3a, 0xbb,
+    0xa3, 0x06, 0xcc, 0x49, 0xad, 0x28, 0xac, 0xd7, 0x35, 0xe5, 0xe6, 0x1b,
+    0x25, 0x1e, 0x57, 0x6c, 0x14, 0x90, 0xdc, 0x63, 0xd7, 0xd1, 0x27, 0x81,
+    0x76, 0xa0, 0xa5, 0xc3, 0x56, 0xbb, 0x2f, 0x8b, 0x87, 0x9d, 0xf9, 0x7c,
+    0xbe, 0x33, 0x4c, 0xd2, 0xc9, 0xce, 0x2c, 0x8d, 0x44, 0xdc, 0x4f, 0xe0,
+    0xea, 0x0d, 0x44, 0xea, 0x08, 0x91, 0x9e, 0xa1, 0x75, 0x7a, 0x8d, 0xcc,
+    0xd7, 0x2a, 0x9c, 0x8d, 0xdd, 0xeb, 0x91, 0x55, 0xab, 0x73, 0x0d, 0xfc,
+    0x15, 0x1c, 0xf6, 0xeb, 0xeb, 0xc6, 0x67, 0x63, 0x44, 0x49, 0x8c, 0x11,
+    0x5e, 0xc8, 0xf3, 0x12, 0xca, 0xd0, 0xe7, 0xe5, 0xe4, 0xbe, 0xbf, 0x73,
+    0x58, 0x75, 0xeb, 0xd2, 0x90, 0xc7, 0xea, 0x56, 0x20, 0x85, 0x6d, 0xe5,
+    0x28, 0xd5, 0x74, 0x7c, 0x34, 0x66, 0xc7, 0x63, 0x5e, 0xdb, 0x07, 0x30,
+    0x5e, 0xef, 0xed, 0x1d, 0x20, 0x0d, 0xc9, 0x40, 0xce, 0x32, 0xc4, 0xbe,
+    0xfa, 0x79, 0xf0, 0xf3, 0xde, 0xde, 0x62, 0xf1, 0xf3, 0x9e, 0x1a, 0x4c,
+    0x95, 0x61, 0x32, 0xb7, 0x55, 0xd9, 0x19, 0x86, 0x70, 0xeb, 0x25, 0xe7,
+    0x77, 0x63, 0x04, 0x6c, 0x3a, 0xe6, 0x53, 0xd8, 0x88, 0x6e, 0x3b, 0x2c,
+    0x93, 0xc6, 0x7c, 0x0c, 0x5e, 0xc5, 0x2b, 0x91, 0x4d, 0x93, 0x38, 0x13,
+    0x6a, 0xb6, 0xae, 0xb9, 0x2d, 0x73, 0x07, 0x95, 0x58, 0xe4, 0xb7, 0xed,
+    0x90, 0xb7, 0x43, 0x43, 0x27, 0xcd, 0x9c, 0x4e, 0xda, 0xa1, 0x7a, 0xc7,
+    0x7f, 0x1f, 0xb5, 0xd4, 0x9d, 0xab, 0x3e, 0x3c, 0xfd, 0x36, 0x6a, 0x21,
+    0x2b, 0x70, 0xfc, 0x5f, 0x47, 0x6a, 0x07, 0xb5, 0x43, 0xda, 0x32, 0xdc,
+    0xc5, 0xff, 0x54, 0x14, 0xd6, 0xeb, 0x0e, 0x48, 0x75, 0xd0, 0x6e, 0xf1,
+    0xae, 0x56, 0x08, 0xe1, 0x42, 0xb0, 0xab, 0x37, 0x1b, 0x0e, 0xf1, 0x52,
+    0x6b, 0xc4, 0xa7, 0x82, 0x4e, 0x2f, 0x7e, 0x2f, 0x4a, 0x7a, 0xeb, 0x2f,
+    0xe8, 0xd1, 0xd8, 0x2e, 0x52, 0x57, 0x5a, 0x94, 0xcb, 0x20, 0xd7, 0xbc,
+    0x09, 0xb7, 0xfd, 0x1e, 0x8d, 0xd7, 0x9c, 0xea, 0x70, 0x5b, 0xa6, 0x57,
+    0xa8, 0x03, 0x9c, 0x9f, 0x8d, 0x8a, 0x7b, 0x89, 0x94, 0x1f, 0x33, 0x5e,
+    0x31, 0xf4, 0x89, 0xdd, 0xc0, 0xdc, 0xd1, 0x87, 0x1e, 0x37, 0xf7, 0x68,
+    0xcc, 0xa6, 0x63, 0x16, 0x8f, 0x29, 0x33, 0x73, 0x06, 0x96, 0xd8, 0x82,
+    0x9c, 0x1a, 0xf7, 0x68, 0x4c, 0x7d, 0x9c, 0x33, 0x16, 0x95, 0x21, 0xfc,
+    0xf4, 0xe1, 0xcc, 0x57, 0x88, 0xe3, 0xc8, 0x81, 0xdd, 0xa3, 0x31, 0x7f,
+    0xa5, 0x91, 0x75, 0x34, 0xa6, 0xea, 0xee, 0x61, 0x25, 0x9c, 0xf4, 0xf5,
+    0xc2, 0x47, 0x63, 0x4a, 0x8b, 0xbb, 0x85, 0x8f, 0xc7, 0x5c, 0x42, 0xcc,
+    0xe9, 0x38, 0x67, 0xbf, 0xed, 0x91, 0x7b, 0x3c, 0x66, 0x0e, 0x36, 0x48,
+    0xb5, 0xf6, 0x3c, 0x07, 0xd0, 0x80, 0x77, 0x2e, 0xdf, 0x8f, 0x00, 0xd4,
+    0xe2, 0x19, 0x93, 0xa5, 0xda, 0x23, 0x37, 0xa7, 0x24, 0x40, 0x99, 0xca,
+    0x1a, 0x63, 0x79, 0x59, 0x4b, 0x6b, 0xe1, 0xbe, 0x56, 0x9f, 0xad, 0xf6,
+    0x80, 0xa8, 0x76, 0xb8, 0xcc, 0xf5, 0x6c, 0x7c, 0x53, 0xdc, 0x7c, 0x38,
+    0xf6, 0xb0, 0x85, 0x4b, 0x99, 0xd1, 0xe9, 0xd7, 0xba, 0x60, 0xf3, 0x31,
+    0xa2, 0xfb, 0x61, 0xcc, 0x6b, 0xae, 0x13, 0x64, 0x0f, 0x71, 0x1f, 0xad,
+    0x28, 0x90, 0x40, 0xc0, 0xdf, 0xa1, 0x40, 0x6f, 0xd2, 0x64, 0x2a, 0x62,
+    0x57, 0x33, 0x11, 0xad, 0x54, 0xb0, 0x87, 0x31, 0xfe, 0xca, 0x44, 0x1a,
+    0xc3, 0x79, 0xf1, 0x78, 0xec, 0x4d, 0x83, 0x2c, 0x9b, 0x27, 0xe9, 0x00,
+    0x19, 0xc2, 0xfd, 0x28, 0x7d, 0x1b, 0x8a, 0x68, 0xb0, 0xc2, 0x12, 0x8a,
+    0xe2, 0xf9, 0x18, 0xd8, 0x00, 0xb7, 0xcb, 0xa0, 0xa0, 0x59, 0x54, 0x97,
+    0x63, 0x7a, 0x3f, 0xd6, 0xbe, 0xf3, 0xf9, 0x98, 0xc9, 0xb1, 0xe2, 0x1b,
+    0xf9, 0x7d, 0x2e, 0x00, 0x50, 0xae, 0xea, 0xa7, 0xe3, 0x0d, 0xba, 0xfe,
+    0x46, 0xb6, 0x50, 0x85, 0x23, 0x63, 0x15, 0x58, 0x88, 0x66, 0xc5, 0x30,
+    0x14, 0xb9, 0x75, 0x06, 0xda, 0xa8, 0xe6, 0xb0, 0x2d, 0xfd, 0x17, 0x35,
+    0x7c, 0x78, 0x8b, 0x9a, 0x2d, 0x38, 0x65, 0xd7, 0xf5, 0x7b, 0x63, 0x94,
+    0x5e, 0x8e, 0xec, 0xf8, 0x63, 0xe9, 0x96, 0x24, 0xa0, 0xb7, 0x24, 0x93,
+    0x7c, 0xed, 0x0c, 0xef, 0xa6, 0x36, 0xc5, 0x25, 0x83, 0x98, 0xb8, 0xe5,
+    0x5c, 0x5e, 0x5c, 0xdf, 0x38, 0x46, 0x76, 0xe3, 0x01, 0x04, 0x05, 0x0e,
+    0xde, 0xd5, 0xf5, 0x27, 0x7a, 0x35, 0xfa, 0x8f, 0x52, 0x6d, 0xd6, 0x7a,
+    0x86, 0x28, 0x58, 0x12, 0x0c, 0xaa, 0xb6, 0x78, 0xd5, 0x09, 0x2d, 0x0c,
+    0x4f, 0xe4, 0x97, 0xe2, 0xe2, 0xe9, 0x32, 0x5e, 0xca, 0x05, 0x62, 0x01,
+    0x37, 0xee, 0x17, 0xca, 0x32, 0x1e, 0x18, 0x67, 0x9a, 0x01, 0x68, 0xff,
+    0x20, 0xc9, 0x4f, 0x52, 0xb8, 0x01, 0x2a, 0x3a, 0x09, 0x98, 0xaf, 0x29,
+    0x4f, 0x3a, 0xfb, 0x5d, 0xca, 0xf2, 0x06, 0xe5, 0x34, 0x1b, 0x0f, 0xd8,
+    0xa5, 0x9b, 0xb6, 0x8e, 0x46, 0xae, 0x73, 0x30, 0x08, 0xef, 0xde, 0x38,
+    0x54, 0x15, 0x15, 0xa7, 0x0f, 0x7f, 0x19, 0xc1, 0x69, 0x08, 0x7d, 0x22,
+    0x2f, 0x05, 0x27, 0x00, 0xcb, 0xea, 0xf5, 0xac, 0x32, 0xb1, 0xc2, 0x20,
+    0x21, 0xd0, 0x91, 0x36, 0x9c, 0x52, 0x10, 0x72, 0x25, 0x10, 0x3f, 0x5e,
+    0xb5, 0xc1, 0xbf, 0x95, 0xc4, 0x90, 0x77, 0x6c, 0xb4, 0xdb, 0xca, 0xf8,
+    0x79, 0xc7, 0xf2, 0xce, 0x06, 0x83, 0xd5, 0x78, 0x70, 0x85, 0xd3, 0x49,
+    0x70, 0x10, 0xdb, 0xac, 0xf2, 0x98, 0x22, 0xa6, 0xe5, 0x04, 0x21, 0x1e,
+    0x62, 0x02, 0x0b, 0x39, 0x54, 0xb7, 0x33, 0x5a, 0xf7, 0xfe, 0x03, 0xc7,
+    0x0c, 0x59, 0xa2, 0x46, 0x0f, 0x94, 0xc3, 0x56, 0x5f, 0x80, 0x08, 0x91,
+    0xac, 0x99, 0x7a, 0x2e, 0x07, 0x61, 0x60, 0x02, 0x95, 0xc1, 0xa3, 0x20,
+    0xd7, 0xe9, 0x05, 0xde, 0x4a, 0xec, 0x4a, 0x1e, 0xb6, 0x12, 0x3f, 0x69,
+    0x38, 0x1d, 0xa7, 0xe1, 0xce, 0x8a, 0x2f, 0x53, 0x70, 0x1e, 0x80, 0x16,
+    0xa1, 0x33, 0x75, 0x83, 0x96, 0xc4, 0x23, 0x2f, 0x4e, 0x17, 0xb4, 0xe4,
+    0xa4, 0x5e, 0xcf, 0x5a, 0x29, 0xcc, 0xdd, 0x15, 0x1e, 0x72, 0x11, 0xa1,
+    0xcf, 0x30, 0xfa, 0x45, 0x8b, 0xc5, 0xa2, 0x16, 0xd6, 0xeb, 0x56, 0x77,
+    0xad, 0x18, 0x43, 0x63, 0x21, 0xf8, 0xdf, 0x55, 0x63, 0x1d, 0x7b, 0xd1,
+    0x8e, 0x5f, 0x16, 0xeb, 0xc4, 0xb7, 0xba, 0xfd, 0x5d, 0x84, 0xff, 0xf5,
+    0x7a, 0x0f, 0xbe, 0x8c, 0xd0, 0x70, 0xb4, 0xcb, 0xdb, 0xfd, 0x38, 0xe6,
+    0x03, 0x0a, 0x14, 0x9c, 0xe7, 0x36, 0xae, 0xdc, 0x93, 0x58, 0x64, 0x25,
+    0xe3, 0xd5, 0x31, 0x61, 0xf5, 0x1d, 0xcb, 0x3a, 0x9c, 0xd0, 0x2a, 0x32,
+    0x8f, 0x43, 0xed, 0xd2, 0xd6, 0xf9, 0xc5, 0x8f, 0x30, 0x31, 0x3f, 0x66,
+    0x38, 0x31, 0x1f, 0x32, 0xd0, 0xed, 0xc8, 0x0f, 0x1e, 0x4a, 0xfc, 0x38,
+    0xd6, 0x48, 0xd6, 0x47, 0x26, 0x84, 0xbe, 0x7f, 0x73, 0x35, 0x82, 0x03,
+    0xb7, 0xdd, 0x01, 0x07, 0x86, 0xdb, 0x09, 0x11, 0x5f, 0x14, 0xd5, 0x0f,
+    0x60, 0x9d, 0x02, 0x2c, 0x09, 0x61, 0x27, 0xb1, 0x5a, 0x5a, 0x77, 0xbd,
+    0x5e, 0xc3, 0x9b, 0x3e, 0xe0, 0x3a, 0xee, 0x01, 0xd8, 0x65, 0xb3, 0xde,
+    0x24, 0x84, 0x06, 0x10, 0x2a, 0x4b, 0x85, 0x6a, 0x0c, 0xbf, 0x7b, 0x33,
+    0x29, 0xf1, 0x3b, 0x18, 0xa9, 0xd6, 0x6b, 0xd4, 0x4f, 0xd7, 0x01, 0x83,
+    0x2c, 0xd1, 0xe5, 0xfd, 0x91, 0xe8, 0x7f, 0xed, 0x25, 0xf7, 0xf0, 0xb8,
+    0x58, 0x40, 0xf2, 0xad, 0xe8, 0x7f, 0xc5, 0xbc, 0xa6, 0xd0, 0xfd, 0x38,
+    0x86, 0x1b, 0x32, 0x40, 0xf6, 0x52, 0x7d, 0xb7, 0xea, 0xc7, 0x71, 0x09,
+    0xc7, 0x7c, 0xed, 0x3e, 0xa4, 0x62, 0x17, 0xe8, 0x48, 0xb6, 0xbd, 0x1a,
+    0x6e, 0x75, 0x3e, 0x97, 0x46, 0xed, 0xfa, 0x86, 0x83, 0x54, 0x4b, 0xc0,
+    0x0b, 0xee, 0x81, 0xca, 0xd7, 0x8a, 0xbe, 0x10, 0xb8, 0x82, 0x4c, 0x72,
+    0x30, 0x11, 0x31, 0xab, 0x39, 0x7a, 0xe5, 0x10, 0x10, 0x2d, 0x42, 0x40,
+    0x06, 0x91, 0x90, 0x33, 0x62, 0x92, 0x9f, 0x2b, 0x8e, 0xd0, 0x7c, 0x1c,
+    0xeb, 0xc0, 0x88, 0xa9, 0xaf, 0xcf, 0xee, 0x8b, 0x6f, 0xee, 0x1e, 0xb5,
+    0xa2, 0x47, 0x4c, 0x54, 0x46, 0x48, 0x16, 0x8b, 0xfc, 0x82, 0xb9, 0x3d,
+    0xaa, 0x41, 0x74, 0x57, 0x2e, 0xe4, 0xb0, 0x03, 0xa1, 0xe9, 0xc3, 0xe3,
+    0xda, 0xa9, 0x4a, 0x6d, 0xd9, 0x16, 0xea, 0x8b, 0xe2, 0x40, 0xab, 0xf5,
+    0x9a, 0x7d, 0x6f, 0xb5, 0x68, 0xd5, 0xa4, 0x2b, 0xbe, 0xe0, 0xa0, 0x4a,
+    0xd6, 0xbe, 0xb6, 0x80, 0xd7, 0x08, 0x2c, 0x97, 0x4b, 0x97, 0xb2, 0xc1,
+    0x92, 0x36, 0xb7, 0x76, 0x7f, 0xfa, 0x69, 0xeb, 0xc3, 0x7f, 0xdf, 0xdc,
+    0xfc, 0xfd, 0xe7, 0x9f, 0x21, 0x5f, 0x61, 0x1e, 0x3c, 0x90, 0x1d, 0x02,
+    0x05, 0xe4, 0xef, 0x3f, 0xff, 0xec, 0xfd, 0xe7, 0x6b, 0xf2, 0xe1, 0xfd,
+    0x77, 0x82, 0xf4, 0x45, 0xcc, 0xfb, 0x99, 0x0c, 0xa3, 0xf0, 0x3b, 0x5c,
+    0x1a, 0x79, 0x7a, 0x7d, 0x19, 0x9e, 0xc1, 0x59, 0x8c, 0xad, 0xcb, 0x34,
+    0xc1, 0x9b, 0x1f, 0x47, 0xc9, 0x44, 0xf8, 0x64, 0x24, 0xe5, 0x34, 0xf3,
+    0x77, 0x77, 0x6f, 0x43, 0x39, 0x9a, 0xf5, 0x20, 0xe2, 0xb0, 0x3b, 0x9d,
+    0xcd, 0x66, 0xbb, 0xe5, 0x81, 0x76, 0xb7, 0x6e, 0x46, 0x82, 0x7c, 0x68,
+    0xdf, 0x90, 0xb3, 0xb0, 0x2f, 0xe2, 0x4c, 0x10, 0xf7, 0x43, 0xfb, 0x86,
+    0x6e, 0x1d, 0x27, 0xd3, 0x87, 0x14, 0x7a, 0x25, 0x6e, 0x9f, 0x92, 0xd7,
+    0x7b, 0xfb, 0xff, 0x9b, 0xc1, 0xff, 0xff, 0x24, 0xff, 0x0a, 0x62, 0x72,
+    0x96, 0x64, 0x61, 0x9c, 0x7d, 0x0d, 0x19, 0xb9, 0x9c, 0xcd, 0x66, 0x5b,
+    0x97, 0x22, 0x9d, 0x84, 0x59, 0x86, 0x5f, 0xb4, 0xc9, 0xc8, 0x48, 0xa4,
+    0xa2, 0xf7, 0x40, 0x6e, 0xd3, 0x00, 0xd6, 0x86, 0x91, 0x61, 0x2a, 0x04,
+    0x49, 0x86, 0x10, 0x8b, 0x4c, 0x6f, 0x05, 0x23, 0x32, 0x21, 0x41, 0xfc,
+    0x40, 0xa6, 0x22, 0xcd, 0x92, 0x78, 0x2b, 0xe9, 0x41, 0xea, 0x28, 0xcc,
+    0x23, 0x20, 0xfd, 0x64, 0xfa, 0x40, 0x74, 0x1c, 0x9a, 0x64, 0xc9, 0x50,
+    0xce, 0x83, 0x54, 0x90, 0x20, 0x1e, 0x90, 0x20, 0xcb, 0x92, 0x3e, 0xc4,
+    0x5f, 0x07, 0xc4, 0xb8, 0xf8, 0x03, 0x95, 0xfe, 0x1b, 0x46, 0x22, 0xdb,
+    0x72, 0xe5, 0x48, 0x10, 0xe7, 0x5a, 0xb7, 0x70, 0x28, 0x0e, 0x32, 0x10,
+    0x41, 0xa4, 0xee, 0x39, 0x10, 0xc4, 0xbc, 0x22, 0xf3, 0x50, 0x8e, 0x20,
+    0x5c, 0x9a, 0x0a, 0x70, 0xbc, 0xa8, 0x4c, 0xb5, 0xad, 0x30, 0xee, 0x47,
+    0x33, 0x38, 0xa4, 0x9c, 0xbf, 0x8e, 0xc2, 0x49, 0xa8, 0x47, 0x80, 0xe6,
+    0x88, 0x88, 0x0c, 0x3a, 0x9d, 0x65, 0x82, 0x21, 0x9c, 0x8c, 0x4c, 0x92,
+    0x41, 0x38, 0x84, 0xbf, 0x02, 0xa6, 0xb5, 0x35, 0x9d, 0xf5, 0xa2, 0x30,
+    0x1b, 0x31, 0x32, 0x08, 0x33, 0x7d, 0x53, 0x02, 0x23, 0x19, 0x14, 0x22,
+    0x5a, 0x19, 0xcc, 0x63, 0x37, 0x49, 0x21, 0x16, 0x1b, 0x41, 0x0f, 0xa1,
+    0xc8, 0xd4, 0x5c, 0x0b, 0xe8, 0xd8, 0x16, 0xcc, 0x55, 0x26, 0x80, 0x9b,
+    0x49, 0x28, 0x35, 0x8a, 0x70, 0xdc, 0xf9, 0x28, 0x99, 0x94, 0x67, 0x12,
+    0x66, 0x64, 0x38, 0x4b, 0xe3, 0x30, 0x1b, 0x09, 0x6c, 0x33, 0x48, 0x48,
+    0x96, 0xb0, 0xad, 0x6c, 0xa6, 0x6e, 0xff, 0x94, 0x09, 0x56, 0x1f, 0x26,
+    0x51, 0x94, 0xcc, 0x61, 0x6a, 0xfd, 0x24, 0x56, 0x0e, 0xa3, 0xcc, 0xc7,
+    0x25, 0x0f, 0x7a, 0x10, 0x49, 0xee, 0xe7, 0xcb, 0x1c, 0x27, 0x32, 0xec,
+    0x2b, 0x6c, 0x23, 0xfe, 0xa7, 0xc5, 0xa2, 0xea, 0x57, 0xd9, 0x28, 0x88,
+    0x22, 0xd2, 0x13, 0x1a, 0x5f, 0x62, 0x80, 0x7b, 0xde, 0x9a, 0x4d, 0x0a,
+    0xf3, 0x85, 0xdb, 0xd2, 0x65, 0x18, 0x44, 0x04, 0xae, 0xaf, 0x85, 0xe1,
+    0x56, 0x67, 0xe9, 0x6d, 0xdd, 0xbc, 0x3f, 0x25, 0xd7, 0x17, 0x6f, 0x6f,
+    0x7e, 0x3d, 0xbc, 0x3a, 0x25, 0xed, 0x6b, 0x72, 0x79, 0x75, 0xf1, 0x4b,
+    0xfb, 0xe4, 0xf4, 0x84, 0x38, 0x87, 0xd7, 0xa4, 0x7d, 0xed, 0x30, 0xf2,
+    0x6b, 0xfb, 0xe6, 0xfd, 0xc5, 0xc7, 0x1b, 0xf2, 0xeb, 0xe1, 0xd5, 0xd5,
+    0xe1, 0xf9, 0xcd, 0x6f, 0xe4, 0xe2, 0x2d, 0x39, 0x3c, 0xff, 0x8d, 0xfc,
+    0x57, 0xfb, 0xfc, 0x84, 0x6d, 0x9d, 0x7e, 0xba, 0xbc, 0x3a, 0xbd, 0xbe,
+    0x26, 0x17, 0x57, 0xa4, 0xfd, 0xe1, 0xf2, 0xac, 0x7d, 0x7a, 0xc2, 0x48,
+    0xfb, 0xfc, 0xf8, 0xec, 0xe3, 0x49, 0xfb, 0xfc, 0x1d, 0x39, 0xfa, 0x78,
+    0x43, 0xce, 0x2f, 0x6e, 0xc8, 0x59, 0xfb, 0x43, 0xfb, 0xe6, 0xf4, 0x84,
+    0xdc, 0x5c, 0x10, 0x18, 0x50, 0x77, 0xd5, 0x3e, 0xbd, 0x26, 0x17, 0x6f,
+    0xb7, 0x3e, 0x9c, 0x5e, 0x1d, 0xbf, 0x3f, 0x3c, 0xbf, 0x39, 0x3c, 0x6a,
+    0x9f, 0xb5, 0x6f, 0x7e, 0x63, 0xe4, 0x6d, 0xfb, 0xe6, 0x1c, 0xfa, 0x7c,
+    0x7b, 0x71, 0x45, 0x0e, 0xc9, 0xe5, 0xe1, 0xd5, 0x4d, 0xfb, 0xf8, 0xe3,
+    0xd9, 0xe1, 0x15, 0xb9, 0xfc, 0x78, 0x75, 0x79, 0x71, 0x7d, 0x4a, 0x0e,
+    0xcf, 0x4f, 0xb6, 0xce, 0x2f, 0xce, 0xdb, 0xe7, 0x6f, 0xaf, 0xda, 0xe7,
+    0xef, 0x4e, 0xe1, 0x6b, 0x4e, 0x1e, 0x69, 0x9f, 0x93, 0xf3, 0x0b, 0x72,
+    0xfa, 0xcb, 0xe9, 0xf9, 0x0d, 0xb9, 0x7e, 0x7f, 0x78, 0x76, 0x86, 0x43,
+    0x1d, 0x7e, 0xbc, 0x79, 0x7f, 0x71, 0x85, 0xf0, 0x1d, 0x5f, 0x5c, 0xfe,
+    0x76, 0xd5, 0x7e, 0xf7, 0xfe, 0x86, 0xbc, 0xbf, 0x38, 0x3b, 0x39, 0xbd,
+    0xba, 0xde, 0x3a, 0x3a, 0x25, 0x67, 0xed, 0xc3, 0xa3, 0xb3, 0x53, 0x35,
+    0xd4, 0xf9, 0x6f, 0xe4, 0xf8, 0xec, 0xb0, 0xfd, 0x81, 0x91, 0x93, 0xc3,
+    0x0f, 0x87, 0xef, 0x4e, 0xb1, 0xd5, 0xc5, 0xcd, 0xfb, 0xd3, 0x2b, 0xac,
+    0xa6, 0xa1, 0xfb, 0xf5, 0xfd, 0x29, 0x16, 0xb5, 0xcf, 0xc9, 0xe1, 0xf9,
+    0xd6, 0xe1, 0xf1, 0x4d, 0xfb, 0xe2, 0x1c, 0x70, 0x72, 0x7c, 0x71, 0x7e,
+    0x73, 0x75, 0x78, 0x7c, 0xc3, 0xc8, 0xcd, 0xc5, 0xd5, 0x4d, 0xde, 0xf4,
+    0xd7, 0xf6, 0xf5, 0x29, 0x23, 0x87, 0x57, 0xed, 0x6b, 0x40, 0xc8, 0xdb,
+    0xab, 0x8b, 0x0f, 0x8c, 0x00, 0x3a, 0x2f, 0xde, 0x22, 0xce, 0xce, 0xb7,
+    0x8e, 0x2f, 0xce, 0xcf, 0x4f, 0x55, 0x2f, 0x80, 0x6a, 0x52, 0x5a, 0x91,
+    0x8b, 0x2b, 0x7c, 0xfe, 0x78, 0x7d, 0x5a, 0xc0, 0x72, 0x72, 0x7a, 0x78,
+    0xd6, 0x3e, 0x7f, 0x77, 0x0d, 0x10, 0xdc, 0xbc, 0x3f, 0xdd, 0x32, 0x95,
+    0xbd, 0xad, 0x9f, 0x76, 0xb7, 0x5e, 0xe5, 0x82, 0x87, 0xb8, 0x94, 0x3c,
+    0x6e, 0x6d, 0xab, 0xbd, 0x05, 0x3b, 0x44, 0x6c, 0x37, 0xb7, 0x80, 0x8f,
+    0x1e, 0x5f, 0x9c, 0xbf, 0x6d, 0xbf, 0xfb, 0xd2, 0xbe, 0x39, 0xfd, 0x70,
+    0x4d, 0x38, 0xe9, 0x6c, 0x81, 0x27, 0xff, 0x5d, 0x9a, 0xcc, 0xa6, 0x6d,
+    0x29, 0x26, 0xae, 0xf3, 0x0e, 0x32, 0x88, 0x83, 0x88, 0x1c, 0x27, 0xf1,
+    0x30, 0xbc, 0x75, 0x18, 0x89, 0xc4, 0xad, 0x88, 0x07, 0x6f, 0x03, 0xc8,
+    0xd8, 0x7a, 0xa0, 0x0c, 0xeb, 0xab, 0x97, 0xaa, 0xc1, 0x40, 0xdc, 0x85,
+    0x7d, 0xa1, 0x3e, 0xfb, 0x41, 0x8a, 0x87, 0x36, 0x7c, 0xc6, 0x45, 0xb7,
+    0x62, 0x04, 0x3f, 0xea, 0x72, 0x08, 0xea, 0xa9, 0xfe, 0xfd, 0x4e, 0x48,
+    0x46, 0x1c, 0x20, 0xff, 0x5b, 0x3d, 0x20, 0x88, 0x42, 0x43, 0xa1, 0xaa,
+    0x1b, 0xa7, 0x62, 0xb4, 0x3e, 0xfe, 0xbe, 0xd4, 0xc6, 0x5b, 0x3e, 0xa2,
+    0x29, 0x28, 0x8f, 0x5a, 0x7e, 0x57, 0x3d, 0x7c, 0x30, 0x98, 0x84, 0x31,
+    0x31, 0xd6, 0x20, 0x1c, 0x86, 0x47, 0x08, 0xe6, 0xa2, 0x47, 0x3e, 0xb6,
+    0x89, 0x3b, 0x09, 0x63, 0x8f, 0xfc, 0x13, 0x59, 0x66, 0xd0, 0x97, 0xe0,
+    0x1f, 0x32, 0x50, 0x59, 0x38, 0x43, 0x01, 0xf1, 0x6c, 0x84, 0x4d, 0xbe,
+    0x49, 0x79, 0x94, 0x26, 0x5f, 0x21, 0x33, 0x96, 0x80, 0xeb, 0xfb, 0xd9,
+    0xe8, 0xc2, 0x71, 0x54, 0x53, 0x6c, 0xe8, 0x3c, 0xd9, 0xfb, 0x25, 0x5a,
+    0xd0, 0xb8, 0xfb, 0xd5, 0xe5, 0xc6, 0x3f, 0x1e, 0xa3, 0x1d, 0xaf, 0x0e,
+    0x33, 0xc5, 0x40, 0x58, 0xf5, 0x30, 0x1f, 0x33, 0x9c, 0x02, 0x36, 0x46,
+    0x9b, 0xf8, 0x59, 0xf0, 0x1b, 0x23, 0x9c, 0xb8, 0xea, 0x2a, 0x91, 0x20,
+    0xa2, 0x9b, 0x06, 0xb0, 0x96, 0xd9, 0x2c, 0xd0, 0xf3, 0xc7, 0xc9, 0x97,
+    0xf4, 0xc7, 0xe3, 0x1c, 0xa2, 0x3b, 0x81, 0x11, 0xa3, 0x2c, 0xe6, 0xfd,
+    0x9b, 0x02, 0x3d, 0x84, 0x79, 0x54, 0xa3, 0x7c, 0xcc, 0x04, 0x92, 0x4a,
+    0x9c, 0xc4, 0x3b, 0x78, 0xdd, 0x1b, 0x30, 0x77, 0x1c, 0xba, 0x8f, 0x57,
+    0x6c, 0x10, 0x37, 0x15, 0xdf, 0x66, 0x90, 0x5d, 0x87, 0x54, 0xf5, 0xdf,
+    0xc9, 0x35, 0xd9, 0xdf, 0x08, 0xc2, 0x95, 0x00, 0xe9, 0xfb, 0x62, 0x18,
+    0x54, 0x33, 0x35, 0xea, 0x44, 0x64, 0x59, 0x70, 0x2b, 0xb2, 0x4d, 0x43,
+    0x5c, 0xc0, 0xb7, 0x8e, 0x5e, 0xd8, 0xbf, 0xf2, 0x22, 0x93, 0x61, 0x98,
+    0x4e, 0x50, 0xd6, 0xcd, 0xa6, 0x83, 0x40, 0x8a, 0x8c, 0x4c, 0x67, 0x51,
+    0x04, 0xf3, 0x4a, 0xb5, 0x30, 0xfc, 0x78, 0x75, 0x46, 0x32, 0x98, 0xb3,
+    0x4c, 0xc8, 0x01, 0xf8, 0x1c, 0x88, 0x4c, 0xa6, 0x61, 0xff, 0x4d, 0x22,
+    0x83, 0x4d, 0xe0, 0xfc, 0x77, 0x92, 0x5d, 0x6a, 0x0f, 0x79, 0xf6, 0x22,
+    0x2a, 0x3a, 0x4e, 0x26, 0x93, 0x80, 0x64, 0x02, 0x6c, 0x55, 0xd0, 0x43,
+    0x8c, 0x9f, 0x1d, 0xa0, 0x42, 0xc9, 0x2f, 0x06, 0xa8, 0x3e, 0x28, 0x8c,
+    0xe7, 0xab, 0x90, 0x3d, 0xb9, 0x58, 0x1b, 0x17, 0xe6, 0x62, 0x38, 0x84,
+    0x8f, 0x62, 0x1d, 0x29, 0xbf, 0x23, 0x23, 0x89, 0xfd, 0xfc, 0xdc, 0x1d,
+    0xa5, 0x2f, 0x17, 0x4f, 0x86, 0x24, 0x15, 0x7d, 0x11, 0xde, 0x89, 0x41,
+    0xbe, 0x5a, 0xe4, 0x2b, 0x20, 0x38, 0x8c, 0xc9, 0xd5, 0xe1, 0x07, 0x32,
+    0x1f, 0x85, 0x91, 0x50, 0x60, 0x85, 0x19, 0xe8, 0x2f, 0xfd, 0x24, 0x8e,
+    0x55, 0x22, 0xb7, 0xbb, 0x47, 0xb4, 0x51, 0x94, 0xfd, 0x08, 0xd6, 0xeb,
+    0x69, 0x18, 0x45, 0x05, 0xa8, 0xf8, 0xf8, 0x72, 0x48, 0xe1, 0x03, 0x4c,
+    0x6a, 0xdf, 0x14, 0xb0, 0x66, 0x32, 0x01, 0x72, 0x06, 0x75, 0x2f, 0x0a,
+    0xb2, 0x11, 0x09, 0x15, 0xbb, 0x06, 0xd0, 0x95, 0x63, 0x56, 0x29, 0x43,
+    0x51, 0xf4, 0x2c, 0x70, 0x3f, 0x08, 0x90, 0x4e, 0x59, 0x1b, 0x72, 0xe5,
+    0xf0, 0x1b, 0x5d, 0x64, 0x52, 0x2e, 0x79, 0x2e, 0xd0, 0xa6, 0x3e, 0xa0,
+    0x31, 0x13, 0xa0, 0x5f, 0xa1, 0xaa, 0xa6, 0xc9, 0x01, 0x41, 0x34, 0xda,
+    0xba, 0x1e, 0x81, 0xf4, 0x44, 0x94, 0xcc, 0xf1, 0x0d, 0x3a, 0xda, 0x14,
+    0xb9, 0x3e, 0x0b, 0xea, 0x23, 0x30, 0x21, 0x2c, 0x98, 0x7b, 0xf6, 0xf3,
+    0xb3, 0x59, 0x6c, 0x18, 0x45, 0xa1, 0x05, 0x6a, 0x3f, 0x89, 0x30, 0x31,
+    0x70, 0x9d, 0x3c, 0x80, 0x75, 0x24, 0xb1, 0x20, 0xe0, 0x14, 0x23, 0xe8,
+    0x67, 0x00, 0xf4, 0x1f, 0xe8, 0x8a, 0x7a, 0x9b, 0x21, 0x0c, 0xcf, 0x87,
+    0xfe, 0x3a, 0xfc, 0x2e, 0x0c, 0xe4, 0xf0, 0xfb, 0xd9, 0x50, 0x07, 0xf7,
+    0xe1, 0x64, 0x36, 0x21, 0x71, 0x4e, 0x24, 0x39, 0x98, 0x53, 0x91, 0xaa,
+    0xfe, 0x2a, 0x85, 0x76, 0x34, 0xcb, 0xa4, 0x48, 0xdf, 0x27, 0xd1, 0x20,
+    0x19, 0x0e, 0x81, 0x09, 0x95, 0x0a, 0xfe, 0x2c, 0xd2, 0xe6, 0x41, 0x28,
+    0x11, 0x3f, 0xfd, 0x28, 0x08, 0x27, 0xa8, 0xde, 0x26, 0x72, 0x24, 0x52,
+    0xb3, 0xd8, 0xb0, 0xca, 0x90, 0x00, 0x61, 0x08, 0x41, 0xd9, 0x36, 0x1a,
+    0xe4, 0x4d, 0x62, 0xfc, 0x06, 0x09, 0xe1, 0x45, 0xc2, 0xfc, 0x4a, 0xad,
+    0x05, 0xb6, 0x04, 0x22, 0xfe, 0x26, 0x25, 0xfe, 0x7e, 0x9e, 0x0a, 0x84,
+    0xe3, 0x59, 0xd4, 0x9a, 0x93, 0x40, 0x16, 0xde, 0xc6, 0x41, 0xb4, 0x69,
+    0x21, 0x21, 0xab, 0xe3, 0xdf, 0x1c, 0xf1, 0x56, 0x48, 0x3d, 0x08, 0xa2,
+    0x13, 0xd9, 0x36, 0x70, 0xf4, 0x8d, 0x43, 0xc2, 0x4e, 0xf9, 0x8b, 0x66,
+    0x59, 0x68, 0x79, 0x6a, 0x03, 0x6e, 0x1a, 0xf3, 0x17, 0x91, 0x82, 0xe5,
+    0xf3, 0x17, 0x8e, 0xaa, 0x73, 0xe0, 0xcd, 0xe8, 0x77, 0x6a, 0x80, 0x27,
+    0xc8, 0xd6, 0x8c, 0xfd, 0x7c, 0x09, 0xa5, 0xc6, 0xcd, 0x46, 0x01, 0x30,
+    0xcb, 0xde, 0x03, 0x9a, 0x66, 0x39, 0x4d, 0x5a, 0xe0, 0x80, 0x1f, 0xcd,
+    0xd0, 0x23, 0x81, 0x4f, 0xec, 0x91, 0x24, 0xee, 0x0b, 0xe2, 0xe2, 0x75,
+    0x8e, 0xeb, 0x7b, 0xd9, 0x22, 0xd5, 0xbf, 0xff, 0xfc, 0x33, 0x78, 0x22,
+    0xae, 0xde, 0x3e, 0x9f, 0x52, 0xd3, 0xe1, 0x69, 0x7f, 0x94, 0x7c, 0x30,
+    0x4a, 0xc2, 0x4b, 0x35, 0x01, 0x68, 0xac, 0x44, 0x7c, 0x6a, 0x6d, 0x7b,
+    0x08, 0xc1, 0x3b, 0x95, 0x83, 0xe9, 0x4d, 0x91, 0x5e, 0xa2, 0x56, 0x33,
+    0x0d, 0xe3, 0x97, 0xe9, 0xa0, 0xa0, 0x9a, 0xbf, 0xbb, 0x6c, 0x5f, 0x40,
+    0x4b, 0x50, 0x19, 0x0b, 0xcd, 0x3c, 0xcd, 0x85, 0x68, 0xfa, 0xc3, 0x91,
+    0x2f, 0x67, 0x51, 0xf4, 0x71, 0xfa, 0x27, 0xb4, 0x1e, 0x19, 0xde, 0x81,
+    0x54, 0x00, 0x35, 0x67, 0x36, 0x05, 0x86, 0x6b, 0x8d, 0x8a, 0x20, 0x95,
+    0x75, 0xbb, 0x7f, 0xfc, 0x82, 0x5a, 0x88, 0x50, 0xa6, 0x17, 0x2a, 0x1f,
+    0xe0, 0x12, 0x4b, 0x33, 0x41, 0x06, 0x21, 0xdc, 0x08, 0x5d, 0x0d, 0xe9,
+    0xe5, 0x2c, 0xca, 0xc4, 0x31, 0xa4, 0x58, 0x5c, 0x02, 0x15, 0x66, 0xf2,
+    0xc5, 0x90, 0xfe, 0x97, 0x10, 0x53, 0x82, 0x41, 0xbc, 0x01, 0xb9, 0x3a,
+    0xfc, 0x15, 0x00, 0x06, 0xad, 0x34, 0x85, 0x43, 0xc0, 0x85, 0x98, 0x0e,
+    0x30, 0x8b, 0x00, 0x5d, 0x2d, 0x41, 0x2a, 0xb3, 0x6a, 0x60, 0x6e, 0xd2,
+    0x20, 0xce, 0x26, 0xa1, 0x94, 0xff, 0x0f, 0xd6, 0xec, 0xea, 0x2d, 0xc0,
+    0x64, 0xba, 0xaf, 0x1e, 0xff, 0x64, 0xa6, 0x62, 0xf7, 0x42, 0x7d, 0xf2,
+    0xc8, 0x61, 0x04, 0x02, 0x59, 0xea, 0xe1, 0xb9, 0x10, 0x5c, 0xcf, 0xa6,
+    0x2a, 0x9f, 0x1e, 0x2e, 0xfc, 0x40, 0xe5, 0xd0, 0x26, 0xd6, 0x9c, 0xb3,
+    0xc2, 0x02, 0xe9, 0x73, 0x13, 0x38, 0x08, 0xe8, 0x0d, 0x93, 0xac, 0x52,
+    0x7e, 0x5a, 0x7b, 0xee, 0xea, 0x2d, 0x39, 0x51, 0x3c, 0x43, 0x85, 0x76,
+    0x9f, 0xb5, 0xe7, 0x54, 0x8b, 0x43, 0xf0, 0xfd, 0xbc, 0x88, 0x85, 0xc0,
+    0x67, 0x36, 0x6d, 0xb6, 0x95, 0x19, 0x76, 0x99, 0x81, 0xd7, 0xab, 0xac,
+    0x00, 0x1f, 0x18, 0x0d, 0xf8, 0x0d, 0x78, 0x7e, 0x8a, 0xa7, 0xdd, 0x03,
+    0xd5, 0xa4, 0x7d, 0xf2, 0xc6, 0xf0, 0x94, 0x00, 0x00, 0xc9, 0xe0, 0xcf,
+    0x06, 0x92, 0x54, 0xf0, 0x9e, 0x88, 0xf8, 0xe1, 0x45, 0xe0, 0x9e, 0x0b,
+    0xdc, 0x18, 0x7f, 0x19, 0xbc, 0x4f, 0x01, 0x77, 0x05, 0xe2, 0xc2, 0x18,
+    0xf7, 0xf0, 0xf0, 0x52, 0xf5, 0xa5, 0xa4, 0xb4, 0x4c, 0xc2, 0x78, 0x26,
+    0x95, 0xb7, 0x4d, 0x4b, 0x84, 0x1f, 0xa9, 0x51, 0x06, 0x8e, 0xa3, 0x59,
+    0x8a, 0x3b, 0x76, 0x50, 0x3c, 0x3d, 0x1b, 0x12, 0x03, 0x41, 0x60, 0x06,
+    0x9d, 0x04, 0x0f, 0x4a, 0x00, 0x07, 0x52, 0x09, 0x01, 0xe5, 0x15, 0x44,
+    0x86, 0xb7, 0x41, 0x3c, 0xa6, 0xc3, 0x63, 0x0c, 0x0f, 0xab, 0x2f, 0xb2,
+    0xbe, 0x90, 0x71, 0x94, 0xe8, 0x2b, 0x47, 0x88, 0x1c, 0x05, 0x92, 0x0c,
+    0x42, 0xd4, 0xe4, 0x73, 0xdb, 0x0e, 0x3e, 0x4d, 0x81, 0x2a, 0xe8, 0x0f,
+    0x9d, 0x33, 0x06, 0xa2, 0x2b, 0x31, 0x4c, 0x45, 0x36, 0xfa, 0x53, 0x5b,
+    0xf8, 0x52, 0xc3, 0x34, 0x8b, 0x55, 0xf0, 0xdb, 0x52, 0x85, 0x83, 0x5b,
+    0xb0, 0x75, 0xf1, 0x52, 0x9f, 0xf2, 0xde, 0xc5, 0xad, 0x1b, 0x03, 0x09,
+    0x56, 0xed, 0xdb, 0xd3, 0x18, 0x43, 0x49, 0xc0, 0x84, 0xa6, 0x96, 0xc1,
+    0xf9, 0xe3, 0xbd, 0x6b, 0x9b, 0xa7, 0xa6, 0x65, 0x3b, 0xdf, 0x12, 0x45,
+    0x99, 0x9e, 0x87, 0x79, 0x54, 0x08, 0xae, 0xc6, 0xcf, 0xe1, 0x4c, 0x26,
+    0x37, 0xb3, 0x58, 0xfc, 0x29, 0xd4, 0x5c, 0xe1, 0x27, 0x9f, 0x70, 0x0d,
+    0x0a, 0x9b, 0x57, 0xbb, 0x97, 0x73, 0xde, 0x96, 0xc4, 0x80, 0xa9, 0x75,
+    0x1c, 0x29, 0x3a, 0xff, 0x21, 0x93, 0x3b, 0x4b, 0x6e, 0x9f, 0xaf, 0x52,
+    0xa8, 0xf0, 0xd7, 0x59, 0x72, 0x7b, 0x26, 0xee, 0x04, 0xd8, 0x42, 0x91,
+    0xfe, 0xf9, 0x2c, 0xed, 0x0c, 0x6b, 0xa2, 0x88, 0x50, 0xfd, 0x40, 0xeb,
+    0x5b, 0xbc, 0x3a, 0x7b, 0x7d, 0xa4, 0xb9, 0xe8, 0xfd, 0xfb, 0xc3, 0xe8,
+    0xfe, 0x0d, 0xca, 0x94, 0x8b, 0xaf, 0x6a, 0xb4, 0xec, 0x21, 0x8b, 0xfe,
+    0xfd, 0x49, 0x61, 0x27, 0x4f, 0x4d, 0x4a, 0xd5, 0x78, 0x9f, 0x20, 0x17,
+    0x79, 0x91, 0x23, 0xf0, 0x5a, 0xf5, 0x9d, 0x89, 0x14, 0xd8, 0xee, 0xd3,
+    0x0e, 0x2e, 0x35, 0xca, 0x9f, 0x76, 0x06, 0xea, 0xa1, 0xa0, 0xe1, 0xb3,
+    0x06, 0xba, 0xc6, 0x0f, 0x99, 0xcd, 0x52, 0x38, 0x0e, 0xfd, 0x52, 0xb5,
+    0x6b, 0x50, 0x38, 0x73, 0x2c, 0x86, 0xdc, 0x3e, 0x21, 0x41, 0x66, 0xd0,
+    0x99, 0xe5, 0xdd, 0x13, 0xfc, 0x78, 0xf7, 0x3a, 0x05, 0x5f, 0x63, 0x32,
+    0x12, 0x39, 0x3b, 0x3d, 0x79, 0x06, 0x05, 0x47, 0x62, 0xf0, 0x97, 0x2b,
+    0x3b, 0x59, 0x01, 0x40, 0xf5, 0x88, 0xa8, 0x5e, 0x8a, 0xf7, 0xe1, 0xed,
+    0xe8, 0xc5, 0x28, 0x82, 0x51, 0xc1, 0x8d, 0x31, 0xd2, 0xce, 0x8b, 0xb3,
+    0xd3, 0x13, 0x70, 0xb9, 0x14, 0x6e, 0x22, 0x4d, 0xdb, 0xa8, 0xa2, 0xe2,
+    0x77, 0xea, 0x11, 0xac, 0xde, 0x2c, 0x8c, 0xe4, 0x4e, 0x18, 0x93, 0x48,
+    0x0c, 0xaa, 0x76, 0xfd, 0x25, 0x84, 0xdf, 0x9f, 0x81, 0xae, 0x29, 0xd4,
+    0xbb, 0x4c, 0x13, 0x8c, 0xb6, 0x03, 0x35, 0x15, 0x8f, 0xcf, 0xa2, 0xdb,
+    0xe3, 0xcb, 0x8f, 0x10, 0x85, 0xfc, 0x36, 0x13, 0x71, 0xff, 0x01, 0x97,
+    0xf8, 0xd7, 0x70, 0xe7, 0x6d, 0x48, 0xb2, 0x08, 0xf5, 0x58, 0xdd, 0x71,
+    0x15, 0x57, 0x0a, 0x06, 0xe4, 0x46, 0xe0, 0x46, 0xf9, 0xe1, 0x92, 0x26,
+    0xc1, 0x00, 0xaa, 0x6a, 0x35, 0xc1, 0x7e, 0x7c, 0x3e, 0xcd, 0xc7, 0x72,
+    0x24, 0x64, 0xd8, 0x27, 0x18, 0xd7, 0x56, 0x8a, 0x82, 0x72, 0x3c, 0x90,
+    0x30, 0x1e, 0x2b, 0x4c, 0xf7, 0x1e, 0x94, 0x74, 0xd4, 0xfd, 0x93, 0x81,
+    0xe8, 0xcd, 0x6e, 0x41, 0xe1, 0xbe, 0x75, 0xe8, 0x56, 0x57, 0x05, 0x5b,
+    0x4e, 0x4e, 0x8f, 0x3e, 0xbe, 0xfb, 0xf2, 0xf6, 0xec, 0xf0, 0x1d, 0xc4,
+    0x5a, 0x1e, 0xb7, 0x0c, 0x75, 0x5f, 0x05, 0x73, 0x9f, 0x68, 0xc1, 0x44,
+    0xae, 0x82, 0x39, 0xc8, 0x26, 0x63, 0x07, 0x1a, 0x86, 0xc1, 0xb6, 0xd2,
+    0x60, 0x7e, 0x1c, 0x4c, 0x81, 0xd8, 0x7d, 0x60, 0xfe, 0x7d, 0x70, 0x66,
+    0xe7, 0x7c, 0x7e, 0x4d, 0xdb, 0x97, 0x89, 0xd2, 0xf6, 0x19, 0x81, 0xa3,
+    0xa5, 0x78, 0xfa, 0x46, 0x8e, 0xc4, 0x44, 0xc9, 0xf1, 0x5d, 0x84, 0x6e,
+    0xb7, 0xaf, 0xba, 0x2b, 0xf5, 0xfd, 0xe1, 0x9b, 0x94, 0x7e, 0x21, 0x77,
+    0xb5, 0x30, 0x81, 0x1b, 0x16, 0x07, 0x6b, 0x03, 0xc0, 0x4b, 0xf4, 0x92,
+    0x58, 0x4e, 0x33, 0x87, 0x6d, 0x65, 0x0f, 0x99, 0x14, 0x13, 0x58, 0x24,
+    0x9f, 0x38, 0xd7, 0x86, 0x36, 0x75, 0x9e, 0xbd, 0x18, 0x90, 0x28, 0x49,
+    0xa6, 0x2e, 0x25, 0x21, 0x7c, 0xa8, 0x5e, 0x45, 0x22, 0x81, 0x28, 0xd1,
+    0xfa, 0x55, 0x58, 0x75, 0xd8, 0x16, 0x04, 0xa7, 0xdf, 0x8b, 0x60, 0x6a,
+    0xf7, 0x80, 0x01, 0xeb, 0x91, 0x08, 0xa6, 0x64, 0x22, 0x26, 0xb8, 0x66,
+    0xe6, 0x6e, 0x3a, 0x15, 0x11, 0xc6, 0x80, 0x74, 0x64, 0x12, 0xae, 0xf5,
+    0x32, 0xcd, 0x7a, 0x0a, 0x1c, 0x82, 0x5f, 0x8d, 0x5b, 0x1f, 0xa0, 0x62,
+    0xbe, 0x38, 0x04, 0xde, 0xd2, 0x98, 0x49, 0x70, 0x0e, 0x6e, 0x9e, 0x29,
+    0xcc, 0x44, 0x13, 0xbc, 0x0f, 0x6a, 0x5c, 0x90, 0xcd, 0x52, 0x25, 0x91,
+    0x51, 0xce, 0xc2, 0x27, 0x06, 0x60, 0x56, 0x7a, 0xc2, 0x99, 0x0c, 0x20,
+    0xce, 0x9e, 0x09, 0x61, 0x16, 0xc0, 0x90, 0x78, 0xa9, 0xa7, 0x0a, 0x88,
+    0x74, 0x07, 0xba, 0xfa, 0x93, 0x00, 0x29, 0xf2, 0xf3, 0xc1, 0x0b, 0x8a,
+    0xf1, 0xe6, 0x6c, 0x95, 0x78, 0x03, 0x59, 0xda, 0x04, 0x88, 0xb5, 0x89,
+    0x05, 0x79, 0xe1, 0x4a, 0xcc, 0x15, 0x42, 0xb8, 0x6a, 0x2a, 0xee, 0x3f,
+    0x58, 0xfd, 0x1b, 0xeb, 0xd0, 0x27, 0xce, 0x61, 0x94, 0x25, 0xe4, 0xdb,
+    0x4c, 0xcc, 0x54, 0x73, 0x48, 0x5b, 0x21, 0x51, 0xd8, 0x4b, 0x83, 0xf4,
+    0x81, 0x88, 0x58, 0xa6, 0x0f, 0x38, 0x1c, 0xe4, 0xa6, 0x2a, 0x96, 0xa8,
+    0x5a, 0xaa, 0x00, 0xf6, 0x60, 0x86, 0x9f, 0xd7, 0x34, 0x1b, 0x87, 0x40,
+    0x2d, 0x67, 0x6b, 0xa9, 0x76, 0xcb, 0x35, 0xae, 0x1b, 0xba, 0xf7, 0x63,
+    0x64, 0x92, 0xb0, 0xa6, 0xb0, 0x6d, 0xb4, 0xe1, 0xea, 0x93, 0x72, 0x74,
+    0x13, 0xda, 0xc0, 0x0d, 0x13, 0x84, 0x93, 0x57, 0x70, 0x29, 0xe8, 0xe0,
+    0xc1, 0xa1, 0xcd, 0x2d, 0xfc, 0xda, 0x8f, 0xfe, 0x20, 0x86, 0x7e, 0xd2,
+    0x9f, 0xc5, 0x70, 0x0e, 0xa6, 0x6f, 0xb4, 0x05, 0x37, 0x0f, 0xa3, 0x88,
+    0xa4, 0xa2, 0x97, 0x24, 0xb2, 0x76, 0xb0, 0x3b, 0x7d, 0x73, 0x30, 0x7d,
+    0x73, 0x93, 0x3e, 0x00, 0x0a, 0x80, 0xf6, 0x91, 0x99, 0x82, 0xd2, 0xb4,
+    0xff, 0x0f, 0xe3, 0x4f, 0xf6, 0xa0, 0x16, 0x74, 0x5f, 0x91, 0xb7, 0xa9,
+    0xa0, 0x99, 0xa3, 0x2e, 0x57, 0xa4, 0xff, 0xa7, 0x02, 0x66, 0xe8, 0xca,
+    0x74, 0x26, 0x68, 0x73, 0x6b, 0xc9, 0xc8, 0xfe, 0x3f, 0xf6, 0xf6, 0xf6,
+    0xf0, 0xe7, 0x16, 0xa6, 0x31, 0x7d, 0x99, 0x87, 0xc3, 0xf0, 0xaf, 0x9b,
+    0x53, 0x46, 0x7e, 0x6d, 0xbf, 0x6d, 0x93, 0x4c, 0x1f, 0x0b, 0x22, 0x73,
+    0x48, 0xff, 0x20, 0x98, 0x4e, 0x2e, 0x06, 0x66, 0x92, 0x97, 0x91, 0x08,
+    0x32, 0xb5, 0xc1, 0x81, 0x63, 0x02, 0x09, 0x84, 0x32, 0x9f, 0x5b, 0x0e,
+    0x99, 0x7a, 0xfb, 0x57, 0xc2, 0xa6, 0x38, 0x34, 0x99, 0x07, 0xe8, 0x86,
+    0x10, 0x92, 0xec, 0x68, 0xf4, 0x6b, 0x21, 0x8f, 0x00, 0x3a, 0xa4, 0xb1,
+    0x05, 0x8d, 0x7e, 0x4b, 0x66, 0x64, 0x82, 0xb9, 0x10, 0xa3, 0x40, 0x11,
+    0xa6, 0x0d, 0x30, 0xea, 0x6e, 0xe1, 0x30, 0x2c, 0x35, 0xb9, 0x42, 0x6c,
+    0x13, 0xb8, 0xbf, 0x17, 0x17, 0x6e, 0x2f, 0x5f, 0x38, 0xef, 0xaf, 0x58,
+    0xba, 0x3d, 0xbd, 0x74, 0x40, 0xaa, 0x79, 0x5b, 0x4b, 0xea, 0x60, 0x3e,
+    0x20, 0x19, 0x1a, 0xd1, 0x12, 0x28, 0xa9, 0x32, 0x14, 0xb2, 0x3f, 0x62,
+    0x64, 0x24, 0xa2, 0x29, 0x0c, 0xa3, 0x3e, 0xb7, 0x01, 0xa1, 0x4f, 0x8e,
+    0xd1, 0xee, 0xa6, 0x2a, 0xd1, 0xad, 0x08, 0x37, 0xed, 0x75, 0x39, 0x76,
+    0x42, 0xb8, 0xea, 0xcc, 0xd4, 0x85, 0x1e, 0xa1, 0x26, 0xfc, 0xd5, 0x65,
+    0xd0, 0x3d, 0xe1, 0x38, 0x0a, 0x40, 0x58, 0x1c, 0x47, 0xcf, 0xe5, 0x67,
+    0x09, 0xba, 0x27, 0x20, 0xd1, 0xd7, 0xc7, 0x89, 0x94, 0x70, 0x02, 0x93,
+    0xdf, 0x0c, 0xa0, 0x35, 0x0c, 0x8a, 0xce, 0xb3, 0xa0, 0x27, 0x22, 0x2d,
+    0x59, 0x5d, 0xfc, 0xfc, 0x23, 0x6e, 0x5b, 0xcc, 0xb1, 0x7a, 0xe5, 0x6e,
+    0x1f, 0x44, 0xf0, 0xfe, 0xcd, 0x36, 0x83, 0xb1, 0xe1, 0x7c, 0x1e, 0xc8,
+    0x82, 0x89, 0xca, 0xa2, 0xdc, 0x1a, 0x26, 0xa9, 0x4f, 0xb6, 0xfb, 0xc3,
+    0xdb, 0x9d, 0x6d, 0xd2, 0xb0, 0x5f, 0x2c, 0xe9, 0xfa, 0x40, 0xef, 0x45,
+    0x34, 0x7d, 0x62, 0x9c, 0x6c, 0x1a, 0xc4, 0x6a, 0x18, 0xbc, 0x58, 0xdc,
+    0x27, 0xdb, 0xd3, 0x59, 0x2a, 0xd4, 0x29, 0x10, 0x2d, 0x60, 0xb7, 0x99,
+    0x0d, 0x02, 0x60, 0x6d, 0x6d, 0xa4, 0x2a, 0x8d, 0x3f, 0x1f, 0x0d, 0xd3,
+    0xe4, 0x54, 0xce, 0x23, 0x6e, 0x84, 0xed, 0x03, 0x75, 0xa9, 0x43, 0x79,
+    0x58, 0x45, 0xae, 0x3b, 0xd0, 0x68, 0x9b, 0x6d, 0x85, 0x83, 0xea, 0x19,
+    0x62, 0xb6, 0x65, 0x79, 0xca, 0x66, 0xf3, 0x74, 0xb6, 0xa0, 0x6b, 0xa5,
+    0x70, 0x63, 0xd7, 0x2a, 0x25, 0x93, 0x6c, 0x6f, 0xab, 0x43, 0x8f, 0x3e,
+    0x71, 0xce, 0xe1, 0xdb, 0x48, 0x4b, 0xca, 0x36, 0xd5, 0xc4, 0x74, 0xfc,
+    0xbc, 0xfa, 0x36, 0x9e, 0x96, 0xdf, 0x7e, 0xa2, 0xfe, 0x3c, 0x48, 0x21,
+    0xff, 0xab, 0x68, 0xf1, 0xab, 0x2e, 0x78, 0xa2, 0x4d, 0x18, 0x0f, 0x93,
+    0xa2, 0x41, 0x1b, 0x9e, 0x9e, 0xa8, 0x8d, 0x42, 0xb0, 0xa8, 0x7e, 0x82,
+    0x8f, 0x50, 0xbf, 0x4b, 0x9b, 0x5b, 0xa9, 0xb8, 0x85, 0x0b, 0xec, 0x52,
+    0xb5, 0xad, 0x3e, 0x86, 0xae, 0xc6, 0x32, 0x43, 0x04, 0x61, 0x05, 0x5c,
+    0xe7, 0xce, 0xd6, 0x06, 0x92, 0x63, 0x5b, 0xa6, 0xc5, 0x56, 0x35, 0xad,
+    0x30, 0xd0, 0xcb, 0xac, 0x75, 0xde, 0xa4, 0xbf, 0xfe, 0x7f, 0xb3, 0xd6,
+    0x53, 0x91, 0x02, 0xe9, 0x06, 0x71, 0x5f, 0x14, 0x58, 0xbb, 0xb4, 0x0a,
+    0x9f, 0xc0, 0x75, 0x2f, 0x88, 0xa0, 0xca, 0xa0, 0x68, 0x78, 0x64, 0x4a,
+    0x9e, 0x68, 0x85, 0x28, 0xc9, 0x82, 0x3b, 0x7b, 0x3c, 0x28, 0x22, 0x58,
+    0xf6, 0x3f, 0xb7, 0x54, 0x6b, 0xae, 0x48, 0xac, 0x06, 0x79, 0x21, 0xe0,
+    0x51, 0x8e, 0x19, 0x31, 0xfe, 0xf8, 0xea, 0x65, 0xc3, 0xe6, 0x9a, 0xff,
+    0xc0, 0xf9, 0x68, 0xb2, 0x0d, 0x93, 0xdb, 0x66, 0x65, 0x36, 0x81, 0xb5,
+    0x76, 0xf6, 0xc9, 0xf3, 0x16, 0x54, 0x0f, 0xed, 0xe7, 0x30, 0x6c, 0x19,
+    0x18, 0xfc, 0x1c, 0x9a, 0xca, 0x65, 0xff, 0x9f, 0xc0, 0x5f, 0x75, 0x62,
+    0xd6, 0x2a, 0x0b, 0xdd, 0x84, 0xe5, 0xed, 0x8e, 0xb7, 0xf3, 0xe5, 0x70,
+    0xe7, 0xf7, 0x60, 0xe7, 0xfb, 0xde, 0xce, 0x7f, 0x76, 0x1b, 0x40, 0x1c,
+    0x5a, 0x38, 0x16, 0x43, 0x54, 0x79, 0x30, 0xfe, 0xe4, 0x00, 0x3f, 0x6d,
+    0x97, 0xbb, 0xae, 0x0c, 0xfb, 0x3d, 0xb7, 0x6f, 0xb8, 0x7e, 0x6c, 0x18,
+    0xc6, 0x90, 0x01, 0xbb, 0x0e, 0x74, 0xd1, 0x48, 0x99, 0xff, 0xe5, 0xa6,
+    0x93, 0x30, 0x66, 0x64, 0x12, 0xdc, 0x3f, 0x97, 0xa8, 0x54, 0x60, 0xfc,
+    0xdf, 0x23, 0xab, 0x35, 0x82, 0x99, 0x84, 0xb1, 0x8f, 0x90, 0x6c, 0x4d,
+    0x82, 0x7b, 0x1f, 0xc0, 0xf9, 0x9f, 0x22, 0xa2, 0x6a, 0xef, 0xd1, 0xe6,
+    0x75, 0xa8, 0x42, 0xe9, 0x3e, 0x23, 0xff, 0xf1, 0x8f, 0x7f, 0xfc, 0xfc,
+    0x8f, 0xf2, 0x32, 0x54, 0xba, 0x5f, 0x5e, 0xd6, 0xf1, 0x1e, 0x23, 0xfb,
+    0xff, 0x51, 0xee, 0xb5, 0xda, 0xc5, 0xfa, 0xe2, 0x6e, 0x2b, 0xe0, 0xad,
+    0x0e, 0x3e, 0xbc, 0xbc, 0x67, 0xa3, 0x56, 0x5a, 0xaa, 0x47, 0xb5, 0xbb,
+    0xe2, 0xc5, 0x48, 0xde, 0x5f, 0xeb, 0x7a, 0x43, 0x9c, 0xe2, 0xc5, 0x3d,
+    0xbf, 0xfe, 0xc7, 0x0a, 0x32, 0x36, 0xa6, 0x44, 0xbd, 0x18, 0x1f, 0x3f,
+    0xbf, 0x5e, 0xd9, 0xf7, 0x9b, 0xf3, 0x81, 0xfe, 0x8a, 0x55, 0xdc, 0x98,
+    0xba, 0xf3, 0xa7, 0x16, 0x72, 0xaf, 0xa2, 0xf3, 0xd5, 0xec, 0x9a, 0x97,
+    0xef, 0x95, 0xbf, 0x97, 0x7b, 0xdd, 0x9c, 0x39, 0xf3, 0xc2, 0xae, 0xf7,
+    0xe0, 0x14, 0xc1, 0x2a, 0xcc, 0x9b, 0x32, 0xc6, 0x5e, 0x8c, 0x8f, 0x7f,
+    0xec, 0xaf, 0xac, 0x64, 0x55, 0xfe, 0x66, 0xc1, 0x64, 0xf5, 0x11, 0x94,
+    0x67, 0x72, 0x59, 0xd3, 0xd7, 0x5f, 0xcf, 0x67, 0x15, 0x1c, 0x7e, 0x01,
+    0xd2, 0xff, 0xac, 0xb8, 0xae, 0xca, 0x6a, 0x2e, 0xe9, 0xa6, 0x53, 0xf5,
+    0x81, 0x2d, 0xc8, 0xf9, 0xe7, 0x7f, 0x16, 0x3f, 0xd6, 0xb4, 0xff, 0xc9,
+    0x8c, 0x2b, 0x46, 0x83, 0xbb, 0xbf, 0xba, 0x06, 0xaf, 0xcc, 0x05, 0x27,
+    0xc5, 0xc8, 0xb0, 0x30, 0x2f, 0xd0, 0x79, 0x69, 0x69, 0x80, 0xd7, 0xff,
+    0xd6, 0x00, 0xa4, 0x41, 0xb6, 0x77, 0x70, 0x36, 0x29, 0xcc, 0x64, 0x65,
+    0xb4, 0x95, 0xb7, 0x38, 0x74, 0x71, 0xfd, 0x75, 0x10, 0x85, 0x90, 0xca,
+    0x6a, 0x50, 0xec, 0xa2, 0xb3, 0xcc, 0xe0, 0xd5, 0xf8, 0x62, 0x39, 0xd9,
+    0xde, 0x6e, 0x6e, 0xc1, 0x4d, 0x76, 0x1a, 0x1f, 0xea, 0xb4, 0x18, 0xa9,
+    0xf1, 0x7c, 0x02, 0xfa, 0xfc, 0x18, 0x79, 0xdc, 0x2a, 0x1a, 0x39, 0xa6,
+    0xd7, 0x8c, 0x0c, 0x92, 0x78, 0x5b, 0x12, 0xfc, 0x76, 0x7c, 0xcd, 0x81,
+    0x25, 0xce, 0x7b, 0x32, 0x47, 0xa4, 0x84, 0x3c, 0x9e, 0x65, 0x32, 0x99,
+    0xfc, 0x02, 0x10, 0x85, 0xf2, 0xc1, 0xd5, 0xfd, 0xd0, 0xe6, 0x56, 0x3e,
+    0xc6, 0x33, 0xea, 0x2e, 0x37, 0x52, 0xe9, 0xbe, 0x45, 0xa6, 0xd5, 0x35,
+    0x5e, 0xe7, 0x35, 0x72, 0xe8, 0x92, 0xd8, 0xdd, 0xc6, 0x45, 0xd9, 0x66,
+    0x6b, 0xb8, 0xb2, 0x21, 0xfb, 0x41, 0xbd, 0x67, 0x6f, 0x8c, 0x7d, 0x56,
+    0x51, 0xe5, 0xb1, 0x62, 0x45, 0x89, 0xab, 0x97, 0x94, 0x6e, 0xb3, 0x65,
+    0xd1, 0xfe, 0xf5, 0x73, 0x77, 0xd6, 0x4a, 0xbc, 0xe5, 0x09, 0x53, 0x6f,
+    0x9d, 0xf1, 0x98, 0xb6, 0xd6, 0xc6, 0xfa, 0xd3, 0xb6, 0xdf, 0xf3, 0xb9,
+    0xca, 0x8a, 0xff, 0xa4, 0xb4, 0xa5, 0x2d, 0x88, 0x6c, 0x73, 0x32, 0xe7,
+    0x36, 0xdb, 0x64, 0x05, 0x92, 0x8d, 0x48, 0x5a, 0x51, 0x43, 0xec, 0x20,
+    0x4b, 0x95, 0xa3, 0xc5, 0x1c, 0xe4, 0x44, 0x98, 0x56, 0x90, 0x71, 0x0b,
+    0x8e, 0xa7, 0xed, 0x02, 0x1e, 0xb4, 0x35, 0x55, 0x8f, 0x58, 0x9d, 0xac,
+    0xb8, 0x80, 0xc8, 0x92, 0x6e, 0xe1, 0xf0, 0x9a, 0xa5, 0xa9, 0xc8, 0xb6,
+    0xb5, 0x59, 0xd7, 0x83, 0xef, 0xa5, 0x65, 0xb3, 0xdd, 0x56, 0x30, 0x14,
+    0x1c, 0x9a, 0xde, 0x7e, 0x8a, 0x2d, 0x95, 0x50, 0x78, 0xbb, 0xbd, 0x61,
+    0x39, 0xf2, 0x6e, 0xf3, 0x05, 0x59, 0x03, 0x08, 0x6e, 0xdc, 0x37, 0x48,
+    0xc2, 0xb2, 0x8c, 0x9a, 0x28, 0x4f, 0xb6, 0x76, 0x16, 0x94, 0xb8, 0xea,
+    0x38, 0xe7, 0x5f, 0x42, 0x6c, 0x05, 0x9e, 0x9e, 0xa6, 0x3d, 0x64, 0x82,
+    0x50, 0x82, 0x63, 0x57, 0x50, 0xa2, 0x36, 0xfc, 0xf5, 0x6b, 0x40, 0x44,
+    0x3e, 0x6f, 0xb3, 0x7e, 0x25, 0x9c, 0x96, 0x70, 0x37, 0xdb, 0xd9, 0x27,
+    0xfa, 0xc7, 0x64, 0xb0, 0xb3, 0xbf, 0xf3, 0xda, 0x3c, 0x45, 0xb7, 0x3b,
+    0xfb, 0x3b, 0x3f, 0x9b, 0xa7, 0xfb, 0x68, 0x67, 0x7f, 0xe7, 0xef, 0x25,
+    0x1a, 0xfd, 0xf7, 0x88, 0xda, 0x64, 0x66, 0x10, 0x6b, 0x66, 0x5d, 0x0a,
+    0x0c, 0x1e, 0x26, 0x50, 0x24, 0x47, 0x70, 0x85, 0xa6, 0x0c, 0x88, 0xeb,
+    0x95, 0x3a, 0x07, 0xff, 0xb8, 0x05, 0x37, 0x1b, 0x12, 0x67, 0xd7, 0xca,
+    0x05, 0xd1, 0x28, 0x57, 0x97, 0xa6, 0x6d, 0x59, 0x57, 0xca, 0xf8, 0x64,
+    0x7b, 0xf5, 0xe6, 0xc0, 0x6d, 0x38, 0xd9, 0xa7, 0x2e, 0x52, 0xab, 0x22,
+    0x03, 0x4d, 0x4a, 0xea, 0x03, 0x33, 0x06, 0x91, 0xeb, 0x16, 0xe7, 0xa1,
+    0x3a, 0xa9, 0x2f, 0xc5, 0xe4, 0x1c, 0x7d, 0xb3, 0x78, 0xb5, 0x13, 0x79,
+    0x84, 0x9d, 0xf2, 0x37, 0x7b, 0x0d, 0xf1, 0x13, 0x62, 0x28, 0x62, 0xb0,
+    0xc6, 0x13, 0x3a, 0xc2, 0x9f, 0xee, 0xb1, 0xaa, 0x42, 0x49, 0x74, 0x6e,
+    0x1a, 0xbf, 0x14, 0xa8, 0x7e, 0xf6, 0xc8, 0x20, 0xd7, 0x5d, 0x47, 0x1f,
+    0xc3, 0x76, 0x74, 0xed, 0xb2, 0xaa, 0x68, 0xa7, 0xd5, 0x54, 0xf4, 0x1b,
+    0x0e, 0x89, 0x6b, 0x2d, 0x31, 0xe7, 0x85, 0x85, 0x0f, 0xaf, 0x2d, 0x2f,
+    0xff, 0x93, 0x3d, 0xa1, 0x89, 0x94, 0x2f, 0x16, 0x40, 0x00, 0x1d, 0xc3,
+    0x2b, 0x7d, 0x22, 0x9a, 0x70, 0x4e, 0xf6, 0xa0, 0x47, 0x28, 0x33, 0xa4,
+    0xa4, 0x38, 0xd3, 0x12, 0xcb, 0x9e, 0xda, 0xe1, 0x1b, 0xb1, 0x9a, 0x53,
+    0xac, 0x46, 0xc5, 0xb6, 0x46, 0x85, 0xe5, 0x52, 0xa9, 0xf0, 0x50, 0xbc,
+    0x13, 0xd2, 0x88, 0x07, 0x83, 0x82, 0x9a, 0xe1, 0x20, 0x46, 0x3b, 0xc0,
+    0x8e, 0x72, 0xcd, 0x80, 0x5a, 0x0c, 0x3b, 0xc7, 0x8f, 0x52, 0x13, 0xd4,
+    0xf5, 0xe9, 0xba, 0x31, 0xaa, 0x2f, 0x95, 0x03, 0xb6, 0xe3, 0xd2, 0x98,
+    0xba, 0x1d, 0x26, 0x9b, 0xc2, 0xab, 0x35, 0xb8, 0xaa, 0xa9, 0x63, 0x05,
+    0xf2, 0x95, 0xd1, 0xcb, 0xd4, 0x50, 0x4d, 0x07, 0x2b, 0x3d, 0x20, 0xc7,
+    0x57, 0x0d, 0x14, 0xef, 0xf4, 0xca, 0xac, 0xd0, 0x37, 0x08, 0xa5, 0x4d,
+    0xc4, 0xd3, 0x7a, 0x8d, 0x6d, 0x5a, 0xac, 0x30, 0x37, 0x7d, 0x79, 0x85,
+    0x0d, 0x62, 0x94, 0x96, 0xae, 0x85, 0xae, 0x57, 0xf8, 0xa5, 0x37, 0x5d,
+    0x97, 0x59, 0x81, 0xb1, 0xfb, 0x92, 0x60, 0xbc, 0xa7, 0x39, 0x42, 0x73,
+    0x89, 0x06, 0xf9, 0x73, 0x3a, 0xfc, 0xc5, 0xc9, 0xa3, 0x56, 0xb0, 0x55,
+    0x72, 0x5b, 0xa6, 0x4b, 0xf2, 0xee, 0x7e, 0xa0, 0x13, 0x90, 0x47, 0xc3,
+    0x05, 0x3d, 0xd5, 0x81, 0x45, 0x7a, 0x25, 0x05, 0x36, 0x16, 0xf3, 0x13,
+    0x45, 0xb5, 0xc8, 0xea, 0x31, 0x5c, 0x94, 0x23, 0x51, 0xe1, 0xc5, 0x54,
+    0xa9, 0xad, 0x6e, 0x20, 0x78, 0x09, 0xa7, 0x4d, 0x3c, 0x75, 0x23, 0x5e,
+    0x38, 0x7c, 0x70, 0x8b, 0x29, 0x74, 0x72, 0xd1, 0xd1, 0xa5, 0xd8, 0x74,
+    0xa5, 0xa6, 0xee, 0x15, 0xa9, 0x4f, 0xcf, 0xd1, 0x6a, 0x02, 0xe1, 0x26,
+    0x55, 0xa1, 0xb9, 0xb5, 0x24, 0x78, 0x0b, 0xc1, 0xe3, 0x96, 0xfe, 0xde,
+    0xcd, 0x7a, 0x6d, 0x8c, 0xb7, 0xad, 0x6e, 0x07, 0xf8, 0xdc, 0x85, 0x94,
+    0x91, 0x70, 0xcd, 0x0d, 0x70, 0x4c, 0x9d, 0x11, 0x37, 0x33, 0xc7, 0x43,
+    0x21, 0x10, 0xa9, 0x8a, 0x32, 0x91, 0x73, 0xe2, 0x72, 0xb8, 0x0f, 0x77,
+    0x0f, 0xd4, 0x43, 0x20, 0x75, 0x37, 0xf6, 0x7d, 0xfc, 0xd6, 0xfd, 0x09,
+    0xcd, 0x2d, 0xdd, 0xa1, 0x8a, 0x87, 0x6d, 0x0e, 0x21, 0x96, 0x86, 0x5d,
+    0x1a, 0xa0, 0x74, 0xc8, 0xb0, 0xb4, 0xbb, 0x42, 0x99, 0xaf, 0x2e, 0xb4,
+    0x2c, 0x3e, 0x18, 0x06, 0x00, 0xa8, 0x57, 0xae, 0xe1, 0x75, 0xf6, 0x69,
+    0xdd, 0x0a, 0x76, 0x63, 0x88, 0x02, 0x66, 0x84, 0x78, 0xc3, 0x3e, 0xb0,
+    0x24, 0x7f, 0x72, 0x0b, 0x61, 0x8f, 0x8c, 0xcf, 0x5e, 0xc1, 0xa6, 0xc6,
+    0x6f, 0x99, 0x1a, 0x4b, 0x04, 0x3b, 0x50, 0x8b, 0x55, 0xf6, 0x50, 0x69,
+    0x28, 0x91, 0xd1, 0x95, 0xc4, 0xea, 0xf6, 0xae, 0xd2, 0x51, 0xb6, 0x8d,
+    0x4c, 0xdd, 0x7e, 0x77, 0x7a, 0xb3, 0xfd, 0x12, 0x99, 0x6a, 0x61, 0xc1,
+    0xda, 0x43, 0x79, 0x54, 0x1b, 0x43, 0xcf, 0x7f, 0x33, 0x8f, 0x8e, 0xb6,
+    0x26, 0x2d, 0x49, 0xfb, 0x4c, 0x8c, 0xe1, 0xc5, 0x3e, 0x22, 0x9b, 0x45,
+    0x32, 0xdf, 0x23, 0xb6, 0xb2, 0xdb, 0x2c, 0x50, 0x9a, 0xf7, 0xad, 0x36,
+    0x3a, 0x34, 0xd1, 0x3a, 0xc9, 0x4d, 0xe2, 0x1a, 0x40, 0x6c, 0xb5, 0x89,
+    0x70, 0xdd, 0xb3, 0x45, 0xe3, 0x6b, 0x3a, 0x95, 0xaa, 0x91, 0x2f, 0x80,
+    0x8d, 0x54, 0x25, 0x92, 0x4d, 0xcf, 0x18, 0xbb, 0xdc, 0xce, 0xaf, 0xd2,
+    0xa8, 0xd8, 0xef, 0xf8, 0x63, 0xed, 0x13, 0x59, 0x0a, 0x31, 0x49, 0xfc,
+    0x45, 0x63, 0xd6, 0x04, 0x92, 0xd5, 0x28, 0x6a, 0x7e, 0xdb, 0xe5, 0xd3,
+    0xd4, 0xdb, 0x10, 0x39, 0xd7, 0xa4, 0x00, 0x1d, 0x97, 0x1a, 0x17, 0x10,
+    0x1a, 0x51, 0xe9, 0x6e, 0x17, 0x41, 0x85, 0x72, 0xd3, 0x7a, 0x7d, 0xcb,
+    0x5d, 0x8d, 0xa9, 0x43, 0x74, 0x20, 0x5e, 0xbb, 0xec, 0x05, 0x39, 0x70,
+    0x41, 0x6f, 0x5e, 0xd1, 0xe3, 0x4a, 0xbd, 0x06, 0xd9, 0xc6, 0xbe, 0xa2,
+    0x6d, 0x6a, 0x96, 0xaf, 0x00, 0xef, 0x4b, 0x12, 0x81, 0x2c, 0x28, 0x0a,
+    0x9a, 0x65, 0xd8, 0xf3, 0x5b, 0x41, 0x6c, 0x15, 0x42, 0xab, 0x37, 0xf6,
+    0x2c, 0x30, 0x3d, 0x41, 0xa7, 0x1d, 0x7b, 0xe4, 0x24, 0x1c, 0x90, 0x87,
+    0x64, 0x46, 0xa2, 0xf0, 0xab, 0xce, 0x41, 0xc0, 0x14, 0x03, 0x3c, 0xdd,
+    0x01, 0x49, 0x67, 0x45, 0xbb, 0x56, 0x01, 0xd4, 0x64, 0x10, 0x67, 0x3a,
+    0xb0, 0xae, 0xd1, 0x61, 0xcd, 0xc9, 0x9a, 0x85, 0x5a, 0x9e, 0x59, 0x1a,
+    0x11, 0x4e, 0x56, 0x51, 0x95, 0xe7, 0x40, 0x36, 0xc8, 0xf6, 0xee, 0x2e,
+    0x28, 0x0c, 0xa6, 0x57, 0x20, 0x14, 0x5d, 0x29, 0xc8, 0xe0, 0xe8, 0x96,
+    0x8b, 0xb7, 0x7a, 0x3e, 0x91, 0x83, 0xb1, 0x7d, 0x10, 0x10, 0xbc, 0xa8,
+    0xd5, 0x81, 0x7e, 0x60, 0xbc, 0x06, 0xd9, 0x76, 0xde, 0xd8, 0x9d, 0x42,
+    0xc9, 0xc1, 0x6e, 0xf0, 0x06, 0x63, 0x2e, 0x86, 0x60, 0xcd, 0x07, 0x18,
+    0x4a, 0x38, 0x2e, 0x94, 0xc0, 0x65, 0x85, 0x42, 0xdd, 0xd7, 0x69, 0xc3,
+    0x66, 0xe7, 0x5f, 0x7e, 0x7c, 0xd6, 0xce, 0xc7, 0x1b, 0xc9, 0x56, 0xc5,
+    0x88, 0x21, 0x25, 0x8b, 0x31, 0x14, 0xa0, 0xd8, 0x3a, 0xb6, 0x61, 0xb8,
+    0x96, 0x22, 0x8b, 0xc1, 0x7e, 0x4c, 0x32, 0xd9, 0xa6, 0xea, 0x0b, 0x53,
+    0x2f, 0xd9, 0x35, 0xe5, 0x9d, 0xb8, 0x3e, 0xca, 0x0a, 0x2b, 0xc7, 0x10,
+    0xf6, 0xc7, 0xd0, 0xc5, 0xc8, 0xf6, 0xdb, 0x28, 0xb8, 0xc5, 0xf3, 0x0e,
+    0x16, 0xc7, 0x28, 0x14, 0x22, 0xbc, 0x51, 0xb7, 0xa8, 0xa8, 0xf2, 0x42,
+    0xe0, 0x22, 0xbd, 0x92, 0x56, 0xd3, 0x4b, 0xee, 0x5f, 0x62, 0x12, 0x62,
+    0x77, 0x25, 0x13, 0x50, 0x95, 0xc0, 0x02, 0x17, 0x43, 0x69, 0xb3, 0xcf,
+    0x2a, 0x50, 0x5c, 0x5f, 0x75, 0xf7, 0x84, 0x2e, 0xa1, 0xb9, 0x8e, 0xfa,
+    0x9e, 0xb9, 0x8d, 0xf7, 0xe7, 0xdb, 0x84, 0x3f, 0x6f, 0x6f, 0x34, 0xfb,
+    0xaa, 0xad, 0x3e, 0xdb, 0xe6, 0x33, 0x85, 0xc6, 0x93, 0x61, 0xcd, 0xe0,
+    0xa5, 0xe9, 0x1e, 0x06, 0xdb, 0x30, 0x77, 0xb4, 0x16, 0x4b, 0x6b, 0xa9,
+    0x44, 0x65, 0x6e, 0xba, 0xa8, 0x2b, 0xae, 0xf0, 0x8a, 0x5f, 0x4b, 0x79,
+    0xf8, 0x2a, 0x1e, 0x18, 0x29, 0xa9, 0xf8, 0x05, 0xb2, 0xbf, 0x8a, 0x87,
+    0x75, 0xe3, 0x46, 0xd5, 0x5d, 0x23, 0x1c, 0x8d, 0x55, 0x5b, 0x16, 0x69,
+    0x1b, 0x03, 0xc4, 0xef, 0x8a, 0x90, 0x36, 0xf2, 0x49, 0xf7, 0xda, 0x5c,
+    0x93, 0xb8, 0x3a, 0xa9, 0xc2, 0x18, 0xb1, 0x97, 0x1f, 0xc1, 0x88, 0xad,
+    0xdc, 0x55, 0xca, 0xee, 0x79, 0xa9, 0x30, 0xd6, 0xd0, 0x1b, 0x9c, 0x58,
+    0x84, 0x5e, 0xf0, 0xd5, 0x6a, 0xa2, 0x5e, 0x93, 0x7a, 0x4f, 0xec, 0x01,
+    0x8d, 0xa5, 0x55, 0xa6, 0x82, 0x55, 0xff, 0xbc, 0x85, 0x6e, 0x4f, 0x40,
+    0xe9, 0x11, 0xf1, 0x40, 0x27, 0x18, 0x82, 0x4e, 0x67, 0x74, 0xc9, 0x62,
+    0x69, 0x5c, 0xbc, 0x01, 0x2f, 0xab, 0xd2, 0x6c, 0x54, 0x5a, 0x69, 0xa1,
+    0xd9, 0xc0, 0xf5, 0x85, 0x9b, 0xf8, 0x97, 0xee, 0xe5, 0x25, 0xa0, 0x96,
+    0xf5, 0xc9, 0xaa, 0x5c, 0xc8, 0x8e, 0xea, 0xd5, 0xeb, 0xab, 0xd2, 0xae,
+    0x9b, 0xab, 0x0f, 0x4b, 0xb6, 0x05, 0xf1, 0xbe, 0x2d, 0xc5, 0x05, 0x3d,
+    0x05, 0xe9, 0x4e, 0x4f, 0xc6, 0x4f, 0x71, 0x40, 0x0b, 0x17, 0xee, 0xa3,
+    0xee, 0xd3, 0x27, 0xaf, 0xf4, 0x17, 0x83, 0x60, 0x5a, 0xa0, 0x20, 0x60,
+    0xf1, 0x36, 0x5d, 0xea, 0xf5, 0x29, 0xa9, 0x81, 0x6f, 0xe7, 0xfa, 0x78,
+    0x6e, 0x85, 0x26, 0xe8, 0xec, 0x9a, 0x4b, 0x23, 0xfe, 0xfc, 0xea, 0x15,
+    0x40, 0x97, 0x7c, 0x0a, 0xea, 0x00, 0xef, 0xce, 0x70, 0xbe, 0xa3, 0x0f,
+    0xef, 0x6e, 0x53, 0x0f, 0xf6, 0xb8, 0x32, 0xde, 0x75, 0x99, 0x11, 0x08,
+    0xa3, 0x70, 0xba, 0x13, 0x0e, 0x4a, 0x35, 0xa0, 0xac, 0x3d, 0x58, 0x55,
+    0x1d, 0x15, 0xd7, 0xfd, 0xdb, 0x70, 0xbe, 0x03, 0xd9, 0xf2, 0x83, 0x1d,
+    0x90, 0xf3, 0xdb, 0x25, 0x77, 0x58, 0x2e, 0x60, 0x2d, 0xf6, 0xe0, 0x61,
+    0xe5, 0x2f, 0x50, 0xb9, 0xb4, 0x1f, 0x80, 0xdc, 0x21, 0x85, 0x96, 0x99,
+    0x03, 0xc6, 0x95, 0xfb, 0x01, 0xd9, 0x61, 0x88, 0x1c, 0x4c, 0x31, 0xa9,
+    0xa2, 0x21, 0x48, 0x65, 0x5f, 0xf9, 0xb7, 0x54, 0x07, 0x4b, 0x9a, 0x33,
+    0x92, 0x15, 0x76, 0x02, 0x17, 0x9e, 0xfe, 0x2a, 0x7a, 0xd7, 0x49, 0xff,
+    0x2b, 0x7c, 0xff, 0x3b, 0x8f, 0x0d, 0x09, 0x3d, 0xa5, 0x28, 0xb9, 0xdd,
+    0xc9, 0x87, 0xde, 0xd6, 0xf3, 0x9e, 0x9b, 0x06, 0xca, 0x26, 0x23, 0x45,
+    0x07, 0xce, 0x1c, 0x2e, 0x2b, 0x73, 0x48, 0x83, 0xac, 0x29, 0x6f, 0xa4,
+    0x41, 0x1c, 0xff, 0x9f, 0xfb, 0x46, 0xed, 0x96, 0x13, 0x8b, 0x20, 0xb2,
+    0x51, 0x32, 0xc7, 0x13, 0xe2, 0x2e, 0x66, 0x28, 0x9b, 0xd5, 0x82, 0xc1,
+    0xd5, 0x89, 0x08, 0xb3, 0x06, 0xea, 0xf5, 0x6a, 0xf8, 0x5f, 0x59, 0x13,
+    0xa5, 0xdb, 0x8f, 0x25, 0xe8, 0xe1, 0x72, 0x42, 0x38, 0xd9, 0x6c, 0x76,
+    0x19, 0xa8, 0xd5, 0x45, 0xa7, 0xce, 0x97, 0x2f, 0x97, 0xed, 0xf3, 0x77,
+    0x5f, 0xbe, 0x38, 0x3f, 0x6c, 0x59, 0x80, 0xeb, 0xe0, 0x55, 0x37, 0x71,
+    0x0d, 0xda, 0x14, 0xfd, 0xe1, 0x07, 0xd6, 0xdc, 0x52, 0x51, 0x12, 0x63,
+    0x46, 0x1d, 0xe1, 0xb6, 0x43, 0x65, 0x05, 0xf9, 0x68, 0xfb, 0x99, 0xc0,
+    0x2a, 0x23, 0x26, 0xe5, 0xb7, 0xd4, 0x4b, 0x11, 0x28, 0xda, 0x60, 0xbd,
+    0x17, 0x15, 0x94, 0x96, 0xa2, 0x6c, 0x30, 0x50, 0x5a, 0xf3, 0x37, 0x9c,
+    0x13, 0x98, 0xec, 0x85, 0x9a, 0x2c, 0x38, 0x9d, 0x11, 0x85, 0xb6, 0x3b,
+    0xab, 0xec, 0x64, 0x9e, 0xa6, 0xc2, 0x7c, 0x27, 0x0e, 0xdf, 0x84, 0xd9,
+    0x35, 0x7e, 0xf4, 0xea, 0x04, 0xbe, 0x43, 0xc5, 0x89, 0x71, 0x0e, 0x78,
+    0xea, 0x53, 0x58, 0x37, 0xc9, 0x14, 0xc7, 0x28, 0x97, 0xbe, 0x17, 0x98,
+    0x94, 0xbb, 0x93, 0x17, 0xab, 0xbb, 0x53, 0x54, 0x31, 0x3a, 0x5e, 0x85,
+    0xa1, 0xec, 0x22, 0x30, 0x85, 0x86, 0x94, 0x35, 0x98, 0xed, 0xc4, 0xb0,
+    0x06, 0x7b, 0xc9, 0x50, 0xda, 0xaa, 0xae, 0x5a, 0x99, 0x0a, 0x8c, 0x56,
+    0xac, 0x29, 0xc0, 0x04, 0xe4, 0xb1, 0xe6, 0x3b, 0x2c, 0x88, 0x42, 0x7d,
+    0x5b, 0x88, 0x56, 0x2d, 0xf0, 0xea, 0xd8, 0x50, 0xa3, 0x7a, 0xe8, 0x15,
+    0x26, 0xd9, 0xb4, 0x07, 0x38, 0x36, 0x67, 0x76, 0x90, 0xf0, 0xcc, 0xf2,
+    0xa1, 0xb3, 0x00, 0xf6, 0x4d, 0x4f, 0xc6, 0x3b, 0xb8, 0x1b, 0x76, 0xa2,
+    0xe4, 0xf6, 0x29, 0x36, 0x5e, 0xb1, 0xc3, 0x0b, 0x4e, 0x05, 0x9c, 0xa2,
+    0xec, 0x71, 0x50, 0xcf, 0x46, 0x6d, 0xb5, 0x0e, 0xa8, 0x30, 0xb4, 0xac,
+    0x51, 0xde, 0xc2, 0x21, 0x96, 0x0c, 0xbe, 0x31, 0x5e, 0x31, 0x79, 0xda,
+    0xfc, 0xbf, 0x48, 0xe6, 0x9b, 0x14, 0x7c, 0xb8, 0x00, 0x00};
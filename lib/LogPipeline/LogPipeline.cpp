@@ -0,0 +1,244 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Metrics.h>
+
+#include "LogPipeline.h"
+
+// Record layout in the ring: sink mask, line length, protocol length,
+// deviceID length, protocol, deviceID and line without terminators
+static const size_t RECORD_HEADER = 4;
+static const int LEVEL_NONE = 100;
+
+static size_t recordSize(const uint8_t *header) {
+  return RECORD_HEADER + header[1] + header[2] + header[3];
+}
+
+LogPipeline Logs;
+
+size_t LogPipeline::Input::write(uint8_t c) {
+  line[length++] = c;
+  if (c == '\n' || length == LOG_PIPELINE_LINE_SIZE) {
+    line[length] = '\0';
+    pipeline->commit(index, line, length);
+    length = 0;
+  }
+  return 1;
+}
+
+LogPipeline::LogPipeline()
+    : head(0),
+      used(0),
+      lastRecord(0),
+      lastValid(false),
+      context({"", ""}),
+      minLevel(LEVEL_NONE),
+      buffered(false),
+      dropCount(0),
+      reportedDrops(0) {
+  for (uint8_t i = 0; i < LOG_PIPELINE_SINKS; ++i) {
+    sinks[i].sink = nullptr;
+    sinks[i].input.pipeline = this;
+    sinks[i].input.index = i;
+  }
+}
+
+LogPipeline::~LogPipeline() = default;
+
+void LogPipeline::attach(LogSink &sink, SimpleLogger::Level level) {
+  Sink *slot = nullptr;
+  for (auto &candidate : sinks) {
+    if (candidate.sink == &sink) {
+      slot = &candidate;
+      break;
+    }
+    if (!slot && candidate.sink == nullptr) {
+      slot = &candidate;
+    }
+  }
+  if (!slot) {
+    Logger.error.println(F("No free log sink"));
+    return;
+  }
+  slot->sink = &sink;
+  slot->level = level;
+  Logger.addHandler(level, slot->input);
+  updateMinLevel();
+}
+
+void LogPipeline::detach(LogSink &sink) {
+  for (auto &slot : sinks) {
+    if (slot.sink == &sink) {
+      Logger.removeHandler(slot.input);
+      removeFromRing(1 << slot.input.index);
+      slot.sink = nullptr;
+      slot.input.length = 0;
+    }
+  }
+  updateMinLevel();
+}
+
+void LogPipeline::updateMinLevel() {
+  minLevel = LEVEL_NONE;
+  for (const auto &slot : sinks) {
+    if (slot.sink && slot.level < minLevel) {
+      minLevel = slot.level;
+    }
+  }
+}
+
+void LogPipeline::put(const void *data, size_t length) {
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  size_t pos = (head + used) % LOG_PIPELINE_BUFFER_SIZE;
+  for (size_t i = 0; i < length; ++i) {
+    ring[pos] = bytes[i];
+    pos = (pos + 1) % LOG_PIPELINE_BUFFER_SIZE;
+  }
+  used += length;
+}
+
+void LogPipeline::get(size_t pos, void *data, size_t length) const {
+  uint8_t *bytes = static_cast<uint8_t *>(data);
+  for (size_t i = 0; i < length; ++i) {
+    bytes[i] = ring[(pos + i) % LOG_PIPELINE_BUFFER_SIZE];
+  }
+}
+
+bool LogPipeline::sameAsLast(const char *line, size_t length) const {
+  if (!lastValid) {
+    return false;
+  }
+  uint8_t header[RECORD_HEADER];
+  get(lastRecord, header, sizeof(header));
+  if (header[1] != length) {
+    return false;
+  }
+  size_t pos = lastRecord + RECORD_HEADER + header[2] + header[3];
+  for (size_t i = 0; i < length; ++i) {
+    if (ring[(pos + i) % LOG_PIPELINE_BUFFER_SIZE] !=
+        static_cast<uint8_t>(line[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void LogPipeline::commit(uint8_t index, char *line, size_t length) {
+  if (!buffered) {
+    sinks[index].sink->writeLine(line, length, context);
+    return;
+  }
+
+  uint8_t mask = 1 << index;
+  // Logger writes each line to all handlers one after another
+  if (sameAsLast(line, length) && !(ring[lastRecord] & mask)) {
+    ring[lastRecord] |= mask;
+    return;
+  }
+  uint8_t protocolLength =
+      strnlen(context.protocol, LOG_PIPELINE_CONTEXT_SIZE);
+  uint8_t deviceIDLength =
+      strnlen(context.deviceID, LOG_PIPELINE_CONTEXT_SIZE);
+  size_t size = RECORD_HEADER + protocolLength + deviceIDLength + length;
+  if (LOG_PIPELINE_BUFFER_SIZE - used < size) {
+    dropCount++;
+    Metrics.inc(METRIC_LOG_DROPPED);
+    return;
+  }
+  lastRecord = (head + used) % LOG_PIPELINE_BUFFER_SIZE;
+  lastValid = true;
+  uint8_t header[RECORD_HEADER] = {mask, static_cast<uint8_t>(length),
+                                   protocolLength, deviceIDLength};
+  put(header, sizeof(header));
+  put(context.protocol, protocolLength);
+  put(context.deviceID, deviceIDLength);
+  put(line, length);
+}
+
+void LogPipeline::removeFromRing(uint8_t mask) {
+  for (size_t offset = 0; offset < used;) {
+    size_t pos = (head + offset) % LOG_PIPELINE_BUFFER_SIZE;
+    uint8_t header[RECORD_HEADER];
+    get(pos, header, sizeof(header));
+    ring[pos] &= ~mask;
+    offset += recordSize(header);
+  }
+}
+
+void LogPipeline::loop(size_t budget) {
+  size_t written = 0;
+  while (used > 0 && written < budget) {
+    uint8_t header[RECORD_HEADER];
+    get(head, header, sizeof(header));
+    char protocol[LOG_PIPELINE_CONTEXT_SIZE + 1];
+    char deviceID[LOG_PIPELINE_CONTEXT_SIZE + 1];
+    char line[LOG_PIPELINE_LINE_SIZE + 1];
+    size_t pos = head + RECORD_HEADER;
+    get(pos, protocol, header[2]);
+    protocol[header[2]] = '\0';
+    pos += header[2];
+    get(pos, deviceID, header[3]);
+    deviceID[header[3]] = '\0';
+    pos += header[3];
+    size_t length = header[1];
+    get(pos, line, length);
+    line[length] = '\0';
+
+    // release first, the sinks may log themselves
+    if (lastRecord == head) {
+      lastValid = false;
+    }
+    head = (head + recordSize(header)) % LOG_PIPELINE_BUFFER_SIZE;
+    used -= recordSize(header);
+
+    const LogContext lineContext = {protocol, deviceID};
+    for (const auto &slot : sinks) {
+      if ((header[0] & (1 << slot.input.index)) && slot.sink) {
+        slot.sink->writeLine(line, length, lineContext);
+      }
+    }
+    written += length;
+  }
+
+  if (used == 0 && dropCount != reportedDrops) {
+    unsigned long dropped = dropCount - reportedDrops;
+    reportedDrops = dropCount;
+    Logger.warning.print(F("Log buffer full, lines dropped: "));
+    Logger.warning.println(dropped);
+  }
+}
+
+void LogPipeline::flush() {
+  // a second pass writes the drop warning
+  while (used > 0) {
+    loop(SIZE_MAX);
+  }
+}
@@ -0,0 +1,159 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef LOGPIPELINE_H
+#define LOGPIPELINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Print.h>
+
+#include <ArduinoSimpleLogging.h>
+
+#ifndef LOG_PIPELINE_BUFFER_SIZE
+#define LOG_PIPELINE_BUFFER_SIZE 2048
+#endif
+
+#ifndef LOG_PIPELINE_LINE_SIZE
+#define LOG_PIPELINE_LINE_SIZE 64
+#endif
+
+#ifndef LOG_PIPELINE_SINKS
+#define LOG_PIPELINE_SINKS 4
+#endif
+
+// Maximum length of the context strings
+#ifndef LOG_PIPELINE_CONTEXT_SIZE
+#define LOG_PIPELINE_CONTEXT_SIZE 32
+#endif
+
+// Bytes written to the sinks per loop
+#ifndef LOG_PIPELINE_BUDGET
+#define LOG_PIPELINE_BUDGET 256
+#endif
+
+// RF device a log line refers to, empty strings if none
+struct LogContext {
+  const char *protocol;
+  const char *deviceID;
+};
+
+class LogSink {
+ public:
+  virtual ~LogSink() = default;
+  // line is NUL terminated and ends with the newline, if any
+  virtual void writeLine(const char *line, size_t length,
+                         const LogContext &context) = 0;
+};
+
+class PrintLogSink : public LogSink {
+ public:
+  explicit PrintLogSink(Print &target) : target(target) {}
+  void writeLine(const char *line, size_t length,
+                 const LogContext &context) override {
+    target.write(reinterpret_cast<const uint8_t *>(line), length);
+  }
+
+ private:
+  Print &target;
+};
+
+// Decouples logging from the (slow) log targets.  Each sink gets a
+// Logger handler that splits the output into lines.  The lines are
+// stored in one preallocated ring, a line logged to several sinks is
+// stored once.  loop() writes them to the sinks with a byte budget.  If
+// the ring is full, new lines are dropped and counted.
+class LogPipeline {
+ public:
+  LogPipeline();
+  ~LogPipeline();
+
+  // Register the sink with Logger or change its level
+  void attach(LogSink &sink, SimpleLogger::Level level);
+  void detach(LogSink &sink);
+  // Check before formatting messages in hot paths
+  bool enabled(SimpleLogger::Level level) const { return level >= minLevel; }
+  // Attach the device to the following lines, the strings must stay
+  // valid until clearContext().
+  void setContext(const char *protocol, const char *deviceID) {
+    context = {protocol, deviceID};
+  }
+  void clearContext() { context = {"", ""}; }
+
+  // Lines are written to the sinks immediately until begin()
+  void begin() { buffered = true; }
+  void loop(size_t budget = LOG_PIPELINE_BUDGET);
+  // Write all pending lines, e.g. before a restart or in blocking code
+  void flush();
+
+  size_t pending() const { return used; }
+  unsigned long drops() const { return dropCount; }
+
+ private:
+  class Input : public Print {
+   public:
+    size_t write(uint8_t c) override;
+
+    LogPipeline *pipeline = nullptr;
+    uint8_t index = 0;
+    size_t length = 0;
+    char line[LOG_PIPELINE_LINE_SIZE + 1];
+  };
+
+  struct Sink {
+    LogSink *sink;
+    SimpleLogger::Level level;
+    Input input;
+  };
+
+  void commit(uint8_t index, char *line, size_t length);
+  bool sameAsLast(const char *line, size_t length) const;
+  void put(const void *data, size_t length);
+  void get(size_t pos, void *data, size_t length) const;
+  void removeFromRing(uint8_t mask);
+  void updateMinLevel();
+
+  Sink sinks[LOG_PIPELINE_SINKS];
+  uint8_t ring[LOG_PIPELINE_BUFFER_SIZE];
+  size_t head;
+  size_t used;
+  // last stored line, a copy for another sink is merged into it
+  size_t lastRecord;
+  bool lastValid;
+  LogContext context;
+  int minLevel;
+  bool buffered;
+  unsigned long dropCount;
+  unsigned long reportedDrops;
+};
+
+extern LogPipeline Logs;
+
+#endif  // LOGPIPELINE_H
@@ -0,0 +1,542 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <Arduino.h>
+
+#include <ArduinoSimpleLogging.h>
+
+#include "AsyncMqttTransport.h"
+
+static const uint8_t MQTT_CONNECT = 0x10;
+static const uint8_t MQTT_CONNACK = 0x20;
+static const uint8_t MQTT_PUBLISH = 0x30;
+static const uint8_t MQTT_PUBACK = 0x40;
+static const uint8_t MQTT_SUBSCRIBE = 0x82;
+static const uint8_t MQTT_SUBACK = 0x90;
+static const uint8_t MQTT_UNSUBSCRIBE = 0xa2;
+static const uint8_t MQTT_UNSUBACK = 0xb0;
+static const uint8_t MQTT_PINGREQ = 0xc0;
+static const uint8_t MQTT_PINGRESP = 0xd0;
+static const uint8_t MQTT_DISCONNECT = 0xe0;
+
+static const uint8_t PUBLISH_RETAIN = 0x01;
+static const uint8_t PUBLISH_QOS1 = 0x02;
+static const uint8_t PUBLISH_DUP = 0x08;
+
+static const uint8_t CONNECT_CLEAN_SESSION = 0x02;
+static const uint8_t CONNECT_WILL = 0x04;
+static const uint8_t CONNECT_WILL_RETAIN = 0x20;
+static const uint8_t CONNECT_PASSWORD = 0x40;
+static const uint8_t CONNECT_USER = 0x80;
+
+static size_t stringSize(const String &str) { return 2 + str.length(); }
+
+static size_t lengthSize(size_t remainingLength) {
+  size_t size = 1;
+  while (remainingLength >= 128) {
+    remainingLength /= 128;
+    size++;
+  }
+  return size;
+}
+
+enum PacketFraming { FRAMING_INCOMPLETE, FRAMING_COMPLETE, FRAMING_MALFORMED };
+
+// Fixed header and remaining length of the packet at data
+static PacketFraming packetSize(const uint8_t *data, size_t length,
+                                size_t &headerLength, size_t &remaining) {
+  remaining = 0;
+  headerLength = 1;
+  for (size_t shift = 0; headerLength < length; shift += 7) {
+    uint8_t digit = data[headerLength++];
+    remaining |= static_cast<size_t>(digit & 0x7f) << shift;
+    if ((digit & 0x80) == 0) {
+      return FRAMING_COMPLETE;
+    }
+    if (headerLength == 5) {
+      return FRAMING_MALFORMED;
+    }
+  }
+  return FRAMING_INCOMPLETE;
+}
+
+AsyncMqttTransport::AsyncMqttTransport()
+    : port(1883),
+      state(IDLE),
+      connectStart(0),
+      lastOutbound(0),
+      pingSent(0),
+      pingOutstanding(false),
+      packetId(0),
+      publishRemaining(0),
+      tcpConnected(false),
+      tcpDisconnected(false),
+      rxOverflow(false),
+      rxDropped(false),
+      rxLength(0),
+      rxDiscard(0),
+      rxDrop(0) {
+  client.setNoDelay(true);
+  client.onConnect([this](void *, AsyncClient *) { tcpConnected = true; });
+  client.onDisconnect(
+      [this](void *, AsyncClient *) { tcpDisconnected = true; });
+  client.onData([this](void *, AsyncClient *, void *data, size_t length) {
+    onData(static_cast<const uint8_t *>(data), length);
+  });
+}
+
+AsyncMqttTransport::~AsyncMqttTransport() {
+  client.onDisconnect(nullptr);
+  client.onData(nullptr);
+  client.close(true);
+}
+
+void AsyncMqttTransport::setServer(const char *host, uint16_t port) {
+  this->host = host;
+  this->port = port;
+}
+
+void AsyncMqttTransport::onData(const uint8_t *data, size_t length) {
+  while (length > 0) {
+    size_t &drop = rxDiscard > 0 ? rxDiscard : rxDrop;
+    if (drop > 0) {
+      size_t skip = std::min(drop, length);
+      drop -= skip;
+      data += skip;
+      length -= skip;
+      continue;
+    }
+    size_t part = std::min(length, sizeof(rxBuffer) - rxLength);
+    memcpy(rxBuffer + rxLength, data, part);
+    rxLength += part;
+    data += part;
+    length -= part;
+    if (length > 0 && !discardOversized()) {
+      // complete packets that loop() did not process yet
+      rxOverflow = true;
+      return;
+    }
+  }
+}
+
+bool AsyncMqttTransport::discardOversized() {
+  size_t pos = 0;
+  size_t headerLength;
+  size_t remaining;
+  while (packetSize(rxBuffer + pos, rxLength - pos, headerLength,
+                    remaining) == FRAMING_COMPLETE) {
+    size_t total = headerLength + remaining;
+    if (total > sizeof(rxBuffer)) {
+      // drop the buffered part and skip the rest in onData(), the
+      // packets before it are still processed
+      rxDrop = total - (rxLength - pos);
+      rxLength = pos;
+      rxDropped = true;
+      return true;
+    }
+    if (pos + total > rxLength) {
+      return false;
+    }
+    pos += total;
+  }
+  return false;
+}
+
+bool AsyncMqttTransport::connect(const char *id, const char *user,
+                                 const char *password, const char *willTopic,
+                                 const char *willMessage) {
+  if (state != IDLE) {
+    return state == CONNECTED;
+  }
+  clientId = id;
+  this->user = user ? user : "";
+  this->password = password ? password : "";
+  this->willTopic = willTopic ? willTopic : "";
+  this->willMessage = willMessage ? willMessage : "";
+
+  tcpConnected = false;
+  tcpDisconnected = false;
+  rxOverflow = false;
+  rxDropped = false;
+  rxLength = 0;
+  rxDiscard = 0;
+  rxDrop = 0;
+  connectStart = millis();
+  // resolves the host name in the background as well
+  if (!client.connect(host.c_str(), port)) {
+    Logger.error.println(F("MQTT: cannot start TCP connection"));
+    return false;
+  }
+  state = TCP_CONNECTING;
+  return false;
+}
+
+void AsyncMqttTransport::close(bool graceful) {
+  // a graceful close still sends the queued data
+  client.close(!graceful);
+  tcpDisconnected = false;
+  state = IDLE;
+  pingOutstanding = false;
+  publishRemaining = 0;
+  rxLength = 0;
+  rxDiscard = 0;
+  rxDrop = 0;
+}
+
+void AsyncMqttTransport::disconnect() {
+  if (state == CONNECTED && writeHeader(MQTT_DISCONNECT, 0)) {
+    send();
+  }
+  close(true);
+}
+
+bool AsyncMqttTransport::writeHeader(uint8_t type, size_t remainingLength) {
+  if (client.space() < 1 + lengthSize(remainingLength) + remainingLength) {
+    return false;
+  }
+  uint8_t header[5];
+  size_t pos = 0;
+  header[pos++] = type;
+  do {
+    uint8_t digit = remainingLength % 128;
+    remainingLength /= 128;
+    header[pos++] = digit | (remainingLength > 0 ? 0x80 : 0);
+  } while (remainingLength > 0);
+  return add(header, pos);
+}
+
+bool AsyncMqttTransport::add(const void *data, size_t length) {
+  return length == 0 ||
+         client.add(static_cast<const char *>(data), length,
+                    ASYNC_WRITE_FLAG_COPY) == length;
+}
+
+bool AsyncMqttTransport::addUint16(uint16_t value) {
+  uint8_t data[] = {static_cast<uint8_t>(value >> 8),
+                    static_cast<uint8_t>(value & 0xff)};
+  return add(data, sizeof(data));
+}
+
+bool AsyncMqttTransport::addString(const char *str) {
+  size_t length = strlen(str);
+  return addUint16(length) && add(str, length);
+}
+
+bool AsyncMqttTransport::send() {
+  lastOutbound = millis();
+  return client.send();
+}
+
+uint16_t AsyncMqttTransport::nextPacketId() {
+  if (++packetId == 0) {
+    packetId = 1;
+  }
+  return packetId;
+}
+
+bool AsyncMqttTransport::sendConnect() {
+  static const uint8_t protocol[] = {0, 4, 'M', 'Q', 'T', 'T', 4};
+  uint8_t flags = CONNECT_CLEAN_SESSION;
+  size_t length = sizeof(protocol) + 1 + 2 + stringSize(clientId);
+  if (willTopic.length() > 0) {
+    flags |= CONNECT_WILL | CONNECT_WILL_RETAIN;
+    length += stringSize(willTopic) + stringSize(willMessage);
+  }
+  if (user.length() > 0) {
+    flags |= CONNECT_USER | CONNECT_PASSWORD;
+    length += stringSize(user) + stringSize(password);
+  }
+
+  bool ok = writeHeader(MQTT_CONNECT, length) &&
+            add(protocol, sizeof(protocol)) && add(&flags, 1) &&
+            addUint16(MQTT_ASYNC_KEEPALIVE) && addString(clientId.c_str());
+  if (ok && (flags & CONNECT_WILL)) {
+    ok = addString(willTopic.c_str()) && addString(willMessage.c_str());
+  }
+  if (ok && (flags & CONNECT_USER)) {
+    ok = addString(user.c_str()) && addString(password.c_str());
+  }
+  return ok && send();
+}
+
+bool AsyncMqttTransport::subscribe(const char *topic) {
+  if (state != CONNECTED) {
+    return false;
+  }
+  // requested QoS 0
+  return writeHeader(MQTT_SUBSCRIBE, 2 + 2 + strlen(topic) + 1) &&
+         addUint16(nextPacketId()) && addString(topic) &&
+         add("\0", 1) && send();
+}
+
+bool AsyncMqttTransport::unsubscribe(const char *topic) {
+  if (state != CONNECTED) {
+    return false;
+  }
+  return writeHeader(MQTT_UNSUBSCRIBE, 2 + 2 + strlen(topic)) &&
+         addUint16(nextPacketId()) && addString(topic) && send();
+}
+
+bool AsyncMqttTransport::publish(const char *topic, const uint8_t *payload,
+                                 size_t length, bool retain) {
+  return beginPublish(topic, length, retain) &&
+         write(payload, length) == length && endPublish();
+}
+
+bool AsyncMqttTransport::beginPublish(const char *topic, size_t length,
+                                      bool retain) {
+  if (state != CONNECTED || publishRemaining > 0) {
+    return false;
+  }
+  // fails without writing anything if the TCP buffer has not enough space
+  if (!writeHeader(MQTT_PUBLISH | (retain ? PUBLISH_RETAIN : 0),
+                   2 + strlen(topic) + length) ||
+      !addString(topic)) {
+    return false;
+  }
+  publishRemaining = length;
+  return true;
+}
+
+uint16_t AsyncMqttTransport::beginPublishQos1(const char *topic,
+                                              size_t length, bool retain,
+                                              uint16_t packetId) {
+  if (state != CONNECTED || publishRemaining > 0) {
+    return 0;
+  }
+  uint8_t header = MQTT_PUBLISH | PUBLISH_QOS1 | (retain ? PUBLISH_RETAIN : 0);
+  if (packetId != 0) {
+    header |= PUBLISH_DUP;
+  }
+  if (!writeHeader(header, 2 + strlen(topic) + 2 + length)) {
+    return 0;
+  }
+  if (packetId == 0) {
+    packetId = nextPacketId();
+  }
+  if (!addString(topic) || !addUint16(packetId)) {
+    return 0;
+  }
+  publishRemaining = length;
+  return packetId;
+}
+
+size_t AsyncMqttTransport::write(const uint8_t *data, size_t length) {
+  length = std::min(length, publishRemaining);
+  if (!add(data, length)) {
+    return 0;
+  }
+  publishRemaining -= length;
+  return length;
+}
+
+bool AsyncMqttTransport::endPublish() {
+  if (publishRemaining > 0) {
+    // a message of the announced length is expected by the broker
+    Logger.error.println(F("MQTT: incomplete publish, disconnect"));
+    close();
+    return false;
+  }
+  return send();
+}
+
+void AsyncMqttTransport::loop() {
+  if (tcpDisconnected) {
+    tcpDisconnected = false;
+    if (state != IDLE) {
+      Logger.warning.println(F("MQTT: connection closed"));
+    }
+    close();
+    return;
+  }
+  if (rxOverflow) {
+    Logger.error.println(F("MQTT: receive buffer overflow, disconnect"));
+    close();
+    return;
+  }
+  if (rxDropped) {
+    rxDropped = false;
+    Logger.warning.println(F("MQTT: received packet too large, dropped"));
+  }
+
+  switch (state) {
+    case IDLE:
+      return;
+    case TCP_CONNECTING:
+      if (tcpConnected && !sendConnect()) {
+        Logger.error.println(F("MQTT: sending CONNECT failed"));
+        close();
+        return;
+      }
+      if (tcpConnected) {
+        state = MQTT_CONNECTING;
+      }
+      break;
+    case MQTT_CONNECTING:
+    case CONNECTED:
+      processReceived();
+      break;
+  }
+
+  if (connecting() && (millis() - connectStart) > MQTT_ASYNC_CONNECT_TIMEOUT) {
+    Logger.error.println(F("MQTT: connect timeout"));
+    close();
+    return;
+  }
+  if (state == CONNECTED) {
+    checkKeepAlive();
+  }
+}
+
+void AsyncMqttTransport::checkKeepAlive() {
+  unsigned long now = millis();
+  if (pingOutstanding) {
+    if ((now - pingSent) > MQTT_ASYNC_KEEPALIVE * 1000UL) {
+      Logger.error.println(F("MQTT: no PINGRESP, connection lost"));
+      close();
+    }
+    return;
+  }
+  if ((now - lastOutbound) >= MQTT_ASYNC_KEEPALIVE * 1000UL &&
+      writeHeader(MQTT_PINGREQ, 0) && send()) {
+    pingOutstanding = true;
+    pingSent = now;
+  }
+}
+
+void AsyncMqttTransport::processReceived() {
+  size_t pos = 0;
+  while (pos < rxLength && state != IDLE) {
+    if (rxDiscard > 0) {
+      size_t skip = std::min(rxDiscard, rxLength - pos);
+      rxDiscard -= skip;
+      pos += skip;
+      continue;
+    }
+
+    size_t headerLength;
+    size_t remaining;
+    PacketFraming framing =
+        packetSize(rxBuffer + pos, rxLength - pos, headerLength, remaining);
+    if (framing == FRAMING_MALFORMED) {
+      Logger.error.println(F("MQTT: malformed packet, disconnect"));
+      close();
+      return;
+    }
+    if (framing == FRAMING_INCOMPLETE) {
+      break;
+    }
+    size_t total = headerLength + remaining;
+    if (total > sizeof(rxBuffer)) {
+      Logger.warning.println(F("MQTT: received packet too large, dropped"));
+      rxDiscard = total;
+      continue;
+    }
+    if (pos + total > rxLength) {
+      break;
+    }
+    handlePacket(rxBuffer[pos], rxBuffer + pos + headerLength, remaining);
+    pos += total;
+  }
+  if (state == IDLE) {
+    return;
+  }
+  rxLength -= pos;
+  memmove(rxBuffer, rxBuffer + pos, rxLength);
+}
+
+void AsyncMqttTransport::handlePacket(uint8_t header, uint8_t *data,
+                                      size_t length) {
+  switch (header & 0xf0) {
+    case MQTT_CONNACK:
+      if (state != MQTT_CONNECTING || length < 2) {
+        break;
+      }
+      if (data[1] != 0) {
+        Logger.error.print(F("MQTT: connection refused, code "));
+        Logger.error.println(data[1]);
+        close();
+        return;
+      }
+      state = CONNECTED;
+      pingOutstanding = false;
+      break;
+    case MQTT_PUBLISH:
+      if (state == CONNECTED) {
+        handlePublish(header, data, length);
+      }
+      break;
+    case MQTT_SUBACK & 0xf0:
+      if (length >= 3 && data[2] == 0x80) {
+        Logger.error.println(F("MQTT: subscription rejected"));
+      }
+      break;
+    case MQTT_PINGRESP:
+      pingOutstanding = false;
+      break;
+    case MQTT_PUBACK:
+      if (length >= 2 && ackCallback) {
+        ackCallback((data[0] << 8) | data[1]);
+      }
+      break;
+    case MQTT_UNSUBACK:
+    default:
+      break;
+  }
+}
+
+void AsyncMqttTransport::handlePublish(uint8_t header, uint8_t *data,
+                                       size_t length) {
+  if (length < 2) {
+    return;
+  }
+  uint8_t qos = (header >> 1) & 0x03;
+  size_t topicLength = (data[0] << 8) | data[1];
+  size_t offset = 2 + topicLength + (qos > 0 ? 2 : 0);
+  if (offset > length) {
+    return;
+  }
+  if (qos > 0) {
+    uint8_t ack[] = {MQTT_PUBACK, 2, data[2 + topicLength],
+                     data[3 + topicLength]};
+    if (client.space() >= sizeof(ack) && add(ack, sizeof(ack))) {
+      send();
+    }
+  }
+  // Move the topic over its length field to terminate it
+  memmove(data, data + 2, topicLength);
+  data[topicLength] = '\0';
+  if (callback) {
+    callback(reinterpret_cast<char *>(data), data + offset, length - offset);
+  }
+}
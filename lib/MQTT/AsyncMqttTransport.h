@@ -0,0 +1,136 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef ASYNCMQTTTRANSPORT_H
+#define ASYNCMQTTTRANSPORT_H
+
+#include <WString.h>
+
+#include <ESPAsyncTCP.h>
+
+#include "MqttTransport.h"
+
+#ifndef MQTT_ASYNC_RX_BUFFER_SIZE
+#define MQTT_ASYNC_RX_BUFFER_SIZE 512
+#endif
+
+#ifndef MQTT_ASYNC_CONNECT_TIMEOUT
+#define MQTT_ASYNC_CONNECT_TIMEOUT 10000
+#endif
+
+// Keep alive interval in seconds
+#ifndef MQTT_ASYNC_KEEPALIVE
+#define MQTT_ASYNC_KEEPALIVE 15
+#endif
+
+// Non-blocking MQTT 3.1.1 backend based on ESPAsyncTCP.  Subscriptions
+// use QoS 0, publishing supports QoS 0 and 1.  The TCP
+// callbacks only store data and flags, all protocol handling is done in
+// loop().
+class AsyncMqttTransport : public MqttTransport {
+ public:
+  AsyncMqttTransport();
+  ~AsyncMqttTransport() override;
+
+  void setServer(const char *host, uint16_t port) override;
+  void setCallback(const MessageCb &cb) override { callback = cb; }
+  bool connect(const char *id, const char *user, const char *password,
+               const char *willTopic, const char *willMessage) override;
+  bool connecting() override {
+    return state == TCP_CONNECTING || state == MQTT_CONNECTING;
+  }
+  bool connected() override { return state == CONNECTED; }
+  void disconnect() override;
+  void loop() override;
+
+  bool subscribe(const char *topic) override;
+  bool unsubscribe(const char *topic) override;
+  bool publish(const char *topic, const uint8_t *payload, size_t length,
+               bool retain) override;
+  bool beginPublish(const char *topic, size_t length, bool retain) override;
+  size_t write(const uint8_t *data, size_t length) override;
+  bool endPublish() override;
+
+  bool supportsQos1() override { return true; }
+  void setAckCallback(const AckCb &cb) override { ackCallback = cb; }
+  uint16_t beginPublishQos1(const char *topic, size_t length, bool retain,
+                            uint16_t packetId) override;
+
+ private:
+  enum State { IDLE, TCP_CONNECTING, MQTT_CONNECTING, CONNECTED };
+
+  void onData(const uint8_t *data, size_t length);
+  // Make room if the buffer ends with a packet larger than the buffer
+  bool discardOversized();
+  void close(bool graceful = false);
+  bool sendConnect();
+  bool writeHeader(uint8_t type, size_t remainingLength);
+  bool add(const void *data, size_t length);
+  bool addUint16(uint16_t value);
+  bool addString(const char *str);
+  bool send();
+  uint16_t nextPacketId();
+  void processReceived();
+  void handlePacket(uint8_t header, uint8_t *data, size_t length);
+  void handlePublish(uint8_t header, uint8_t *data, size_t length);
+  void checkKeepAlive();
+
+  AsyncClient client;
+  MessageCb callback;
+  AckCb ackCallback;
+  String host;
+  uint16_t port;
+  String clientId;
+  String user;
+  String password;
+  String willTopic;
+  String willMessage;
+
+  State state;
+  unsigned long connectStart;
+  unsigned long lastOutbound;
+  unsigned long pingSent;
+  bool pingOutstanding;
+  uint16_t packetId;
+  size_t publishRemaining;
+
+  // set by the TCP callbacks
+  bool tcpConnected;
+  bool tcpDisconnected;
+  bool rxOverflow;
+  bool rxDropped;
+  uint8_t rxBuffer[MQTT_ASYNC_RX_BUFFER_SIZE];
+  size_t rxLength;
+  // bytes of an oversized packet still to skip
+  size_t rxDiscard;
+  // the same, but following the complete packets left in the buffer
+  size_t rxDrop;
+};
+
+#endif  // ASYNCMQTTTRANSPORT_H
@@ -0,0 +1,117 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Metrics.h>
+#include <RfHash.h>
+
+#include "ClusterArbiter.h"
+
+ClusterArbiter::ClusterArbiter() : count(0), seenHead(0) {
+  memset(held, 0, sizeof(held));
+  memset(seen, 0, sizeof(seen));
+}
+
+ClusterArbiter::~ClusterArbiter() = default;
+
+ClusterClaim ClusterArbiter::claimOf(const RfEvent &event, const char *name) {
+  uint32_t hash = rfHash(RF_HASH_INIT, event.protocol, strlen(event.protocol));
+  hash = rfHash(hash, event.deviceID, strlen(event.deviceID));
+  hash = rfHash(hash, event.message, strlen(event.message));
+  return {hash, rfHash(hash, name, strlen(name))};
+}
+
+ClusterArbiter::Result ClusterArbiter::hold(const RfEvent &event,
+                                            const ClusterClaim &claim,
+                                            unsigned long now) {
+  for (const auto &entry : seen) {
+    if (entry.time != 0 && entry.claim.hash == claim.hash &&
+        entry.claim.rank < claim.rank &&
+        now - entry.time < MQTT_CLUSTER_CLAIM_WINDOW) {
+      Metrics.inc(METRIC_CLUSTER_YIELDED);
+      return YIELDED;
+    }
+  }
+  for (auto &entry : held) {
+    if (!entry.used) {
+      entry.event = event;
+      entry.claim = claim;
+      entry.since = now;
+      entry.lost = false;
+      entry.used = true;
+      count++;
+      return HELD;
+    }
+  }
+  return FULL;
+}
+
+void ClusterArbiter::onClaim(const ClusterClaim &claim, unsigned long now) {
+  Metrics.inc(METRIC_CLUSTER_CLAIMS);
+  for (auto &entry : held) {
+    if (entry.used && entry.claim.hash == claim.hash &&
+        claim.rank < entry.claim.rank) {
+      entry.lost = true;
+    }
+  }
+  // the frame may still be in the RF or MQTT pipeline of this gateway
+  seen[seenHead] = {claim, now ? now : 1};
+  seenHead = (seenHead + 1) % MQTT_CLUSTER_CLAIMS;
+}
+
+void ClusterArbiter::release(unsigned long now, unsigned long holdoff,
+                             const ReleaseCb &cb) {
+  if (count == 0) {
+    return;
+  }
+  for (auto &entry : held) {
+    if (entry.used && entry.lost) {
+      entry.used = false;
+      count--;
+      Metrics.inc(METRIC_CLUSTER_YIELDED);
+    }
+  }
+  // keep the order of reception
+  while (count > 0) {
+    Held *oldest = nullptr;
+    for (auto &entry : held) {
+      if (entry.used && (!oldest || now - entry.since > now - oldest->since)) {
+        oldest = &entry;
+      }
+    }
+    if (now - oldest->since < holdoff) {
+      return;
+    }
+    oldest->used = false;
+    count--;
+    Metrics.inc(METRIC_CLUSTER_WON);
+    cb(oldest->event);
+  }
+}
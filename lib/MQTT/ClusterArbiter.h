@@ -0,0 +1,110 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef CLUSTERARBITER_H
+#define CLUSTERARBITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+
+#include <RfEvent.h>
+
+// Events held until the arbitration is decided
+#ifndef MQTT_CLUSTER_PENDING
+#define MQTT_CLUSTER_PENDING 4
+#endif
+
+// Claims of other gateways remembered for frames not received yet
+#ifndef MQTT_CLUSTER_CLAIMS
+#define MQTT_CLUSTER_CLAIMS 16
+#endif
+
+// ms a remembered claim is valid
+#ifndef MQTT_CLUSTER_CLAIM_WINDOW
+#define MQTT_CLUSTER_CLAIM_WINDOW 1000
+#endif
+
+// A gateway's claim to publish a frame
+struct ClusterClaim {
+  uint32_t hash;  // of protocol, deviceID and message
+  uint32_t rank;  // of hash and gateway name, the lowest wins
+};
+
+// Arbitration between gateways that receive the same RF frames.  A
+// received event is held for the holdoff time while its claim is
+// announced to the other gateways.  The rank of a claim is a hash of
+// the frame and the gateway name, so every gateway computes the same
+// winner for a frame, and the frames spread evenly over the gateways.
+// A held event is dropped as soon as a claim with a lower rank for
+// the same frame is seen.  Lost claims only cause duplicates, never
+// lost frames.
+class ClusterArbiter {
+ public:
+  enum Result { HELD, YIELDED, FULL };
+  using ReleaseCb = std::function<void(const RfEvent &event)>;
+
+  ClusterArbiter();
+  ~ClusterArbiter();
+
+  static ClusterClaim claimOf(const RfEvent &event, const char *name);
+
+  // FULL: publish the event without arbitration.  YIELDED: another
+  // gateway already claimed it with a lower rank.
+  Result hold(const RfEvent &event, const ClusterClaim &claim,
+              unsigned long now);
+  // For every claim received, including the own ones
+  void onClaim(const ClusterClaim &claim, unsigned long now);
+  // Pass the won events held for at least holdoff ms to cb
+  void release(unsigned long now, unsigned long holdoff,
+               const ReleaseCb &cb);
+
+  bool empty() const { return count == 0; }
+
+ private:
+  struct Held {
+    RfEvent event;
+    ClusterClaim claim;
+    unsigned long since;
+    bool lost;
+    bool used;
+  };
+  struct Seen {
+    ClusterClaim claim;
+    unsigned long time;
+  };
+
+  Held held[MQTT_CLUSTER_PENDING];
+  size_t count;
+  Seen seen[MQTT_CLUSTER_CLAIMS];
+  size_t seenHead;
+};
+
+#endif  // CLUSTERARBITER_H
@@ -0,0 +1,90 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "InFlightWindow.h"
+
+InFlightWindow::InFlightWindow() : count(0) {
+  for (auto &message : messages) {
+    message.used = false;
+  }
+}
+
+InFlightWindow::~InFlightWindow() = default;
+
+InFlightMessage *InFlightWindow::add(const RfEvent &event,
+                                     unsigned long age) {
+  for (auto &message : messages) {
+    if (!message.used) {
+      message.event = event;
+      message.age = age;
+      message.firstSent = 0;
+      message.lastSent = 0;
+      message.packetId = 0;
+      message.retries = 0;
+      message.used = true;
+      count++;
+      return &message;
+    }
+  }
+  return nullptr;
+}
+
+InFlightMessage *InFlightWindow::find(uint16_t packetId) {
+  for (auto &message : messages) {
+    if (message.used && message.packetId == packetId) {
+      return &message;
+    }
+  }
+  return nullptr;
+}
+
+void InFlightWindow::remove(InFlightMessage *message) {
+  if (message->used) {
+    message->used = false;
+    count--;
+  }
+}
+
+InFlightMessage *InFlightWindow::expired(unsigned long now,
+                                         unsigned long timeout) {
+  InFlightMessage *oldest = nullptr;
+  for (auto &message : messages) {
+    if (message.used && (now - message.lastSent) > timeout &&
+        (!oldest || (now - message.firstSent) > (now - oldest->firstSent))) {
+      oldest = &message;
+    }
+  }
+  return oldest;
+}
+
+void InFlightWindow::expireAll(unsigned long now, unsigned long timeout) {
+  for (auto &message : messages) {
+    message.lastSent = now - timeout - 1;
+  }
+}
@@ -0,0 +1,80 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INFLIGHTWINDOW_H
+#define INFLIGHTWINDOW_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <RfEvent.h>
+
+#ifndef MQTT_INFLIGHT_WINDOW
+#define MQTT_INFLIGHT_WINDOW 4
+#endif
+
+// QoS 1 publish, kept until the broker acknowledged it
+struct InFlightMessage {
+  RfEvent event;
+  unsigned long age;  // age of the event on the first attempt
+  unsigned long firstSent;
+  unsigned long lastSent;
+  uint16_t packetId;
+  uint8_t retries;
+  bool used;
+};
+
+// Fixed size set of unacknowledged QoS 1 publishes.  Several messages
+// can be outstanding at once, so publishing does not wait for each
+// PUBACK.
+class InFlightWindow {
+ public:
+  InFlightWindow();
+  ~InFlightWindow();
+
+  // Returns nullptr if the window is full
+  InFlightMessage *add(const RfEvent &event, unsigned long age);
+  // Returns nullptr for an unknown packet id
+  InFlightMessage *find(uint16_t packetId);
+  void remove(InFlightMessage *message);
+  // Oldest message last sent more than timeout ms ago, or nullptr
+  InFlightMessage *expired(unsigned long now, unsigned long timeout);
+  // Make all messages due for retransmission, e.g. after a reconnect
+  void expireAll(unsigned long now, unsigned long timeout);
+
+  size_t size() const { return count; }
+  bool full() const { return count == MQTT_INFLIGHT_WINDOW; }
+  bool empty() const { return count == 0; }
+
+ private:
+  InFlightMessage messages[MQTT_INFLIGHT_WINDOW];
+  size_t count;
+};
+
+#endif  // INFLIGHTWINDOW_H
@@ -27,8 +27,13 @@
   SOFTWARE.
 */
 
+#include <algorithm>
+
 #include <ArduinoSimpleLogging.h>
 
+#include <LogPipeline.h>
+#include <Metrics.h>
+
 #include <Version.h>
 
 #include "MqttClient.h"
@@ -44,16 +49,36 @@ class PayloadString : public String {
   }
 };
 
-MqttClient::MqttClient(const Settings &settings, WiFiClient &client)
-    : settings(settings), mqttClient(client), lastConnectAttempt(0) {}
+MqttClient::MqttClient(const Settings &settings, WiFiClient &client,
+                       RfEventStore &offlineStore)
+    : settings(settings),
+      offlineStore(offlineStore),
+      lastConnectAttempt(0),
+      connectBackoff(MQTT_CONNECTION_ATTEMPT_DELAY),
+      connectDelay(0),
+      wasConnected(false),
+      connectPending(false),
+      lastMetricsPublish(0) {
+  if (settings.mqttAsync) {
+    mqttClient.emplace<AsyncMqttTransport>();
+  } else {
+    mqttClient.emplace<PubSubTransport>(client);
+  }
+}
 
-MqttClient::~MqttClient() { mqttClient.disconnect(); }
+MqttClient::~MqttClient() { mqttClient->disconnect(); }
 
 void MqttClient::begin() {
   using namespace std::placeholders;
-  mqttClient.setServer(settings.mqttBroker.c_str(), settings.mqttBrokerPort);
+  mqttClient->setServer(settings.mqttBroker.c_str(), settings.mqttBrokerPort);
 
-  mqttClient.setCallback(std::bind(&MqttClient::onMessage, this, _1, _2, _3));
+  mqttClient->setCallback(std::bind(&MqttClient::onMessage, this, _1, _2, _3));
+  mqttClient->setAckCallback(std::bind(&MqttClient::onAck, this, _1));
+  if (!mqttClient->supportsQos1() && settings.mqttQosProtocols.length() > 0) {
+    Logger.warning.println(
+        F("QoS 1 needs the non-blocking MQTT client, publish with QoS 0"));
+  }
+  checkBatchCapacity();
 
   reconnect();
 }
@@ -63,62 +88,190 @@ static String stateMessage(const bool online) {
 }
 
 bool MqttClient::connect() {
-  if (0 == settings.mqttUser.length()) {
-    return mqttClient.connect(settings.deviceName.c_str(),
-                              settings.mqttStateTopic.c_str(), 0, true,
-                              stateMessage(false).c_str());
-  } else {
-    return mqttClient.connect(
-        settings.deviceName.c_str(), settings.mqttUser.c_str(),
-        settings.mqttPassword.c_str(), settings.mqttStateTopic.c_str(), 0, true,
-        stateMessage(false).c_str());
-  }
+  return mqttClient->connect(
+      settings.deviceName.c_str(), settings.mqttUser.c_str(),
+      settings.mqttPassword.c_str(), settings.mqttStateTopic.c_str(),
+      stateMessage(false).c_str());
 }
 
 void MqttClient::reconnect() {
+  if (mqttClient->connected()) {
+    if (!wasConnected) {
+      onConnected();
+    }
+    return;
+  }
+  if (wasConnected) {
+    wasConnected = false;
+    Logger.warning.println(F("MQTT connection lost."));
+    scheduleConnect();
+    return;
+  }
+  if (mqttClient->connecting()) {
+    return;
+  }
+  if (connectPending) {
+    // background connect of the asynchronous backend failed
+    onConnectFailed();
+    return;
+  }
   if (lastConnectAttempt > 0 &&
-      (millis() - lastConnectAttempt) < MQTT_CONNECTION_ATTEMPT_DELAY) {
+      (millis() - lastConnectAttempt) < connectDelay) {
     return;
   }
 
-  if (!mqttClient.connected()) {
-    Logger.debug.println(F("Try to (re)connect to MQTT broker"));
-    if (connect()) {
-      Logger.info.println(F("MQTT connected."));
-      if (subsrcibe()) {
-        mqttClient.publish(settings.mqttStateTopic.c_str(),
-                           stateMessage(true).c_str(), true);
-        mqttClient.publish(settings.mqttVersionTopic.c_str(),
-                           fwJsonVersion(false).c_str(), true);
-        Logger.info.println(F("MQTT subscribed."));
-      } else {
-        Logger.error.println(F("MQTT subsrcibe failed!"));
-      }
-    } else {
-      Logger.error.println(F("MQTT connect failed!"));
-    }
+  Logger.debug.println(F("Try to (re)connect to MQTT broker"));
+  if (connect()) {
+    onConnected();
+  } else if (mqttClient->connecting()) {
+    connectPending = true;
+  } else {
+    onConnectFailed();
   }
+}
 
+void MqttClient::scheduleConnect() {
+  // Half fixed, half random delay, so that gateways do not reconnect in
+  // lockstep after a broker restart
+  connectDelay = connectBackoff / 2 + random(connectBackoff / 2 + 1);
   lastConnectAttempt = millis();
 }
 
+void MqttClient::onConnected() {
+  wasConnected = true;
+  connectPending = false;
+  connectBackoff = MQTT_CONNECTION_ATTEMPT_DELAY;
+  // unacknowledged messages are sent again on the new connection
+  inFlight.expireAll(millis(), MQTT_RETRANSMIT_TIMEOUT);
+  Metrics.inc(METRIC_MQTT_CONNECTS);
+  Logger.info.println(F("MQTT connected."));
+  connectedStateTopic = settings.mqttStateTopic;
+  if (subsrcibe()) {
+    mqttClient->publish(settings.mqttStateTopic.c_str(),
+                        stateMessage(true).c_str(), true);
+    publishVersion();
+    Logger.info.println(F("MQTT subscribed."));
+  } else {
+    Logger.error.println(F("MQTT subsrcibe failed!"));
+  }
+}
+
+void MqttClient::onConnectFailed() {
+  connectPending = false;
+  Metrics.inc(METRIC_MQTT_CONNECT_FAILED);
+  scheduleConnect();
+  connectBackoff =
+      std::min<unsigned long>(connectBackoff * 2,
+                               MQTT_CONNECTION_ATTEMPT_MAX_DELAY);
+  Logger.error.print(F("MQTT connect failed, retry in "));
+  Logger.error.print(connectDelay);
+  Logger.error.println(F(" ms"));
+}
+
 bool MqttClient::subsrcibe() {
   String topic = settings.mqttSendTopic + "+";
 
   Logger.debug.print(F("MQTT subscribe to topic: "));
   Logger.debug.println(topic);
 
-  return mqttClient.subscribe(topic.c_str());
+  if (!mqttClient->subscribe(topic.c_str())) {
+    return false;
+  }
+
+  topic = settings.mqttSendTopic + FPSTR(MQTT_CODE_TOPIC) + "+";
+  Logger.debug.print(F("MQTT subscribe to topic: "));
+  Logger.debug.println(topic);
+
+  if (!mqttClient->subscribe(topic.c_str())) {
+    return false;
+  }
+  subscribedSendTopic = settings.mqttSendTopic;
+  return subscribeCluster();
+}
+
+bool MqttClient::subscribeCluster() {
+  subscribedClusterTopic = settings.clusterTopic;
+  if (!clustering()) {
+    return true;
+  }
+  Logger.debug.print(F("MQTT subscribe to topic: "));
+  Logger.debug.println(settings.clusterTopic);
+  return mqttClient->subscribe(settings.clusterTopic.c_str());
+}
+
+void MqttClient::unsubscribe(const String &sendTopic) {
+  String topic = sendTopic + "+";
+  mqttClient->unsubscribe(topic.c_str());
+  topic = sendTopic + FPSTR(MQTT_CODE_TOPIC) + "+";
+  mqttClient->unsubscribe(topic.c_str());
+}
+
+void MqttClient::publishVersion() {
+  mqttClient->publish(settings.mqttVersionTopic.c_str(),
+                      fwJsonVersion(false).c_str(), true);
+  publishedVersionTopic = settings.mqttVersionTopic;
+}
+
+void MqttClient::updateTopics() {
+  checkBatchCapacity();
+  if (!mqttClient->connected()) {
+    // the next connect uses the new topics
+    return;
+  }
+  if (settings.mqttStateTopic != connectedStateTopic) {
+    // The last will is bound to the connection
+    Logger.info.println(F("MQTT state topic changed, reconnect."));
+    mqttClient->publish(connectedStateTopic.c_str(),
+                        stateMessage(false).c_str(), true);
+    mqttClient->disconnect();
+    wasConnected = false;
+    lastConnectAttempt = 0;
+    return;
+  }
+  if (settings.mqttSendTopic != subscribedSendTopic) {
+    unsubscribe(subscribedSendTopic);
+    if (!subsrcibe()) {
+      Logger.error.println(F("MQTT subsrcibe failed!"));
+    }
+  }
+  if (settings.clusterTopic != subscribedClusterTopic) {
+    if (subscribedClusterTopic.length() > 0) {
+      mqttClient->unsubscribe(subscribedClusterTopic.c_str());
+    }
+    if (!subscribeCluster()) {
+      Logger.error.println(F("MQTT subsrcibe failed!"));
+    }
+  }
+  if (settings.mqttVersionTopic != publishedVersionTopic) {
+    publishVersion();
+  }
 }
 
 void MqttClient::loop() {
   reconnect();
-  mqttClient.loop();
+  cluster.release(millis(), settings.clusterHoldoff,
+                  [this](const RfEvent &event) { deliver(event); });
+  if (mqttClient->connected()) {
+    retransmit();
+    if (!batch.empty() &&
+        (!batching() ||
+         (millis() - batch.started()) >= settings.mqttBatchInterval)) {
+      flushBatch();
+    }
+    replayOfflineEvents();
+    publishMetrics();
+  }
+  mqttClient->loop();
 }
 
 void MqttClient::onMessage(char *topic, uint8_t *payload, unsigned int length) {
+  if (clustering() && settings.clusterTopic == topic) {
+    onClaim(payload, length);
+    return;
+  }
   PayloadString strPayload(payload, length);
   String strTopic(topic);
+  Metrics.inc(METRIC_MQTT_RECEIVED);
 
   Logger.debug.print(F("New MQTT message: "));
   Logger.debug.print(strTopic);
@@ -126,8 +279,20 @@ void MqttClient::onMessage(char *topic, uint8_t *payload, unsigned int length) {
   Logger.debug.println(strPayload);
 
   if (strTopic.startsWith(settings.mqttSendTopic)) {
-    if (onRfDataCallback) {
-      onRfDataCallback(String(topic + settings.mqttSendTopic.length()),
+    const char *topicPart = topic + settings.mqttSendTopic.length();
+    size_t codeTopicLength = strlen_P(MQTT_CODE_TOPIC);
+    if (strncmp_P(topicPart, MQTT_CODE_TOPIC, codeTopicLength) == 0) {
+      if (onCodeCallback) {
+        onCodeCallback(String(topicPart + codeTopicLength));
+      }
+    } else if (strcmp_P(topicPart, MQTT_OTA_TOPIC) == 0) {
+      if (!settings.mqttOta) {
+        Logger.warning.println(F("MQTT update request ignored, see mqttOta"));
+      } else if (onOtaCallback) {
+        onOtaCallback(strPayload);
+      }
+    } else if (onRfDataCallback) {
+      onRfDataCallback(String(topicPart),
                        strPayload);
     }
   }
@@ -137,16 +302,419 @@ void MqttClient::registerRfDataHandler(const MqttClient::RfDataCb &cb) {
   onRfDataCallback = cb;
 }
 
-void MqttClient::publishCode(const String &protocol, const String &payload) {
-  String topic = settings.mqttReceiveTopic + protocol;
+bool MqttClient::publishCode(const RfEvent &event) {
+  if (clustering() && mqttClient->connected()) {
+    ClusterClaim claim =
+        ClusterArbiter::claimOf(event, settings.deviceName.c_str());
+    switch (cluster.hold(event, claim, millis())) {
+      case ClusterArbiter::HELD:
+        publishClaim(claim);
+        return true;
+      case ClusterArbiter::YIELDED:
+        if (Logs.enabled(Logger.DEBUG)) {
+          Logger.debug.print(F("Frame published by another gateway: "));
+          Logger.debug.println(event.message);
+        }
+        return true;
+      case ClusterArbiter::FULL:
+        break;
+    }
+  }
+  return deliver(event);
+}
 
-  Logger.debug.print(F("Publish MQTT message: "));
-  Logger.debug.print(topic);
-  Logger.debug.print(F(" retain="));
-  Logger.debug.print(settings.mqttRetain);
-  Logger.debug.print(F(" .. "));
-  Logger.debug.println(payload);
-  mqttClient.publish(topic.c_str(), payload.c_str(), settings.mqttRetain);
+// Claims are "<hash> <rank> <deviceName>", hash and rank as 8 hex digits
+void MqttClient::publishClaim(const ClusterClaim &claim) {
+  char payload[18 + MQTT_TOPIC_BUFFER_SIZE];
+  int length = snprintf(payload, sizeof(payload), "%08x %08x %s",
+                        static_cast<unsigned>(claim.hash),
+                        static_cast<unsigned>(claim.rank),
+                        settings.deviceName.c_str());
+  mqttClient->publish(settings.clusterTopic.c_str(),
+                      reinterpret_cast<const uint8_t *>(payload),
+                      std::min<size_t>(length, sizeof(payload) - 1), false);
+}
+
+void MqttClient::onClaim(const uint8_t *payload, unsigned int length) {
+  char buffer[18];
+  if (length < sizeof(buffer) - 1) {
+    return;
+  }
+  memcpy(buffer, payload, sizeof(buffer) - 1);
+  buffer[sizeof(buffer) - 1] = '\0';
+  char *end;
+  ClusterClaim claim;
+  claim.hash = strtoul(buffer, &end, 16);
+  if (end != buffer + 8) {
+    return;
+  }
+  claim.rank = strtoul(end, &end, 16);
+  if (end != buffer + 17) {
+    return;
+  }
+  cluster.onClaim(claim, millis());
+}
+
+bool MqttClient::deliver(const RfEvent &event) {
+  // Keep the order: as long as stored events are pending, queue behind them
+  if (!mqttClient->connected() || !offlineStore.empty()) {
+    if (Logs.enabled(Logger.DEBUG)) {
+      Logger.debug.print(F("MQTT not available, store message for protocol "));
+      Logger.debug.println(event.protocol);
+    }
+    return store(event);
+  }
+  if (useQos1(event)) {
+    if (inFlight.full() || !publishReliable(event, 0)) {
+      // must not get lost, publish it in order later
+      Logger.debug.println(F("MQTT QoS 1 window full, store message"));
+      return store(event);
+    }
+    return true;
+  }
+  if (batching()) {
+    if (!addToBatch(event, 0)) {
+      return store(event);
+    }
+    return true;
+  }
+  return publishEvent(event, 0);
+}
+
+bool MqttClient::store(const RfEvent &event) {
+  // a dropped event is counted by the store
+  if (!offlineStore.push(event)) {
+    return false;
+  }
+  Metrics.inc(METRIC_MQTT_STORED);
+  return true;
+}
+
+long MqttClient::batchCapacity() const {
+  size_t topicLength =
+      settings.mqttReceiveTopic.length() + strlen_P(MQTT_BATCH_TOPIC);
+  if (topicLength >= sizeof(topicBuffer)) {
+    // see batchTopic()
+    return 0;
+  }
+  // PubSubClient limit for the whole packet
+  return static_cast<long>(MQTT_MAX_PACKET_SIZE) - 5 - 2 -
+         static_cast<long>(topicLength);
+}
+
+void MqttClient::checkBatchCapacity() {
+  if (settings.mqttBatchInterval > 0 && batchCapacity() <= 0) {
+    Logger.warning.println(
+        F("MQTT receive topic too long for batches, batching disabled"));
+  }
+}
+
+bool MqttClient::addToBatch(const RfEvent &event, unsigned long age) {
+  size_t capacity = static_cast<size_t>(batchCapacity());
+  if (!batch.add(event, age, capacity)) {
+    if (batch.empty()) {
+      // too large for a batch on its own
+      return publishEvent(event, age);
+    }
+    if (!flushBatch()) {
+      return false;
+    }
+    if (!batch.add(event, age, capacity)) {
+      return publishEvent(event, age);
+    }
+  }
+  if (batch.size() >= settings.mqttBatchSize) {
+    // the batch stays for the next loop on failure
+    flushBatch();
+  }
+  return true;
+}
+
+bool MqttClient::flushBatch() {
+  const char *topic = batchTopic();
+  if (topic == nullptr) {
+    // the topic changed while the batch was collected, do not retry
+    Metrics.inc(METRIC_MQTT_PUBLISH_FAILED);
+    batch.clear();
+    return true;
+  }
+  const char *payload = batch.payload();
+  if (Logs.enabled(Logger.DEBUG)) {
+    Logger.debug.print(F("Publish MQTT batch: "));
+    Logger.debug.print(topic);
+    Logger.debug.print(F(" .. "));
+    Logger.debug.println(payload);
+  }
+  if (!mqttClient->publish(topic, reinterpret_cast<const uint8_t *>(payload),
+                           batch.length(), settings.mqttRetain)) {
+    Metrics.inc(METRIC_MQTT_PUBLISH_FAILED);
+    return false;
+  }
+  Metrics.inc(METRIC_MQTT_PUBLISHED);
+  Metrics.inc(METRIC_MQTT_BATCHED, batch.size());
+  batch.clear();
+  return true;
+}
+
+static bool listContains(const String &list, const char *name) {
+  size_t length = strlen(name);
+  const char *pos = list.c_str();
+  while (*pos) {
+    while (*pos == ' ') {
+      pos++;
+    }
+    const char *end = strchr(pos, ',');
+    size_t itemLength = end ? end - pos : strlen(pos);
+    while (itemLength > 0 && pos[itemLength - 1] == ' ') {
+      itemLength--;
+    }
+    if (itemLength == length && strncmp(pos, name, length) == 0) {
+      return true;
+    }
+    if (!end) {
+      break;
+    }
+    pos = end + 1;
+  }
+  return false;
+}
+
+bool MqttClient::useQos1(const RfEvent &event) {
+  return mqttClient->supportsQos1() &&
+         listContains(settings.mqttQosProtocols, event.protocol);
+}
+
+bool MqttClient::publishReliable(const RfEvent &event, unsigned long age) {
+  InFlightMessage *message = inFlight.add(event, age);
+  if (message == nullptr) {
+    return false;
+  }
+  message->firstSent = millis();
+  if (!sendInFlight(*message)) {
+    inFlight.remove(message);
+    return false;
+  }
+  return true;
+}
+
+bool MqttClient::sendInFlight(InFlightMessage &message) {
+  uint16_t packetId = message.packetId;
+  if (!publishEvent(message.event, message.age, &packetId)) {
+    return false;
+  }
+  if (packetId == 0) {
+    // dropped by publishEvent(), nothing to acknowledge
+    inFlight.remove(&message);
+    return true;
+  }
+  message.packetId = packetId;
+  message.lastSent = millis();
+  return true;
+}
+
+void MqttClient::retransmit() {
+  // at most one message per loop, the others are due in the next loops
+  InFlightMessage *message =
+      inFlight.expired(millis(), MQTT_RETRANSMIT_TIMEOUT);
+  if (message == nullptr) {
+    return;
+  }
+  if (message->retries >= MQTT_RETRANSMIT_LIMIT) {
+    Logger.error.print(F("MQTT message not acknowledged, dropped: "));
+    Logger.error.println(message->event.protocol);
+    Metrics.inc(METRIC_MQTT_UNACKED);
+    inFlight.remove(message);
+    return;
+  }
+  Logger.debug.print(F("MQTT retransmit message "));
+  Logger.debug.println(message->packetId);
+  if (sendInFlight(*message)) {
+    message->retries++;
+    Metrics.inc(METRIC_MQTT_RETRIES);
+  }
+}
+
+void MqttClient::onAck(uint16_t packetId) {
+  InFlightMessage *message = inFlight.find(packetId);
+  if (message == nullptr) {
+    Logger.debug.print(F("MQTT PUBACK for unknown message "));
+    Logger.debug.println(packetId);
+    return;
+  }
+  unsigned long latency = millis() - message->firstSent;
+  Metrics.inc(METRIC_MQTT_ACKED);
+  Metrics.set(METRIC_MQTT_ACK_LATENCY, latency);
+  if (latency > Metrics.get(METRIC_MQTT_ACK_LATENCY_MAX)) {
+    Metrics.set(METRIC_MQTT_ACK_LATENCY_MAX, latency);
+  }
+  inFlight.remove(message);
+}
+
+void MqttClient::replayOfflineEvents() {
+  for (size_t i = 0; i < MQTT_OFFLINE_REPLAY; ++i) {
+    const RfEvent *event = offlineStore.front();
+    if (event == nullptr) {
+      return;
+    }
+    unsigned long age = millis() - event->timestamp;
+    bool published;
+    if (useQos1(*event)) {
+      if (inFlight.full()) {
+        // continue once a message is acknowledged
+        return;
+      }
+      published = publishReliable(*event, age);
+    } else if (batching()) {
+      published = addToBatch(*event, age);
+    } else {
+      published = publishEvent(*event, age);
+    }
+    if (!published) {
+      // try again later
+      return;
+    }
+    offlineStore.pop();
+    if (offlineStore.empty()) {
+      Logger.info.println(F("All stored messages published."));
+    }
+  }
+}
+
+void MqttClient::publishMetrics() {
+  if (settings.mqttMetricsInterval == 0 ||
+      (lastMetricsPublish > 0 &&
+       (millis() - lastMetricsPublish) <
+           settings.mqttMetricsInterval * 1000UL)) {
+    return;
+  }
+  lastMetricsPublish = millis();
+  if (!publishStatus(F("metrics"), Metrics.toJson(), true)) {
+    Logger.warning.println(F("MQTT publish of metrics failed!"));
+  }
+}
+
+const char *MqttClient::batchTopic() {
+  size_t prefixLength = settings.mqttReceiveTopic.length();
+  size_t suffixLength = strlen_P(MQTT_BATCH_TOPIC);
+  if (prefixLength + suffixLength >= sizeof(topicBuffer)) {
+    Logger.error.println(F("MQTT topic too long for batches"));
+    return nullptr;
+  }
+  memcpy(topicBuffer, settings.mqttReceiveTopic.c_str(), prefixLength);
+  strcpy_P(topicBuffer + prefixLength, MQTT_BATCH_TOPIC);
+  return topicBuffer;
+}
+
+const char *MqttClient::receiveTopic(const RfEvent &event) {
+  size_t prefixLength = settings.mqttReceiveTopic.length();
+  size_t protocolLength = strlen(event.protocol);
+  size_t deviceIDLength = strlen(event.deviceID);
+  size_t length = prefixLength + protocolLength +
+                  (event.hasDeviceID() ? deviceIDLength + 1 : 0);
+  if (length >= sizeof(topicBuffer)) {
+    Logger.error.print(F("MQTT topic too long for protocol "));
+    Logger.error.println(event.protocol);
+    return nullptr;
+  }
+
+  char *pos = topicBuffer;
+  memcpy(pos, settings.mqttReceiveTopic.c_str(), prefixLength);
+  pos += prefixLength;
+  memcpy(pos, event.protocol, protocolLength);
+  pos += protocolLength;
+  if (event.hasDeviceID()) {
+    *pos++ = '/';
+    memcpy(pos, event.deviceID, deviceIDLength);
+    pos += deviceIDLength;
+  }
+  *pos = '\0';
+  return topicBuffer;
+}
+
+bool MqttClient::countPublish(const RfEvent &event, bool published) {
+  Metrics.inc(published ? METRIC_MQTT_PUBLISHED : METRIC_MQTT_PUBLISH_FAILED);
+  if (published && onPublishCallback) {
+    onPublishCallback(event);
+  }
+  return published;
+}
+
+bool MqttClient::publishEvent(const RfEvent &event, unsigned long age,
+                              uint16_t *packetId) {
+  const char *topic = receiveTopic(event);
+  if (topic == nullptr) {
+    // cannot be published at all, do not retry
+    Metrics.inc(METRIC_MQTT_PUBLISH_FAILED);
+    return true;
+  }
+
+  if (Logs.enabled(Logger.DEBUG)) {
+    Logger.debug.print(F("Publish MQTT message: "));
+    Logger.debug.print(topic);
+    Logger.debug.print(F(" retain="));
+    Logger.debug.print(settings.mqttRetain);
+    if (age > 0) {
+      Logger.debug.print(F(" age="));
+      Logger.debug.print(age);
+    }
+    Logger.debug.print(F(" .. "));
+    Logger.debug.println(event.message);
+  }
+
+  size_t messageLength = strlen(event.message);
+  bool injectAge = age > 0 && event.message[0] == '{';
+  if (!injectAge && packetId == nullptr) {
+    bool published = mqttClient->publish(
+        topic, reinterpret_cast<const uint8_t *>(event.message), messageLength,
+        settings.mqttRetain);
+    return countPublish(event, published);
+  }
+
+  // Delayed message: inject the age (in ms) as first JSON member
+  char prefix[24];
+  const char *body = event.message;
+  size_t prefixLength = 0;
+  if (injectAge) {
+    body++;
+    prefixLength = snprintf(prefix, sizeof(prefix), "{\"age\":%lu%s", age,
+                            body[0] == '}' ? "" : ",");
+  }
+  size_t bodyLength = messageLength - (body - event.message);
+  size_t length = prefixLength + bodyLength;
+  if (packetId != nullptr) {
+    *packetId = mqttClient->beginPublishQos1(topic, length,
+                                             settings.mqttRetain, *packetId);
+    if (*packetId == 0) {
+      return countPublish(event, false);
+    }
+  } else if (!mqttClient->beginPublish(topic, length, settings.mqttRetain)) {
+    return countPublish(event, false);
+  }
+  mqttClient->write(reinterpret_cast<const uint8_t *>(prefix), prefixLength);
+  mqttClient->write(reinterpret_cast<const uint8_t *>(body), bodyLength);
+  return countPublish(event, mqttClient->endPublish());
+}
+
+bool MqttClient::publishStatus(const __FlashStringHelper *name,
+                               const String &payload, bool retain) {
+  return publishStatus(name,
+                       reinterpret_cast<const uint8_t *>(payload.c_str()),
+                       payload.length(), retain);
+}
+
+bool MqttClient::publishStatus(const __FlashStringHelper *name,
+                               const uint8_t *payload, size_t length,
+                               bool retain) {
+  if (!mqttClient->connected()) {
+    return false;
+  }
+  String topic = settings.mqttStateTopic + '/' + name;
+  // streamed, as status documents may exceed MQTT_MAX_PACKET_SIZE
+  if (!mqttClient->beginPublish(topic.c_str(), length, retain)) {
+    return false;
+  }
+  mqttClient->write(payload, length);
+  return mqttClient->endPublish();
 }
 
-bool MqttClient::isConnected() { return mqttClient.connected(); }
+bool MqttClient::isConnected() { return mqttClient->connected(); }
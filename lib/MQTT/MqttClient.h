@@ -33,39 +33,146 @@
 #include <WString.h>
 #include <WiFiClient.h>
 
-#include <PubSubClient.h>
-
+#include <RfEvent.h>
+#include <RfEventStore.h>
 #include <Settings.h>
+#include <StaticSlot.h>
+
+#include "AsyncMqttTransport.h"
+#include "ClusterArbiter.h"
+#include "InFlightWindow.h"
+#include "MqttTransport.h"
+#include "PublishBatch.h"
+#include "PubSubTransport.h"
 
 #ifndef MQTT_CONNECTION_ATTEMPT_DELAY
 #define MQTT_CONNECTION_ATTEMPT_DELAY 5000
 #endif
 
+// Upper bound of the exponential reconnect backoff
+#ifndef MQTT_CONNECTION_ATTEMPT_MAX_DELAY
+#define MQTT_CONNECTION_ATTEMPT_MAX_DELAY 120000
+#endif
+
+// Sub topic of mqttSendTopic to trigger codes of the code library
+const char PROGMEM MQTT_CODE_TOPIC[] = "code/";
+// Sub topic of mqttSendTopic to start a pull update, if mqttOta is set
+const char PROGMEM MQTT_OTA_TOPIC[] = "ota";
+// Sub topic of mqttReceiveTopic for batched events
+const char PROGMEM MQTT_BATCH_TOPIC[] = "batch";
+
+#ifndef MQTT_TOPIC_BUFFER_SIZE
+#define MQTT_TOPIC_BUFFER_SIZE 128
+#endif
+
+// Time to wait for the PUBACK of a QoS 1 message before sending it again
+#ifndef MQTT_RETRANSMIT_TIMEOUT
+#define MQTT_RETRANSMIT_TIMEOUT 5000
+#endif
+
+#ifndef MQTT_RETRANSMIT_LIMIT
+#define MQTT_RETRANSMIT_LIMIT 5
+#endif
+
+#ifndef MQTT_OFFLINE_REPLAY
+#define MQTT_OFFLINE_REPLAY 2
+#endif
+
 class MqttClient {
  public:
   using RfDataCb =
       std::function<void(const String &topic_part, const String &payload)>;
+  using CodeCb = std::function<void(const String &name)>;
+  using OtaCb = std::function<void(const String &payload)>;
+  // Called after an event was handed to the broker connection
+  using PublishCb = std::function<void(const RfEvent &event)>;
 
-  MqttClient(const Settings &settings, WiFiClient &client);
+  MqttClient(const Settings &settings, WiFiClient &client,
+             RfEventStore &offlineStore);
   ~MqttClient();
   void begin();
   void loop();
   void registerRfDataHandler(const RfDataCb &cb);
+  void registerCodeHandler(const CodeCb &cb) { onCodeCallback = cb; }
+  void registerOtaHandler(const OtaCb &cb) { onOtaCallback = cb; }
+  void registerPublishHandler(const PublishCb &cb) { onPublishCallback = cb; }
 
   void reconnect();
-  void publishCode(const String &protocol, const String &payload);
+  // Apply changed topics without a new connection if possible
+  void updateTopics();
+  bool publishCode(const RfEvent &event);
+  // Publish to <mqttStateTopic>/<name>
+  bool publishStatus(const __FlashStringHelper *name, const String &payload,
+                     bool retain = false);
+  bool publishStatus(const __FlashStringHelper *name, const uint8_t *payload,
+                     size_t length, bool retain = false);
   bool isConnected();
 
  private:
   void onMessage(char *topic, uint8_t *payload, unsigned int length);
   bool connect();
+  void onConnected();
+  void onConnectFailed();
+  void scheduleConnect();
   bool subsrcibe();
+  void unsubscribe(const String &sendTopic);
+  void publishVersion();
+  bool subscribeCluster();
+  bool clustering() const { return settings.clusterTopic.length() > 0; }
+  void publishClaim(const ClusterClaim &claim);
+  void onClaim(const uint8_t *payload, unsigned int length);
+  // publishCode() after the cluster arbitration
+  bool deliver(const RfEvent &event);
+  bool store(const RfEvent &event);
+  const char *receiveTopic(const RfEvent &event);
+  const char *batchTopic();
+  // QoS 1 if packetId is given, see MqttTransport::beginPublishQos1()
+  bool publishEvent(const RfEvent &event, unsigned long age,
+                    uint16_t *packetId = nullptr);
+  bool countPublish(const RfEvent &event, bool published);
+  bool useQos1(const RfEvent &event);
+  bool publishReliable(const RfEvent &event, unsigned long age);
+  bool sendInFlight(InFlightMessage &message);
+  void retransmit();
+  void onAck(uint16_t packetId);
+  // Room for the batch payload, may be negative for long topics
+  long batchCapacity() const;
+  bool batching() const {
+    return settings.mqttBatchInterval > 0 && batchCapacity() > 0;
+  }
+  void checkBatchCapacity();
+  bool addToBatch(const RfEvent &event, unsigned long age);
+  bool flushBatch();
+  void replayOfflineEvents();
+  void publishMetrics();
 
   const Settings &settings;
   RfDataCb onRfDataCallback = nullptr;
-
-  PubSubClient mqttClient;
+  CodeCb onCodeCallback = nullptr;
+  OtaCb onOtaCallback = nullptr;
+  PublishCb onPublishCallback = nullptr;
+
+  StaticSlot<MqttTransport, (sizeof(AsyncMqttTransport) >
+                             sizeof(PubSubTransport)
+                                 ? sizeof(AsyncMqttTransport)
+                                 : sizeof(PubSubTransport))>
+      mqttClient;
+  RfEventStore &offlineStore;
+  InFlightWindow inFlight;
+  PublishBatch batch;
+  ClusterArbiter cluster;
   unsigned long lastConnectAttempt;
+  unsigned long connectBackoff;
+  unsigned long connectDelay;
+  bool wasConnected;
+  bool connectPending;
+  unsigned long lastMetricsPublish;
+  // Topics of the current connection
+  String subscribedSendTopic;
+  String connectedStateTopic;
+  String publishedVersionTopic;
+  String subscribedClusterTopic;
+  char topicBuffer[MQTT_TOPIC_BUFFER_SIZE];
 };
 
 #endif  // MQTTCLIENT_H
@@ -0,0 +1,86 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef MQTTTRANSPORT_H
+#define MQTTTRANSPORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <functional>
+
+// MQTT protocol backend used by MqttClient.
+class MqttTransport {
+ public:
+  using MessageCb =
+      std::function<void(char *topic, uint8_t *payload, unsigned int length)>;
+  using AckCb = std::function<void(uint16_t packetId)>;
+
+  virtual ~MqttTransport() = default;
+
+  virtual void setServer(const char *host, uint16_t port) = 0;
+  virtual void setCallback(const MessageCb &cb) = 0;
+  // Returns true if the connection is established.  Non-blocking
+  // backends return false and continue in the background, check
+  // connecting() and connected() in the next loops.
+  virtual bool connect(const char *id, const char *user, const char *password,
+                       const char *willTopic, const char *willMessage) = 0;
+  virtual bool connecting() { return false; }
+  virtual bool connected() = 0;
+  virtual void disconnect() = 0;
+  virtual void loop() = 0;
+
+  virtual bool subscribe(const char *topic) = 0;
+  virtual bool unsubscribe(const char *topic) = 0;
+  virtual bool publish(const char *topic, const uint8_t *payload,
+                       size_t length, bool retain) = 0;
+  bool publish(const char *topic, const char *payload, bool retain) {
+    return publish(topic, reinterpret_cast<const uint8_t *>(payload),
+                   strlen(payload), retain);
+  }
+  // Publish a message of the given length in several parts
+  virtual bool beginPublish(const char *topic, size_t length,
+                            bool retain) = 0;
+  virtual size_t write(const uint8_t *data, size_t length) = 0;
+  virtual bool endPublish() = 0;
+
+  // QoS 1 publishing, not available with all backends
+  virtual bool supportsQos1() { return false; }
+  virtual void setAckCallback(const AckCb &cb) {}
+  // Like beginPublish() with QoS 1.  Returns the packet id of the
+  // message or 0 on failure.  Pass the id of an earlier attempt to
+  // retransmit it with the DUP flag, or 0 for a new message.
+  virtual uint16_t beginPublishQos1(const char *topic, size_t length,
+                                    bool retain, uint16_t packetId) {
+    return 0;
+  }
+};
+
+#endif  // MQTTTRANSPORT_H
@@ -0,0 +1,77 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PUBSUBTRANSPORT_H
+#define PUBSUBTRANSPORT_H
+
+#include <WiFiClient.h>
+
+#include <PubSubClient.h>
+
+#include "MqttTransport.h"
+
+// Blocking backend based on PubSubClient
+class PubSubTransport : public MqttTransport {
+ public:
+  explicit PubSubTransport(WiFiClient &client) : client(client) {}
+  ~PubSubTransport() override = default;
+
+  void setServer(const char *host, uint16_t port) override {
+    client.setServer(host, port);
+  }
+  void setCallback(const MessageCb &cb) override { client.setCallback(cb); }
+  bool connect(const char *id, const char *user, const char *password,
+               const char *willTopic, const char *willMessage) override;
+  bool connected() override { return client.connected(); }
+  void disconnect() override { client.disconnect(); }
+  void loop() override { client.loop(); }
+
+  bool subscribe(const char *topic) override {
+    return client.subscribe(topic);
+  }
+  bool unsubscribe(const char *topic) override {
+    return client.unsubscribe(topic);
+  }
+  bool publish(const char *topic, const uint8_t *payload, size_t length,
+               bool retain) override {
+    return client.publish(topic, payload, length, retain);
+  }
+  bool beginPublish(const char *topic, size_t length, bool retain) override {
+    return client.beginPublish(topic, length, retain);
+  }
+  size_t write(const uint8_t *data, size_t length) override {
+    return client.write(data, length);
+  }
+  bool endPublish() override { return client.endPublish() == 1; }
+
+ private:
+  PubSubClient client;
+};
+
+#endif  // PUBSUBTRANSPORT_H
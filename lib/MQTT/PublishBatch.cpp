@@ -0,0 +1,112 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <Arduino.h>
+
+#include "PublishBatch.h"
+
+PublishBatch::PublishBatch() { clear(); }
+
+PublishBatch::~PublishBatch() = default;
+
+void PublishBatch::clear() {
+  buffer[0] = '[';
+  used = 1;
+  count = 0;
+  startTime = 0;
+}
+
+void PublishBatch::append(const char *data, size_t length) {
+  if (used + length > limit) {
+    // mark as overflowed, checked by add()
+    used = limit + 1;
+    return;
+  }
+  memcpy(buffer + used, data, length);
+  used += length;
+}
+
+void PublishBatch::appendString(const char *str) {
+  append("\"", 1);
+  for (const char *pos = str; *pos; ++pos) {
+    if (*pos == '"' || *pos == '\\') {
+      append("\\", 1);
+    }
+    append(pos, 1);
+  }
+  append("\"", 1);
+}
+
+bool PublishBatch::add(const RfEvent &event, unsigned long age,
+                       size_t capacity) {
+  if (capacity < 3) {
+    return false;
+  }
+  // keep one byte for the closing bracket and one for the terminator
+  limit = std::min(capacity, sizeof(buffer) - 1) - 1;
+  size_t before = used;
+
+  if (count > 0) {
+    append(",", 1);
+  }
+  append("{\"protocol\":", 12);
+  appendString(event.protocol);
+  if (event.hasDeviceID()) {
+    append(",\"deviceID\":", 12);
+    appendString(event.deviceID);
+  }
+  if (age > 0) {
+    char number[24];
+    append(number, snprintf(number, sizeof(number), ",\"age\":%lu", age));
+  }
+  append(",\"message\":", 11);
+  append(event.message, strlen(event.message));
+  append("}", 1);
+
+  if (used > limit) {
+    used = before;
+    return false;
+  }
+  if (count == 0) {
+    startTime = millis();
+  }
+  count++;
+  return true;
+}
+
+const char *PublishBatch::payload() {
+  buffer[used] = ']';
+  buffer[used + 1] = '\0';
+  return buffer;
+}
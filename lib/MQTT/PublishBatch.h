@@ -0,0 +1,73 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PUBLISHBATCH_H
+#define PUBLISHBATCH_H
+
+#include <stddef.h>
+
+// for MQTT_MAX_PACKET_SIZE
+#include <PubSubClient.h>
+
+#include <RfEvent.h>
+
+// Collects received events as JSON array to publish them with a single
+// message:
+// [{"protocol":"..","deviceID":"..","age":..,"message":{..}},..]
+// deviceID and age are only present if set.
+class PublishBatch {
+ public:
+  PublishBatch();
+  ~PublishBatch();
+
+  // Returns false if the entry does not fit into a payload of at most
+  // capacity bytes.
+  bool add(const RfEvent &event, unsigned long age, size_t capacity);
+  // The JSON array, valid until the next add() or clear()
+  const char *payload();
+  size_t length() const { return used + 1; }
+  void clear();
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  // millis() of the first entry
+  unsigned long started() const { return startTime; }
+
+ private:
+  void append(const char *data, size_t length);
+  void appendString(const char *str);
+
+  char buffer[MQTT_MAX_PACKET_SIZE];
+  size_t used;
+  size_t limit;
+  size_t count;
+  unsigned long startTime;
+};
+
+#endif  // PUBLISHBATCH_H
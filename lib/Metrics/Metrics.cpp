@@ -0,0 +1,164 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "Metrics.h"
+
+static const char PROGMEM NAME_RF_RECEIVED[] = "rfReceived";
+static const char PROGMEM NAME_RF_DUPLICATES[] = "rfDuplicates";
+static const char PROGMEM NAME_RF_DENIED[] = "rfDenied";
+static const char PROGMEM NAME_RF_UNCHANGED[] = "rfUnchanged";
+static const char PROGMEM NAME_RF_RATE_LIMITED[] = "rfRateLimited";
+static const char PROGMEM NAME_RF_QUEUE_DROPPED[] = "rfQueueDropped";
+static const char PROGMEM NAME_RULES_MATCHED[] = "rulesMatched";
+static const char PROGMEM NAME_RF_TRANSMITTED[] = "rfTransmitted";
+static const char PROGMEM NAME_RF_TRANSMIT_FAILED[] = "rfTransmitFailed";
+static const char PROGMEM NAME_RF_TRANSMIT_DROPPED[] = "rfTransmitDropped";
+static const char PROGMEM NAME_RF_TRANSMIT_COALESCED[] = "rfTransmitCoalesced";
+static const char PROGMEM NAME_RF_TRANSMIT_QUEUE_MAX[] = "rfTransmitQueueMax";
+static const char PROGMEM NAME_RF_TRANSMIT_LATENCY[] = "rfTransmitLatency";
+static const char PROGMEM NAME_RF_TRANSMIT_LATENCY_MAX[] =
+    "rfTransmitLatencyMax";
+static const char PROGMEM NAME_RF_CAPTURED[] = "rfCaptured";
+static const char PROGMEM NAME_RF_CAPTURE_DROPPED[] = "rfCaptureDropped";
+static const char PROGMEM NAME_MQTT_PUBLISHED[] = "mqttPublished";
+static const char PROGMEM NAME_MQTT_PUBLISH_FAILED[] = "mqttPublishFailed";
+static const char PROGMEM NAME_MQTT_STORED[] = "mqttStored";
+static const char PROGMEM NAME_MQTT_RECEIVED[] = "mqttReceived";
+static const char PROGMEM NAME_MQTT_CONNECTS[] = "mqttConnects";
+static const char PROGMEM NAME_MQTT_CONNECT_FAILED[] = "mqttConnectFailed";
+static const char PROGMEM NAME_MQTT_BATCHED[] = "mqttBatched";
+static const char PROGMEM NAME_MQTT_ACKED[] = "mqttAcked";
+static const char PROGMEM NAME_MQTT_RETRIES[] = "mqttRetries";
+static const char PROGMEM NAME_MQTT_UNACKED[] = "mqttUnacked";
+static const char PROGMEM NAME_MQTT_ACK_LATENCY[] = "mqttAckLatency";
+static const char PROGMEM NAME_MQTT_ACK_LATENCY_MAX[] = "mqttAckLatencyMax";
+static const char PROGMEM NAME_CLUSTER_CLAIMS[] = "clusterClaims";
+static const char PROGMEM NAME_CLUSTER_WON[] = "clusterWon";
+static const char PROGMEM NAME_CLUSTER_YIELDED[] = "clusterYielded";
+static const char PROGMEM NAME_WS_CLIENTS[] = "wsClients";
+static const char PROGMEM NAME_WS_CONNECTS[] = "wsConnects";
+static const char PROGMEM NAME_WS_EVENTS_SENT[] = "wsEventsSent";
+static const char PROGMEM NAME_WS_EVENTS_DROPPED[] = "wsEventsDropped";
+static const char PROGMEM NAME_HTTP_REQUESTS[] = "httpRequests";
+static const char PROGMEM NAME_HTTP_AUTH_FAILED[] = "httpAuthFailed";
+static const char PROGMEM NAME_LOAD_INJECTED[] = "loadInjected";
+static const char PROGMEM NAME_LOAD_PUBLISHED[] = "loadPublished";
+static const char PROGMEM NAME_LOAD_LOST[] = "loadLost";
+static const char PROGMEM NAME_LOAD_RATE[] = "loadRate";
+static const char PROGMEM NAME_LOAD_LATENCY[] = "loadLatency";
+static const char PROGMEM NAME_LOAD_LATENCY_MAX[] = "loadLatencyMax";
+static const char PROGMEM NAME_LOG_DROPPED[] = "logDropped";
+
+static const char *const METRIC_NAMES[METRIC_COUNT] = {
+    NAME_RF_RECEIVED,             NAME_RF_DUPLICATES,
+    NAME_RF_DENIED,               NAME_RF_UNCHANGED,
+    NAME_RF_RATE_LIMITED,         NAME_RF_QUEUE_DROPPED,
+    NAME_RULES_MATCHED,           NAME_RF_TRANSMITTED,
+    NAME_RF_TRANSMIT_FAILED,      NAME_RF_TRANSMIT_DROPPED,
+    NAME_RF_TRANSMIT_COALESCED,   NAME_RF_TRANSMIT_QUEUE_MAX,
+    NAME_RF_TRANSMIT_LATENCY,     NAME_RF_TRANSMIT_LATENCY_MAX,
+    NAME_RF_CAPTURED,             NAME_RF_CAPTURE_DROPPED,
+    NAME_MQTT_PUBLISHED,          NAME_MQTT_PUBLISH_FAILED,
+    NAME_MQTT_STORED,             NAME_MQTT_RECEIVED,
+    NAME_MQTT_CONNECTS,           NAME_MQTT_CONNECT_FAILED,
+    NAME_MQTT_BATCHED,            NAME_MQTT_ACKED,
+    NAME_MQTT_RETRIES,            NAME_MQTT_UNACKED,
+    NAME_MQTT_ACK_LATENCY,        NAME_MQTT_ACK_LATENCY_MAX,
+    NAME_CLUSTER_CLAIMS,          NAME_CLUSTER_WON,
+    NAME_CLUSTER_YIELDED,         NAME_WS_CLIENTS,
+    NAME_WS_CONNECTS,             NAME_WS_EVENTS_SENT,
+    NAME_WS_EVENTS_DROPPED,       NAME_HTTP_REQUESTS,
+    NAME_HTTP_AUTH_FAILED,        NAME_LOAD_INJECTED,
+    NAME_LOAD_PUBLISHED,          NAME_LOAD_LOST,
+    NAME_LOAD_RATE,               NAME_LOAD_LATENCY,
+    NAME_LOAD_LATENCY_MAX,        NAME_LOG_DROPPED};
+
+MetricsRegistry Metrics;
+
+MetricsRegistry::MetricsRegistry() {
+  memset(counters, 0, sizeof(counters));
+  memset(&received, 0, sizeof(received));
+  memset(&duplicates, 0, sizeof(duplicates));
+}
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+void MetricsRegistry::ProtocolTable::count(const char *protocol) {
+  for (size_t i = 0; i < used; ++i) {
+    if (strcmp(entries[i].name, protocol) == 0) {
+      entries[i].count++;
+      return;
+    }
+  }
+  if (used == METRICS_PROTOCOLS || strlen(protocol) >= METRICS_PROTOCOL_SIZE) {
+    other++;
+    return;
+  }
+  ProtocolCount &entry = entries[used++];
+  strcpy(entry.name, protocol);
+  entry.count = 1;
+}
+
+void MetricsRegistry::ProtocolTable::toJson(String &json) const {
+  json += '{';
+  for (size_t i = 0; i < used; ++i) {
+    json += '"';
+    json += entries[i].name;
+    json += F("\":");
+    json += entries[i].count;
+    json += ',';
+  }
+  json += F("\"other\":");
+  json += other;
+  json += '}';
+}
+
+String MetricsRegistry::toJson() const {
+  String json;
+  json.reserve(96 + METRIC_COUNT * 24 +
+               (received.used + duplicates.used) * 32);
+  json += F("{\"uptime\":");
+  json += millis() / 1000;
+  for (size_t metric = 0; metric < METRIC_COUNT; ++metric) {
+    json += F(",\"");
+    json += FPSTR(METRIC_NAMES[metric]);
+    json += F("\":");
+    json += counters[metric];
+  }
+  json += F(",\"protocols\":");
+  received.toJson(json);
+  json += F(",\"duplicates\":");
+  duplicates.toJson(json);
+  json += '}';
+  return json;
+}
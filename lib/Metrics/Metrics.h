@@ -0,0 +1,134 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <WString.h>
+
+#ifndef METRICS_PROTOCOLS
+#define METRICS_PROTOCOLS 16
+#endif
+
+#ifndef METRICS_PROTOCOL_SIZE
+#define METRICS_PROTOCOL_SIZE 24
+#endif
+
+enum Metric {
+  METRIC_RF_RECEIVED,
+  METRIC_RF_DUPLICATES,
+  METRIC_RF_DENIED,
+  METRIC_RF_UNCHANGED,
+  METRIC_RF_RATE_LIMITED,
+  METRIC_RF_QUEUE_DROPPED,
+  METRIC_RULES_MATCHED,
+  METRIC_RF_TRANSMITTED,
+  METRIC_RF_TRANSMIT_FAILED,
+  METRIC_RF_TRANSMIT_DROPPED,
+  METRIC_RF_TRANSMIT_COALESCED,
+  METRIC_RF_TRANSMIT_QUEUE_MAX,
+  METRIC_RF_TRANSMIT_LATENCY,
+  METRIC_RF_TRANSMIT_LATENCY_MAX,
+  METRIC_RF_CAPTURED,
+  METRIC_RF_CAPTURE_DROPPED,
+  METRIC_MQTT_PUBLISHED,
+  METRIC_MQTT_PUBLISH_FAILED,
+  METRIC_MQTT_STORED,
+  METRIC_MQTT_RECEIVED,
+  METRIC_MQTT_CONNECTS,
+  METRIC_MQTT_CONNECT_FAILED,
+  METRIC_MQTT_BATCHED,
+  METRIC_MQTT_ACKED,
+  METRIC_MQTT_RETRIES,
+  METRIC_MQTT_UNACKED,
+  METRIC_MQTT_ACK_LATENCY,
+  METRIC_MQTT_ACK_LATENCY_MAX,
+  METRIC_CLUSTER_CLAIMS,
+  METRIC_CLUSTER_WON,
+  METRIC_CLUSTER_YIELDED,
+  METRIC_WS_CLIENTS,
+  METRIC_WS_CONNECTS,
+  METRIC_WS_EVENTS_SENT,
+  METRIC_WS_EVENTS_DROPPED,
+  METRIC_HTTP_REQUESTS,
+  METRIC_HTTP_AUTH_FAILED,
+  METRIC_LOAD_INJECTED,
+  METRIC_LOAD_PUBLISHED,
+  METRIC_LOAD_LOST,
+  METRIC_LOAD_RATE,
+  METRIC_LOAD_LATENCY,
+  METRIC_LOAD_LATENCY_MAX,
+  METRIC_LOG_DROPPED,
+  METRIC_COUNT
+};
+
+// Fixed set of counters without any heap usage.  All updates happen
+// from the main loop, so plain integers are sufficient.
+class MetricsRegistry {
+ public:
+  MetricsRegistry();
+  ~MetricsRegistry();
+
+  void inc(Metric metric, uint32_t count = 1) { counters[metric] += count; }
+  // For gauges like the number of connected clients
+  void set(Metric metric, uint32_t value) { counters[metric] = value; }
+  uint32_t get(Metric metric) const { return counters[metric]; }
+
+  // Count a received or suppressed duplicate message per protocol.
+  // Further protocols are counted as "other" once the table is full.
+  void countProtocol(const char *protocol) { received.count(protocol); }
+  void countDuplicate(const char *protocol) { duplicates.count(protocol); }
+
+  String toJson() const;
+
+ private:
+  struct ProtocolCount {
+    char name[METRICS_PROTOCOL_SIZE];
+    uint32_t count;
+  };
+  struct ProtocolTable {
+    ProtocolCount entries[METRICS_PROTOCOLS];
+    size_t used;
+    uint32_t other;
+
+    void count(const char *protocol);
+    void toJson(String &json) const;
+  };
+
+  uint32_t counters[METRIC_COUNT];
+  ProtocolTable received;
+  ProtocolTable duplicates;
+};
+
+extern MetricsRegistry Metrics;
+
+#endif  // METRICS_H
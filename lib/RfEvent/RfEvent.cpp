@@ -0,0 +1,67 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "RfEvent.h"
+
+static bool copyString(char *target, size_t size, const char *source,
+                       size_t length) {
+  if (source == nullptr) {
+    target[0] = '\0';
+    return true;
+  }
+  if (length >= size) {
+    return false;
+  }
+  memcpy(target, source, length);
+  target[length] = '\0';
+  return true;
+}
+
+static bool copyString(char *target, size_t size, const char *source) {
+  return copyString(target, size, source, source ? strlen(source) : 0);
+}
+
+bool RfEvent::fits(const char *protocol, const char *deviceID,
+                   size_t messageLength) {
+  return (!protocol || strlen(protocol) < RF_EVENT_PROTOCOL_SIZE) &&
+         (!deviceID || strlen(deviceID) < RF_EVENT_DEVICEID_SIZE) &&
+         messageLength < RF_EVENT_MESSAGE_SIZE;
+}
+
+bool RfEvent::set(const char *protocol, const char *deviceID,
+                  const char *message, size_t messageLength,
+                  unsigned long timestamp) {
+  this->timestamp = timestamp;
+  return copyString(this->protocol, sizeof(this->protocol), protocol) &&
+         copyString(this->deviceID, sizeof(this->deviceID), deviceID) &&
+         copyString(this->message, sizeof(this->message), message,
+                    messageLength);
+}
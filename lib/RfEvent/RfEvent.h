@@ -0,0 +1,64 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RFEVENT_H
+#define RFEVENT_H
+
+#include <stddef.h>
+
+#ifndef RF_EVENT_PROTOCOL_SIZE
+#define RF_EVENT_PROTOCOL_SIZE 32
+#endif
+
+#ifndef RF_EVENT_DEVICEID_SIZE
+#define RF_EVENT_DEVICEID_SIZE 24
+#endif
+
+#ifndef RF_EVENT_MESSAGE_SIZE
+#define RF_EVENT_MESSAGE_SIZE 192
+#endif
+
+// A decoded RF message, stored in fixed size buffers to avoid heap
+// allocations between receiving and publishing.
+struct RfEvent {
+  char protocol[RF_EVENT_PROTOCOL_SIZE];
+  char deviceID[RF_EVENT_DEVICEID_SIZE];
+  char message[RF_EVENT_MESSAGE_SIZE];
+  unsigned long timestamp;
+
+  // Returns false if one of the strings does not fit into its buffer.
+  bool set(const char *protocol, const char *deviceID, const char *message,
+           size_t messageLength, unsigned long timestamp);
+  // Whether set() would succeed, without changing the event
+  static bool fits(const char *protocol, const char *deviceID,
+                   size_t messageLength);
+  bool hasDeviceID() const { return deviceID[0] != '\0'; }
+};
+
+#endif  // RFEVENT_H
@@ -0,0 +1,92 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <Arduino.h>
+
+#include <ArduinoSimpleLogging.h>
+
+#include <Metrics.h>
+
+#include "RfEventQueue.h"
+
+RfEventQueue::RfEventQueue()
+    : head(0),
+      count(0),
+      overflowCount(0),
+      dropCount(0),
+      reportedOverflows(0) {}
+
+RfEventQueue::~RfEventQueue() = default;
+
+bool RfEventQueue::push(const char *protocol, const char *deviceID,
+                        const char *message, size_t messageLength) {
+  // checked first, a rejected event must not evict a queued one
+  if (!RfEvent::fits(protocol, deviceID, messageLength)) {
+    Logger.warning.print(F("RF event too large, dropped: "));
+    Logger.warning.println(protocol);
+    dropCount++;
+    Metrics.inc(METRIC_RF_QUEUE_DROPPED);
+    return false;
+  }
+  size_t tail = (head + count) % RF_EVENT_QUEUE_SIZE;
+  if (count == RF_EVENT_QUEUE_SIZE) {
+    // overwrite the oldest event
+    head = (head + 1) % RF_EVENT_QUEUE_SIZE;
+    count--;
+    overflowCount++;
+    Metrics.inc(METRIC_RF_QUEUE_DROPPED);
+  }
+  events[tail].set(protocol, deviceID, message, messageLength, millis());
+  count++;
+  return true;
+}
+
+size_t RfEventQueue::drain(const RfEventQueue::EventCb &cb, size_t maxEvents) {
+  if (overflowCount != reportedOverflows) {
+    Logger.warning.print(F("RF event queue overflow, events lost: "));
+    Logger.warning.println(overflowCount - reportedOverflows);
+    reportedOverflows = overflowCount;
+  }
+
+  size_t drained = 0;
+  while (count > 0 && drained < maxEvents) {
+    if (!cb || !cb(events[head])) {
+      dropCount++;
+    }
+    head = (head + 1) % RF_EVENT_QUEUE_SIZE;
+    count--;
+    drained++;
+  }
+  return drained;
+}
+
+void RfEventQueue::clear() {
+  head = 0;
+  count = 0;
+}
@@ -0,0 +1,79 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RFEVENTQUEUE_H
+#define RFEVENTQUEUE_H
+
+#include <functional>
+
+#include "RfEvent.h"
+
+#ifndef RF_EVENT_QUEUE_SIZE
+#define RF_EVENT_QUEUE_SIZE 8
+#endif
+
+#ifndef RF_EVENT_QUEUE_DRAIN
+#define RF_EVENT_QUEUE_DRAIN 2
+#endif
+
+// Fixed capacity ring buffer that decouples the RF receiver from the
+// (potentially blocking) MQTT publishing.  If the queue is full, the
+// oldest event is overwritten.
+class RfEventQueue {
+ public:
+  // Returns false if the event could not be delivered.
+  using EventCb = std::function<bool(const RfEvent &)>;
+
+  RfEventQueue();
+  ~RfEventQueue();
+
+  bool push(const char *protocol, const char *deviceID, const char *message,
+            size_t messageLength);
+  size_t drain(const EventCb &cb, size_t maxEvents = RF_EVENT_QUEUE_DRAIN);
+  void clear();
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  static constexpr size_t capacity() { return RF_EVENT_QUEUE_SIZE; }
+
+  // Events overwritten because the queue was full
+  unsigned long overflows() const { return overflowCount; }
+  // Events rejected because they are too large or could not be delivered
+  unsigned long drops() const { return dropCount; }
+
+ private:
+  RfEvent events[RF_EVENT_QUEUE_SIZE];
+  size_t head;
+  size_t count;
+  unsigned long overflowCount;
+  unsigned long dropCount;
+  unsigned long reportedOverflows;
+};
+
+#endif  // RFEVENTQUEUE_H
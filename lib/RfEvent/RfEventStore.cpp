@@ -0,0 +1,181 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include <FS.h>
+
+#include <ArduinoSimpleLogging.h>
+
+#include "RfEventStore.h"
+
+RfEventStore::RfEventStore()
+    : events(nullptr),
+      capacity(0),
+      head(0),
+      count(0),
+      spillCapacity(0),
+      spillCount(0),
+      spillSlots(0),
+      spillReadSlot(0),
+      spillLoaded(false),
+      started(false),
+      dropCount(0) {}
+
+RfEventStore::~RfEventStore() { delete[] events; }
+
+void RfEventStore::begin(size_t capacity, size_t spillCapacity) {
+  if (!started) {
+    // Timestamps of a previous boot are meaningless, start with a clean file
+    removeSpillFile();
+    started = true;
+  }
+  capacity = std::min(capacity, static_cast<size_t>(RF_EVENT_STORE_MAX));
+  if (capacity != this->capacity) {
+    if (count > 0) {
+      Logger.warning.print(F("Offline buffer resized, events lost: "));
+      Logger.warning.println(count);
+      dropCount += count;
+    }
+    delete[] events;
+    events = capacity > 0 ? new RfEvent[capacity] : nullptr;
+    this->capacity = capacity;
+    head = 0;
+    count = 0;
+  }
+  this->spillCapacity =
+      std::min(spillCapacity, static_cast<size_t>(RF_EVENT_SPILL_MAX));
+}
+
+bool RfEventStore::push(const RfEvent &event) {
+  if (spillCount > 0 || (capacity > 0 && count == capacity)) {
+    // keep the order: once spilled, everything goes to the file
+    if (spill(event)) {
+      return true;
+    }
+    if (spillCount > 0 || capacity == 0) {
+      dropCount++;
+      return false;
+    }
+    // RAM only: overwrite the oldest event
+    head = (head + 1) % capacity;
+    count--;
+    dropCount++;
+  }
+  if (capacity == 0) {
+    dropCount++;
+    return false;
+  }
+  events[(head + count) % capacity] = event;
+  count++;
+  return true;
+}
+
+bool RfEventStore::spill(const RfEvent &event) {
+  if (spillCount == 0) {
+    // a new file, the ring size may have changed
+    removeSpillFile();
+    spillSlots = spillCapacity;
+  }
+  if (spillCount >= std::min(spillCapacity, spillSlots)) {
+    return false;
+  }
+  // the file grows up to spillSlots events, then slots are reused
+  File file = SPIFFS.open(FPSTR(RF_EVENT_SPILL_FILE),
+                          SPIFFS.exists(FPSTR(RF_EVENT_SPILL_FILE)) ? "r+"
+                                                                    : "w");
+  size_t slot = (spillReadSlot + spillCount) % spillSlots;
+  if (!file || !file.seek(slot * sizeof(RfEvent), SeekSet)) {
+    Logger.error.println(F("Open offline spill file failed!"));
+    return false;
+  }
+  size_t written = file.write(reinterpret_cast<const uint8_t *>(&event),
+                              sizeof(RfEvent));
+  file.close();
+  if (written != sizeof(RfEvent)) {
+    Logger.error.println(F("Write offline spill file failed!"));
+    return false;
+  }
+  if (spillCount == 0) {
+    Logger.info.println(F("Offline buffer full, spill events to SPIFFS."));
+  }
+  spillCount++;
+  return true;
+}
+
+const RfEvent *RfEventStore::front() {
+  if (count > 0) {
+    return &events[head];
+  }
+  if (spillCount == 0) {
+    return nullptr;
+  }
+  if (!spillLoaded) {
+    File file = SPIFFS.open(FPSTR(RF_EVENT_SPILL_FILE), "r");
+    if (!file || !file.seek(spillReadSlot * sizeof(RfEvent), SeekSet) ||
+        file.read(reinterpret_cast<uint8_t *>(&spillEvent),
+                  sizeof(RfEvent)) != sizeof(RfEvent)) {
+      Logger.error.println(F("Read offline spill file failed!"));
+      dropCount += spillCount;
+      removeSpillFile();
+      return nullptr;
+    }
+    file.close();
+    spillLoaded = true;
+  }
+  return &spillEvent;
+}
+
+void RfEventStore::pop() {
+  if (count > 0) {
+    head = (head + 1) % capacity;
+    count--;
+  } else if (spillCount > 0) {
+    spillReadSlot = (spillReadSlot + 1) % spillSlots;
+    spillLoaded = false;
+    if (--spillCount == 0) {
+      removeSpillFile();
+    }
+  }
+}
+
+void RfEventStore::clear() {
+  head = 0;
+  count = 0;
+  removeSpillFile();
+}
+
+void RfEventStore::removeSpillFile() {
+  spillCount = 0;
+  spillReadSlot = 0;
+  spillLoaded = false;
+  if (SPIFFS.exists(FPSTR(RF_EVENT_SPILL_FILE))) {
+    SPIFFS.remove(FPSTR(RF_EVENT_SPILL_FILE));
+  }
+}
@@ -0,0 +1,88 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RFEVENTSTORE_H
+#define RFEVENTSTORE_H
+
+#include "RfEvent.h"
+
+#ifndef RF_EVENT_STORE_MAX
+#define RF_EVENT_STORE_MAX 32
+#endif
+
+#ifndef RF_EVENT_SPILL_MAX
+#define RF_EVENT_SPILL_MAX 512
+#endif
+
+const char PROGMEM RF_EVENT_SPILL_FILE[] = "/offline.bin";
+
+// Bounded store-and-forward buffer for events that could not be
+// published.  Events are kept in RAM first.  If the RAM buffer is full
+// and spilling is enabled, further events are written to a SPIFFS
+// file, used as ring of spillCapacity events.  Events are handed out in
+// the order they were stored.
+class RfEventStore {
+ public:
+  RfEventStore();
+  ~RfEventStore();
+
+  // (Re)configure the number of events kept in RAM and in the spill file.
+  void begin(size_t capacity, size_t spillCapacity);
+  bool push(const RfEvent &event);
+  // Oldest stored event or nullptr if the store is empty.
+  const RfEvent *front();
+  void pop();
+  void clear();
+
+  bool empty() const { return count == 0 && spillCount == 0; }
+  size_t size() const { return count + spillCount; }
+  unsigned long drops() const { return dropCount; }
+
+ private:
+  bool spill(const RfEvent &event);
+  void removeSpillFile();
+
+  RfEvent *events;
+  size_t capacity;
+  size_t head;
+  size_t count;
+
+  size_t spillCapacity;
+  size_t spillCount;
+  // ring size of the current file, fixed until it is removed
+  size_t spillSlots;
+  size_t spillReadSlot;
+  bool spillLoaded;
+  RfEvent spillEvent;
+  bool started;
+
+  unsigned long dropCount;
+};
+
+#endif  // RFEVENTSTORE_H
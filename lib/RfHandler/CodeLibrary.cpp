@@ -0,0 +1,213 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <memory>
+
+#include <FS.h>
+
+#include <ArduinoSimpleLogging.h>
+#include <ESPiLight.h>
+
+#include "CodeLibrary.h"
+
+namespace JsonKey {
+static const char name[] = "name";
+static const char protocol[] = "protocol";
+static const char message[] = "message";
+}  // namespace JsonKey
+
+static void logJsonDeserializationError(const DeserializationError &error) {
+  Logger.error.print(F("deserializeJson() failed with code "));
+  Logger.error.println(error.c_str());
+}
+
+CodeLibrary::CodeLibrary() : count(0) {}
+
+CodeLibrary::~CodeLibrary() = default;
+
+bool CodeLibrary::validName(const String &name) {
+  if (name.length() == 0 || name.length() >= CODE_LIBRARY_NAME_SIZE) {
+    return false;
+  }
+  // Names are used as the last level of a MQTT topic
+  return name.indexOf('/') < 0 && name.indexOf('+') < 0 &&
+         name.indexOf('#') < 0;
+}
+
+void CodeLibrary::compile(Entry &entry, uint16_t *pulses) {
+  int length;
+  if (entry.protocol == F("RAW")) {
+    length =
+        ESPiLight::stringToPulseTrain(entry.message, pulses,
+                                      MAXPULSESTREAMLENGTH);
+  } else {
+    length = ESPiLight::createPulseTrain(pulses, entry.protocol, entry.message);
+  }
+  entry.compiled = length > 0 && entry.train.encode(pulses, length);
+  if (!entry.compiled) {
+    Logger.warning.print(F("Cannot precompile code "));
+    Logger.warning.print(entry.name);
+    Logger.warning.print(F(": "));
+    Logger.warning.println(length);
+  }
+}
+
+bool CodeLibrary::add(const String &name, const String &protocol,
+                      const String &message, uint16_t *pulses) {
+  if (!validName(name) || protocol.length() == 0 || message.length() == 0) {
+    Logger.error.print(F("Invalid code library entry: "));
+    Logger.error.println(name);
+    return false;
+  }
+
+  Entry *entry = nullptr;
+  for (auto &candidate : entries) {
+    if (candidate.name == name) {
+      entry = &candidate;
+      break;
+    }
+  }
+  if (entry == nullptr) {
+    if (count >= CODE_LIBRARY_SIZE) {
+      Logger.error.println(F("Code library is full!"));
+      return false;
+    }
+    entries.emplace_front();
+    entry = &entries.front();
+    entry->name = name;
+    count++;
+  }
+  entry->protocol = protocol;
+  entry->message = message;
+  compile(*entry, pulses);
+  return true;
+}
+
+bool CodeLibrary::set(const String &name, const String &protocol,
+                      const String &message) {
+  std::unique_ptr<uint16_t[]> pulses(new uint16_t[MAXPULSESTREAMLENGTH]);
+  return add(name, protocol, message, pulses.get());
+}
+
+bool CodeLibrary::remove(const String &name) {
+  auto before = entries.before_begin();
+  for (auto it = entries.begin(); it != entries.end(); before = it++) {
+    if (it->name == name) {
+      entries.erase_after(before);
+      count--;
+      return true;
+    }
+  }
+  return false;
+}
+
+const CodeLibrary::Entry *CodeLibrary::find(const char *name) const {
+  for (const auto &entry : entries) {
+    if (entry.name == name) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+void CodeLibrary::forEach(const EntryCb &cb) const {
+  for (const auto &entry : entries) {
+    cb(entry);
+  }
+}
+
+size_t CodeLibrary::jsonSize() const {
+  size_t size = JSON_ARRAY_SIZE(count) + count * JSON_OBJECT_SIZE(3);
+  for (const auto &entry : entries) {
+    size += entry.name.length() + entry.protocol.length() +
+            entry.message.length() + 3;
+  }
+  return size;
+}
+
+void CodeLibrary::toJson(JsonArray codes) const {
+  for (const auto &entry : entries) {
+    JsonObject code = codes.createNestedObject();
+    code[JsonKey::name] = entry.name;
+    code[JsonKey::protocol] = entry.protocol;
+    code[JsonKey::message] = entry.message;
+  }
+}
+
+bool CodeLibrary::deserialize(const String &json) {
+  DynamicJsonDocument jsonDoc(JSON_OBJECT_SIZE(3) + json.length());
+  DeserializationError error = deserializeJson(jsonDoc, json);
+  if (error) {
+    logJsonDeserializationError(error);
+    return false;
+  }
+  return set(jsonDoc[JsonKey::name].as<String>(),
+             jsonDoc[JsonKey::protocol].as<String>(),
+             jsonDoc[JsonKey::message].as<String>());
+}
+
+void CodeLibrary::load() {
+  if (!SPIFFS.exists(FPSTR(CODE_LIBRARY_FILE))) {
+    return;
+  }
+  File file = SPIFFS.open(FPSTR(CODE_LIBRARY_FILE), "r");
+  if (!file) {
+    Logger.error.println(F("Open code library file for read failed!"));
+    return;
+  }
+  DynamicJsonDocument jsonDoc(JSON_ARRAY_SIZE(CODE_LIBRARY_SIZE) +
+                              CODE_LIBRARY_SIZE * JSON_OBJECT_SIZE(3) +
+                              file.size());
+  DeserializationError error = deserializeJson(jsonDoc, file);
+  file.close();
+  if (error) {
+    logJsonDeserializationError(error);
+    return;
+  }
+
+  entries.clear();
+  count = 0;
+  std::unique_ptr<uint16_t[]> pulses(new uint16_t[MAXPULSESTREAMLENGTH]);
+  for (JsonObject code : jsonDoc.as<JsonArray>()) {
+    add(code[JsonKey::name].as<String>(), code[JsonKey::protocol].as<String>(),
+        code[JsonKey::message].as<String>(), pulses.get());
+  }
+  Logger.debug.print(F("Code library loaded: "));
+  Logger.debug.println(count);
+}
+
+void CodeLibrary::save() const {
+  File file = SPIFFS.open(FPSTR(CODE_LIBRARY_FILE), "w");
+  if (!file) {
+    Logger.error.println(F("Open code library file for write failed!"));
+    return;
+  }
+  serialize(file);
+  file.close();
+}
@@ -0,0 +1,99 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef CODELIBRARY_H
+#define CODELIBRARY_H
+
+#include <forward_list>
+#include <functional>
+
+#include <WString.h>
+
+#include <ArduinoJson.h>
+
+#include "CompactPulseTrain.h"
+
+#ifndef CODE_LIBRARY_SIZE
+#define CODE_LIBRARY_SIZE 16
+#endif
+
+#ifndef CODE_LIBRARY_NAME_SIZE
+#define CODE_LIBRARY_NAME_SIZE 32
+#endif
+
+const char PROGMEM CODE_LIBRARY_FILE[] = "/codes.json";
+
+// Named transmit codes, stored in SPIFFS.  Each code is parsed into a
+// pulse train when it is added, so it can be sent without parsing.
+class CodeLibrary {
+ public:
+  struct Entry {
+    String name;
+    String protocol;
+    String message;
+    bool compiled;
+    CompactPulseTrain train;
+  };
+  using EntryCb = std::function<void(const Entry &)>;
+
+  CodeLibrary();
+  ~CodeLibrary();
+
+  void load();
+  void save() const;
+
+  // Add or replace the code with the given name.
+  bool set(const String &name, const String &protocol, const String &message);
+  bool remove(const String &name);
+  const Entry *find(const char *name) const;
+  size_t size() const { return count; }
+  void forEach(const EntryCb &cb) const;
+
+  template <typename T>
+  void serialize(T &target) const {
+    DynamicJsonDocument jsonDoc(jsonSize());
+    toJson(jsonDoc.to<JsonArray>());
+    serializeJson(jsonDoc, target);
+  }
+  // Parse a code from {"name": ..., "protocol": ..., "message": ...}
+  bool deserialize(const String &json);
+
+ private:
+  static bool validName(const String &name);
+  size_t jsonSize() const;
+  void toJson(JsonArray codes) const;
+  static void compile(Entry &entry, uint16_t *pulses);
+  bool add(const String &name, const String &protocol, const String &message,
+           uint16_t *pulses);
+
+  std::forward_list<Entry> entries;
+  size_t count;
+};
+
+#endif  // CODELIBRARY_H
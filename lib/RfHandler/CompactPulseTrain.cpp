@@ -0,0 +1,106 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "CompactPulseTrain.h"
+
+bool CompactPulseTrain::encode(const uint16_t *pulses, size_t length,
+                               uint8_t tolerance) {
+  if (length > PULSE_TRAIN_MAX_LENGTH) {
+    return false;
+  }
+  memset(indices, 0, sizeof(indices));
+  timingCount = 0;
+  for (size_t pos = 0; pos < length; ++pos) {
+    uint8_t idx = 0;
+    while (idx < timingCount &&
+           static_cast<uint32_t>(abs(timings[idx] - pulses[pos])) * 100 >
+               static_cast<uint32_t>(timings[idx]) * tolerance) {
+      idx++;
+    }
+    if (idx == timingCount) {
+      if (timingCount == PULSE_TRAIN_MAX_TIMINGS) {
+        return false;
+      }
+      timings[timingCount++] = pulses[pos];
+    }
+    indices[pos / 2] |= (pos & 1) ? (idx << 4) : idx;
+  }
+  this->length = length;
+  return true;
+}
+
+size_t CompactPulseTrain::decode(uint16_t *pulses, size_t maxLength) const {
+  size_t count = length < maxLength ? length : maxLength;
+  for (size_t pos = 0; pos < count; ++pos) {
+    pulses[pos] = timings[index(pos)];
+  }
+  return count;
+}
+
+size_t CompactPulseTrain::serialize(uint8_t *buffer, size_t size) const {
+  size_t needed = serializedSize();
+  if (needed > size) {
+    return 0;
+  }
+  uint8_t *pos = buffer;
+  *pos++ = timingCount;
+  *pos++ = length & 0xff;
+  *pos++ = length >> 8;
+  for (uint8_t i = 0; i < timingCount; ++i) {
+    *pos++ = timings[i] & 0xff;
+    *pos++ = timings[i] >> 8;
+  }
+  memcpy(pos, indices, (length + 1) / 2);
+  return needed;
+}
+
+size_t CompactPulseTrain::deserialize(const uint8_t *buffer, size_t size) {
+  if (size < 3) {
+    return 0;
+  }
+  const uint8_t *pos = buffer;
+  uint8_t count = *pos++;
+  uint16_t pulses = pos[0] | (pos[1] << 8);
+  pos += 2;
+  if (count > PULSE_TRAIN_MAX_TIMINGS || pulses > PULSE_TRAIN_MAX_LENGTH ||
+      static_cast<size_t>(3 + 2 * count + (pulses + 1) / 2) > size) {
+    return 0;
+  }
+  timingCount = count;
+  length = pulses;
+  for (uint8_t i = 0; i < timingCount; ++i) {
+    timings[i] = pos[0] | (pos[1] << 8);
+    pos += 2;
+  }
+  memcpy(indices, pos, (length + 1) / 2);
+  return serializedSize();
+}
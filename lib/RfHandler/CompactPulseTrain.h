@@ -0,0 +1,69 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef COMPACTPULSETRAIN_H
+#define COMPACTPULSETRAIN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ESPiLight.h>
+
+#define PULSE_TRAIN_MAX_TIMINGS 16
+#define PULSE_TRAIN_MAX_LENGTH MAXPULSESTREAMLENGTH
+
+// Pulse train stored as a table of distinct pulse lengths and one 4 bit
+// table index per pulse.  This is about a quarter of the size of the
+// uint16_t array used by ESPiLight.
+struct CompactPulseTrain {
+  uint16_t timings[PULSE_TRAIN_MAX_TIMINGS];
+  uint8_t indices[(PULSE_TRAIN_MAX_LENGTH + 1) / 2];
+  uint16_t length;
+  uint8_t timingCount;
+
+  // Returns false if the pulse train has too many distinct pulse lengths.
+  // With a tolerance in percent, pulses close to a known length share
+  // its table entry, as received pulses jitter.
+  bool encode(const uint16_t *pulses, size_t length, uint8_t tolerance = 0);
+  // Returns the number of pulses written to pulses.
+  size_t decode(uint16_t *pulses, size_t maxLength) const;
+  // Binary form: timing count, length (LE16), timings (LE16) and the
+  // packed indices.  Returns the size written, 0 if it does not fit.
+  size_t serialize(uint8_t *buffer, size_t size) const;
+  // Reads the binary form, returns the size consumed, 0 if invalid.
+  size_t deserialize(const uint8_t *buffer, size_t size);
+  size_t serializedSize() const {
+    return 3 + 2 * timingCount + (length + 1) / 2;
+  }
+  uint8_t index(size_t pos) const {
+    return (pos & 1) ? (indices[pos / 2] >> 4) : (indices[pos / 2] & 0x0f);
+  }
+};
+
+#endif  // COMPACTPULSETRAIN_H
@@ -0,0 +1,184 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Arduino.h>
+#include <ArduinoSimpleLogging.h>
+
+#include <Metrics.h>
+
+#include "LoadGenerator.h"
+
+LoadGenerator::LoadGenerator()
+    : running(false),
+      interval(0),
+      nextDue(0),
+      seq(0),
+      windowStart(0),
+      injected(0),
+      publishedCount(0),
+      lost(0),
+      skipped(0),
+      latencySum(0),
+      latencyMax(0) {
+  memset(slots, 0, sizeof(slots));
+}
+
+LoadGenerator::~LoadGenerator() = default;
+
+void LoadGenerator::start(uint16_t rate) {
+  if (rate == 0) {
+    Logger.error.println(F("Load test needs a rate above 0!"));
+    return;
+  }
+  memset(slots, 0, sizeof(slots));
+  running = true;
+  setRate(rate);
+  nextDue = micros();
+  windowStart = millis();
+  injected = publishedCount = lost = skipped = 0;
+  latencySum = latencyMax = 0;
+  Logger.info.print(F("Start load test with events/s: "));
+  Logger.info.println(rate);
+}
+
+void LoadGenerator::stop() {
+  if (!running) {
+    return;
+  }
+  report();
+  running = false;
+  Logger.info.println(F("Load test stopped."));
+}
+
+void LoadGenerator::setRate(uint16_t rate) {
+  if (rate > 0) {
+    interval = 1000000UL / rate;
+  }
+}
+
+void LoadGenerator::loop(const InjectCb &cb) {
+  if (!running) {
+    return;
+  }
+  uint32_t now = micros();
+  expire(now);
+  // a slow loop skips the injections it cannot catch up
+  if (static_cast<int32_t>(now - nextDue) >
+      static_cast<int32_t>(interval * LOAD_TEST_BURST)) {
+    uint32_t behind = (now - nextDue) / interval;
+    skipped += behind;
+    nextDue += behind * interval;
+  }
+  char message[24];
+  for (size_t i = 0;
+       i < LOAD_TEST_BURST && static_cast<int32_t>(now - nextDue) >= 0; ++i) {
+    Slot &slot = slots[seq % LOAD_TEST_SLOTS];
+    if (slot.pending) {
+      lost++;
+      Metrics.inc(METRIC_LOAD_LOST);
+    }
+    slot = {seq, micros(), true};
+    snprintf(message, sizeof(message), "{\"seq\":%u}",
+             static_cast<unsigned>(seq));
+    seq++;
+    injected++;
+    Metrics.inc(METRIC_LOAD_INJECTED);
+    cb(FPSTR(LOAD_TEST_PROTOCOL), message);
+    nextDue += interval;
+  }
+  if (millis() - windowStart >= LOAD_TEST_REPORT) {
+    report();
+  }
+}
+
+void LoadGenerator::published(const char *protocol, const char *message) {
+  if (!running || strcmp_P(protocol, LOAD_TEST_PROTOCOL) != 0) {
+    return;
+  }
+  const char *value = strchr(message, ':');
+  if (value == nullptr) {
+    return;
+  }
+  uint32_t number = strtoul(value + 1, nullptr, 10);
+  Slot &slot = slots[number % LOAD_TEST_SLOTS];
+  if (!slot.pending || slot.seq != number) {
+    return;
+  }
+  slot.pending = false;
+  uint32_t latency = micros() - slot.injected;
+  publishedCount++;
+  latencySum += latency;
+  if (latency > latencyMax) {
+    latencyMax = latency;
+  }
+  Metrics.inc(METRIC_LOAD_PUBLISHED);
+}
+
+void LoadGenerator::expire(uint32_t now) {
+  for (Slot &slot : slots) {
+    if (slot.pending && now - slot.injected > LOAD_TEST_TIMEOUT * 1000UL) {
+      slot.pending = false;
+      lost++;
+      Metrics.inc(METRIC_LOAD_LOST);
+    }
+  }
+}
+
+void LoadGenerator::report() {
+  unsigned long elapsed = millis() - windowStart;
+  if (elapsed == 0) {
+    return;
+  }
+  uint32_t publishRate = publishedCount * 1000UL / elapsed;
+  uint32_t latency = publishedCount > 0 ? latencySum / publishedCount : 0;
+  Metrics.set(METRIC_LOAD_RATE, publishRate);
+  Metrics.set(METRIC_LOAD_LATENCY, latency);
+  Metrics.set(METRIC_LOAD_LATENCY_MAX, latencyMax);
+
+  Logger.info.print(F("Load test: injected/s="));
+  Logger.info.print(injected * 1000UL / elapsed);
+  Logger.info.print(F(" published/s="));
+  Logger.info.print(publishRate);
+  Logger.info.print(F(" lost="));
+  Logger.info.print(lost);
+  Logger.info.print(F(" skipped="));
+  Logger.info.print(skipped);
+  Logger.info.print(F(" latency avg/max us="));
+  Logger.info.print(latency);
+  Logger.info.print('/');
+  Logger.info.println(latencyMax);
+
+  windowStart = millis();
+  injected = publishedCount = lost = skipped = 0;
+  latencySum = latencyMax = 0;
+}
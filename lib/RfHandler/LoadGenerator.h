@@ -0,0 +1,110 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef LOADGENERATOR_H
+#define LOADGENERATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+
+#include <WString.h>
+
+// Injected events tracked until they are published
+#ifndef LOAD_TEST_SLOTS
+#define LOAD_TEST_SLOTS 32
+#endif
+
+// ms until an injected event that was not published counts as lost
+#ifndef LOAD_TEST_TIMEOUT
+#define LOAD_TEST_TIMEOUT 2000
+#endif
+
+// ms between two reports
+#ifndef LOAD_TEST_REPORT
+#define LOAD_TEST_REPORT 10000
+#endif
+
+// Injections per loop() when a slow loop fell behind the rate
+#ifndef LOAD_TEST_BURST
+#define LOAD_TEST_BURST 4
+#endif
+
+const char PROGMEM LOAD_TEST_PROTOCOL[] = "loadtest";
+
+// Synthetic load for capacity measurements.  loop() injects decoded
+// events {"seq":<n>} of protocol "loadtest" at a fixed rate, published()
+// takes them back after the MQTT PUBLISH.  Every LOAD_TEST_REPORT ms
+// the achieved rates, the receive to publish latency and the lost
+// events are logged and set as metrics.
+class LoadGenerator {
+ public:
+  using InjectCb =
+      std::function<void(const String &protocol, const String &message)>;
+
+  LoadGenerator();
+  ~LoadGenerator();
+
+  // Events per second
+  void start(uint16_t rate);
+  void stop();
+  // Change the rate of a running generator
+  void setRate(uint16_t rate);
+  bool isRunning() const { return running; }
+
+  void loop(const InjectCb &cb);
+  // Call for every published event, others than "loadtest" are ignored.
+  void published(const char *protocol, const char *message);
+
+ private:
+  struct Slot {
+    uint32_t seq;
+    uint32_t injected;  // micros()
+    bool pending;
+  };
+
+  void expire(uint32_t now);
+  void report();
+
+  Slot slots[LOAD_TEST_SLOTS];
+  bool running;
+  uint32_t interval;  // us
+  uint32_t nextDue;   // micros()
+  uint32_t seq;
+  unsigned long windowStart;
+  uint32_t injected;
+  uint32_t publishedCount;
+  uint32_t lost;
+  uint32_t skipped;
+  uint64_t latencySum;
+  uint32_t latencyMax;
+};
+
+#endif  // LOADGENERATOR_H
@@ -0,0 +1,185 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "ProtocolStats.h"
+
+ProtocolStats::ProtocolStats()
+    : capacity(0),
+      pass(0),
+      passMatches(0),
+      passTrains(0),
+      observeStart(0),
+      observePeriod(0) {
+  clear();
+}
+
+void ProtocolStats::begin(size_t protocols) {
+  entries.reset(new Entry[protocols]);
+  capacity = protocols;
+  clear();
+}
+
+void ProtocolStats::clear() {
+  if (entries) {
+    memset(entries.get(), 0, capacity * sizeof(Entry));
+  }
+  count = 0;
+  overflow = false;
+  trains = 0;
+  unmatched = 0;
+  totalMicros = 0;
+}
+
+ProtocolStats::Entry *ProtocolStats::find(const char *protocol, bool add) {
+  for (size_t i = 0; i < count; ++i) {
+    if (strcmp(entries[i].name, protocol) == 0) {
+      return &entries[i];
+    }
+  }
+  if (!add) {
+    return nullptr;
+  }
+  if (count == capacity || strlen(protocol) >= RF_PROTOCOL_NAME_SIZE) {
+    overflow = true;
+    return nullptr;
+  }
+  Entry &entry = entries[count++];
+  strcpy(entry.name, protocol);
+  return &entry;
+}
+
+void ProtocolStats::countMatch(const char *protocol, bool valid) {
+  if (passMatches < UINT8_MAX) {
+    passMatches++;
+  }
+  // noise decodes of otherwise unseen protocols must not fill the table
+  Entry *entry = find(protocol, valid);
+  if (!entry) {
+    return;
+  }
+  if (valid) {
+    entry->valid++;
+  } else {
+    entry->other++;
+  }
+  entry->lastPass = pass;
+}
+
+void ProtocolStats::endPass(unsigned long micros) {
+  if (passTrains == 0 && passMatches == 0) {
+    return;
+  }
+  trains += passTrains;
+  totalMicros += micros;
+  if (passMatches == 0) {
+    unmatched += passTrains;
+    return;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (entries[i].lastPass == pass) {
+      Entry &entry = entries[i];
+      entry.passes++;
+      entry.totalMicros += micros;
+      if (micros > entry.maxMicros) {
+        entry.maxMicros = micros;
+      }
+    }
+  }
+}
+
+void ProtocolStats::observe(unsigned long period) {
+  clear();
+  observeStart = millis();
+  observePeriod = period;
+}
+
+bool ProtocolStats::observationDone() const {
+  return observePeriod > 0 && millis() - observeStart >= observePeriod;
+}
+
+void ProtocolStats::appendSuggestion(String &json) const {
+  json += '[';
+  bool first = true;
+  for (size_t i = 0; i < count; ++i) {
+    if (entries[i].valid >= RF_AUTOTUNE_MIN_MATCHES) {
+      if (!first) {
+        json += ',';
+      }
+      json += '"';
+      json += entries[i].name;
+      json += '"';
+      first = false;
+    }
+  }
+  json += ']';
+}
+
+String ProtocolStats::suggestion() const {
+  String json;
+  appendSuggestion(json);
+  return json;
+}
+
+String ProtocolStats::toJson() const {
+  String json;
+  json.reserve(96 + count * 96);
+  json += F("{\"trains\":");
+  json += trains;
+  json += F(",\"unmatched\":");
+  json += unmatched;
+  json += F(",\"decodeUs\":");
+  json += totalMicros;
+  json += F(",\"protocols\":{");
+  for (size_t i = 0; i < count; ++i) {
+    const Entry &entry = entries[i];
+    if (i > 0) {
+      json += ',';
+    }
+    json += '"';
+    json += entry.name;
+    json += F("\":{\"valid\":");
+    json += entry.valid;
+    json += F(",\"other\":");
+    json += entry.other;
+    json += F(",\"avgUs\":");
+    json += entry.passes > 0 ? entry.totalMicros / entry.passes : 0;
+    json += F(",\"maxUs\":");
+    json += entry.maxMicros;
+    json += '}';
+  }
+  json += F("},\"overflowed\":");
+  json += overflow ? F("true") : F("false");
+  json += F(",\"suggested\":");
+  appendSuggestion(json);
+  json += '}';
+  return json;
+}
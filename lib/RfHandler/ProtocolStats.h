@@ -0,0 +1,109 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PROTOCOLSTATS_H
+#define PROTOCOLSTATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include <WString.h>
+
+#ifndef RF_PROTOCOL_NAME_SIZE
+#define RF_PROTOCOL_NAME_SIZE 24
+#endif
+
+// Valid messages a protocol needs to be suggested by the auto-tune
+#ifndef RF_AUTOTUNE_MIN_MATCHES
+#define RF_AUTOTUNE_MIN_MATCHES 2
+#endif
+
+// Decoder statistics.  The time of a receiver pass is accounted to all
+// protocols that matched in it, passes with a pulse train but without
+// a match count as unmatched.  Protocols get an entry with their first
+// valid message.
+class ProtocolStats {
+ public:
+  ProtocolStats();
+
+  // Allocate the table for the given number of protocols
+  void begin(size_t protocols);
+  void beginPass() {
+    pass++;
+    passMatches = 0;
+    passTrains = 0;
+  }
+  void countTrain() { passTrains++; }
+  void countMatch(const char *protocol, bool valid);
+  void endPass(unsigned long micros);
+  // A pulse train was received or decoded in the last pass
+  bool passActive() const { return passTrains > 0 || passMatches != 0; }
+  void clear();
+
+  // Start an observation period of the given ms, 0 stops it
+  void observe(unsigned long period);
+  bool observationDone() const;
+  // A valid protocol did not fit into the table, the suggestion would
+  // miss it
+  bool overflowed() const { return overflow; }
+  // JSON array of the protocols with enough valid messages
+  String suggestion() const;
+  String toJson() const;
+
+ private:
+  struct Entry {
+    char name[RF_PROTOCOL_NAME_SIZE];
+    uint32_t valid;
+    uint32_t other;  // invalid or incomplete decodes
+    uint32_t passes;
+    uint32_t totalMicros;
+    uint32_t maxMicros;
+    uint32_t lastPass;  // pass of the last match
+  };
+
+  Entry *find(const char *protocol, bool add);
+  void appendSuggestion(String &json) const;
+
+  std::unique_ptr<Entry[]> entries;
+  size_t capacity;
+  size_t count;
+  bool overflow;
+  uint32_t pass;
+  uint8_t passMatches;
+  uint8_t passTrains;
+  uint32_t trains;
+  uint32_t unmatched;
+  uint32_t totalMicros;
+  unsigned long observeStart;
+  unsigned long observePeriod;
+};
+
+#endif  // PROTOCOLSTATS_H
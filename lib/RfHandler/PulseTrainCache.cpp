@@ -0,0 +1,143 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <FS.h>
+
+#include <ArduinoSimpleLogging.h>
+
+#include "PulseTrainCache.h"
+#include "RfHash.h"
+
+static const uint32_t CACHE_FILE_MAGIC = 0x31435450;  // "PTC1"
+static const uint32_t CHECK_HASH_INIT = 0x811c9dc5u ^ 0x5bd1e995u;
+
+PulseTrainCache::PulseTrainCache()
+    : useCounter(0), persistent(false), hitCount(0), missCount(0) {
+  memset(entries, 0, sizeof(entries));
+}
+
+PulseTrainCache::~PulseTrainCache() = default;
+
+PulseTrainCache::Key PulseTrainCache::keyOf(const char *message,
+                                            size_t length) {
+  Key key;
+  key.hash = rfHash(RF_HASH_INIT, message, length);
+  key.check = rfHash(CHECK_HASH_INIT, message, length);
+  key.length = length;
+  return key;
+}
+
+const CompactPulseTrain *PulseTrainCache::find(const Key &key) {
+  for (auto &entry : entries) {
+    if (entry.used && entry.key.hash == key.hash &&
+        entry.key.check == key.check && entry.key.length == key.length) {
+      entry.lastUsed = ++useCounter;
+      hitCount++;
+      return &entry.train;
+    }
+  }
+  missCount++;
+  return nullptr;
+}
+
+void PulseTrainCache::insert(const Key &key, const CompactPulseTrain &train) {
+  Entry *victim = &entries[0];
+  for (auto &entry : entries) {
+    if (!entry.used) {
+      victim = &entry;
+      break;
+    }
+    if (entry.lastUsed < victim->lastUsed) {
+      victim = &entry;
+    }
+  }
+  victim->key = key;
+  victim->train = train;
+  victim->used = true;
+  victim->lastUsed = ++useCounter;
+
+  if (persistent) {
+    save();
+  }
+}
+
+void PulseTrainCache::setPersistent(bool persistent) {
+  if (persistent && !this->persistent) {
+    load();
+  }
+  this->persistent = persistent;
+}
+
+void PulseTrainCache::load() {
+  File file = SPIFFS.open(FPSTR(RF_PULSE_CACHE_FILE), "r");
+  if (!file) {
+    return;
+  }
+  uint32_t magic = 0;
+  uint32_t size = 0;
+  if (file.read(reinterpret_cast<uint8_t *>(&magic), sizeof(magic)) !=
+          sizeof(magic) ||
+      file.read(reinterpret_cast<uint8_t *>(&size), sizeof(size)) !=
+          sizeof(size) ||
+      magic != CACHE_FILE_MAGIC || size != sizeof(entries)) {
+    Logger.warning.println(F("Ignore incompatible pulse train cache file."));
+    return;
+  }
+  if (file.read(reinterpret_cast<uint8_t *>(entries), sizeof(entries)) !=
+      sizeof(entries)) {
+    Logger.error.println(F("Read pulse train cache file failed!"));
+    memset(entries, 0, sizeof(entries));
+    return;
+  }
+  file.close();
+
+  useCounter = 0;
+  for (const auto &entry : entries) {
+    useCounter = std::max(useCounter, entry.lastUsed);
+  }
+  Logger.debug.println(F("Pulse train cache loaded."));
+}
+
+void PulseTrainCache::save() const {
+  File file = SPIFFS.open(FPSTR(RF_PULSE_CACHE_FILE), "w");
+  if (!file) {
+    Logger.error.println(F("Open pulse train cache file for write failed!"));
+    return;
+  }
+  uint32_t size = sizeof(entries);
+  file.write(reinterpret_cast<const uint8_t *>(&CACHE_FILE_MAGIC),
+             sizeof(CACHE_FILE_MAGIC));
+  file.write(reinterpret_cast<const uint8_t *>(&size), sizeof(size));
+  file.write(reinterpret_cast<const uint8_t *>(entries), sizeof(entries));
+  file.close();
+}
@@ -0,0 +1,85 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PULSETRAINCACHE_H
+#define PULSETRAINCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "CompactPulseTrain.h"
+
+#ifndef RF_PULSE_CACHE_SIZE
+#define RF_PULSE_CACHE_SIZE 8
+#endif
+
+const char PROGMEM RF_PULSE_CACHE_FILE[] = "/pulses.bin";
+
+// LRU cache of parsed RAW messages, keyed by two independent hashes and
+// the length of the textual message.
+class PulseTrainCache {
+ public:
+  struct Key {
+    uint32_t hash;
+    uint32_t check;
+    uint16_t length;
+  };
+
+  PulseTrainCache();
+  ~PulseTrainCache();
+
+  static Key keyOf(const char *message, size_t length);
+  const CompactPulseTrain *find(const Key &key);
+  void insert(const Key &key, const CompactPulseTrain &train);
+
+  // With persistence enabled, the cache is loaded from and written to
+  // SPIFFS.
+  void setPersistent(bool persistent);
+  unsigned long hits() const { return hitCount; }
+  unsigned long misses() const { return missCount; }
+
+ private:
+  struct Entry {
+    Key key;
+    uint32_t lastUsed;
+    bool used;
+    CompactPulseTrain train;
+  };
+
+  void load();
+  void save() const;
+
+  Entry entries[RF_PULSE_CACHE_SIZE];
+  uint32_t useCounter;
+  bool persistent;
+  unsigned long hitCount;
+  unsigned long missCount;
+};
+
+#endif  // PULSETRAINCACHE_H
@@ -0,0 +1,124 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#include <Arduino.h>
+#include <ArduinoSimpleLogging.h>
+
+#include <Metrics.h>
+
+#include "RawCapture.h"
+
+static const uint32_t CAPTURE_FILE_MAGIC = 0x31504352;  // "RCP1"
+
+RawCapture::RawCapture()
+    : head(0), count(0), streaming(false), recording(false) {}
+
+RawCapture::~RawCapture() {
+  if (file) {
+    file.close();
+  }
+}
+
+void RawCapture::setRecording(bool recording) {
+  if (!recording && file) {
+    file.close();
+  }
+  this->recording = recording;
+}
+
+bool RawCapture::push(const uint16_t *pulses, size_t length) {
+  if (count == RF_CAPTURE_SLOTS) {
+    Metrics.inc(METRIC_RF_CAPTURE_DROPPED);
+    return false;
+  }
+  Record &record = records[(head + count) % RF_CAPTURE_SLOTS];
+  if (!record.train.encode(pulses, length, RF_CAPTURE_TOLERANCE)) {
+    Metrics.inc(METRIC_RF_CAPTURE_DROPPED);
+    return false;
+  }
+  record.time = millis();
+  count++;
+  Metrics.inc(METRIC_RF_CAPTURED);
+  return true;
+}
+
+void RawCapture::loop(const RecordCb &cb) {
+  if (count == 0) {
+    return;
+  }
+  const Record &record = records[head];
+  if (recording) {
+    write(record);
+  }
+  if (streaming && cb) {
+    cb(record);
+  }
+  head = (head + 1) % RF_CAPTURE_SLOTS;
+  count--;
+}
+
+bool RawCapture::openFile() {
+  if (file && file.size() < RF_CAPTURE_FILE_SIZE) {
+    return true;
+  }
+  if (file) {
+    file.close();
+    SPIFFS.remove(FPSTR(RF_CAPTURE_FILE_PREVIOUS));
+    SPIFFS.rename(String(FPSTR(RF_CAPTURE_FILE)),
+                  String(FPSTR(RF_CAPTURE_FILE_PREVIOUS)));
+  }
+  file = SPIFFS.open(FPSTR(RF_CAPTURE_FILE), "a");
+  if (!file) {
+    Logger.error.println(F("Open capture file failed, stop recording!"));
+    recording = false;
+    return false;
+  }
+  if (file.size() == 0) {
+    file.write(reinterpret_cast<const uint8_t *>(&CAPTURE_FILE_MAGIC),
+               sizeof(CAPTURE_FILE_MAGIC));
+  }
+  return true;
+}
+
+void RawCapture::write(const Record &record) {
+  if (!openFile()) {
+    return;
+  }
+  uint8_t buffer[sizeof(record.time) + sizeof(CompactPulseTrain)];
+  memcpy(buffer, &record.time, sizeof(record.time));
+  size_t size = sizeof(record.time) +
+                record.train.serialize(buffer + sizeof(record.time),
+                                       sizeof(buffer) - sizeof(record.time));
+  if (file.write(buffer, size) != size) {
+    Logger.error.println(F("Write capture file failed, stop recording!"));
+    setRecording(false);
+    return;
+  }
+  // keep the file readable for the download
+  file.flush();
+}
@@ -0,0 +1,103 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RAWCAPTURE_H
+#define RAWCAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+
+#include <FS.h>
+
+#include "CompactPulseTrain.h"
+
+// Pulse trains waiting for the main loop
+#ifndef RF_CAPTURE_SLOTS
+#define RF_CAPTURE_SLOTS 4
+#endif
+
+// Size of the capture file before it is rotated
+#ifndef RF_CAPTURE_FILE_SIZE
+#define RF_CAPTURE_FILE_SIZE 32768
+#endif
+
+// Received pulses within this percentage share one timing
+#ifndef RF_CAPTURE_TOLERANCE
+#define RF_CAPTURE_TOLERANCE 10
+#endif
+
+const char PROGMEM RF_CAPTURE_FILE[] = "/capture.bin";
+const char PROGMEM RF_CAPTURE_FILE_PREVIOUS[] = "/capture.1.bin";
+
+// Capture of raw pulse trains in their compact form.  The receiver
+// only encodes into a preallocated ring, loop() takes one record per
+// call, appends it to the capture file (if recording) and passes it on
+// to the stream handler.
+//
+// The capture file starts with the magic "RCP1", followed by records
+// of the receive time in ms (LE32) and the serialized pulse train.
+// When it exceeds RF_CAPTURE_FILE_SIZE, it is renamed to
+// RF_CAPTURE_FILE_PREVIOUS and a new file is started.
+class RawCapture {
+ public:
+  struct Record {
+    uint32_t time;
+    CompactPulseTrain train;
+  };
+  using RecordCb = std::function<void(const Record &record)>;
+
+  RawCapture();
+  ~RawCapture();
+
+  // Streaming passes the records to the handler of loop()
+  void setStreaming(bool streaming) { this->streaming = streaming; }
+  void setRecording(bool recording);
+  bool isRecording() const { return recording; }
+  bool active() const { return streaming || recording; }
+
+  // Returns false if the ring is full or the pulse train cannot be
+  // encoded.
+  bool push(const uint16_t *pulses, size_t length);
+  void loop(const RecordCb &cb);
+
+ private:
+  void write(const Record &record);
+  bool openFile();
+
+  Record records[RF_CAPTURE_SLOTS];
+  uint8_t head;
+  uint8_t count;
+  bool streaming;
+  bool recording;
+  File file;
+};
+
+#endif  // RAWCAPTURE_H
@@ -0,0 +1,182 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "RfDeviceFilter.h"
+#include "RfHash.h"
+
+bool RfDeviceFilter::matches(const String &list, const char *protocol,
+                             const char *deviceID) {
+  size_t protocolLength = strlen(protocol);
+  size_t deviceIDLength = strlen(deviceID);
+  const char *pos = list.c_str();
+  while (*pos) {
+    while (*pos == ' ') {
+      pos++;
+    }
+    const char *end = strchr(pos, ',');
+    size_t length = end ? end - pos : strlen(pos);
+    while (length > 0 && pos[length - 1] == ' ') {
+      length--;
+    }
+    if (length >= protocolLength &&
+        strncmp(pos, protocol, protocolLength) == 0) {
+      if (length == protocolLength) {
+        return true;
+      }
+      if (pos[protocolLength] == '/' &&
+          length == protocolLength + 1 + deviceIDLength &&
+          strncmp(pos + protocolLength + 1, deviceID, deviceIDLength) == 0) {
+        return true;
+      }
+    }
+    if (!end) {
+      break;
+    }
+    pos = end + 1;
+  }
+  return false;
+}
+
+RfDeviceFilter::RfDeviceFilter()
+    : ratePerMinute(0), burst(1), changeOnly(false), refresh(0) {
+  clear();
+}
+
+RfDeviceFilter::~RfDeviceFilter() = default;
+
+void RfDeviceFilter::setLists(const String &allow, const String &deny) {
+  allowList = allow;
+  denyList = deny;
+}
+
+void RfDeviceFilter::setRate(uint16_t perMinute, uint8_t burst) {
+  ratePerMinute = perMinute;
+  this->burst = burst > 0 ? burst : 1;
+  // start with full buckets
+  for (auto &entry : entries) {
+    entry.tokens = this->burst * 1000UL;
+  }
+}
+
+void RfDeviceFilter::setChangeOnly(bool enabled, unsigned long refresh) {
+  changeOnly = enabled;
+  this->refresh = refresh;
+}
+
+void RfDeviceFilter::clear() { memset(entries, 0, sizeof(entries)); }
+
+size_t RfDeviceFilter::devices() const {
+  size_t count = 0;
+  for (const auto &entry : entries) {
+    if (entry.key != 0) {
+      count++;
+    }
+  }
+  return count;
+}
+
+RfDeviceFilter::Entry &RfDeviceFilter::lookup(uint32_t key,
+                                              unsigned long now) {
+  size_t start = key % RF_DEVICE_TABLE_SIZE;
+  Entry *victim = nullptr;
+  for (size_t i = 0; i < RF_DEVICE_TABLE_PROBES; ++i) {
+    Entry &entry = entries[(start + i) % RF_DEVICE_TABLE_SIZE];
+    if (entry.key == key) {
+      return entry;
+    }
+    if (entry.key == 0) {
+      if (!victim || victim->key != 0) {
+        victim = &entry;
+      }
+    } else if (!victim || (victim->key != 0 && (now - entry.lastSeen) >
+                                                   (now - victim->lastSeen))) {
+      victim = &entry;
+    }
+  }
+  // new device, or the least recently seen one is forgotten
+  victim->key = key;
+  victim->payloadHash = 0;
+  victim->tokens = burst * 1000UL;
+  victim->lastSeen = now;
+  victim->lastPublish = now - refresh - 1;
+  return *victim;
+}
+
+void RfDeviceFilter::refill(Entry &entry, unsigned long now) {
+  // ratePerMinute / 60000 tokens per ms
+  uint32_t capacity = burst * 1000UL;
+  uint64_t tokens = entry.tokens + static_cast<uint64_t>(now - entry.lastSeen) *
+                                       ratePerMinute / 60;
+  entry.tokens = tokens < capacity ? tokens : capacity;
+}
+
+RfDeviceFilter::Verdict RfDeviceFilter::check(const char *protocol,
+                                              const char *deviceID,
+                                              const char *message,
+                                              size_t messageLength) {
+  if (matches(denyList, protocol, deviceID) ||
+      (allowList.length() > 0 &&
+       !matches(allowList, protocol, deviceID))) {
+    return DENIED;
+  }
+  if (!changeOnly && ratePerMinute == 0) {
+    return PASS;
+  }
+
+  uint32_t key = rfHash(RF_HASH_INIT, protocol, strlen(protocol));
+  key = rfHash(key, deviceID, strlen(deviceID));
+  if (key == 0) {
+    key = 1;
+  }
+  unsigned long now = millis();
+  Entry &entry = lookup(key, now);
+  uint32_t payloadHash = rfHash(RF_HASH_INIT, message, messageLength);
+
+  refill(entry, now);
+  entry.lastSeen = now;
+
+  if (changeOnly && entry.payloadHash == payloadHash &&
+      (refresh == 0 || (now - entry.lastPublish) < refresh)) {
+    return UNCHANGED;
+  }
+  if (ratePerMinute > 0) {
+    if (entry.tokens < 1000) {
+      // a dropped change must not count as published
+      return RATE_LIMITED;
+    }
+    entry.tokens -= 1000;
+  }
+  entry.payloadHash = payloadHash;
+  entry.lastPublish = now;
+  return PASS;
+}
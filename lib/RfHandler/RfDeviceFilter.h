@@ -0,0 +1,101 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RFDEVICEFILTER_H
+#define RFDEVICEFILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <WString.h>
+
+#ifndef RF_DEVICE_TABLE_SIZE
+#define RF_DEVICE_TABLE_SIZE 32
+#endif
+
+// Slots searched for a device before the least recently seen is evicted
+#ifndef RF_DEVICE_TABLE_PROBES
+#define RF_DEVICE_TABLE_PROBES 4
+#endif
+
+// Device level filter for received messages.  Devices are identified
+// by protocol and deviceID, list entries are "<protocol>" for all
+// devices of a protocol or "<protocol>/<deviceID>", comma separated.
+//
+// Messages pass the stages in this order:
+// - deny list and allow list (if not empty)
+// - change-only: the message must differ from the last one published
+//   of this device, or the last one was published refresh ms ago
+// - token bucket per device with rate messages per minute and a burst
+//   size
+class RfDeviceFilter {
+ public:
+  enum Verdict { PASS, DENIED, UNCHANGED, RATE_LIMITED };
+
+  RfDeviceFilter();
+  ~RfDeviceFilter();
+
+  void setLists(const String &allow, const String &deny);
+  // A rate of 0 disables the rate limit.
+  void setRate(uint16_t perMinute, uint8_t burst);
+  // A refresh of 0 never publishes unchanged messages.
+  void setChangeOnly(bool enabled, unsigned long refresh);
+  Verdict check(const char *protocol, const char *deviceID,
+                const char *message, size_t messageLength);
+  void clear();
+
+  size_t devices() const;
+
+  // Match "<protocol>" or "<protocol>/<deviceID>" in a comma separated
+  // list
+  static bool matches(const String &list, const char *protocol,
+                      const char *deviceID);
+
+ private:
+  struct Entry {
+    uint32_t key;  // 0 for a free slot
+    uint32_t payloadHash;
+    uint32_t tokens;  // in 1/1000 token
+    unsigned long lastSeen;
+    unsigned long lastPublish;
+  };
+
+  Entry &lookup(uint32_t key, unsigned long now);
+  void refill(Entry &entry, unsigned long now);
+
+  String allowList;
+  String denyList;
+  uint16_t ratePerMinute;
+  uint8_t burst;
+  bool changeOnly;
+  unsigned long refresh;
+  Entry entries[RF_DEVICE_TABLE_SIZE];
+};
+
+#endif  // RFDEVICEFILTER_H
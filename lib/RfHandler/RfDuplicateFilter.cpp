@@ -0,0 +1,82 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "RfDuplicateFilter.h"
+#include "RfHash.h"
+
+RfDuplicateFilter::RfDuplicateFilter() : window(0) { clear(); }
+
+RfDuplicateFilter::~RfDuplicateFilter() = default;
+
+void RfDuplicateFilter::setWindow(unsigned long window) {
+  this->window = window;
+}
+
+void RfDuplicateFilter::clear() {
+  memset(entries, 0, sizeof(entries));
+}
+
+bool RfDuplicateFilter::isDuplicate(const char *protocol, const char *deviceID,
+                                    const char *message,
+                                    size_t messageLength) {
+  if (window == 0) {
+    return false;
+  }
+
+  uint32_t hash = rfHash(RF_HASH_INIT, protocol, strlen(protocol));
+  hash = rfHash(hash, deviceID, strlen(deviceID));
+  hash = rfHash(hash, message, messageLength);
+
+  unsigned long now = millis();
+  Entry *oldest = &entries[0];
+  for (auto &entry : entries) {
+    if (entry.used && entry.hash == hash) {
+      // the window starts with the published frame, so that periodic
+      // repeats are still published once per window
+      if ((now - entry.lastPublished) < window) {
+        return true;
+      }
+      entry.lastPublished = now;
+      return false;
+    }
+    if (!entry.used || (oldest->used && (now - entry.lastPublished) >
+                                            (now - oldest->lastPublished))) {
+      oldest = &entry;
+    }
+  }
+
+  oldest->hash = hash;
+  oldest->lastPublished = now;
+  oldest->used = true;
+  return false;
+}
@@ -0,0 +1,66 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RFDUPLICATEFILTER_H
+#define RFDUPLICATEFILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef RF_DUPLICATE_CACHE_SIZE
+#define RF_DUPLICATE_CACHE_SIZE 16
+#endif
+
+// Small LRU cache of recently seen frames.  A frame is a duplicate, if
+// the same (protocol, deviceID, message) was published less than window
+// ms before.
+class RfDuplicateFilter {
+ public:
+  RfDuplicateFilter();
+  ~RfDuplicateFilter();
+
+  // A window of 0 disables the filter.
+  void setWindow(unsigned long window);
+  unsigned long getWindow() const { return window; }
+  bool isDuplicate(const char *protocol, const char *deviceID,
+                   const char *message, size_t messageLength);
+  void clear();
+
+ private:
+  struct Entry {
+    uint32_t hash;
+    unsigned long lastPublished;
+    bool used;
+  };
+
+  unsigned long window;
+  Entry entries[RF_DUPLICATE_CACHE_SIZE];
+};
+
+#endif  // RFDUPLICATEFILTER_H
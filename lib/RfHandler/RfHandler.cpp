@@ -28,7 +28,14 @@
 */
 #include <ArduinoSimpleLogging.h>
 
+#include <LogPipeline.h>
+#include <Metrics.h>
+
 #include "RfHandler.h"
+#include "RfHash.h"
+
+// Shared work buffer for RAW transmissions, too large for the stack.
+static uint16_t rawPulses[MAXPULSESTREAMLENGTH];
 
 RfHandler::RfHandler(const Settings &settings)
     : settings(settings), rf(settings.rfTransmitterPin) {
@@ -37,7 +44,59 @@ RfHandler::RfHandler(const Settings &settings)
 
 RfHandler::~RfHandler() { rf.initReceiver(-1); }
 
-void RfHandler::transmitCode(const String &protocol, const String &message) {
+bool RfHandler::transmitCode(const String &protocol, const String &message) {
+  bool queued =
+      transmitQueue.push(protocol.c_str(), message.c_str(), message.length());
+  updateQueueMetrics();
+  if (!queued) {
+    Metrics.inc(METRIC_RF_TRANSMIT_DROPPED);
+    Logger.error.print(F("transmit queue full, drop rf signal for protocol "));
+    Logger.error.println(protocol);
+    return false;
+  }
+  return true;
+}
+
+bool RfHandler::transmitNamedCode(const String &name) {
+  if (!codeLibrary || !codeLibrary->find(name.c_str())) {
+    Logger.error.print(F("unknown code: "));
+    Logger.error.println(name);
+    return false;
+  }
+  bool queued = transmitQueue.push("", name.c_str(), name.length(), true);
+  updateQueueMetrics();
+  if (!queued) {
+    Metrics.inc(METRIC_RF_TRANSMIT_DROPPED);
+    Logger.error.print(F("transmit queue full, drop code "));
+    Logger.error.println(name);
+    return false;
+  }
+  return true;
+}
+
+void RfHandler::sendNamedCode(const char *name) {
+  // the entry may have been removed while the job was queued
+  const CodeLibrary::Entry *entry =
+      codeLibrary ? codeLibrary->find(name) : nullptr;
+  if (!entry) {
+    Metrics.inc(METRIC_RF_TRANSMIT_FAILED);
+    Logger.error.print(F("unknown code: "));
+    Logger.error.println(name);
+    return;
+  }
+  if (!entry->compiled) {
+    sendCode(entry->protocol, entry->message);
+    return;
+  }
+
+  Logger.info.print(F("transmit code "));
+  Logger.info.println(name);
+  size_t length = entry->train.decode(rawPulses, MAXPULSESTREAMLENGTH);
+  rf.sendPulseTrain(rawPulses, length);
+  Metrics.inc(METRIC_RF_TRANSMITTED);
+}
+
+void RfHandler::sendCode(const String &protocol, const String &message) {
   int result = 0;
 
   Logger.info.print(F("transmit rf signal "));
@@ -46,11 +105,20 @@ void RfHandler::transmitCode(const String &protocol, const String &message) {
   Logger.info.println(protocol);
 
   if (protocol == F("RAW")) {
-    uint16_t rawpulses[MAXPULSESTREAMLENGTH];
-    int rawlen =
-        rf.stringToPulseTrain(message, rawpulses, MAXPULSESTREAMLENGTH);
+    const auto key = PulseTrainCache::keyOf(message.c_str(), message.length());
+    int rawlen;
+    const CompactPulseTrain *cached = pulseCache.find(key);
+    if (cached) {
+      rawlen = cached->decode(rawPulses, MAXPULSESTREAMLENGTH);
+    } else {
+      rawlen = rf.stringToPulseTrain(message, rawPulses, MAXPULSESTREAMLENGTH);
+      CompactPulseTrain train;
+      if (rawlen > 0 && train.encode(rawPulses, rawlen)) {
+        pulseCache.insert(key, train);
+      }
+    }
     if (rawlen > 0) {
-      rf.sendPulseTrain(rawpulses, rawlen);
+      rf.sendPulseTrain(rawPulses, rawlen);
       result = rawlen;
     } else {
       Logger.error.print(F("invalid pulse train message: "));
@@ -68,6 +136,7 @@ void RfHandler::transmitCode(const String &protocol, const String &message) {
           Logger.error.println(F("pulse type not defined"));
           break;
       }
+      Metrics.inc(METRIC_RF_TRANSMIT_FAILED);
       return;
     }
   } else {
@@ -75,10 +144,12 @@ void RfHandler::transmitCode(const String &protocol, const String &message) {
   }
 
   if (result > 0) {
+    Metrics.inc(METRIC_RF_TRANSMITTED);
     Logger.debug.print(F("transmitted pulse train with "));
     Logger.debug.print(result);
     Logger.debug.println(F(" pulses"));
   } else {
+    Metrics.inc(METRIC_RF_TRANSMIT_FAILED);
     Logger.error.print(F("transmitting failed: "));
     switch (result) {
       case ESPiLight::ERROR_UNAVAILABLE_PROTOCOL:
@@ -99,22 +170,12 @@ void RfHandler::transmitCode(const String &protocol, const String &message) {
 
 void RfHandler::onRfCode(const String &protocol, const String &message,
                          int status, size_t repeats, const String &deviceID) {
+  protocolStats.countMatch(protocol.c_str(), status == VALID);
   if (!onReceiveCallback) return;
 
   if (status == VALID) {
-    Logger.info.print(F("rf signal received: "));
-    Logger.info.print(message);
-    Logger.info.print(F(" with protocol "));
-    Logger.info.print(protocol);
-    if (deviceID != nullptr) {
-      Logger.info.print(F(" deviceID="));
-      Logger.info.println(deviceID);
-      onReceiveCallback(protocol + "/" + deviceID, message);
-    } else {
-      Logger.info.println(deviceID);
-      onReceiveCallback(protocol, message);
-    }
-  } else {
+    onValidCode(protocol, message, deviceID);
+  } else if (Logs.enabled(Logger.DEBUG)) {
     Logger.debug.print(F("rf signal received: "));
     Logger.debug.print(message);
     Logger.debug.print(F(" protocol="));
@@ -128,7 +189,94 @@ void RfHandler::onRfCode(const String &protocol, const String &message,
   }
 }
 
+void RfHandler::injectCode(const String &protocol, const String &message,
+                           const String &deviceID) {
+  if (onReceiveCallback) {
+    onValidCode(protocol, message, deviceID);
+  }
+}
+
+void RfHandler::onValidCode(const String &protocol, const String &message,
+                            const String &deviceID) {
+  if (duplicateFilter.isDuplicate(protocol.c_str(), deviceID.c_str(),
+                                  message.c_str(), message.length())) {
+    Metrics.inc(METRIC_RF_DUPLICATES);
+    Metrics.countDuplicate(protocol.c_str());
+    if (Logs.enabled(Logger.DEBUG)) {
+      Logger.debug.print(F("rf signal duplicate suppressed: "));
+      Logger.debug.print(message);
+      Logger.debug.print(F(" protocol="));
+      Logger.debug.println(protocol);
+    }
+    return;
+  }
+  Metrics.inc(METRIC_RF_RECEIVED);
+  Metrics.countProtocol(protocol.c_str());
+  // local actions do not depend on the publish filter
+  if (ruleEngine) {
+    using namespace std::placeholders;
+    ruleEngine->evaluate(protocol.c_str(), deviceID.c_str(), message.c_str(),
+                         std::bind(&RfHandler::applyRule, this, _1));
+  }
+  RfDeviceFilter::Verdict verdict =
+      deviceFilter.check(protocol.c_str(), deviceID.c_str(), message.c_str(),
+                         message.length());
+  if (verdict != RfDeviceFilter::PASS) {
+    switch (verdict) {
+      case RfDeviceFilter::DENIED:
+        Metrics.inc(METRIC_RF_DENIED);
+        break;
+      case RfDeviceFilter::UNCHANGED:
+        Metrics.inc(METRIC_RF_UNCHANGED);
+        break;
+      default:
+        Metrics.inc(METRIC_RF_RATE_LIMITED);
+        break;
+    }
+    if (Logs.enabled(Logger.DEBUG)) {
+      Logger.debug.print(F("rf signal filtered: "));
+      Logger.debug.print(message);
+      Logger.debug.print(F(" protocol="));
+      Logger.debug.print(protocol);
+      Logger.debug.print(F(" deviceID="));
+      Logger.debug.println(deviceID);
+    }
+    return;
+  }
+  if (Logs.enabled(Logger.INFO)) {
+    Logs.setContext(protocol.c_str(), deviceID.c_str());
+    Logger.info.print(F("rf signal received: "));
+    Logger.info.print(message);
+    Logger.info.print(F(" with protocol "));
+    Logger.info.print(protocol);
+    if (deviceID != nullptr) {
+      Logger.info.print(F(" deviceID="));
+    }
+    Logger.info.println(deviceID);
+    Logs.clearContext();
+  }
+  onReceiveCallback(protocol.c_str(), deviceID.c_str(), message.c_str(),
+                    message.length());
+}
+
+void RfHandler::applyRule(const RuleEngine::Rule &rule) {
+  Metrics.inc(METRIC_RULES_MATCHED);
+  Logger.debug.print(F("rule matched: "));
+  Logger.debug.println(rule.name);
+  if (rule.code.length() > 0) {
+    transmitNamedCode(rule.code);
+  }
+  if (rule.publish.length() > 0) {
+    onReceiveCallback("rule", rule.name.c_str(), rule.publish.c_str(),
+                      rule.publish.length());
+  }
+}
+
 void RfHandler::onRfRaw(const uint16_t *pulses, size_t length) {
+  protocolStats.countTrain();
+  if (capture.active()) {
+    capture.push(pulses, length);
+  }
   if (rawMode) {
     String data = rf.pulseTrainToString(pulses, length);
     if (data.length() > 0) {
@@ -140,12 +288,46 @@ void RfHandler::onRfRaw(const uint16_t *pulses, size_t length) {
   }
 }
 
+// availableProtocols() is a JSON array of the protocol names
+static size_t protocolCount() {
+  String protocols = ESPiLight::availableProtocols();
+  size_t quotes = 0;
+  for (const char *c = protocols.c_str(); *c; ++c) {
+    if (*c == '"') {
+      quotes++;
+    }
+  }
+  return quotes / 2;
+}
+
 void RfHandler::begin() {
+  protocolStats.begin(protocolCount());
+  configureDeviceFilter();
+  startReceiver();
+  pulseCache.setPersistent(settings.rfPulseCachePersist);
+  protocolStats.observe(settings.rfAutoTune * 60000UL);
+}
+
+void RfHandler::configureDeviceFilter() {
+  deviceFilter.setLists(settings.rfDeviceAllow, settings.rfDeviceDeny);
+  deviceFilter.setRate(settings.rfDeviceRate, settings.rfDeviceBurst);
+  deviceFilter.setChangeOnly(settings.rfChangeOnly,
+                             settings.rfChangeRefresh * 1000UL);
+}
+
+void RfHandler::restartReceiver() {
+  rf.initReceiver(-1);
+  startReceiver();
+}
+
+void RfHandler::startReceiver() {
   if (0 < settings.rfReceiverPin) {
     using namespace std::placeholders;
     if (settings.rfReceiverPinPullUp) {
       // 5V protection with reverse diode needs pullup
       pinMode(settings.rfReceiverPin, INPUT_PULLUP);
+    } else {
+      pinMode(settings.rfReceiverPin, INPUT);
     }
     rf.setCallback(std::bind(&RfHandler::onRfCode, this, _1, _2, _3, _4, _5));
     rf.setPulseTrainCallBack(std::bind(&RfHandler::onRfRaw, this, _1, _2));
@@ -160,6 +342,13 @@ void RfHandler::disableReceiver() { rf.disableReceiver(); }
 void RfHandler::setEchoEnabled(bool enabled) { rf.setEchoEnabled(enabled); }
 
 void RfHandler::filterProtocols(const String &protocols) {
+  // ESPiLight parses the list on every call
+  uint32_t hash =
+      rfHash(RF_HASH_INIT, protocols.c_str(), protocols.length());
+  if (hash == protocolsHash) {
+    return;
+  }
+  protocolsHash = hash;
   rf.limitProtocols(protocols);
 }
 
@@ -167,7 +356,39 @@ String RfHandler::availableProtocols() {
   return ESPiLight::availableProtocols();
 }
 
-void RfHandler::loop() { rf.loop(); }
+String RfHandler::pulseTrainToString(const uint16_t *pulses, size_t length) {
+  return ESPiLight::pulseTrainToString(pulses, length);
+}
+
+void RfHandler::loop() {
+  protocolStats.beginPass();
+  unsigned long start = micros();
+  rf.loop();
+  protocolStats.endPass(micros() - start);
+  capture.loop(onRawCallback);
+
+  // only one transmission per pass, to keep the main loop responsive
+  const RfTransmitJob *job = transmitQueue.front();
+  if (job) {
+    if (job->named) {
+      sendNamedCode(job->message);
+    } else {
+      sendCode(job->protocol, job->message);
+    }
+    transmitQueue.pop();
+    Metrics.set(METRIC_RF_TRANSMIT_LATENCY, transmitQueue.averageLatency());
+    Metrics.set(METRIC_RF_TRANSMIT_LATENCY_MAX, transmitQueue.maxLatency());
+    Logger.debug.print(F("transmit queue latency: "));
+    Logger.debug.print(transmitQueue.lastLatency());
+    Logger.debug.print(F(" ms, pending: "));
+    Logger.debug.println(transmitQueue.size());
+  }
+}
+
+void RfHandler::updateQueueMetrics() {
+  Metrics.set(METRIC_RF_TRANSMIT_COALESCED, transmitQueue.coalesced());
+  Metrics.set(METRIC_RF_TRANSMIT_QUEUE_MAX, transmitQueue.maxDepth());
+}
 
 void RfHandler::registerReceiveHandler(const ReceiveCb &cb) {
   onReceiveCallback = cb;
@@ -38,34 +38,97 @@
 
 #include <Settings.h>
 
+#include "CodeLibrary.h"
+#include "ProtocolStats.h"
+#include "PulseTrainCache.h"
+#include "RawCapture.h"
+#include "RfDeviceFilter.h"
+#include "RfDuplicateFilter.h"
+#include "RfTransmitQueue.h"
+#include "RuleEngine.h"
+
 class RfHandler {
  public:
-  using ReceiveCb = std::function<void(const String &, const String &)>;
+  // The views are only valid during the callback
+  using ReceiveCb =
+      std::function<void(const char *protocol, const char *deviceID,
+                         const char *message, size_t messageLength)>;
 
   RfHandler(const Settings &settings);
   ~RfHandler();
   void begin();
+  // Apply changed receiver pin settings
+  void restartReceiver();
+  void setPulseCachePersistent(bool persistent) {
+    pulseCache.setPersistent(persistent);
+  }
   void loop();
+  // Received in the last loop() or transmissions pending
+  bool active() const {
+    return protocolStats.passActive() || transmitQueue.size() > 0;
+  }
   void registerReceiveHandler(const ReceiveCb &cb);
-
-  void transmitCode(const String &protocol, const String &message);
+  // Called from loop() for captured pulse trains while streaming
+  void registerRawHandler(const RawCapture::RecordCb &cb) {
+    onRawCallback = cb;
+  }
+
+  // Pass a decoded message through the receive path, as if it was
+  // received.  It is not counted by the decoder statistics.
+  void injectCode(const String &protocol, const String &message,
+                  const String &deviceID);
+
+  // Queue a code for transmission, it is sent in one of the next loop()s.
+  bool transmitCode(const String &protocol, const String &message);
+  // Queue a code of the code library by its name.
+  bool transmitNamedCode(const String &name);
+  void setCodeLibrary(const CodeLibrary *library) { codeLibrary = library; }
+  void setRuleEngine(const RuleEngine *engine) { ruleEngine = engine; }
   void setRawMode(bool mode) { rawMode = mode; }
   bool isRawModeEnabled() const { return rawMode; }
   void enableReceiver();
   void disableReceiver();
   void setEchoEnabled(bool enabled);
   void filterProtocols(const String &protocols);
+  void setDuplicateWindow(unsigned long window) {
+    duplicateFilter.setWindow(window);
+  }
+  // Apply the device filter settings
+  void configureDeviceFilter();
+  const RfDeviceFilter &devices() const { return deviceFilter; }
+  const PulseTrainCache &pulseTrains() const { return pulseCache; }
+  RawCapture &rawCapture() { return capture; }
+  ProtocolStats &decoderStats() { return protocolStats; }
 
   static String availableProtocols();
+  static String pulseTrainToString(const uint16_t *pulses, size_t length);
 
  private:
   void onRfCode(const String &protocol, const String &message, int status,
                 size_t repeats, const String &deviceID);
+  void onValidCode(const String &protocol, const String &message,
+                   const String &deviceID);
   void onRfRaw(const uint16_t *pulses, size_t length);
+  void sendCode(const String &protocol, const String &message);
+  void sendNamedCode(const char *name);
+  void updateQueueMetrics();
+  void applyRule(const RuleEngine::Rule &rule);
+  void startReceiver();
 
   const Settings &settings;
   ReceiveCb onReceiveCallback = nullptr;
+  RawCapture::RecordCb onRawCallback = nullptr;
   bool rawMode = false;
+  const CodeLibrary *codeLibrary = nullptr;
+  const RuleEngine *ruleEngine = nullptr;
+  RfDuplicateFilter duplicateFilter;
+  RfDeviceFilter deviceFilter;
+  RfTransmitQueue transmitQueue;
+  PulseTrainCache pulseCache;
+  RawCapture capture;
+  ProtocolStats protocolStats;
+  // hash of the applied protocol filter
+  uint32_t protocolsHash = 0;
 
   ESPiLight rf;
 };
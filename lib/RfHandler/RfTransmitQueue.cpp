@@ -0,0 +1,102 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "RfTransmitQueue.h"
+
+RfTransmitQueue::RfTransmitQueue()
+    : head(0),
+      count(0),
+      maxCount(0),
+      coalescedCount(0),
+      overflowCount(0),
+      processedCount(0),
+      lastLatencyMs(0),
+      maxLatencyMs(0),
+      latencySum(0) {}
+
+RfTransmitQueue::~RfTransmitQueue() = default;
+
+bool RfTransmitQueue::push(const char *protocol, const char *message,
+                           size_t messageLength, bool named) {
+  size_t protocolLength = strlen(protocol);
+  if (protocolLength >= RF_TRANSMIT_PROTOCOL_SIZE ||
+      messageLength >= RF_TRANSMIT_MESSAGE_SIZE) {
+    overflowCount++;
+    return false;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    const RfTransmitJob &job = jobs[(head + i) % RF_TRANSMIT_QUEUE_SIZE];
+    if (job.named == named && strcmp(job.protocol, protocol) == 0 &&
+        strncmp(job.message, message, messageLength) == 0 &&
+        job.message[messageLength] == '\0') {
+      coalescedCount++;
+      return true;
+    }
+  }
+
+  if (count == RF_TRANSMIT_QUEUE_SIZE) {
+    overflowCount++;
+    return false;
+  }
+
+  RfTransmitJob &job = jobs[(head + count) % RF_TRANSMIT_QUEUE_SIZE];
+  memcpy(job.protocol, protocol, protocolLength + 1);
+  memcpy(job.message, message, messageLength);
+  job.message[messageLength] = '\0';
+  job.enqueued = millis();
+  job.named = named;
+  count++;
+  if (count > maxCount) {
+    maxCount = count;
+  }
+  return true;
+}
+
+const RfTransmitJob *RfTransmitQueue::front() const {
+  return count > 0 ? &jobs[head] : nullptr;
+}
+
+void RfTransmitQueue::pop() {
+  if (count == 0) {
+    return;
+  }
+  lastLatencyMs = millis() - jobs[head].enqueued;
+  if (lastLatencyMs > maxLatencyMs) {
+    maxLatencyMs = lastLatencyMs;
+  }
+  latencySum += lastLatencyMs;
+  processedCount++;
+  head = (head + 1) % RF_TRANSMIT_QUEUE_SIZE;
+  count--;
+}
@@ -0,0 +1,96 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RFTRANSMITQUEUE_H
+#define RFTRANSMITQUEUE_H
+
+#include <stddef.h>
+
+#ifndef RF_TRANSMIT_QUEUE_SIZE
+#define RF_TRANSMIT_QUEUE_SIZE 4
+#endif
+
+#ifndef RF_TRANSMIT_PROTOCOL_SIZE
+#define RF_TRANSMIT_PROTOCOL_SIZE 32
+#endif
+
+#ifndef RF_TRANSMIT_MESSAGE_SIZE
+#define RF_TRANSMIT_MESSAGE_SIZE 256
+#endif
+
+struct RfTransmitJob {
+  char protocol[RF_TRANSMIT_PROTOCOL_SIZE];
+  char message[RF_TRANSMIT_MESSAGE_SIZE];
+  unsigned long enqueued;
+  // message is the name of a code library entry
+  bool named;
+};
+
+// Fixed capacity FIFO of pending transmissions.  Identical pending jobs
+// are coalesced into one.
+class RfTransmitQueue {
+ public:
+  RfTransmitQueue();
+  ~RfTransmitQueue();
+
+  // Returns false if the job was rejected (queue full or too large).
+  bool push(const char *protocol, const char *message, size_t messageLength,
+            bool named = false);
+  // Oldest pending job or nullptr.
+  const RfTransmitJob *front() const;
+  // Remove the oldest job and account its latency.
+  void pop();
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  size_t maxDepth() const { return maxCount; }
+  unsigned long coalesced() const { return coalescedCount; }
+  unsigned long overflows() const { return overflowCount; }
+  unsigned long processed() const { return processedCount; }
+  // Time from enqueuing until the job was transmitted (ms)
+  unsigned long lastLatency() const { return lastLatencyMs; }
+  unsigned long maxLatency() const { return maxLatencyMs; }
+  unsigned long averageLatency() const {
+    return processedCount > 0 ? latencySum / processedCount : 0;
+  }
+
+ private:
+  RfTransmitJob jobs[RF_TRANSMIT_QUEUE_SIZE];
+  size_t head;
+  size_t count;
+  size_t maxCount;
+  unsigned long coalescedCount;
+  unsigned long overflowCount;
+  unsigned long processedCount;
+  unsigned long lastLatencyMs;
+  unsigned long maxLatencyMs;
+  unsigned long latencySum;
+};
+
+#endif  // RFTRANSMITQUEUE_H
@@ -0,0 +1,267 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#include <string.h>
+
+#include <FS.h>
+
+#include <ArduinoSimpleLogging.h>
+
+#include "RfHash.h"
+#include "RuleEngine.h"
+
+namespace JsonKey {
+static const char name[] = "name";
+static const char protocol[] = "protocol";
+static const char deviceID[] = "deviceID";
+static const char match[] = "match";
+static const char code[] = "code";
+static const char publish[] = "publish";
+}  // namespace JsonKey
+
+// rule object with the match and publish objects
+static const size_t RULE_JSON_SIZE =
+    JSON_OBJECT_SIZE(6) + 2 * JSON_OBJECT_SIZE(4);
+
+static void logJsonDeserializationError(const DeserializationError &error) {
+  Logger.error.print(F("deserializeJson() failed with code "));
+  Logger.error.println(error.c_str());
+}
+
+static uint32_t hashOf(const char *str) {
+  return rfHash(RF_HASH_INIT, str, strlen(str));
+}
+
+RuleEngine::RuleEngine() : count(0) {}
+
+RuleEngine::~RuleEngine() = default;
+
+bool RuleEngine::validName(const String &name) {
+  // Names are used as the last level of a MQTT topic
+  return name.length() > 0 && name.indexOf('/') < 0 &&
+         name.indexOf('+') < 0 && name.indexOf('#') < 0;
+}
+
+bool RuleEngine::add(JsonObject object) {
+  String name = object[JsonKey::name] | "";
+  String protocol = object[JsonKey::protocol] | "";
+  String code = object[JsonKey::code] | "";
+  String publish;
+  if (!object[JsonKey::publish].isNull()) {
+    serializeJson(object[JsonKey::publish], publish);
+  }
+  if (!validName(name) || protocol.length() == 0 ||
+      (code.length() == 0 && publish.length() == 0)) {
+    Logger.error.print(F("Invalid rule: "));
+    Logger.error.println(name);
+    return false;
+  }
+
+  Rule *rule = nullptr;
+  for (auto &candidate : rules) {
+    if (candidate.name == name) {
+      rule = &candidate;
+      break;
+    }
+  }
+  if (rule == nullptr) {
+    if (count >= RULE_ENGINE_SIZE) {
+      Logger.error.println(F("Rule table is full!"));
+      return false;
+    }
+    rules.emplace_front();
+    rule = &rules.front();
+    rule->name = name;
+    count++;
+  }
+  rule->protocol = protocol;
+  rule->deviceID = object[JsonKey::deviceID] | "";
+  rule->code = code;
+  rule->publish = publish;
+  rule->protocolHash = hashOf(rule->protocol.c_str());
+  rule->deviceHash = hashOf(rule->deviceID.c_str());
+  rule->match = "";
+  rule->needles = "";
+  JsonObject match = object[JsonKey::match];
+  if (!match.isNull()) {
+    serializeJson(match, rule->match);
+    for (auto field : match) {
+      String value;
+      serializeJson(field.value(), value);
+      if (rule->needles.length() > 0) {
+        rule->needles += '\n';
+      }
+      rule->needles += '"';
+      rule->needles += field.key().c_str();
+      rule->needles += F("\":");
+      rule->needles += value;
+    }
+  }
+  return true;
+}
+
+bool RuleEngine::remove(const String &name) {
+  auto before = rules.before_begin();
+  for (auto it = rules.begin(); it != rules.end(); before = it++) {
+    if (it->name == name) {
+      rules.erase_after(before);
+      count--;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool RuleEngine::contains(const char *message, const char *needle,
+                          size_t length) {
+  // the field must start after '{' or ',' and end before ',' or '}',
+  // so that "unit":1 neither matches "subunit":1 nor "unit":10
+  for (const char *pos = strchr(message, '"'); pos;
+       pos = strchr(pos + 1, '"')) {
+    if (pos != message && pos[-1] != '{' && pos[-1] != ',') {
+      continue;
+    }
+    if (strncmp(pos, needle, length) == 0 &&
+        (pos[length] == ',' || pos[length] == '}')) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t RuleEngine::evaluate(const char *protocol, const char *deviceID,
+                            const char *message, const RuleCb &cb) const {
+  if (count == 0) {
+    return 0;
+  }
+  uint32_t protocolHash = hashOf(protocol);
+  uint32_t deviceHash = hashOf(deviceID);
+  size_t matches = 0;
+  for (const auto &rule : rules) {
+    if (rule.protocolHash != protocolHash ||
+        (rule.deviceID.length() > 0 && rule.deviceHash != deviceHash)) {
+      continue;
+    }
+    // matching rules transmit, so a hash collision must not trigger one
+    if (rule.protocol != protocol ||
+        (rule.deviceID.length() > 0 && rule.deviceID != deviceID)) {
+      continue;
+    }
+    bool matched = true;
+    const char *needle = rule.needles.c_str();
+    while (matched && *needle) {
+      const char *end = strchr(needle, '\n');
+      size_t length = end ? end - needle : strlen(needle);
+      matched = contains(message, needle, length);
+      needle += end ? length + 1 : length;
+    }
+    if (matched) {
+      matches++;
+      cb(rule);
+    }
+  }
+  return matches;
+}
+
+size_t RuleEngine::jsonSize() const {
+  size_t size = JSON_ARRAY_SIZE(count) + count * RULE_JSON_SIZE;
+  for (const auto &rule : rules) {
+    size += rule.name.length() + rule.protocol.length() +
+            rule.deviceID.length() + rule.match.length() +
+            rule.code.length() + rule.publish.length() + 6;
+  }
+  return size;
+}
+
+void RuleEngine::toJson(JsonArray array) const {
+  for (const auto &rule : rules) {
+    JsonObject object = array.createNestedObject();
+    object[JsonKey::name] = rule.name;
+    object[JsonKey::protocol] = rule.protocol;
+    if (rule.deviceID.length() > 0) {
+      object[JsonKey::deviceID] = rule.deviceID;
+    }
+    if (rule.match.length() > 0) {
+      object[JsonKey::match] = serialized(rule.match);
+    }
+    if (rule.code.length() > 0) {
+      object[JsonKey::code] = rule.code;
+    }
+    if (rule.publish.length() > 0) {
+      object[JsonKey::publish] = serialized(rule.publish);
+    }
+  }
+}
+
+bool RuleEngine::deserialize(const String &json) {
+  DynamicJsonDocument jsonDoc(RULE_JSON_SIZE + json.length());
+  DeserializationError error = deserializeJson(jsonDoc, json);
+  if (error) {
+    logJsonDeserializationError(error);
+    return false;
+  }
+  return add(jsonDoc.as<JsonObject>());
+}
+
+void RuleEngine::load() {
+  if (!SPIFFS.exists(FPSTR(RULE_ENGINE_FILE))) {
+    return;
+  }
+  File file = SPIFFS.open(FPSTR(RULE_ENGINE_FILE), "r");
+  if (!file) {
+    Logger.error.println(F("Open rule file for read failed!"));
+    return;
+  }
+  DynamicJsonDocument jsonDoc(JSON_ARRAY_SIZE(RULE_ENGINE_SIZE) +
+                              RULE_ENGINE_SIZE * RULE_JSON_SIZE +
+                              file.size());
+  DeserializationError error = deserializeJson(jsonDoc, file);
+  file.close();
+  if (error) {
+    logJsonDeserializationError(error);
+    return;
+  }
+
+  rules.clear();
+  count = 0;
+  for (JsonObject rule : jsonDoc.as<JsonArray>()) {
+    add(rule);
+  }
+  Logger.debug.print(F("Rules loaded: "));
+  Logger.debug.println(count);
+}
+
+void RuleEngine::save() const {
+  File file = SPIFFS.open(FPSTR(RULE_ENGINE_FILE), "w");
+  if (!file) {
+    Logger.error.println(F("Open rule file for write failed!"));
+    return;
+  }
+  serialize(file);
+  file.close();
+}
@@ -0,0 +1,110 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RULEENGINE_H
+#define RULEENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <forward_list>
+#include <functional>
+
+#include <WString.h>
+
+#include <ArduinoJson.h>
+
+#ifndef RULE_ENGINE_SIZE
+#define RULE_ENGINE_SIZE 16
+#endif
+
+const char PROGMEM RULE_ENGINE_FILE[] = "/rules.json";
+
+// Local actions for received RF messages, stored in SPIFFS.  A rule
+//   {"name": "hall", "protocol": "arctech_switch", "deviceID": "92",
+//    "match": {"unit": 1, "state": "on"},
+//    "code": "hall_light", "publish": {"light": "on"}}
+// matches messages of the protocol (and deviceID, if given) that
+// contain all fields of match.  It transmits the named code of the code
+// library and/or publishes the publish value as received message of
+// the pseudo protocol "rule" with the rule name as deviceID.
+//
+// Rules are compiled on load: protocol and deviceID become a hash, each
+// match field the literal '"key":value' as it appears in the compact
+// JSON messages of ESPiLight, so the receive path only compares
+// integers and searches substrings.
+class RuleEngine {
+ public:
+  struct Rule {
+    String name;
+    String protocol;
+    String deviceID;
+    String match;  // JSON object as given
+    String code;
+    String publish;  // JSON value as given
+    uint32_t protocolHash;
+    uint32_t deviceHash;
+    String needles;  // compiled match, separated by '\n'
+  };
+  using RuleCb = std::function<void(const Rule &)>;
+
+  RuleEngine();
+  ~RuleEngine();
+
+  void load();
+  void save() const;
+
+  bool remove(const String &name);
+  size_t size() const { return count; }
+  // Calls cb for all matching rules, returns the number of matches.
+  size_t evaluate(const char *protocol, const char *deviceID,
+                  const char *message, const RuleCb &cb) const;
+
+  template <typename T>
+  void serialize(T &target) const {
+    DynamicJsonDocument jsonDoc(jsonSize());
+    toJson(jsonDoc.to<JsonArray>());
+    serializeJson(jsonDoc, target);
+  }
+  // Add or replace a rule, parsed from its JSON object
+  bool deserialize(const String &json);
+
+ private:
+  static bool validName(const String &name);
+  static bool contains(const char *message, const char *needle,
+                       size_t length);
+  bool add(JsonObject rule);
+  size_t jsonSize() const;
+  void toJson(JsonArray rules) const;
+
+  std::forward_list<Rule> rules;
+  size_t count;
+};
+
+#endif  // RULEENGINE_H
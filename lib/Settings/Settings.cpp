@@ -27,7 +27,10 @@
   SOFTWARE.
 */
 
+#include <string.h>
+
 #include <algorithm>
+#include <memory>
 
 #include <FS.h>
 #include <WString.h>
@@ -43,23 +46,45 @@ char mqttBroker[] = "mqttBroker";
 char mqttBrokerPort[] = "mqttBrokerPort";
 char mqttUser[] = "mqttUser";
 char mqttPassword[] = "mqttPassword";
+char mqttAsync[] = "mqttAsync";
 char mqttRetain[] = "mqttRetain";
+char mqttOta[] = "mqttOta";
+char mqttQosProtocols[] = "mqttQosProtocols";
 char mqttReceiveTopic[] = "mqttReceiveTopic";
 char mqttSendTopic[] = "mqttSendTopic";
 char mqttStateTopic[] = "mqttStateTopic";
 char mqttVersionTopic[] = "mqttVersionTopic";
+char mqttOfflineBuffer[] = "mqttOfflineBuffer";
+char mqttOfflineSpill[] = "mqttOfflineSpill";
+char mqttMetricsInterval[] = "mqttMetricsInterval";
+char mqttBatchInterval[] = "mqttBatchInterval";
+char mqttBatchSize[] = "mqttBatchSize";
+char clusterTopic[] = "clusterTopic";
+char clusterHoldoff[] = "clusterHoldoff";
 char rfEchoMessages[] = "rfEchoMessages";
 char rfReceiverPin[] = "rfReceiverPin";
 char rfTransmitterPin[] = "rfTransmitterPin";
 char rfReceiverPinPullUp[] = "rfReceiverPinPullUp";
+char rfPulseCachePersist[] = "rfPulseCachePersist";
 char rfProtocols[] = "rfProtocols";
+char rfAutoTune[] = "rfAutoTune";
+char rfDuplicateWindow[] = "rfDuplicateWindow";
+char rfDeviceAllow[] = "rfDeviceAllow";
+char rfDeviceDeny[] = "rfDeviceDeny";
+char rfDeviceRate[] = "rfDeviceRate";
+char rfDeviceBurst[] = "rfDeviceBurst";
+char rfChangeOnly[] = "rfChangeOnly";
+char rfChangeRefresh[] = "rfChangeRefresh";
 char serialLogLevel[] = "serialLogLevel";
 char webLogLevel[] = "webLogLevel";
 char syslogLevel[] = "syslogLevel";
 char syslogHost[] = "syslogHost";
 char syslogPort[] = "syslogPort";
+char syslogStructured[] = "syslogStructured";
 char ledPin[] = "ledPin";
 char ledActiveHigh[] = "ledActiveHigh";
+char powerProfile[] = "powerProfile";
+char loadTestRate[] = "loadTestRate";
 }  // namespace JsonKey
 
 static inline bool any(std::initializer_list<bool> items) {
@@ -119,24 +144,212 @@ void Settings::onConfigChange(SettingTypeSet typeSet) const {
   }
 }
 
+namespace {
+struct BinaryHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t length;
+  uint32_t crc;
+};
+
+const uint32_t BINARY_MAGIC = 0x53333334;  // "433S"
+
+// Order of the strings in the binary settings file
+String Settings::*const stringFields[] = {
+    &Settings::deviceName,       &Settings::configPassword,
+    &Settings::mqttBroker,       &Settings::mqttUser,
+    &Settings::mqttPassword,     &Settings::mqttReceiveTopic,
+    &Settings::mqttSendTopic,    &Settings::mqttStateTopic,
+    &Settings::mqttVersionTopic, &Settings::rfProtocols,
+    &Settings::serialLogLevel,   &Settings::webLogLevel,
+    &Settings::syslogLevel,      &Settings::syslogHost,
+    &Settings::mqttQosProtocols, &Settings::rfDeviceAllow,
+    &Settings::rfDeviceDeny,     &Settings::powerProfile,
+    &Settings::clusterTopic,
+};
+
+uint32_t crc32(const uint8_t *data, size_t length) {
+  uint32_t crc = 0xffffffff;
+  while (length--) {
+    crc ^= *data++;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+}  // namespace
+
 void Settings::load() {
   Logger.debug.println(F("Loading config file."));
-  if (SPIFFS.exists(FPSTR(SETTINGS_FILE))) {
-    File file = SPIFFS.open(FPSTR(SETTINGS_FILE), "r");
-    if (!file) {
-      Logger.error.println(F("Open settings file for read failed!"));
-      return;
-    }
-    DynamicJsonDocument jsonDoc(SETTINGS_JSON_DOC_SIZE);
-    DeserializationError error = deserializeJson(jsonDoc, file);
-    if (error) {
-      logJsonDeserializationError(error);
-      return;
+  if (loadBinary()) {
+    return;
+  }
+  if (loadJson()) {
+    // migrate to the binary format for the next boot
+    saveBinary();
+  }
+}
+
+bool Settings::loadBinary() {
+  if (!SPIFFS.exists(FPSTR(SETTINGS_BINARY_FILE))) {
+    return false;
+  }
+  File file = SPIFFS.open(FPSTR(SETTINGS_BINARY_FILE), "r");
+  if (!file) {
+    Logger.error.println(F("Open binary settings file for read failed!"));
+    return false;
+  }
+  BinaryHeader header;
+  if (file.read(reinterpret_cast<uint8_t *>(&header), sizeof(header)) !=
+          sizeof(header) ||
+      header.magic != BINARY_MAGIC ||
+      header.version != SETTINGS_BINARY_VERSION ||
+      header.length < sizeof(BinaryValues)) {
+    Logger.warning.println(F("Ignore incompatible binary settings file."));
+    return false;
+  }
+  std::unique_ptr<uint8_t[]> data(new uint8_t[header.length]);
+  if (file.read(data.get(), header.length) != header.length ||
+      crc32(data.get(), header.length) != header.crc) {
+    Logger.error.println(F("Binary settings file is corrupted!"));
+    return false;
+  }
+  file.close();
+
+  // Validate the string table before anything is changed
+  const uint8_t *end = data.get() + header.length;
+  const uint8_t *pos = data.get() + sizeof(BinaryValues);
+  for (size_t i = 0; i < sizeof(stringFields) / sizeof(*stringFields); ++i) {
+    const uint8_t *terminator =
+        static_cast<const uint8_t *>(memchr(pos, '\0', end - pos));
+    if (terminator == nullptr) {
+      Logger.error.println(F("Binary settings file is corrupted!"));
+      return false;
     }
-    file.close();
+    pos = terminator + 1;
+  }
 
-    applyJson(jsonDoc);
+  BinaryValues values;
+  memcpy(&values, data.get(), sizeof(values));
+  mqttBrokerPort = values.mqttBrokerPort;
+  mqttOfflineBuffer = values.mqttOfflineBuffer;
+  mqttOfflineSpill = values.mqttOfflineSpill;
+  mqttMetricsInterval = values.mqttMetricsInterval;
+  mqttBatchInterval = values.mqttBatchInterval;
+  mqttBatchSize = values.mqttBatchSize;
+  clusterHoldoff = values.clusterHoldoff;
+  rfAutoTune = values.rfAutoTune;
+  rfDuplicateWindow = values.rfDuplicateWindow;
+  rfDeviceRate = values.rfDeviceRate;
+  rfDeviceBurst = values.rfDeviceBurst;
+  rfChangeOnly = values.rfChangeOnly;
+  rfChangeRefresh = values.rfChangeRefresh;
+  syslogPort = values.syslogPort;
+  loadTestRate = values.loadTestRate;
+  syslogStructured = values.syslogStructured;
+  rfReceiverPin = values.rfReceiverPin;
+  rfTransmitterPin = values.rfTransmitterPin;
+  ledPin = values.ledPin;
+  mqttAsync = values.mqttAsync;
+  mqttRetain = values.mqttRetain;
+  mqttOta = values.mqttOta;
+  rfEchoMessages = values.rfEchoMessages;
+  rfReceiverPinPullUp = values.rfReceiverPinPullUp;
+  rfPulseCachePersist = values.rfPulseCachePersist;
+  ledActiveHigh = values.ledActiveHigh;
+
+  pos = data.get() + sizeof(BinaryValues);
+  for (auto field : stringFields) {
+    const char *str = reinterpret_cast<const char *>(pos);
+    this->*field = str;
+    pos += strlen(str) + 1;
   }
+  return true;
+}
+
+void Settings::saveBinary() const {
+  BinaryValues values;
+  memset(&values, 0, sizeof(values));
+  values.mqttBrokerPort = mqttBrokerPort;
+  values.mqttOfflineBuffer = mqttOfflineBuffer;
+  values.mqttOfflineSpill = mqttOfflineSpill;
+  values.mqttMetricsInterval = mqttMetricsInterval;
+  values.mqttBatchInterval = mqttBatchInterval;
+  values.mqttBatchSize = mqttBatchSize;
+  values.clusterHoldoff = clusterHoldoff;
+  values.rfAutoTune = rfAutoTune;
+  values.rfDuplicateWindow = rfDuplicateWindow;
+  values.rfDeviceRate = rfDeviceRate;
+  values.rfDeviceBurst = rfDeviceBurst;
+  values.rfChangeOnly = rfChangeOnly;
+  values.rfChangeRefresh = rfChangeRefresh;
+  values.syslogPort = syslogPort;
+  values.loadTestRate = loadTestRate;
+  values.syslogStructured = syslogStructured;
+  values.rfReceiverPin = rfReceiverPin;
+  values.rfTransmitterPin = rfTransmitterPin;
+  values.ledPin = ledPin;
+  values.mqttAsync = mqttAsync;
+  values.mqttRetain = mqttRetain;
+  values.mqttOta = mqttOta;
+  values.rfEchoMessages = rfEchoMessages;
+  values.rfReceiverPinPullUp = rfReceiverPinPullUp;
+  values.rfPulseCachePersist = rfPulseCachePersist;
+  values.ledActiveHigh = ledActiveHigh;
+
+  size_t length = sizeof(values);
+  for (auto field : stringFields) {
+    length += (this->*field).length() + 1;
+  }
+  if (length > UINT16_MAX) {
+    Logger.error.println(F("Settings too large for binary settings file!"));
+    return;
+  }
+  std::unique_ptr<uint8_t[]> data(new uint8_t[length]);
+  memcpy(data.get(), &values, sizeof(values));
+  uint8_t *pos = data.get() + sizeof(values);
+  for (auto field : stringFields) {
+    const String &str = this->*field;
+    memcpy(pos, str.c_str(), str.length() + 1);
+    pos += str.length() + 1;
+  }
+
+  BinaryHeader header;
+  header.magic = BINARY_MAGIC;
+  header.version = SETTINGS_BINARY_VERSION;
+  header.length = length;
+  header.crc = crc32(data.get(), length);
+
+  File file = SPIFFS.open(FPSTR(SETTINGS_BINARY_FILE), "w");
+  if (!file) {
+    Logger.error.println(F("Open binary settings file for write failed!"));
+    return;
+  }
+  file.write(reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+  file.write(data.get(), length);
+  file.close();
+}
+
+bool Settings::loadJson() {
+  if (!SPIFFS.exists(FPSTR(SETTINGS_FILE))) {
+    return false;
+  }
+  File file = SPIFFS.open(FPSTR(SETTINGS_FILE), "r");
+  if (!file) {
+    Logger.error.println(F("Open settings file for read failed!"));
+    return false;
+  }
+  DynamicJsonDocument jsonDoc(SETTINGS_JSON_DOC_SIZE);
+  DeserializationError error = deserializeJson(jsonDoc, file);
+  if (error) {
+    logJsonDeserializationError(error);
+    return false;
+  }
+  file.close();
+
+  applyJson(jsonDoc);
+  return true;
 }
 
 void Settings::notifyAll() {
@@ -146,6 +359,12 @@ void Settings::notifyAll() {
 
 void Settings::save() {
   Logger.debug.println(F("Saving config file."));
+  saveBinary();
+  // The JSON file is a fallback if the binary format changes
+  saveJson();
+}
+
+void Settings::saveJson() const {
   File file = SPIFFS.open(FPSTR(SETTINGS_FILE), "w");
 
   if (!file) {
@@ -163,23 +382,45 @@ void Settings::doSerialize(JsonDocument &root, bool sensible) const {
   root[JsonKey::mqttBroker] = this->mqttBroker;
   root[JsonKey::mqttBrokerPort] = this->mqttBrokerPort;
   root[JsonKey::mqttUser] = this->mqttUser;
+  root[JsonKey::mqttAsync] = this->mqttAsync;
   root[JsonKey::mqttRetain] = this->mqttRetain;
+  root[JsonKey::mqttOta] = this->mqttOta;
+  root[JsonKey::mqttQosProtocols] = this->mqttQosProtocols;
   root[JsonKey::mqttReceiveTopic] = this->mqttReceiveTopic;
   root[JsonKey::mqttSendTopic] = this->mqttSendTopic;
   root[JsonKey::mqttStateTopic] = this->mqttStateTopic;
   root[JsonKey::mqttVersionTopic] = this->mqttVersionTopic;
+  root[JsonKey::mqttOfflineBuffer] = this->mqttOfflineBuffer;
+  root[JsonKey::mqttOfflineSpill] = this->mqttOfflineSpill;
+  root[JsonKey::mqttMetricsInterval] = this->mqttMetricsInterval;
+  root[JsonKey::mqttBatchInterval] = this->mqttBatchInterval;
+  root[JsonKey::mqttBatchSize] = this->mqttBatchSize;
+  root[JsonKey::clusterTopic] = this->clusterTopic;
+  root[JsonKey::clusterHoldoff] = this->clusterHoldoff;
   root[JsonKey::rfEchoMessages] = this->rfEchoMessages;
   root[JsonKey::rfReceiverPin] = this->rfReceiverPin;
   root[JsonKey::rfTransmitterPin] = this->rfTransmitterPin;
   root[JsonKey::rfReceiverPinPullUp] = this->rfReceiverPinPullUp;
+  root[JsonKey::rfPulseCachePersist] = this->rfPulseCachePersist;
   root[JsonKey::rfProtocols] = serialized(this->rfProtocols);
+  root[JsonKey::rfAutoTune] = this->rfAutoTune;
+  root[JsonKey::rfDuplicateWindow] = this->rfDuplicateWindow;
+  root[JsonKey::rfDeviceAllow] = this->rfDeviceAllow;
+  root[JsonKey::rfDeviceDeny] = this->rfDeviceDeny;
+  root[JsonKey::rfDeviceRate] = this->rfDeviceRate;
+  root[JsonKey::rfDeviceBurst] = this->rfDeviceBurst;
+  root[JsonKey::rfChangeOnly] = this->rfChangeOnly;
+  root[JsonKey::rfChangeRefresh] = this->rfChangeRefresh;
   root[JsonKey::serialLogLevel] = this->serialLogLevel;
   root[JsonKey::webLogLevel] = this->webLogLevel;
   root[JsonKey::syslogLevel] = this->syslogLevel;
   root[JsonKey::syslogHost] = this->syslogHost;
   root[JsonKey::syslogPort] = this->syslogPort;
+  root[JsonKey::syslogStructured] = this->syslogStructured;
   root[JsonKey::ledPin] = this->ledPin;
   root[JsonKey::ledActiveHigh] = this->ledActiveHigh;
+  root[JsonKey::powerProfile] = this->powerProfile;
+  root[JsonKey::loadTestRate] = this->loadTestRate;
 
   if (sensible) {
     root[JsonKey::configPassword] = this->configPassword;
@@ -213,26 +454,54 @@ Settings::SettingTypeSet Settings::applyJson(JsonDocument &parsedSettings) {
                  setIfPresent(parsedSettings, JsonKey::mqttBrokerPort,
                               mqttBrokerPort, notZero<uint16_t>()),
                  setIfPresent(parsedSettings, JsonKey::mqttUser, mqttUser),
+                 setIfPresent(parsedSettings, JsonKey::mqttAsync, mqttAsync),
                  setIfPresent(parsedSettings, JsonKey::mqttPassword,
-                              mqttPassword, notEmpty()),
-                 setIfPresent(parsedSettings, JsonKey::mqttRetain, mqttRetain),
-                 setIfPresent(parsedSettings, JsonKey::mqttReceiveTopic,
-                              mqttReceiveTopic, notEmpty()),
-                 setIfPresent(parsedSettings, JsonKey::mqttSendTopic,
-                              mqttSendTopic, notEmpty()),
-                 setIfPresent(parsedSettings, JsonKey::mqttStateTopic,
-                              mqttStateTopic, notEmpty()),
-                 setIfPresent(parsedSettings, JsonKey::mqttVersionTopic,
-                              mqttVersionTopic, notEmpty())}));
+                              mqttPassword, notEmpty())}));
+  changed.set(
+      MQTT_TOPICS,
+      any({setIfPresent(parsedSettings, JsonKey::mqttReceiveTopic,
+                        mqttReceiveTopic, notEmpty()),
+           setIfPresent(parsedSettings, JsonKey::mqttSendTopic, mqttSendTopic,
+                        notEmpty()),
+           setIfPresent(parsedSettings, JsonKey::mqttStateTopic,
+                        mqttStateTopic, notEmpty()),
+           setIfPresent(parsedSettings, JsonKey::mqttVersionTopic,
+                        mqttVersionTopic, notEmpty()),
+           setIfPresent(parsedSettings, JsonKey::clusterTopic, clusterTopic)}));
+  changed.set(
+      MQTT_PUBLISH,
+      any({setIfPresent(parsedSettings, JsonKey::mqttRetain, mqttRetain),
+           setIfPresent(parsedSettings, JsonKey::mqttOta, mqttOta),
+           setIfPresent(parsedSettings, JsonKey::mqttQosProtocols,
+                        mqttQosProtocols),
+           setIfPresent(parsedSettings, JsonKey::mqttMetricsInterval,
+                        mqttMetricsInterval),
+           setIfPresent(parsedSettings, JsonKey::mqttBatchInterval,
+                        mqttBatchInterval),
+           setIfPresent(parsedSettings, JsonKey::mqttBatchSize, mqttBatchSize,
+                        notZero<uint16_t>()),
+           setIfPresent(parsedSettings, JsonKey::clusterHoldoff,
+                        clusterHoldoff)}));
+  changed.set(
+      MQTT_OFFLINE,
+      any({setIfPresent(parsedSettings, JsonKey::mqttOfflineBuffer,
+                        mqttOfflineBuffer),
+           setIfPresent(parsedSettings, JsonKey::mqttOfflineSpill,
+                        mqttOfflineSpill)}));
   changed.set(RF_ECHO, (setIfPresent(parsedSettings, JsonKey::rfEchoMessages,
                                      rfEchoMessages)));
+  changed.set(RF_CONFIG, setIfPresent(parsedSettings, JsonKey::rfTransmitterPin,
+                                      rfTransmitterPin));
   changed.set(
-      RF_CONFIG,
+      RF_RECEIVER,
       any({setIfPresent(parsedSettings, JsonKey::rfReceiverPin, rfReceiverPin),
-           setIfPresent(parsedSettings, JsonKey::rfTransmitterPin,
-                        rfTransmitterPin),
            setIfPresent(parsedSettings, JsonKey::rfReceiverPinPullUp,
                         rfReceiverPinPullUp)}));
+  changed.set(RF_CACHE,
+              setIfPresent(parsedSettings, JsonKey::rfPulseCachePersist,
+                           rfPulseCachePersist));
+  changed.set(RF_PROTOCOL,
+              setIfPresent(parsedSettings, JsonKey::rfAutoTune, rfAutoTune));
   if (!parsedSettings[JsonKey::rfProtocols].isNull()) {
     String buff;
     serializeJson(parsedSettings[JsonKey::rfProtocols], buff);
@@ -241,6 +510,18 @@ Settings::SettingTypeSet Settings::applyJson(JsonDocument &parsedSettings) {
       changed.set(RF_PROTOCOL, true);
     }
   }
+  changed.set(
+      RF_FILTER,
+      any({setIfPresent(parsedSettings, JsonKey::rfDuplicateWindow,
+                        rfDuplicateWindow),
+           setIfPresent(parsedSettings, JsonKey::rfDeviceAllow, rfDeviceAllow),
+           setIfPresent(parsedSettings, JsonKey::rfDeviceDeny, rfDeviceDeny),
+           setIfPresent(parsedSettings, JsonKey::rfDeviceRate, rfDeviceRate),
+           setIfPresent(parsedSettings, JsonKey::rfDeviceBurst, rfDeviceBurst,
+                        notZero<uint8_t>()),
+           setIfPresent(parsedSettings, JsonKey::rfChangeOnly, rfChangeOnly),
+           setIfPresent(parsedSettings, JsonKey::rfChangeRefresh,
+                        rfChangeRefresh)}));
   changed.set(
       LOGGING,
       any({setIfPresent(parsedSettings, JsonKey::serialLogLevel,
@@ -251,11 +532,17 @@ Settings::SettingTypeSet Settings::applyJson(JsonDocument &parsedSettings) {
       any({setIfPresent(parsedSettings, JsonKey::syslogLevel, syslogLevel),
            setIfPresent(parsedSettings, JsonKey::syslogHost, syslogHost),
            setIfPresent(parsedSettings, JsonKey::syslogPort, syslogPort,
-                        notZero<uint16_t>())}));
+                        notZero<uint16_t>()),
+           setIfPresent(parsedSettings, JsonKey::syslogStructured,
+                        syslogStructured)}));
   changed.set(STATUSLED,
               any({setIfPresent(parsedSettings, JsonKey::ledPin, ledPin),
                    setIfPresent(parsedSettings, JsonKey::ledActiveHigh,
                                 ledActiveHigh)}));
+  changed.set(POWER, setIfPresent(parsedSettings, JsonKey::powerProfile,
+                                  powerProfile));
+  changed.set(LOAD_TEST, setIfPresent(parsedSettings, JsonKey::loadTestRate,
+                                      loadTestRate, notZero<uint16_t>()));
 
   if (hasValidPassword() != pass_before) {
     changed.set(MQTT);
@@ -270,6 +557,9 @@ void Settings::reset() {
     Logger.info.println(F("Remove config file."));
     SPIFFS.remove(FPSTR(SETTINGS_FILE));
   }
+  if (SPIFFS.exists(FPSTR(SETTINGS_BINARY_FILE))) {
+    SPIFFS.remove(FPSTR(SETTINGS_BINARY_FILE));
+  }
 }
 
 bool Settings::hasValidPassword() const {
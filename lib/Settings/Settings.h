@@ -40,6 +40,10 @@
 #include <ArduinoJson.h>
 
 const char PROGMEM SETTINGS_FILE[] = "/settings.json";
+const char PROGMEM SETTINGS_BINARY_FILE[] = "/settings.bin";
+
+// Increment on every change of Settings::BinaryValues or stringFields
+const uint16_t SETTINGS_BINARY_VERSION = 11;
 
 const char PROGMEM DEFAULT_NAME[] = "rf434";
 const char PROGMEM DEFAULT_PASSWORD[] = "MQTT433gateway";
@@ -50,17 +54,26 @@ const char PROGMEM DEFAULT_VERSION_TOPIC_SUFFIX[] = "/version";
 const char PROGMEM DEFAULT_RF_PROTOCOLS[] = "[]";
 const char PROGMEM DEFAULT_SERIAL_LOG_LEVEL[] = "debug";
 const char PROGMEM DEFAULT_WEB_LOG_LEVEL[] = "info";
+const char PROGMEM DEFAULT_POWER_PROFILE[] = "performance";
 
 enum SettingType {
   BASE,
   WEB_CONFIG,
-  MQTT,
+  MQTT,          // broker connection, requires a new MqttClient
+  MQTT_TOPICS,   // resubscribe or reconnect only
+  MQTT_PUBLISH,  // read on each publish
+  MQTT_OFFLINE,
   RF_ECHO,
-  RF_CONFIG,
+  RF_CONFIG,  // transmitter, requires a new RfHandler
+  RF_RECEIVER,
+  RF_CACHE,
   RF_PROTOCOL,
+  RF_FILTER,
   LOGGING,
   SYSLOG,
   STATUSLED,
+  POWER,
+  LOAD_TEST,
   _END
 };
 
@@ -78,27 +91,50 @@ class Settings {
         mqttBrokerPort(1883),
         mqttUser(""),
         mqttPassword(""),
+        mqttAsync(false),
         mqttRetain(true),
+        mqttOta(false),
+        mqttQosProtocols(""),
         mqttReceiveTopic(deviceName + FPSTR(DEFAULT_RECEIVE_TOPIC_SUFFIX)),
         mqttSendTopic(deviceName + FPSTR(DEFAULT_SEND_TOPIC_SUFFIX)),
         mqttStateTopic(deviceName + FPSTR(DEFAULT_STATE_TOPIC_SUFFIX)),
         mqttVersionTopic(deviceName + FPSTR(DEFAULT_VERSION_TOPIC_SUFFIX)),
+        mqttOfflineBuffer(8),
+        mqttOfflineSpill(0),
+        mqttMetricsInterval(60),
+        mqttBatchInterval(0),
+        mqttBatchSize(10),
+        clusterTopic(""),
+        clusterHoldoff(100),
         rfEchoMessages(false),
         rfReceiverPin(12),  // avoid 0, 2, 15, 16
         rfTransmitterPin(4),
         rfReceiverPinPullUp(true),
+        rfPulseCachePersist(false),
         rfProtocols(FPSTR(DEFAULT_RF_PROTOCOLS)),
+        rfAutoTune(0),
+        rfDuplicateWindow(0),
+        rfDeviceAllow(""),
+        rfDeviceDeny(""),
+        rfDeviceRate(0),
+        rfDeviceBurst(3),
+        rfChangeOnly(false),
+        rfChangeRefresh(0),
         serialLogLevel(FPSTR(DEFAULT_SERIAL_LOG_LEVEL)),
         webLogLevel(FPSTR(DEFAULT_WEB_LOG_LEVEL)),
         syslogLevel(""),
         syslogHost(""),
         syslogPort(514),
+        syslogStructured(false),
         ledPin(LED_BUILTIN),
-        ledActiveHigh(false) {}
+        ledActiveHigh(false),
+        powerProfile(FPSTR(DEFAULT_POWER_PROFILE)),
+        loadTestRate(10) {}
   ~Settings();
   void load();
   void save();
   void notifyAll();
+  void notify(SettingTypeSet typeSet) const { onConfigChange(typeSet); }
   template <typename T>
   void serialize(T &target, bool pretty, bool sensible = true) const {
     DynamicJsonDocument jsonDoc(SETTINGS_JSON_DOC_SIZE);
@@ -121,23 +157,57 @@ class Settings {
   uint16_t mqttBrokerPort;
   String mqttUser;
   String mqttPassword;
+  bool mqttAsync;
   bool mqttRetain;
+  // Accept pull update requests on <mqttSendTopic>ota
+  bool mqttOta;
+  // Comma separated protocols published with QoS 1
+  String mqttQosProtocols;
   String mqttReceiveTopic;
   String mqttSendTopic;
   String mqttStateTopic;
   String mqttVersionTopic;
+  uint16_t mqttOfflineBuffer;
+  uint16_t mqttOfflineSpill;
+  uint16_t mqttMetricsInterval;
+  // ms to collect events for a batch publish, 0 disables
+  uint16_t mqttBatchInterval;
+  uint16_t mqttBatchSize;
+  // Shared topic of the gateways that arbitrate frames, empty disables
+  String clusterTopic;
+  // ms to wait for the claims of other gateways
+  uint16_t clusterHoldoff;
   bool rfEchoMessages;
   int8_t rfReceiverPin;
   int8_t rfTransmitterPin;
   bool rfReceiverPinPullUp;
+  bool rfPulseCachePersist;
   String rfProtocols;
+  // Minutes to observe before rfProtocols is reduced, 0 disables
+  uint16_t rfAutoTune;
+  uint16_t rfDuplicateWindow;
+  // Comma separated "<protocol>" or "<protocol>/<deviceID>" entries
+  String rfDeviceAllow;
+  String rfDeviceDeny;
+  // Messages per minute and device, 0 disables
+  uint16_t rfDeviceRate;
+  uint8_t rfDeviceBurst;
+  bool rfChangeOnly;
+  // Seconds after which an unchanged message is published again
+  uint16_t rfChangeRefresh;
   String serialLogLevel;
   String webLogLevel;
   String syslogLevel;
   String syslogHost;
   uint16_t syslogPort;
+  // Add RFC 5424 structured data with protocol and deviceID
+  bool syslogStructured;
   uint8_t ledPin;
   bool ledActiveHigh;
+  // "performance", "balanced" or "powersave"
+  String powerProfile;
+  // Synthetic events per second of the loadTest debug flag
+  uint16_t loadTestRate;
 
  private:
   struct SettingListener {
@@ -149,6 +219,40 @@ class Settings {
         : type(type), callback(cb) {}
   };
 
+  // Fixed size part of the binary settings file
+  struct BinaryValues {
+    uint16_t mqttBrokerPort;
+    uint16_t mqttOfflineBuffer;
+    uint16_t mqttOfflineSpill;
+    uint16_t mqttMetricsInterval;
+    uint16_t mqttBatchInterval;
+    uint16_t mqttBatchSize;
+    uint16_t clusterHoldoff;
+    uint16_t rfAutoTune;
+    uint16_t rfDuplicateWindow;
+    uint16_t rfDeviceRate;
+    uint16_t rfChangeRefresh;
+    uint16_t syslogPort;
+    uint16_t loadTestRate;
+    int8_t rfReceiverPin;
+    int8_t rfTransmitterPin;
+    uint8_t ledPin;
+    uint8_t rfDeviceBurst;
+    bool mqttAsync;
+    bool mqttRetain;
+    bool mqttOta;
+    bool rfEchoMessages;
+    bool rfReceiverPinPullUp;
+    bool rfPulseCachePersist;
+    bool rfChangeOnly;
+    bool syslogStructured;
+    bool ledActiveHigh;
+  };
+
+  bool loadBinary();
+  void saveBinary() const;
+  bool loadJson();
+  void saveJson() const;
   void onConfigChange(SettingTypeSet typeSet) const;
   SettingTypeSet applyJson(JsonDocument &parsedSettings);
   void doSerialize(JsonDocument &jsonDoc, bool sensible = true) const;
@@ -29,23 +29,22 @@
 
 #include <Arduino.h>
 
-#include <LED.h>
-
 #include "StatusLED.h"
 
 StatusLED::StatusLED(uint8_t led_pin, bool activeHigh)
-    : led(nullptr), beatLED(nullptr), _state(normalOperation) {
+    : _state(normalOperation) {
   if (activeHigh) {
-    led = new LED(led_pin, true);
+    led.emplace(led_pin, true);
   } else {
-    led = new LEDOpenDrain(led_pin);
+    led.emplace<LEDOpenDrain>(led_pin);
   }
-  beatLED = new HeartbeatFlashing(*led);
+  beatLED.emplace(*led);
 };
 
 StatusLED::~StatusLED() {
-  delete beatLED;
-  delete led;
+  // the heartbeat refers to the LED
+  beatLED.reset();
+  led.reset();
 }
 
 void StatusLED::loop() {
@@ -31,6 +31,9 @@
 #define STATUSLED_H
 
 #include <HeartbeatFlashing.h>
+#include <LED.h>
+
+#include <StaticSlot.h>
 
 class StatusLED {
  public:
@@ -51,8 +54,10 @@ class StatusLED {
   void setState(States state);
 
  private:
-  LED *led;
-  HeartbeatFlashing *beatLED;
+  StaticSlot<LED, (sizeof(LEDOpenDrain) > sizeof(LED) ? sizeof(LEDOpenDrain)
+                                                     : sizeof(LED))>
+      led;
+  StaticSlot<HeartbeatFlashing> beatLED;
   States _state;
 };
 
@@ -27,15 +27,126 @@
   SOFTWARE.
 */
 
+#include <string.h>
+
 #include <algorithm>
 
+#include <Arduino.h>
+
 #include "SyslogLogTarget.h"
 
+// facility user, severity informational
+static const char PROGMEM SYSLOG_PRI[] = "<14>1 - ";
+static const char PROGMEM SYSLOG_APP[] = " MQTT433gateway - - ";
+static const char PROGMEM SYSLOG_SD_ID[] = "[rf@32473";
+
+SyslogLogTarget::SyslogLogTarget()
+    : port(514),
+      structured(false),
+      headerLength(0),
+      length(0),
+      firstLine(0) {
+  protocol[0] = '\0';
+  deviceID[0] = '\0';
+}
+
 void SyslogLogTarget::begin(const String &name, const String &server,
-                            uint16_t port) {
-  syslog.server(server.c_str(), port);
-  syslog.deviceHostname(name.c_str());
-  syslog.appName("MQTT433gateway");
+                            uint16_t port, bool structured) {
+  send();
+  hostname = name;
+  this->server = server;
+  this->port = port;
+  this->structured = structured;
+}
+
+void SyslogLogTarget::append(const char *data, size_t size) {
+  size = std::min(size, sizeof(datagram) - length);
+  memcpy(datagram + length, data, size);
+  length += size;
+}
+
+void SyslogLogTarget::appendP(PGM_P data) {
+  size_t size = std::min(strlen_P(data), sizeof(datagram) - length);
+  memcpy_P(datagram + length, data, size);
+  length += size;
+}
+
+void SyslogLogTarget::appendParam(const char *name, const char *value) {
+  append(" ", 1);
+  append(name, strlen(name));
+  append("=\"", 2);
+  for (const char *pos = value; *pos; ++pos) {
+    if (*pos == '"' || *pos == '\\' || *pos == ']') {
+      append("\\", 1);
+    }
+    append(pos, 1);
+  }
+  append("\"", 1);
 }
 
-void SyslogLogTarget::flush(const char *buff) { syslog.log(buff); }
+bool SyslogLogTarget::sameContext(const LogContext &context) const {
+  return !structured || (strncmp(protocol, context.protocol,
+                                 LOG_PIPELINE_CONTEXT_SIZE) == 0 &&
+                         strncmp(deviceID, context.deviceID,
+                                 LOG_PIPELINE_CONTEXT_SIZE) == 0);
+}
+
+void SyslogLogTarget::startMessage(const LogContext &context) {
+  // HEADER: PRI VERSION TIMESTAMP HOSTNAME APP-NAME PROCID MSGID, the
+  // gateway has no clock, the receiver adds the time.
+  length = 0;
+  appendP(SYSLOG_PRI);
+  append(hostname.c_str(), hostname.length());
+  appendP(SYSLOG_APP);
+
+  strncpy(protocol, structured ? context.protocol : "", sizeof(protocol));
+  protocol[sizeof(protocol) - 1] = '\0';
+  strncpy(deviceID, structured ? context.deviceID : "", sizeof(deviceID));
+  deviceID[sizeof(deviceID) - 1] = '\0';
+  if (protocol[0] != '\0') {
+    appendP(SYSLOG_SD_ID);
+    appendParam("protocol", protocol);
+    if (deviceID[0] != '\0') {
+      appendParam("deviceID", deviceID);
+    }
+    append("] ", 2);
+  } else {
+    append("- ", 2);
+  }
+  headerLength = length;
+  firstLine = millis();
+}
+
+void SyslogLogTarget::writeLine(const char *line, size_t size,
+                                const LogContext &context) {
+  if (length > headerLength &&
+      (!sameContext(context) || length + size > sizeof(datagram))) {
+    send();
+  }
+  if (length == 0) {
+    startMessage(context);
+  }
+  // longer lines are truncated
+  append(line, size);
+}
+
+void SyslogLogTarget::loop() {
+  if (length > headerLength && (millis() - firstLine) >= SYSLOG_SEND_INTERVAL) {
+    send();
+  }
+}
+
+void SyslogLogTarget::send() {
+  if (length > headerLength) {
+    size_t size = length;
+    if (datagram[size - 1] == '\n') {
+      size--;
+    }
+    if (udp.beginPacket(server.c_str(), port)) {
+      udp.write(reinterpret_cast<const uint8_t *>(datagram), size);
+      udp.endPacket();
+    }
+  }
+  length = 0;
+  headerLength = 0;
+}
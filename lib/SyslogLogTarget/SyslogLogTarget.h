@@ -30,25 +30,55 @@
 #ifndef SYSLOGLOGTARGET_H
 #define SYSLOGLOGTARGET_H
 
-#define SYSLOG_BUFFSIZE 64
-
+#include <WString.h>
 #include <WiFiUdp.h>
 
-#include <LineBufferProxy.h>
-#include <Syslog.h>
+#include <LogPipeline.h>
 
-class SyslogLogTarget : public LineBufferProxy<SYSLOG_BUFFSIZE> {
- public:
-  SyslogLogTarget() : udp(), syslog(udp) {}
+// Fits into one Ethernet frame without fragmentation
+#ifndef SYSLOG_DATAGRAM_SIZE
+#define SYSLOG_DATAGRAM_SIZE 1400
+#endif
+
+// Maximum time in ms a line waits for further lines of its datagram
+#ifndef SYSLOG_SEND_INTERVAL
+#define SYSLOG_SEND_INTERVAL 1000
+#endif
 
-  void begin(const String& name, const String& server, uint16_t port);
+// Sends the log as RFC 5424 messages over UDP.  Lines are collected in
+// one datagram until it is full or SYSLOG_SEND_INTERVAL has passed.
+// With structured data, lines of an RF device are sent in their own
+// message with the SD element [rf@32473 protocol=".." deviceID=".."].
+class SyslogLogTarget : public LogSink {
+ public:
+  SyslogLogTarget();
 
- protected:
-  void flush(const char* buff) override;
+  void begin(const String& name, const String& server, uint16_t port,
+             bool structured);
+  void writeLine(const char* line, size_t length,
+                 const LogContext& context) override;
+  void loop();
 
  private:
+  void startMessage(const LogContext& context);
+  bool sameContext(const LogContext& context) const;
+  void append(const char* data, size_t length);
+  void appendP(PGM_P data);
+  void appendParam(const char* name, const char* value);
+  void send();
+
   WiFiUDP udp;
-  Syslog syslog;
+  String hostname;
+  String server;
+  uint16_t port;
+  bool structured;
+
+  char datagram[SYSLOG_DATAGRAM_SIZE];
+  size_t headerLength;
+  size_t length;
+  unsigned long firstLine;
+  char protocol[LOG_PIPELINE_CONTEXT_SIZE + 1];
+  char deviceID[LOG_PIPELINE_CONTEXT_SIZE + 1];
 };
 
 #endif  // SYSLOGLOGTARGET_H
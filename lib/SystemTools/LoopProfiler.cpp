@@ -0,0 +1,159 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <Arduino.h>
+
+#include "LoopProfiler.h"
+
+void LoopProfiler::Histogram::add(uint32_t duration) {
+  size_t bucket = 0;
+  uint32_t limit = LOOPPROFILER_BUCKET_BASE;
+  while (bucket < LOOPPROFILER_BUCKETS - 1 && duration >= limit) {
+    bucket++;
+    limit <<= 1;
+  }
+  buckets[bucket]++;
+  if (count == 0 || duration < min) {
+    min = duration;
+  }
+  if (duration > max) {
+    max = duration;
+  }
+  count++;
+  total += duration;
+}
+
+// Upper bound of the bucket containing the given percentile
+uint32_t LoopProfiler::Histogram::percentile(uint8_t percent) const {
+  if (count == 0) {
+    return 0;
+  }
+  uint64_t threshold = (static_cast<uint64_t>(count) * percent + 99) / 100;
+  uint64_t sum = 0;
+  uint32_t limit = LOOPPROFILER_BUCKET_BASE;
+  for (size_t bucket = 0; bucket < LOOPPROFILER_BUCKETS - 1; ++bucket) {
+    sum += buckets[bucket];
+    if (sum >= threshold) {
+      return std::min(limit, max);
+    }
+    limit <<= 1;
+  }
+  return max;
+}
+
+LoopProfiler::LoopProfiler(const __FlashStringHelper *const *names,
+                           size_t stageCount, unsigned long interval)
+    : names(names),
+      stageCount(std::min(stageCount, size_t(LOOPPROFILER_MAX_STAGES))),
+      interval(interval),
+      lastReport(millis()),
+      loopStart(0),
+      lapStart(0) {
+  reset();
+}
+
+LoopProfiler::~LoopProfiler() = default;
+
+void LoopProfiler::startLoop() {
+  uint32_t now = micros();
+  if (loopStart != 0) {
+    loopTime.add(now - loopStart);
+  }
+  loopStart = now;
+  lapStart = now;
+}
+
+void LoopProfiler::lap(size_t stage) {
+  uint32_t now = micros();
+  if (stage < stageCount) {
+    stages[stage].add(now - lapStart);
+  }
+  lapStart = now;
+}
+
+void LoopProfiler::reset() {
+  memset(&loopTime, 0, sizeof(loopTime));
+  memset(stages, 0, sizeof(stages));
+  loopStart = 0;
+}
+
+bool LoopProfiler::reportDue() {
+  unsigned long now = millis();
+  if ((now - lastReport) < interval) {
+    return false;
+  }
+  lastReport = now;
+  return true;
+}
+
+static void appendHistogram(String &json, const LoopProfiler::Histogram &h) {
+  json += F("{\"count\":");
+  json += h.count;
+  json += F(",\"min\":");
+  json += h.min;
+  json += F(",\"max\":");
+  json += h.max;
+  json += F(",\"avg\":");
+  json += h.count > 0 ? static_cast<uint32_t>(h.total / h.count) : 0;
+  json += F(",\"p99\":");
+  json += h.percentile(99);
+  json += F(",\"hist\":[");
+  for (size_t bucket = 0; bucket < LOOPPROFILER_BUCKETS; ++bucket) {
+    if (bucket > 0) {
+      json += ',';
+    }
+    json += h.buckets[bucket];
+  }
+  json += F("]}");
+}
+
+String LoopProfiler::toJson() const {
+  String json;
+  json.reserve(128 + (stageCount + 1) * 160);
+  json += F("{\"unit\":\"us\",\"bucketBase\":");
+  json += LOOPPROFILER_BUCKET_BASE;
+  json += F(",\"loop\":");
+  appendHistogram(json, loopTime);
+  json += F(",\"stages\":{");
+  for (size_t stage = 0; stage < stageCount; ++stage) {
+    if (stage > 0) {
+      json += ',';
+    }
+    json += '"';
+    json += names[stage];
+    json += F("\":");
+    appendHistogram(json, stages[stage]);
+  }
+  json += F("}}");
+  return json;
+}
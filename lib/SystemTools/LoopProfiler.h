@@ -0,0 +1,98 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef LOOPPROFILER_H
+#define LOOPPROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <WString.h>
+
+#ifndef LOOPPROFILER_MAX_STAGES
+#define LOOPPROFILER_MAX_STAGES 8
+#endif
+
+// Bucket i counts durations below (LOOPPROFILER_BUCKET_BASE << i) us,
+// the last bucket counts all longer durations.
+#ifndef LOOPPROFILER_BUCKETS
+#define LOOPPROFILER_BUCKETS 16
+#endif
+
+#ifndef LOOPPROFILER_BUCKET_BASE
+#define LOOPPROFILER_BUCKET_BASE 8
+#endif
+
+#ifndef LOOPPROFILER_INTERVAL
+#define LOOPPROFILER_INTERVAL 10000
+#endif
+
+// Measures the time spent in the stages of the main loop.  Call
+// startLoop() at the beginning of each iteration and lap() after each
+// stage.
+class LoopProfiler {
+ public:
+  struct Histogram {
+    uint32_t buckets[LOOPPROFILER_BUCKETS];
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+
+    void add(uint32_t duration);
+    uint32_t percentile(uint8_t percent) const;
+  };
+
+  // names must be valid while the profiler exists (PROGMEM strings)
+  LoopProfiler(const __FlashStringHelper *const *names, size_t stageCount,
+               unsigned long interval = LOOPPROFILER_INTERVAL);
+  ~LoopProfiler();
+  LoopProfiler(const LoopProfiler &) = delete;
+  LoopProfiler &operator=(const LoopProfiler &) = delete;
+
+  void startLoop();
+  void lap(size_t stage);
+  void reset();
+  // True once per interval, used to publish the statistics.
+  bool reportDue();
+
+  String toJson() const;
+
+ private:
+  const __FlashStringHelper *const *names;
+  const size_t stageCount;
+  const unsigned long interval;
+  unsigned long lastReport;
+  uint32_t loopStart;
+  uint32_t lapStart;
+  Histogram loopTime;
+  Histogram stages[LOOPPROFILER_MAX_STAGES];
+};
+
+#endif  // LOOPPROFILER_H
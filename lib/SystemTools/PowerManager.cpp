@@ -0,0 +1,104 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#include <Arduino.h>
+#include <ArduinoSimpleLogging.h>
+
+extern "C" {
+#include <user_interface.h>
+}
+
+#include "PowerManager.h"
+
+static const char PROGMEM PROFILE_BALANCED[] = "balanced";
+static const char PROGMEM PROFILE_POWERSAVE[] = "powersave";
+
+PowerManager::PowerManager()
+    : profile(PERFORMANCE),
+      defaultFrequency(SYS_CPU_80MHZ),
+      defaultSleepMode(WIFI_NONE_SLEEP),
+      boosted(false),
+      boostStart(0) {}
+
+void PowerManager::begin() {
+  defaultFrequency = system_get_cpu_freq();
+  defaultSleepMode = WiFi.getSleepMode();
+}
+
+void PowerManager::setCpuFrequency(uint8_t mhz) {
+  if (system_get_cpu_freq() != mhz) {
+    system_update_cpu_freq(mhz);
+  }
+}
+
+void PowerManager::setProfile(const String &name) {
+  if (name == FPSTR(PROFILE_BALANCED)) {
+    profile = BALANCED;
+  } else if (name == FPSTR(PROFILE_POWERSAVE)) {
+    profile = POWERSAVE;
+  } else {
+    profile = PERFORMANCE;
+  }
+  boosted = false;
+
+  if (profile == PERFORMANCE) {
+    setCpuFrequency(defaultFrequency);
+    WiFi.setSleepMode(defaultSleepMode);
+  } else {
+    setCpuFrequency(SYS_CPU_80MHZ);
+    WiFi.setSleepMode(profile == POWERSAVE ? WIFI_MODEM_SLEEP
+                                           : defaultSleepMode);
+  }
+  Logger.debug.print(F("Power profile: "));
+  Logger.debug.println(name);
+}
+
+void PowerManager::boost() {
+  if (profile == PERFORMANCE) {
+    return;
+  }
+  boostStart = millis();
+  if (!boosted) {
+    boosted = true;
+    setCpuFrequency(SYS_CPU_160MHZ);
+  }
+}
+
+void PowerManager::loop() {
+  if (profile == PERFORMANCE) {
+    return;
+  }
+  if (boosted && millis() - boostStart >= POWER_BOOST_TIME) {
+    boosted = false;
+    setCpuFrequency(SYS_CPU_80MHZ);
+  }
+  if (profile == POWERSAVE && !boosted) {
+    // the receiver is interrupt driven, pulse trains are buffered
+    delay(POWER_IDLE_DELAY);
+  }
+}
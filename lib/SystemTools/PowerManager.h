@@ -0,0 +1,80 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef POWERMANAGER_H
+#define POWERMANAGER_H
+
+#include <stdint.h>
+
+#include <ESP8266WiFi.h>
+#include <WString.h>
+
+// Time the CPU stays at 160 MHz after RF activity
+#ifndef POWER_BOOST_TIME
+#define POWER_BOOST_TIME 2000
+#endif
+
+// Delay of an idle main loop with the powersave profile in ms
+#ifndef POWER_IDLE_DELAY
+#define POWER_IDLE_DELAY 10
+#endif
+
+// Runtime power profiles:
+// - performance: CPU frequency of the build and the default Wi-Fi sleep
+//   mode, the main loop never sleeps
+// - balanced: 80 MHz, boosted to 160 MHz during receive and transmit
+//   bursts
+// - powersave: like balanced, in addition Wi-Fi modem sleep and a delay
+//   in idle loops, so that the modem can actually sleep
+class PowerManager {
+ public:
+  enum Profile { PERFORMANCE, BALANCED, POWERSAVE };
+
+  PowerManager();
+
+  // Remember the defaults, call before the first setProfile()
+  void begin();
+  void setProfile(const String &name);
+  Profile getProfile() const { return profile; }
+  // Keep the CPU at full speed for the next POWER_BOOST_TIME ms
+  void boost();
+  // Call at the end of the main loop
+  void loop();
+
+ private:
+  void setCpuFrequency(uint8_t mhz);
+
+  Profile profile;
+  uint8_t defaultFrequency;
+  WiFiSleepType_t defaultSleepMode;
+  bool boosted;
+  unsigned long boostStart;
+};
+
+#endif  // POWERMANAGER_H
@@ -0,0 +1,254 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <FS.h>
+
+#include <ArduinoSimpleLogging.h>
+#include <LogPipeline.h>
+#include <Updater.h>
+
+#include "PullUpdater.h"
+
+static int hexDigit(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+static bool parseDigest(const String &hex, uint8_t *digest) {
+  if (hex.length() != 2 * br_sha256_SIZE) {
+    return false;
+  }
+  for (size_t i = 0; i < br_sha256_SIZE; ++i) {
+    int high = hexDigit(hex[2 * i]);
+    int low = hexDigit(hex[2 * i + 1]);
+    if (high < 0 || low < 0) {
+      return false;
+    }
+    digest[i] = (high << 4) | low;
+  }
+  return true;
+}
+
+static bool isApplied(const uint8_t *digest) {
+  File file = SPIFFS.open(FPSTR(PULL_UPDATE_FILE), "r");
+  if (!file) {
+    return false;
+  }
+  uint8_t applied[br_sha256_SIZE];
+  bool same = file.read(applied, sizeof(applied)) == sizeof(applied) &&
+              memcmp(applied, digest, sizeof(applied)) == 0;
+  file.close();
+  return same;
+}
+
+static void storeApplied(const uint8_t *digest) {
+  File file = SPIFFS.open(FPSTR(PULL_UPDATE_FILE), "w");
+  if (!file) {
+    Logger.error.println(F("Open pull update file for write failed!"));
+    return;
+  }
+  file.write(digest, br_sha256_SIZE);
+  file.close();
+}
+
+PullUpdater::PullUpdater()
+    : running(false), size(0), written(0), reportedStep(0), lastData(0) {}
+
+PullUpdater::~PullUpdater() = default;
+
+bool PullUpdater::start(const String &url, const String &sha256) {
+  if (running || Update.isRunning()) {
+    Logger.warning.println(F("Pull update: an update is already running"));
+    return false;
+  }
+  size = 0;
+  written = 0;
+  if (!parseDigest(sha256, digest)) {
+    report(F("failed"), F("invalid sha256"));
+    return false;
+  }
+  if (isApplied(digest)) {
+    // e.g. a retained request delivered again after the restart
+    Logger.info.println(F("Pull update: image already applied"));
+    report(F("current"));
+    return false;
+  }
+  Logger.info.print(F("Pull update from "));
+  Logger.info.println(url);
+  if (!http.begin(client, url)) {
+    report(F("failed"), F("invalid url"));
+    return false;
+  }
+  http.setTimeout(PULL_UPDATE_TIMEOUT);
+  // Connect and headers block, the download itself runs in loop()
+  int code = http.GET();
+  if (code != HTTP_CODE_OK) {
+    Logger.error.print(F("Pull update: HTTP request failed: "));
+    Logger.error.println(code < 0 ? HTTPClient::errorToString(code)
+                                  : String(code));
+    http.end();
+    report(F("failed"), F("download failed"));
+    return false;
+  }
+  int length = http.getSize();
+  if (length <= 0) {
+    http.end();
+    report(F("failed"), F("unknown size"));
+    return false;
+  }
+  if (!Update.begin(length)) {
+    Update.printError(Logger.error);
+    http.end();
+    report(F("failed"), F("image too large"));
+    return false;
+  }
+  br_sha256_init(&sha);
+  size = length;
+  reportedStep = 0;
+  lastData = millis();
+  running = true;
+  report(F("download"));
+  return true;
+}
+
+void PullUpdater::loop() {
+  if (!running) {
+    return;
+  }
+  WiFiClient *stream = http.getStreamPtr();
+  int available = stream ? stream->available() : 0;
+  if (available <= 0) {
+    if (!stream || !stream->connected()) {
+      fail(F("connection lost"));
+    } else if (millis() - lastData > PULL_UPDATE_TIMEOUT) {
+      fail(F("timeout"));
+    }
+    return;
+  }
+
+  uint8_t buffer[PULL_UPDATE_CHUNK];
+  size_t length = std::min(static_cast<size_t>(available),
+                           std::min(sizeof(buffer), size - written));
+  length = stream->readBytes(buffer, length);
+  lastData = millis();
+  br_sha256_update(&sha, buffer, length);
+
+  if (written + length == size) {
+    // Keep the last chunk back, so that a wrong image is never complete
+    if (!verify(buffer, length)) {
+      return;
+    }
+    running = false;
+    http.end();
+    storeApplied(digest);
+    Logger.info.println(F("Pull update verified. Rebooting..."));
+    report(F("done"));
+    if (onCommit) {
+      onCommit();
+    }
+    Logs.flush();
+    delay(500);
+    ESP.restart();
+    return;
+  }
+
+  if (Update.write(buffer, length) != length) {
+    Update.printError(Logger.error);
+    fail(F("flash write failed"));
+    return;
+  }
+  written += length;
+  uint8_t step = written * 10 / size;
+  if (step != reportedStep) {
+    reportedStep = step;
+    report(F("download"));
+  }
+}
+
+bool PullUpdater::verify(uint8_t *last, size_t length) {
+  uint8_t actual[br_sha256_SIZE];
+  br_sha256_out(&sha, actual);
+  if (memcmp(actual, digest, sizeof(actual)) != 0) {
+    fail(F("sha256 mismatch"));
+    return false;
+  }
+  if (Update.write(last, length) != length || !Update.end()) {
+    Update.printError(Logger.error);
+    fail(F("flash write failed"));
+    return false;
+  }
+  written += length;
+  return true;
+}
+
+void PullUpdater::fail(const __FlashStringHelper *reason) {
+  running = false;
+  if (Update.isRunning()) {
+    // incomplete images are discarded
+    Update.end(false);
+  }
+  http.end();
+  Logger.error.print(F("Pull update failed: "));
+  Logger.error.println(reason);
+  report(F("failed"), reason);
+}
+
+void PullUpdater::report(const __FlashStringHelper *state,
+                         const __FlashStringHelper *reason) {
+  if (!onStatus) {
+    return;
+  }
+  String json;
+  json.reserve(96);
+  json += F("{\"state\":\"");
+  json += state;
+  json += F("\",\"progress\":");
+  json += written;
+  json += F(",\"size\":");
+  json += size;
+  if (reason) {
+    json += F(",\"error\":\"");
+    json += reason;
+    json += '"';
+  }
+  json += '}';
+  onStatus(json);
+}
@@ -0,0 +1,97 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PULLUPDATER_H
+#define PULLUPDATER_H
+
+#include <stdint.h>
+
+#include <functional>
+
+#include <ESP8266HTTPClient.h>
+#include <pgmspace.h>
+#include <WString.h>
+#include <bearssl/bearssl_hash.h>
+
+// Bytes downloaded and written per loop
+#ifndef PULL_UPDATE_CHUNK
+#define PULL_UPDATE_CHUNK 512
+#endif
+
+// Abort a download without data for this time in ms
+#ifndef PULL_UPDATE_TIMEOUT
+#define PULL_UPDATE_TIMEOUT 10000
+#endif
+
+// SHA-256 of the last applied image
+const char PROGMEM PULL_UPDATE_FILE[] = "/ota.sha256";
+
+// Firmware update pulled from an HTTP server while the gateway keeps
+// running.  The image is written to the free sketch space in small
+// steps from loop(), checked against its SHA-256 before the last chunk
+// is written, and activated with a restart.  A request for the image
+// that was applied last is ignored.  gzip compressed images
+// are expanded by the boot loader.
+class PullUpdater {
+ public:
+  // JSON status document, see status()
+  using StatusCb = std::function<void(const String &json)>;
+  using CommitCb = std::function<void()>;
+
+  PullUpdater();
+  ~PullUpdater();
+
+  // sha256 is the image digest as 64 hex digits
+  bool start(const String &url, const String &sha256);
+  bool isRunning() const { return running; }
+  void registerStatusHandler(const StatusCb &cb) { onStatus = cb; }
+  // Called after the image is verified, before the restart
+  void registerCommitHandler(const CommitCb &cb) { onCommit = cb; }
+  void loop();
+
+ private:
+  void fail(const __FlashStringHelper *reason);
+  void report(const __FlashStringHelper *state,
+              const __FlashStringHelper *reason = nullptr);
+  bool verify(uint8_t *last, size_t length);
+
+  WiFiClient client;
+  HTTPClient http;
+  br_sha256_context sha;
+  uint8_t digest[br_sha256_SIZE];
+  bool running;
+  size_t size;
+  size_t written;
+  uint8_t reportedStep;
+  unsigned long lastData;
+  StatusCb onStatus;
+  CommitCb onCommit;
+};
+
+#endif  // PULLUPDATER_H
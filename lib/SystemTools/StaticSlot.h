@@ -0,0 +1,89 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef STATICSLOT_H
+#define STATICSLOT_H
+
+#include <stddef.h>
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Storage for at most one object of T (or a subclass of at most Size
+// bytes), constructed and destroyed in place.  Subsystems are rebuilt
+// on settings changes; keeping them in a slot instead of new/delete
+// leaves the heap untouched, so it does not fragment.
+//
+// A slot is used like a pointer to the object: it converts to true
+// while the object exists and forwards ->.
+template <typename T, size_t Size = sizeof(T)>
+class StaticSlot {
+ public:
+  StaticSlot() : object(nullptr) {}
+  ~StaticSlot() { reset(); }
+  StaticSlot(const StaticSlot &) = delete;
+  StaticSlot &operator=(const StaticSlot &) = delete;
+
+  // Destroys the current object and constructs a new one
+  template <typename U = T, typename... Args>
+  U *emplace(Args &&... args) {
+    static_assert(std::is_base_of<T, U>::value, "not a subclass");
+    static_assert(sizeof(U) <= Size, "slot too small");
+    static_assert(alignof(U) <= alignof(Storage), "slot misaligned");
+    static_assert(std::is_same<T, U>::value ||
+                      std::has_virtual_destructor<T>::value,
+                  "subclasses need a virtual destructor");
+    reset();
+    U *created = new (&storage) U(std::forward<Args>(args)...);
+    object = created;
+    return created;
+  }
+
+  void reset() {
+    if (object) {
+      object->~T();
+      object = nullptr;
+    }
+  }
+
+  T *get() const { return object; }
+  T *operator->() const { return object; }
+  T &operator*() const { return *object; }
+  explicit operator bool() const { return object != nullptr; }
+
+ private:
+  using Storage =
+      typename std::aligned_storage<Size, alignof(max_align_t)>::type;
+
+  Storage storage;
+  T *object;
+};
+
+#endif  // STATICSLOT_H
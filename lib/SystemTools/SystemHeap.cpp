@@ -27,20 +27,129 @@
   SOFTWARE.
 */
 
+#include <string.h>
+
 #include <Esp.h>
 
 #include "SystemHeap.h"
 
+static const char PROGMEM TAG_SYSTEM[] = "system";
+static const char PROGMEM TAG_WEB[] = "web";
+static const char PROGMEM TAG_MQTT[] = "mqtt";
+static const char PROGMEM TAG_RF[] = "rf";
+
+static const char* const TAG_NAMES[HEAP_TAG_COUNT] = {TAG_SYSTEM, TAG_WEB,
+                                                      TAG_MQTT, TAG_RF};
+
 SystemHeap::SystemHeap(Print& output, unsigned int interval)
-    : output(output), interval(interval), lastOutput(millis()){};
+    : output(output),
+      interval(interval),
+      lastOutput(millis()),
+      lastFree(ESP.getFreeHeap()),
+      minFree(lastFree),
+      intervalMinFree(lastFree) {
+  memset(tags, 0, sizeof(tags));
+  memset(&report, 0, sizeof(report));
+};
 
 SystemHeap::~SystemHeap() = default;
 
-void SystemHeap::loop() {
+void SystemHeap::account(HeapTag tag) {
+  uint32_t now = ESP.getFreeHeap();
+  TagStats& stats = tags[tag];
+  if (now < lastFree) {
+    uint32_t size = lastFree - now;
+    stats.allocations++;
+    stats.allocated += size;
+    if (size > stats.maxAllocated) {
+      stats.maxAllocated = size;
+    }
+  } else if (now > lastFree) {
+    stats.releases++;
+    stats.released += now - lastFree;
+  }
+  lastFree = now;
+  if (now < intervalMinFree) {
+    intervalMinFree = now;
+  }
+  if (now < minFree) {
+    minFree = now;
+  }
+}
+
+bool SystemHeap::loop() {
+  account(HEAP_TAG_SYSTEM);
+
   unsigned long now = millis();
-  if ((now - lastOutput) > interval) {
-    output.print(F("Free heap: "));
-    output.println(ESP.getFreeHeap());
-    lastOutput = now;
+  if ((now - lastOutput) <= interval) {
+    return false;
+  }
+
+  ESP.getHeapStats(&report.freeHeap, &report.maxFreeBlock,
+                   &report.fragmentation);
+  report.intervalMinFree = intervalMinFree;
+  memcpy(report.tags, tags, sizeof(tags));
+  memset(tags, 0, sizeof(tags));
+  intervalMinFree = report.freeHeap;
+
+  output.print(F("Free heap: "));
+  output.print(report.freeHeap);
+  output.print(F(" max block: "));
+  output.print(report.maxFreeBlock);
+  output.print(F(" fragmentation: "));
+  output.print(report.fragmentation);
+  output.print(F("% low watermark: "));
+  output.println(minFree);
+  for (size_t tag = 0; tag < HEAP_TAG_COUNT; ++tag) {
+    const TagStats& stats = report.tags[tag];
+    if (stats.allocations == 0) {
+      continue;
+    }
+    output.print(F("  "));
+    output.print(FPSTR(TAG_NAMES[tag]));
+    output.print(F(": "));
+    output.print(stats.allocations);
+    output.print(F(" allocations, largest "));
+    output.println(stats.maxAllocated);
+  }
+
+  lastOutput = now;
+  return true;
+}
+
+String SystemHeap::toJson() const {
+  String json;
+  json.reserve(128 + HEAP_TAG_COUNT * 96);
+  json += F("{\"free\":");
+  json += report.freeHeap;
+  json += F(",\"maxBlock\":");
+  json += report.maxFreeBlock;
+  json += F(",\"fragmentation\":");
+  json += report.fragmentation;
+  json += F(",\"intervalMin\":");
+  json += report.intervalMinFree;
+  json += F(",\"lowWatermark\":");
+  json += minFree;
+  json += F(",\"tags\":{");
+  for (size_t tag = 0; tag < HEAP_TAG_COUNT; ++tag) {
+    const TagStats& stats = report.tags[tag];
+    if (tag > 0) {
+      json += ',';
+    }
+    json += '"';
+    json += FPSTR(TAG_NAMES[tag]);
+    json += F("\":{\"allocations\":");
+    json += stats.allocations;
+    json += F(",\"allocated\":");
+    json += stats.allocated;
+    json += F(",\"maxAllocated\":");
+    json += stats.maxAllocated;
+    json += F(",\"releases\":");
+    json += stats.releases;
+    json += F(",\"released\":");
+    json += stats.released;
+    json += '}';
   }
+  json += F("}}");
+  return json;
 }
@@ -30,22 +30,61 @@
 #ifndef SYSTEMHEAP_H
 #define SYSTEMHEAP_H
 
+#include <stdint.h>
+
 #include <Print.h>
+#include <WString.h>
 
 #ifndef SYSTEMHEAP_INTERVAL
 #define SYSTEMHEAP_INTERVAL 1000
 #endif
 
+// Subsystems the heap changes are accounted to
+enum HeapTag {
+  HEAP_TAG_SYSTEM,
+  HEAP_TAG_WEB,
+  HEAP_TAG_MQTT,
+  HEAP_TAG_RF,
+  HEAP_TAG_COUNT
+};
+
 class SystemHeap {
  public:
+  struct TagStats {
+    // Number of stages that left the heap smaller/larger
+    uint32_t allocations;
+    uint32_t releases;
+    uint32_t allocated;
+    uint32_t released;
+    uint32_t maxAllocated;
+  };
+  struct Report {
+    uint32_t freeHeap;
+    uint16_t maxFreeBlock;
+    uint8_t fragmentation;
+    uint32_t intervalMinFree;
+    TagStats tags[HEAP_TAG_COUNT];
+  };
+
   SystemHeap(Print& output, unsigned int interval = SYSTEMHEAP_INTERVAL);
   ~SystemHeap();
-  void loop();
+  // Returns true when a new report was created.
+  bool loop();
+  // Account the heap change since the last call to tag.
+  void account(HeapTag tag);
+  const Report& lastReport() const { return report; }
+  uint32_t lowWatermark() const { return minFree; }
+  String toJson() const;
 
  private:
   Print& output;
   const unsigned long interval;
   unsigned long lastOutput;
+  uint32_t lastFree;
+  uint32_t minFree;
+  uint32_t intervalMinFree;
+  TagStats tags[HEAP_TAG_COUNT];
+  Report report;
 };
 
 #endif  // SYSTEMHEAP_H
@@ -35,17 +35,43 @@ SystemLoad::SystemLoad(Print& output, unsigned int interval)
     : output(output),
       interval(interval),
       lastOutput(millis()),
-      itterations(0){};
+      itterations(0),
+      lastLoop(micros()),
+      maxLoop(0),
+      boostedTime(0),
+      slowLoops(0){};
 
 SystemLoad::~SystemLoad() = default;
 
 void SystemLoad::loop() {
   unsigned long now = millis();
+  unsigned long nowUs = micros();
+  unsigned long loopTime = nowUs - lastLoop;
+  lastLoop = nowUs;
   itterations++;
+  if (loopTime > maxLoop) {
+    maxLoop = loopTime;
+  }
+  if (loopTime > SYSTEMLOAD_SLOW_LOOP * 1000UL) {
+    slowLoops++;
+  }
+  if (ESP.getCpuFreqMHz() > 80) {
+    boostedTime += loopTime;
+  }
   if ((now - lastOutput) > interval) {
     output.print(F("Loop iterations since last interval: "));
-    output.println(itterations);
+    output.print(itterations);
+    output.print(F(", max loop: "));
+    output.print(maxLoop / 1000);
+    output.print(F(" ms, slow loops (may miss rf frames): "));
+    output.print(slowLoops);
+    output.print(F(", at 160 MHz: "));
+    output.print(boostedTime / (10UL * (now - lastOutput)));
+    output.println(F(" %"));
     itterations = 0;
+    maxLoop = 0;
+    boostedTime = 0;
+    slowLoops = 0;
     lastOutput = now;
   }
 }
@@ -36,6 +36,12 @@
 #define SYSTEMLOAD_INTERVAL 1000
 #endif
 
+// Loops longer than this (in ms) may overflow the buffer of received
+// pulse trains
+#ifndef SYSTEMLOAD_SLOW_LOOP
+#define SYSTEMLOAD_SLOW_LOOP 50
+#endif
+
 class SystemLoad {
  public:
   SystemLoad(Print& output, unsigned int interval = SYSTEMLOAD_INTERVAL);
@@ -47,6 +53,10 @@ class SystemLoad {
   const unsigned long interval;
   unsigned long lastOutput;
   unsigned int itterations;
+  unsigned long lastLoop;     // us
+  unsigned long maxLoop;      // us
+  unsigned long boostedTime;  // us with more than 80 MHz
+  unsigned int slowLoops;
 };
 
 #endif  // SYSTEMLOAD_H
@@ -0,0 +1,83 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "ChunkedResponse.h"
+
+ChunkedResponse::ChunkedResponse(ESP8266WebServer& server, int code,
+                                 const __FlashStringHelper* contentType)
+    : server(server), length(0), finished(false) {
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(code, contentType, String());
+}
+
+ChunkedResponse::~ChunkedResponse() { end(); }
+
+size_t ChunkedResponse::write(uint8_t c) {
+  if (length == sizeof(buffer)) {
+    sendBuffer();
+  }
+  buffer[length++] = c;
+  return 1;
+}
+
+size_t ChunkedResponse::write(const uint8_t* data, size_t size) {
+  size_t remaining = size;
+  while (remaining > 0) {
+    if (length == sizeof(buffer)) {
+      sendBuffer();
+    }
+    size_t part = std::min(remaining, sizeof(buffer) - length);
+    memcpy(buffer + length, data, part);
+    length += part;
+    data += part;
+    remaining -= part;
+  }
+  return size;
+}
+
+void ChunkedResponse::sendBuffer() {
+  if (length > 0) {
+    server.sendContent(buffer, length);
+    length = 0;
+  }
+}
+
+void ChunkedResponse::end() {
+  if (finished) {
+    return;
+  }
+  sendBuffer();
+  // an empty chunk terminates the response
+  server.sendContent(buffer, 0);
+  finished = true;
+}
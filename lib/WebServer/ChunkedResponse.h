@@ -0,0 +1,63 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef CHUNKEDRESPONSE_H
+#define CHUNKEDRESPONSE_H
+
+#include <ESP8266WebServer.h>
+#include <Print.h>
+
+#ifndef CHUNKED_RESPONSE_BUFFER_SIZE
+#define CHUNKED_RESPONSE_BUFFER_SIZE 256
+#endif
+
+// Print target that sends a response with chunked transfer encoding,
+// so large documents do not need to be assembled in a String first.
+class ChunkedResponse : public Print {
+ public:
+  ChunkedResponse(ESP8266WebServer& server, int code,
+                  const __FlashStringHelper* contentType);
+  ~ChunkedResponse();
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  // Send the pending data and the final chunk.  Called by the destructor
+  // if not done before.
+  void end();
+
+ private:
+  void sendBuffer();
+
+  ESP8266WebServer& server;
+  char buffer[CHUNKED_RESPONSE_BUFFER_SIZE];
+  size_t length;
+  bool finished;
+};
+
+#endif  // CHUNKEDRESPONSE_H
@@ -32,31 +32,58 @@
 
 #include <ArduinoJson.h>
 #include <ArduinoSimpleLogging.h>
+#include <LogPipeline.h>
+
+#include <Metrics.h>
+#include <RawCapture.h>
+#include <RfHash.h>
 
 #include <Version.h>
 
-#include "../../dist/index.html.gz.h"
+#include "../../dist/web_assets.gz.h"
+#include "ChunkedResponse.h"
 #include "ConfigWebServer.h"
 
 const char PROGMEM PLAIN[] = "plain";
 const char PROGMEM TEXT_PLAIN[] = "text/plain";
 const char PROGMEM TEXT_HTML[] = "text/html";
+const char PROGMEM TEXT_CSS[] = "text/css";
+const char PROGMEM APPLICATION_JAVASCRIPT[] = "application/javascript";
 const char PROGMEM APPLICATION_JSON[] = "application/json";
 
+const char PROGMEM IF_NONE_MATCH[] = "If-None-Match";
+
 const char PROGMEM URL_ROOT[] = "/";
+const char PROGMEM URL_APP_CSS[] = "/app.css";
+const char PROGMEM URL_APP_JS[] = "/app.js";
 const char PROGMEM URL_SYSTEM[] = "/system";
 const char PROGMEM URL_CONFIG[] = "/config";
 const char PROGMEM URL_PROTOCOLS[] = "/protocols";
 const char PROGMEM URL_DEBUG[] = "/debug";
+const char PROGMEM URL_DEBUG_PROFILE[] = "/debug/profile";
+const char PROGMEM URL_DEBUG_CAPTURE[] = "/debug/capture";
+const char PROGMEM URL_DEBUG_PROTOCOLS[] = "/debug/protocols";
 const char PROGMEM URL_FIRMWARE[] = "/firmware";
+const char PROGMEM URL_CODES[] = "/codes";
+const char PROGMEM URL_RULES[] = "/rules";
+const char PROGMEM URL_METRICS[] = "/metrics";
 
 void ConfigWebServer::begin() {
+  static const char* headerKeys[] = {IF_NONE_MATCH};
+  server.collectHeaders(headerKeys, 1);
+
   server.on(FPSTR(URL_ROOT), authenticated([this]() {
               Logger.debug.println(F("Webserver: frontend request"));
-              server.sendHeader(F("Content-Encoding"), F("gzip"));
-              server.setContentLength(index_html_gz_len);
-              server.send(200, FPSTR(TEXT_HTML), "");
-              server.sendContent_P(index_html_gz, index_html_gz_len);
+              sendAsset(FPSTR(URL_ROOT), FPSTR(TEXT_HTML), index_html_gz,
+                        index_html_gz_len, false);
+            }));
+  server.on(FPSTR(URL_APP_CSS), HTTP_GET, authenticated([this]() {
+              sendAsset(FPSTR(URL_APP_CSS), FPSTR(TEXT_CSS), app_css_gz,
+                        app_css_gz_len, true);
+            }));
+  server.on(FPSTR(URL_APP_JS), HTTP_GET, authenticated([this]() {
+              sendAsset(FPSTR(URL_APP_JS), FPSTR(APPLICATION_JAVASCRIPT),
+                        app_js_gz, app_js_gz_len, true);
             }));
 
   server.on(FPSTR(URL_SYSTEM), HTTP_GET, authenticated([this]() {
@@ -80,15 +107,9 @@ void ConfigWebServer::begin() {
               onConfigGet();
             }));
 
-  server.on(FPSTR(URL_PROTOCOLS), HTTP_GET, authenticated([this]() {
-              Logger.debug.println(F("Webserver: protocols GET"));
-              if (protocolProvider) {
-                server.send(200, FPSTR(APPLICATION_JSON), protocolProvider());
-              } else {
-                Logger.warning.println(F("No protocolProvider avaiable."));
-                server.send_P(200, APPLICATION_JSON, PSTR("[]"));
-              }
-            }));
+  server.on(
+      FPSTR(URL_PROTOCOLS), HTTP_GET,
+      authenticated(std::bind(&::ConfigWebServer::onProtocolsGet, this)));
 
   server.on(FPSTR(URL_DEBUG), HTTP_GET, authenticated([&]() {
               Logger.debug.println(F("Webserver: debug GET"));
@@ -98,9 +119,68 @@ void ConfigWebServer::begin() {
   server.on(FPSTR(URL_DEBUG), HTTP_PUT,
             authenticated(std::bind(&::ConfigWebServer::onDebugFlagSet, this)));
 
+  server.on(FPSTR(URL_CODES), HTTP_GET,
+            authenticated(std::bind(&::ConfigWebServer::onCodesGet, this)));
+
+  server.on(FPSTR(URL_CODES), HTTP_PUT,
+            authenticated(std::bind(&::ConfigWebServer::onCodesPut, this)));
+
+  server.on(
+      FPSTR(URL_CODES), HTTP_DELETE,
+      authenticated(std::bind(&::ConfigWebServer::onCodesDelete, this)));
+
+  server.on(FPSTR(URL_RULES), HTTP_GET,
+            authenticated(std::bind(&::ConfigWebServer::onRulesGet, this)));
+
+  server.on(FPSTR(URL_RULES), HTTP_PUT,
+            authenticated(std::bind(&::ConfigWebServer::onRulesPut, this)));
+
+  server.on(
+      FPSTR(URL_RULES), HTTP_DELETE,
+      authenticated(std::bind(&::ConfigWebServer::onRulesDelete, this)));
+
+  server.on(FPSTR(URL_DEBUG_PROFILE), HTTP_GET, authenticated([this]() {
+              Logger.debug.println(F("Webserver: debug profile GET"));
+              String profile;
+              if (profileProvider) {
+                profile = profileProvider();
+              }
+              if (profile.length() > 0) {
+                server.send(200, FPSTR(APPLICATION_JSON), profile);
+              } else {
+                server.send_P(404, TEXT_PLAIN,
+                              PSTR("Enable the loopProfile debug flag!"));
+              }
+            }));
+
+  server.on(FPSTR(URL_DEBUG_PROTOCOLS), HTTP_GET, authenticated([this]() {
+              Logger.debug.println(F("Webserver: debug protocols GET"));
+              String stats;
+              if (protocolStatsProvider) {
+                stats = protocolStatsProvider();
+              }
+              if (stats.length() > 0) {
+                server.send(200, FPSTR(APPLICATION_JSON), stats);
+              } else {
+                server.send_P(503, TEXT_PLAIN,
+                              PSTR("No Rf instance available!"));
+              }
+            }));
+
+  server.on(FPSTR(URL_DEBUG_CAPTURE), HTTP_GET, authenticated([this]() {
+              Logger.debug.println(F("Webserver: debug capture GET"));
+              onCaptureGet();
+            }));
+
+  server.on(FPSTR(URL_METRICS), HTTP_GET, authenticated([this]() {
+              Logger.debug.println(F("Webserver: metrics GET"));
+              server.send(200, FPSTR(APPLICATION_JSON), Metrics.toJson());
+            }));
+
   server.on(FPSTR(URL_FIRMWARE), HTTP_GET, authenticated([this]() {
               Logger.debug.println(F("Webserver: firmware GET"));
-              server.send(200, FPSTR(APPLICATION_JSON), fwJsonVersion(true));
+              ChunkedResponse response(server, 200, FPSTR(APPLICATION_JSON));
+              printFwJsonVersion(response, true);
             }));
 
   server.on(
@@ -110,6 +190,7 @@ void ConfigWebServer::begin() {
 
   Logger.debug.println(F("Starting webserver and websocket server."));
   wsLogTarget.begin();
+  wsEventStream.begin();
   server.begin();
 }
 
@@ -125,9 +206,66 @@ void ConfigWebServer::registerDebugFlagHandler(
 }
 
 void ConfigWebServer::onConfigGet() {
-  String buff;
-  settings.serialize(buff, true, false);
-  server.send(200, FPSTR(APPLICATION_JSON), buff);
+  ChunkedResponse response(server, 200, FPSTR(APPLICATION_JSON));
+  settings.serialize(response, true, false);
+}
+
+static String etagString(uint32_t etag) {
+  return String('"') + String(etag, HEX) + '"';
+}
+
+bool ConfigWebServer::notModified(uint32_t etag) {
+  if (etag == 0 || server.header(FPSTR(IF_NONE_MATCH)) != etagString(etag)) {
+    return false;
+  }
+  server.send(304, FPSTR(TEXT_PLAIN), String());
+  return true;
+}
+
+void ConfigWebServer::sendAsset(const __FlashStringHelper* url,
+                                const __FlashStringHelper* contentType,
+                                PGM_P data, size_t length, bool versioned) {
+  // The assets are part of the firmware image
+  String key = fwVersion() + url + length;
+  uint32_t etag = rfHash(RF_HASH_INIT, key.c_str(), key.length());
+  server.sendHeader(F("Cache-Control"),
+                    versioned ? F("private, max-age=31536000, immutable")
+                              : F("no-cache"));
+  server.sendHeader(F("ETag"), etagString(etag));
+  if (notModified(etag)) {
+    return;
+  }
+  server.sendHeader(F("Content-Encoding"), F("gzip"));
+  // the background transfer needs a connection per response
+  server.sendHeader(F("Connection"), F("close"));
+  server.setContentLength(length);
+  server.send(200, contentType, String());
+  if (!assetTransfer.start(server.client(), data, length)) {
+    server.sendContent_P(data, length);
+  }
+}
+
+void ConfigWebServer::onProtocolsGet() {
+  Logger.debug.println(F("Webserver: protocols GET"));
+  if (!protocolProvider) {
+    Logger.warning.println(F("No protocolProvider avaiable."));
+    server.send_P(200, APPLICATION_JSON, PSTR("[]"));
+    return;
+  }
+  // The list is fixed for a firmware, so let the browser cache it
+  server.sendHeader(F("Cache-Control"), F("no-cache"));
+  if (protocolsETag != 0) {
+    server.sendHeader(F("ETag"), etagString(protocolsETag));
+  }
+  if (notModified(protocolsETag)) {
+    return;
+  }
+  String protocols = protocolProvider();
+  if (protocolsETag == 0) {
+    protocolsETag = rfHash(RF_HASH_INIT, protocols.c_str(), protocols.length());
+    server.sendHeader(F("ETag"), etagString(protocolsETag));
+  }
+  server.send(200, FPSTR(APPLICATION_JSON), protocols);
 }
 
 void ConfigWebServer::onSystemCommand() {
@@ -188,9 +326,98 @@ void ConfigWebServer::onDebugFlagGet() {
   for (const auto& debugFlagHandler : debugFlagHandlers) {
     jsonDoc[debugFlagHandler.name] = debugFlagHandler.getState();
   }
-  String result;
-  serializeJson(jsonDoc, result);
-  server.send(200, FPSTR(APPLICATION_JSON), result);
+  ChunkedResponse response(server, 200, FPSTR(APPLICATION_JSON));
+  serializeJson(jsonDoc, response);
+}
+
+void ConfigWebServer::onCodesGet() {
+  Logger.debug.println(F("Webserver: codes GET"));
+  if (!codeLibrary) {
+    server.send_P(200, APPLICATION_JSON, PSTR("[]"));
+    return;
+  }
+  ChunkedResponse response(server, 200, FPSTR(APPLICATION_JSON));
+  codeLibrary->serialize(response);
+}
+
+void ConfigWebServer::onCodesPut() {
+  Logger.debug.println(F("Webserver: codes PUT"));
+  if (!codeLibrary) {
+    server.send_P(503, TEXT_PLAIN, PSTR("No code library available!"));
+    return;
+  }
+  if (!codeLibrary->deserialize(server.arg(FPSTR(PLAIN)))) {
+    server.send_P(400, TEXT_PLAIN, PSTR("Cannot store code!"));
+    return;
+  }
+  codeLibrary->save();
+  onCodesGet();
+}
+
+void ConfigWebServer::onRulesGet() {
+  Logger.debug.println(F("Webserver: rules GET"));
+  if (!ruleEngine) {
+    server.send_P(200, APPLICATION_JSON, PSTR("[]"));
+    return;
+  }
+  ChunkedResponse response(server, 200, FPSTR(APPLICATION_JSON));
+  ruleEngine->serialize(response);
+}
+
+void ConfigWebServer::onRulesPut() {
+  Logger.debug.println(F("Webserver: rules PUT"));
+  if (!ruleEngine) {
+    server.send_P(503, TEXT_PLAIN, PSTR("No rule engine available!"));
+    return;
+  }
+  if (!ruleEngine->deserialize(server.arg(FPSTR(PLAIN)))) {
+    server.send_P(400, TEXT_PLAIN, PSTR("Cannot store rule!"));
+    return;
+  }
+  ruleEngine->save();
+  onRulesGet();
+}
+
+void ConfigWebServer::onRulesDelete() {
+  Logger.debug.println(F("Webserver: rules DELETE"));
+  if (!ruleEngine) {
+    server.send_P(503, TEXT_PLAIN, PSTR("No rule engine available!"));
+    return;
+  }
+  if (!ruleEngine->remove(server.arg(F("name")))) {
+    server.send_P(404, TEXT_PLAIN, PSTR("Unknown rule!"));
+    return;
+  }
+  ruleEngine->save();
+  onRulesGet();
+}
+
+void ConfigWebServer::onCaptureGet() {
+  // the previous file is kept on rotation
+  File file = SPIFFS.open(server.hasArg(F("previous"))
+                              ? FPSTR(RF_CAPTURE_FILE_PREVIOUS)
+                              : FPSTR(RF_CAPTURE_FILE),
+                          "r");
+  if (!file) {
+    server.send_P(404, TEXT_PLAIN, PSTR("Enable the rawCapture debug flag!"));
+    return;
+  }
+  server.streamFile(file, F("application/octet-stream"));
+  file.close();
+}
+
+void ConfigWebServer::onCodesDelete() {
+  Logger.debug.println(F("Webserver: codes DELETE"));
+  if (!codeLibrary) {
+    server.send_P(503, TEXT_PLAIN, PSTR("No code library available!"));
+    return;
+  }
+  if (!codeLibrary->remove(server.arg(F("name")))) {
+    server.send_P(404, TEXT_PLAIN, PSTR("Unknown code!"));
+    return;
+  }
+  codeLibrary->save();
+  onCodesGet();
 }
 
 void ConfigWebServer::onFirmwareFinish() {
@@ -209,6 +436,7 @@ void ConfigWebServer::onFirmwareFinish() {
                   PSTR("Update successful.\n\nDevice will reboot and try "
                        "to reconnect in 20 seconds."));
   }
+  Logs.flush();
   delay(500);
   ESP.restart();
 }
@@ -258,21 +486,27 @@ void ConfigWebServer::onFirmwareUpload() {
     Update.end();
     Logger.warning.print(F("Update was aborted!"));
   }
+  // the upload blocks the main loop, write the Update errors now
+  Logs.flush();
   delay(0);
 }
 
 void ConfigWebServer::loop() {
   wsLogTarget.loop();
+  wsEventStream.loop();
   server.handleClient();
+  assetTransfer.loop();
 }
 
-Print& ConfigWebServer::logTarget() { return wsLogTarget; }
+LogSink& ConfigWebServer::logTarget() { return wsLogTarget; }
 
 ESP8266WebServer::THandlerFunction ConfigWebServer::authenticated(
     const ESP8266WebServer::THandlerFunction& handler) {
   return [=]() {
+    Metrics.inc(METRIC_HTTP_REQUESTS);
     if (!server.authenticate(ADMIN_USERNAME,
                              this->settings.configPassword.c_str())) {
+      Metrics.inc(METRIC_HTTP_AUTH_FAILED);
       server.requestAuthentication(DIGEST_AUTH, nullptr,
                                    F("Authentication required!"));
       Logger.warning.println(F("Webserver: Authentication failed."));
@@ -37,8 +37,12 @@
 
 #include <ESP8266WebServer.h>
 
+#include <CodeLibrary.h>
+#include <RuleEngine.h>
 #include <Settings.h>
 
+#include "ProgmemTransfer.h"
+#include "WebSocketEventStream.h"
 #include "WebSocketLogTarget.h"
 
 class ConfigWebServer {
@@ -48,9 +52,14 @@ class ConfigWebServer {
   using OtaHookCb = std::function<void()>;
   using DebugFlagGetCb = std::function<bool()>;
   using DebugFlagSetCb = std::function<void(bool)>;
+  using ProfileProviderCb = std::function<String()>;
+  using ProtocolStatsProviderCb = std::function<String()>;
 
   ConfigWebServer(Settings& settings)
-      : settings(settings), server(80), wsLogTarget(81) {}
+      : settings(settings),
+        server(80),
+        wsLogTarget(81),
+        wsEventStream(82) {}
   ~ConfigWebServer() = default;
 
   void begin();
@@ -61,10 +70,19 @@ class ConfigWebServer {
     protocolProvider = cb;
   }
   void registerOtaHook(const OtaHookCb& cb) { otaHook = cb; }
+  void registerCodeLibrary(CodeLibrary& library) { codeLibrary = &library; }
+  void registerRuleEngine(RuleEngine& engine) { ruleEngine = &engine; }
+  void registerProfileProvider(const ProfileProviderCb& cb) {
+    profileProvider = cb;
+  }
+  void registerProtocolStatsProvider(const ProtocolStatsProviderCb& cb) {
+    protocolStatsProvider = cb;
+  }
   void registerDebugFlagHandler(const String& state,
                                 const DebugFlagGetCb& getState,
                                 const DebugFlagSetCb& setState);
-  Print& logTarget();
+  LogSink& logTarget();
+  WebSocketEventStream& eventStream() { return wsEventStream; }
 
  private:
   struct SystemCommandHandler {
@@ -85,21 +103,43 @@ class ConfigWebServer {
         : name(state), getState(getState), setState(setState) {}
   };
 
+  bool notModified(uint32_t etag);
+  // gzip compressed part of the web interface, versioned assets are
+  // referenced with a content hash and cached by the browser
+  void sendAsset(const __FlashStringHelper* url,
+                 const __FlashStringHelper* contentType, PGM_P data,
+                 size_t length, bool versioned);
+  void onProtocolsGet();
   ESP8266WebServer::THandlerFunction authenticated(
       const ESP8266WebServer::THandlerFunction& handler);
   void onConfigGet();
   void onSystemCommand();
   void onDebugFlagGet();
   void onDebugFlagSet();
+  void onCodesGet();
+  void onCodesPut();
+  void onCodesDelete();
+  void onRulesGet();
+  void onRulesPut();
+  void onRulesDelete();
+  void onCaptureGet();
   void onFirmwareFinish();
   void onFirmwareUpload();
 
   Settings& settings;
   ESP8266WebServer server;
   WebSocketLogTarget wsLogTarget;
+  WebSocketEventStream wsEventStream;
+  ProgmemTransfer assetTransfer;
   std::forward_list<SystemCommandHandler> systemCommandHandlers;
   ProtocolProviderCb protocolProvider;
   OtaHookCb otaHook;
+  ProfileProviderCb profileProvider;
+  ProtocolStatsProviderCb protocolStatsProvider;
+  // hash of the protocol list, 0 until it was sent once
+  uint32_t protocolsETag = 0;
+  CodeLibrary* codeLibrary = nullptr;
+  RuleEngine* ruleEngine = nullptr;
   std::forward_list<DebugFlagHandler> debugFlagHandlers;
   String password;
 };
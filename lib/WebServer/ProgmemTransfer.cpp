@@ -0,0 +1,92 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include <Arduino.h>
+
+#include "ProgmemTransfer.h"
+
+ProgmemTransfer::ProgmemTransfer() {
+  for (auto& transfer : transfers) {
+    transfer.data = nullptr;
+  }
+}
+
+ProgmemTransfer::~ProgmemTransfer() = default;
+
+bool ProgmemTransfer::start(const WiFiClient& client, PGM_P data,
+                            size_t length) {
+  for (auto& transfer : transfers) {
+    if (transfer.data == nullptr) {
+      transfer.client = client;
+      transfer.data = data;
+      transfer.length = length;
+      transfer.sent = 0;
+      transfer.lastProgress = millis();
+      return true;
+    }
+  }
+  return false;
+}
+
+void ProgmemTransfer::loop() {
+  for (auto& transfer : transfers) {
+    if (transfer.data == nullptr) {
+      continue;
+    }
+    if (!transfer.client.connected()) {
+      finish(transfer);
+      continue;
+    }
+    // only what fits into the send buffer, so that write_P() never waits
+    size_t part = std::min(
+        std::min<size_t>(PROGMEM_TRANSFER_CHUNK,
+                         transfer.client.availableForWrite()),
+        transfer.length - transfer.sent);
+    if (part > 0) {
+      size_t written =
+          transfer.client.write_P(transfer.data + transfer.sent, part);
+      if (written > 0) {
+        transfer.sent += written;
+        transfer.lastProgress = millis();
+      }
+    }
+    if (transfer.sent == transfer.length ||
+        millis() - transfer.lastProgress > PROGMEM_TRANSFER_TIMEOUT) {
+      finish(transfer);
+    }
+  }
+}
+
+void ProgmemTransfer::finish(Transfer& transfer) {
+  transfer.client.stop();
+  transfer.client = WiFiClient();
+  transfer.data = nullptr;
+}
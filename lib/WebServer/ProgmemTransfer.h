@@ -0,0 +1,80 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PROGMEMTRANSFER_H
+#define PROGMEMTRANSFER_H
+
+#include <pgmspace.h>
+#include <stddef.h>
+
+#include <WiFiClient.h>
+
+// Number of responses sent in the background at once
+#ifndef PROGMEM_TRANSFER_SLOTS
+#define PROGMEM_TRANSFER_SLOTS 2
+#endif
+
+// Bytes written per transfer and loop
+#ifndef PROGMEM_TRANSFER_CHUNK
+#define PROGMEM_TRANSFER_CHUNK 1024
+#endif
+
+// Give up a transfer without progress for this time in ms
+#ifndef PROGMEM_TRANSFER_TIMEOUT
+#define PROGMEM_TRANSFER_TIMEOUT 5000
+#endif
+
+// Sends the body of a response from PROGMEM in bounded chunks from
+// loop(), so that a page load does not block the main loop for the
+// whole transfer.  The headers must announce the content length and
+// that the connection is closed after the response.
+class ProgmemTransfer {
+ public:
+  ProgmemTransfer();
+  ~ProgmemTransfer();
+
+  // Returns false if all slots are busy
+  bool start(const WiFiClient& client, PGM_P data, size_t length);
+  void loop();
+
+ private:
+  struct Transfer {
+    WiFiClient client;
+    PGM_P data;
+    size_t length;
+    size_t sent;
+    unsigned long lastProgress;
+  };
+
+  void finish(Transfer& transfer);
+
+  Transfer transfers[PROGMEM_TRANSFER_SLOTS];
+};
+
+#endif  // PROGMEMTRANSFER_H
@@ -0,0 +1,298 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include <ArduinoSimpleLogging.h>
+
+#include <Metrics.h>
+#include <RfDeviceFilter.h>
+
+#include "WebSocketEventStream.h"
+
+static const char SUBSCRIBE[] = "sub";
+
+size_t EventStreamServer::sendSpace(uint8_t num) {
+  WiFiClient *tcp = _clients[num].tcp;
+  if (tcp == nullptr || !tcp->connected()) {
+    return 0;
+  }
+  int space = tcp->availableForWrite();
+  return space > 0 ? space : 0;
+}
+
+WebSocketEventStream::WebSocketEventStream(const uint16_t port)
+    : server(port), seq(1), subscribers(0), overflow(false) {
+  for (auto &client : clients) {
+    client.connected = false;
+    client.all = false;
+    client.raw = false;
+    client.next = seq;
+  }
+}
+
+void WebSocketEventStream::begin() {
+  using namespace std::placeholders;
+  server.onEvent(
+      std::bind(&WebSocketEventStream::handleEvent, this, _1, _2, _3, _4));
+  server.begin();
+}
+
+void WebSocketEventStream::handleEvent(uint8_t num, WStype_t type,
+                                       uint8_t *payload, size_t length) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) {
+    return;
+  }
+  Client &client = clients[num];
+  switch (type) {
+    case WStype_DISCONNECTED:
+      client.connected = false;
+      subscribe(client, "", 0);
+      Logger.debug.print(F("Event stream client "));
+      Logger.debug.print(num);
+      Logger.debug.println(F(" disconnected"));
+      break;
+    case WStype_CONNECTED:
+      client.connected = true;
+      subscribe(client, "", 0);
+      Logger.debug.print(F("Event stream client "));
+      Logger.debug.print(num);
+      Logger.debug.println(F(" connected"));
+      break;
+    case WStype_TEXT: {
+      const char *text = reinterpret_cast<const char *>(payload);
+      size_t prefix = sizeof(SUBSCRIBE) - 1;
+      if (length >= prefix && strncmp(text, SUBSCRIBE, prefix) == 0 &&
+          (length == prefix || text[prefix] == ' ')) {
+        size_t skip = length > prefix ? prefix + 1 : prefix;
+        subscribe(client, text + skip, length - skip);
+      } else {
+        server.sendTXT(num, "{\"error\":\"unknown command\"}");
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void WebSocketEventStream::subscribe(Client &client, const char *list,
+                                     size_t length) {
+  client.all = false;
+  client.raw = false;
+  client.filter = "";
+  client.next = seq;
+
+  // "*" and "raw" are flags, the rest is passed to the device filter
+  const char *end = list + length;
+  for (const char *pos = list; pos < end;) {
+    const char *comma = static_cast<const char *>(memchr(pos, ',', end - pos));
+    const char *next = comma ? comma : end;
+    while (pos < next && *pos == ' ') {
+      pos++;
+    }
+    size_t size = next - pos;
+    while (size > 0 && pos[size - 1] == ' ') {
+      size--;
+    }
+    if (size == 1 && *pos == '*') {
+      client.all = true;
+    } else if (size == 3 && strncmp(pos, "raw", 3) == 0) {
+      client.raw = true;
+    } else if (size > 0) {
+      if (client.filter.length() > 0) {
+        client.filter += ',';
+      }
+      for (size_t i = 0; i < size; ++i) {
+        client.filter += pos[i];
+      }
+    }
+    pos = next + 1;
+  }
+  updateSubscribers();
+}
+
+void WebSocketEventStream::updateSubscribers() {
+  subscribers = 0;
+  for (const auto &client : clients) {
+    if (client.connected &&
+        (client.all || client.raw || client.filter.length() > 0)) {
+      subscribers++;
+    }
+  }
+}
+
+bool WebSocketEventStream::wantsRaw() const {
+  if (subscribers == 0) {
+    return false;
+  }
+  for (const auto &client : clients) {
+    if (client.connected && client.raw) {
+      return true;
+    }
+  }
+  return false;
+}
+
+WebSocketEventStream::Frame &WebSocketEventStream::startFrame(
+    uint8_t clients) {
+  Frame &frame = frames[seq % RF_STREAM_SLOTS];
+  frame.clients = clients;
+  frame.length = 0;
+  overflow = false;
+  char number[24];
+  append(frame, number, snprintf(number, sizeof(number), "{\"seq\":%u",
+                                 static_cast<unsigned>(seq)));
+  return frame;
+}
+
+void WebSocketEventStream::append(Frame &frame, const char *data,
+                                  size_t length) {
+  if (overflow || frame.length + length >= sizeof(frame.data)) {
+    overflow = true;
+    return;
+  }
+  memcpy(frame.data + frame.length, data, length);
+  frame.length += length;
+}
+
+void WebSocketEventStream::appendString(Frame &frame, const char *str) {
+  append(frame, "\"", 1);
+  for (const char *pos = str; *pos; ++pos) {
+    if (*pos == '"' || *pos == '\\') {
+      append(frame, "\\", 1);
+    }
+    append(frame, pos, 1);
+  }
+  append(frame, "\"", 1);
+}
+
+void WebSocketEventStream::finishFrame(Frame &frame) {
+  append(frame, "}", 1);
+  if (overflow) {
+    // keep the seq, the clients see the gap
+    frame.length = 0;
+    Metrics.inc(METRIC_WS_EVENTS_DROPPED);
+  } else {
+    frame.data[frame.length] = '\0';
+  }
+  seq++;
+}
+
+void WebSocketEventStream::publish(const char *protocol,
+                                   const char *deviceID,
+                                   const char *message,
+                                   size_t messageLength) {
+  if (subscribers == 0) {
+    return;
+  }
+  // filter once per event instead of per send
+  uint8_t mask = 0;
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; ++i) {
+    const Client &client = clients[i];
+    if (client.connected &&
+        (client.all ||
+         (client.filter.length() > 0 &&
+          RfDeviceFilter::matches(client.filter, protocol, deviceID)))) {
+      mask |= 1 << i;
+    }
+  }
+  if (mask == 0) {
+    return;
+  }
+
+  Frame &frame = startFrame(mask);
+  append(frame, ",\"protocol\":", 12);
+  appendString(frame, protocol);
+  if (deviceID[0] != '\0') {
+    append(frame, ",\"deviceID\":", 12);
+    appendString(frame, deviceID);
+  }
+  append(frame, ",\"message\":", 11);
+  append(frame, message, messageLength);
+  finishFrame(frame);
+}
+
+void WebSocketEventStream::publishRaw(const String &pulses) {
+  uint8_t mask = 0;
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; ++i) {
+    if (clients[i].connected && clients[i].raw) {
+      mask |= 1 << i;
+    }
+  }
+  if (mask == 0) {
+    return;
+  }
+
+  Frame &frame = startFrame(mask);
+  append(frame, ",\"raw\":", 7);
+  appendString(frame, pulses.c_str());
+  finishFrame(frame);
+}
+
+void WebSocketEventStream::sendFrames(uint8_t num, Client &client) {
+  uint32_t oldest = seq > RF_STREAM_SLOTS ? seq - RF_STREAM_SLOTS : 1;
+  if (client.next < oldest) {
+    // the client was too slow, the frames are overwritten
+    Metrics.inc(METRIC_WS_EVENTS_DROPPED, oldest - client.next);
+    client.next = oldest;
+  }
+  for (uint8_t sent = 0;
+       client.next != seq && sent < RF_STREAM_SENDS_PER_LOOP;) {
+    const Frame &frame = frames[client.next % RF_STREAM_SLOTS];
+    if (frame.length == 0 || !(frame.clients & (1 << num))) {
+      client.next++;
+      continue;
+    }
+    size_t needed = frame.length + WEBSOCKETS_MAX_HEADER_SIZE;
+    if (server.sendSpace(num) < needed) {
+      // keep the frame, it is dropped if the slot is reused first
+      return;
+    }
+    client.next++;
+    if (server.sendTXT(num, frame.data, frame.length)) {
+      Metrics.inc(METRIC_WS_EVENTS_SENT);
+    } else {
+      Metrics.inc(METRIC_WS_EVENTS_DROPPED);
+    }
+    sent++;
+  }
+}
+
+void WebSocketEventStream::loop() {
+  server.loop();
+  if (subscribers == 0) {
+    return;
+  }
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; ++i) {
+    if (clients[i].connected) {
+      sendFrames(i, clients[i]);
+    }
+  }
+}
@@ -0,0 +1,138 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 Puuu
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef WEBSOCKETEVENTSTREAM_H
+#define WEBSOCKETEVENTSTREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <WString.h>
+#include <WebSocketsServer.h>
+
+#include <CompactPulseTrain.h>
+#include <RfEvent.h>
+
+// Frames kept for the clients, a client that falls further behind
+// loses the oldest ones
+#ifndef RF_STREAM_SLOTS
+#define RF_STREAM_SLOTS 8
+#endif
+
+// Largest event frame: the strings plus seq, keys, quotes and braces
+#define RF_STREAM_EVENT_SIZE \
+  (RF_EVENT_PROTOCOL_SIZE + RF_EVENT_DEVICEID_SIZE + RF_EVENT_MESSAGE_SIZE + 64)
+// Largest raw frame: "c:" one character per pulse, ";p:" and up to five
+// digits and a comma per timing
+#define RF_STREAM_RAW_SIZE \
+  (PULSE_TRAIN_MAX_LENGTH + 6 * PULSE_TRAIN_MAX_TIMINGS + 40)
+
+#ifndef RF_STREAM_FRAME_SIZE
+#define RF_STREAM_FRAME_SIZE                                        \
+  (RF_STREAM_EVENT_SIZE > RF_STREAM_RAW_SIZE ? RF_STREAM_EVENT_SIZE \
+                                             : RF_STREAM_RAW_SIZE)
+#endif
+
+static_assert(RF_STREAM_FRAME_SIZE >= RF_STREAM_EVENT_SIZE &&
+                  RF_STREAM_FRAME_SIZE >= RF_STREAM_RAW_SIZE,
+              "RF_STREAM_FRAME_SIZE too small for events and pulse trains");
+
+// Frames sent to each client per loop
+#ifndef RF_STREAM_SENDS_PER_LOOP
+#define RF_STREAM_SENDS_PER_LOOP 1
+#endif
+
+// Exposes the send buffer of the clients, sendTXT() blocks until the
+// frame is written
+class EventStreamServer : public WebSocketsServer {
+ public:
+  explicit EventStreamServer(const uint16_t port) : WebSocketsServer(port) {}
+
+  // Free space in the TCP send buffer of the client
+  size_t sendSpace(uint8_t num);
+};
+
+// Websocket channel for received RF events.  Each event is sent as one
+// JSON text frame:
+//   {"seq":12,"protocol":"..","deviceID":"..","message":{..}}
+//   {"seq":13,"raw":"c:..;p:..@"}
+// A gap in seq tells the client that frames were dropped.
+//
+// Clients receive nothing until they subscribe with a text message
+// "sub <list>", the list has the format of the rf device filter
+// ("<protocol>" or "<protocol>/<deviceID>", comma separated), "*" for
+// all events and "raw" for raw pulse trains.  "sub" without a list
+// unsubscribes.
+class WebSocketEventStream {
+ public:
+  explicit WebSocketEventStream(const uint16_t port);
+
+  void begin();
+  void loop();
+
+  // Only true if a client subscribed raw pulse trains, to save the
+  // conversion
+  bool wantsRaw() const;
+  void publish(const char *protocol, const char *deviceID,
+               const char *message, size_t messageLength);
+  void publishRaw(const String &pulses);
+
+ private:
+  struct Frame {
+    uint16_t length;  // 0 if the event did not fit
+    uint8_t clients;  // mask of the subscribed clients
+    char data[RF_STREAM_FRAME_SIZE];
+  };
+  struct Client {
+    bool connected;
+    bool all;
+    bool raw;
+    uint32_t next;  // seq of the next frame to send
+    String filter;
+  };
+
+  void handleEvent(uint8_t num, WStype_t type, uint8_t *payload,
+                   size_t length);
+  void subscribe(Client &client, const char *list, size_t length);
+  void updateSubscribers();
+  Frame &startFrame(uint8_t clients);
+  void append(Frame &frame, const char *data, size_t length);
+  void appendString(Frame &frame, const char *str);
+  void finishFrame(Frame &frame);
+  void sendFrames(uint8_t num, Client &client);
+
+  EventStreamServer server;
+  Frame frames[RF_STREAM_SLOTS];
+  Client clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+  uint32_t seq;  // seq of the next frame
+  uint8_t subscribers;
+  bool overflow;  // the frame being built is too large
+};
+
+#endif  // WEBSOCKETEVENTSTREAM_H
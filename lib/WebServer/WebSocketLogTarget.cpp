@@ -29,6 +29,8 @@
 
 #include <ArduinoSimpleLogging.h>
 
+#include <Metrics.h>
+
 #include "WebSocketLogTarget.h"
 
 void WebSocketLogTarget::begin() {
@@ -43,6 +45,7 @@ void WebSocketLogTarget::handleEvent(uint8_t num, WStype_t type,
                                      uint8_t *payload, size_t length) {
   switch (type) {
     case WStype_DISCONNECTED:
+      Metrics.set(METRIC_WS_CLIENTS, server.connectedClients());
       Logger.debug.print(F("Websocket client "));
       Logger.debug.print(num);
       Logger.debug.println(F(" disconnected"));
@@ -51,6 +54,8 @@ void WebSocketLogTarget::handleEvent(uint8_t num, WStype_t type,
       String reply(F("*** Connection established ***\n"));
       server.sendTXT(num, reply);
     }
+      Metrics.inc(METRIC_WS_CONNECTS);
+      Metrics.set(METRIC_WS_CLIENTS, server.connectedClients());
       Logger.debug.print(F("Websocket client "));
       Logger.debug.print(num);
       Logger.debug.println(F(" connected"));
@@ -66,6 +71,7 @@ void WebSocketLogTarget::handleEvent(uint8_t num, WStype_t type,
   }
 }
 
-void WebSocketLogTarget::flush(const char *data) {
-  server.broadcastTXT(data, size());
+void WebSocketLogTarget::writeLine(const char *line, size_t length,
+                                   const LogContext &context) {
+  server.broadcastTXT(line, length);
 }
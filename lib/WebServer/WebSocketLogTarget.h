@@ -30,21 +30,18 @@
 #ifndef WEBSOCKETLOGTARGET_H
 #define WEBSOCKETLOGTARGET_H
 
-#include <Print.h>
-
-#include <LineBufferProxy.h>
+#include <LogPipeline.h>
 #include <WebSocketsServer.h>
 
-class WebSocketLogTarget : public LineBufferProxy<64> {
+class WebSocketLogTarget : public LogSink {
  public:
   explicit WebSocketLogTarget(const uint16_t port)
       : server(WebSocketsServer(port)) {}
 
   void loop() { server.loop(); }
   void begin();
-
- protected:
-  void flush(const char* data) override;
+  void writeLine(const char* line, size_t length,
+                 const LogContext& context) override;
 
  private:
   void handleEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
@@ -44,3 +44,17 @@ String fwJsonVersion(bool withBuildIn) {
                       : "") +
          F("}");
 }
+
+size_t printFwJsonVersion(Print &target, bool withBuildIn) {
+  size_t size = target.print(F("{\"version\":\""));
+  size += target.print(FPSTR(fw_version));
+  size += target.print(F("\",\"chipId\":\""));
+  size += target.print(ESP.getChipId(), HEX);
+  size += target.print('"');
+  if (withBuildIn) {
+    size += target.print(F(",\"build_with\":"));
+    size += target.print(FPSTR(fw_build_with));
+  }
+  size += target.print('}');
+  return size;
+}
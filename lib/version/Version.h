@@ -30,10 +30,12 @@
 #ifndef MQTT433GATEWAY_VERSION_H
 #define MQTT433GATEWAY_VERSION_H
 
+#include <Print.h>
 #include <WString.h>
 
 String fwVersion();
 String chipId();
 String fwJsonVersion(bool withBuildIn = false);
+size_t printFwJsonVersion(Print &target, bool withBuildIn = false);
 
 #endif  // MQTT433GATEWAY_VERSION_H
@@ -27,7 +27,7 @@ def build_web():
     os.chdir("web")
     print("Attempting to build webpage...")
     check_call(["npm", "install"])
-    copyfile("build/index.html.gz.h", "../dist/index.html.gz.h")
+    copyfile("build/web_assets.gz.h", "../dist/web_assets.gz.h")
     os.chdir("..")
 
 
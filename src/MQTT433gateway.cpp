@@ -31,12 +31,23 @@
 #include <ESP8266mDNS.h>
 #include <FS.h>
 
+#include <ArduinoJson.h>
 #include <ArduinoSimpleLogging.h>
 #include <WiFiManager.h>
 
+#include <CodeLibrary.h>
 #include <ConfigWebServer.h>
+#include <LoadGenerator.h>
+#include <LoopProfiler.h>
+#include <LogPipeline.h>
 #include <MqttClient.h>
+#include <PowerManager.h>
+#include <PullUpdater.h>
+#include <RfEventQueue.h>
+#include <RfEventStore.h>
 #include <RfHandler.h>
+#include <RuleEngine.h>
+#include <StaticSlot.h>
 #include <Settings.h>
 #include <StatusLED.h>
 #include <SyslogLogTarget.h>
@@ -46,18 +57,92 @@
 WiFiClient wifi;
 
 Settings settings;
-ConfigWebServer *webServer = nullptr;
-MqttClient *mqttClient = nullptr;
-RfHandler *rf = nullptr;
-SyslogLogTarget *syslogLog = nullptr;
-StatusLED *statusLED = nullptr;
-SystemLoad *systemLoad = nullptr;
-SystemHeap *systemHeap = nullptr;
+// Subsystems live in static slots, rebuilding them on settings changes
+// does not fragment the heap.
+StaticSlot<ConfigWebServer> webServer;
+StaticSlot<MqttClient> mqttClient;
+StaticSlot<RfHandler> rf;
+RfEventQueue rfEvents;
+RfEventStore offlineEvents;
+CodeLibrary codeLibrary;
+RuleEngine rules;
+StaticSlot<SyslogLogTarget> syslogLog;
+PrintLogSink serialLog(Serial);
+PowerManager power;
+LoadGenerator loadTest;
+PullUpdater pullUpdate;
+bool loadTestTransmit = false;
+StaticSlot<StatusLED> statusLED;
+StaticSlot<SystemLoad> systemLoad;
+StaticSlot<SystemHeap> systemHeap;
+StaticSlot<LoopProfiler> loopProfiler;
+bool loopProfileMqtt = false;
+bool freeHeapMqtt = false;
+bool rawCaptureMqtt = false;
+// decoded raw captures for the event stream
+uint16_t rawPulses[MAXPULSESTREAMLENGTH];
+
+enum LoopStage {
+  STAGE_STATUSLED,
+  STAGE_MDNS,
+  STAGE_WEBSERVER,
+  STAGE_MQTT,
+  STAGE_RF,
+  STAGE_PUBLISH,
+  STAGE_LOG,
+  STAGE_COUNT
+};
+
+const char PROGMEM STAGE_NAME_STATUSLED[] = "statusLed";
+const char PROGMEM STAGE_NAME_MDNS[] = "mdns";
+const char PROGMEM STAGE_NAME_WEBSERVER[] = "webServer";
+const char PROGMEM STAGE_NAME_MQTT[] = "mqtt";
+const char PROGMEM STAGE_NAME_RF[] = "rf";
+const char PROGMEM STAGE_NAME_PUBLISH[] = "publish";
+const char PROGMEM STAGE_NAME_LOG[] = "log";
+
+const __FlashStringHelper *const LOOP_STAGE_NAMES[STAGE_COUNT] = {
+    FPSTR(STAGE_NAME_STATUSLED), FPSTR(STAGE_NAME_MDNS),
+    FPSTR(STAGE_NAME_WEBSERVER), FPSTR(STAGE_NAME_MQTT),
+    FPSTR(STAGE_NAME_RF),        FPSTR(STAGE_NAME_PUBLISH),
+    FPSTR(STAGE_NAME_LOG)};
+
+static inline void endStage(LoopStage stage, HeapTag tag) {
+  if (loopProfiler) loopProfiler->lap(stage);
+  if (systemHeap) systemHeap->account(tag);
+}
+
+void prepareOta() {
+  Logger.debug.println(F("Prepare for oat update."));
+  if (statusLED) statusLED->setState(StatusLED::ota);
+  if (rf) {
+    rf->filterProtocols(F("[]"));
+    rf.reset();
+  }
+  mqttClient.reset();
+  WiFiUDP::stopAll();
+}
+
+void setupPullUpdate() {
+  pullUpdate.registerStatusHandler([](const String &json) {
+    if (mqttClient) mqttClient->publishStatus(F("ota"), json);
+  });
+  // RF and MQTT keep running during the download, until the verified
+  // image is activated by the restart
+  pullUpdate.registerCommitHandler([]() {
+    // let the non-blocking client send the final status first
+    unsigned long start = millis();
+    while (mqttClient && millis() - start < 500) {
+      mqttClient->loop();
+      delay(10);
+    }
+    prepareOta();
+  });
+}
 
 void setupMqtt(const Settings &) {
-  if (mqttClient != nullptr) {
-    delete mqttClient;
-    mqttClient = nullptr;
+  if (mqttClient) {
+    mqttClient.reset();
     Logger.debug.println(F("MQTT instance removed."));
   }
   if (!settings.hasValidPassword()) {
@@ -70,19 +155,33 @@ void setupMqtt(const Settings &) {
     return;
   }
 
-  mqttClient = new MqttClient(settings, wifi);
+  offlineEvents.begin(settings.mqttOfflineBuffer, settings.mqttOfflineSpill);
+  mqttClient.emplace(settings, wifi, offlineEvents);
   mqttClient->registerRfDataHandler(
       [](const String &protocol, const String &data) {
         if (rf) rf->transmitCode(protocol, data);
       });
+  mqttClient->registerCodeHandler([](const String &name) {
+    if (rf) rf->transmitNamedCode(name);
+  });
+  mqttClient->registerPublishHandler([](const RfEvent &event) {
+    loadTest.published(event.protocol, event.message);
+  });
+  mqttClient->registerOtaHandler([](const String &payload) {
+    DynamicJsonDocument request(JSON_OBJECT_SIZE(2) + 256);
+    if (deserializeJson(request, payload)) {
+      Logger.error.println(F("Invalid update request!"));
+      return;
+    }
+    pullUpdate.start(request[F("url")] | "", request[F("sha256")] | "");
+  });
   mqttClient->begin();
   Logger.info.println(F("MQTT instance created."));
 }
 
 void setupRf(const Settings &) {
   if (rf) {
-    delete rf;
-    rf = nullptr;
+    rf.reset();
     Logger.debug.println(F("Rf instance removed."));
   }
   if (!settings.hasValidPassword()) {
@@ -91,89 +190,166 @@ void setupRf(const Settings &) {
     return;
   }
 
-  rf = new RfHandler(settings);
-  rf->registerReceiveHandler([](const String &protocol, const String &data) {
-    if (mqttClient) {
-      mqttClient->publishCode(protocol, data);
+  rf.emplace(settings);
+  rf->registerReceiveHandler([](const char *protocol, const char *deviceID,
+                                 const char *data, size_t length) {
+    rfEvents.push(protocol, deviceID, data, length);
+    if (webServer) {
+      webServer->eventStream().publish(protocol, deviceID, data, length);
+    }
+  });
+  rf->registerRawHandler([](const RawCapture::Record &record) {
+    if (rawCaptureMqtt && mqttClient) {
+      uint8_t payload[sizeof(record.time) + sizeof(CompactPulseTrain)];
+      memcpy(payload, &record.time, sizeof(record.time));
+      size_t length = record.train.serialize(
+          payload + sizeof(record.time), sizeof(payload) - sizeof(record.time));
+      mqttClient->publishStatus(F("raw"), payload,
+                                sizeof(record.time) + length);
+    }
+    if (webServer && webServer->eventStream().wantsRaw()) {
+      size_t length = record.train.decode(rawPulses, MAXPULSESTREAMLENGTH);
+      webServer->eventStream().publishRaw(
+          RfHandler::pulseTrainToString(rawPulses, length));
     }
   });
   rf->setEchoEnabled(settings.rfEchoMessages);
   rf->filterProtocols(settings.rfProtocols);
+  rf->setDuplicateWindow(settings.rfDuplicateWindow);
+  rf->setCodeLibrary(&codeLibrary);
+  rf->setRuleEngine(&rules);
   rf->begin();
   Logger.info.println(F("RfHandler Instance created."));
 }
 
+void applyAutoTune() {
+  if (rf->decoderStats().overflowed()) {
+    // the suggestion would disable the protocols that did not fit
+    Logger.warning.println(F("Auto-tune skipped, protocol table full."));
+    rf->decoderStats().observe(0);
+    return;
+  }
+  String protocols = rf->decoderStats().suggestion();
+  if (protocols == F("[]")) {
+    Logger.warning.println(F("Auto-tune received no protocol, try again."));
+    rf->decoderStats().observe(settings.rfAutoTune * 60000UL);
+    return;
+  }
+  Logger.info.print(F("Auto-tune enables protocols "));
+  Logger.info.println(protocols);
+  // notifies RF_PROTOCOL, which stops the observation
+  settings.deserialize(String(F("{\"rfAutoTune\":0,\"rfProtocols\":")) +
+                       protocols + '}');
+  settings.save();
+}
+
 void setupWebLog() {
   if (webServer) {
     if (settings.webLogLevel.length() > 0) {
-      Logger.addHandler(Logger.stringToLevel(settings.webLogLevel),
-                        webServer->logTarget());
+      Logs.attach(webServer->logTarget(),
+                  Logger.stringToLevel(settings.webLogLevel));
     } else {
-      Logger.removeHandler(webServer->logTarget());
+      Logs.detach(webServer->logTarget());
     }
   }
 }
 
 void setupWebServer() {
-  webServer = new ConfigWebServer(settings);
+  webServer.emplace(settings);
 
   webServer->registerSystemCommandHandler(F("restart"), []() {
     Logger.info.println(F("Restart device."));
+    Logs.flush();
     delay(100);
     ESP.restart();
   });
   webServer->registerSystemCommandHandler(F("reset_wifi"), []() {
     Logger.info.println(F("Reset wifi and restart device."));
     WiFi.disconnect(true);
+    Logs.flush();
     delay(100);
     ESP.restart();
   });
   webServer->registerSystemCommandHandler(F("reset_config"), []() {
     Logger.info.println(F("Reset configuration and restart device."));
     settings.reset();
+    Logs.flush();
     delay(100);
     ESP.restart();
   });
   webServer->registerProtocolProvider(RfHandler::availableProtocols);
-  webServer->registerOtaHook([]() {
-    Logger.debug.println(F("Prepare for oat update."));
-    if (statusLED) statusLED->setState(StatusLED::ota);
-    if (rf) {
-      rf->filterProtocols(F("[]"));
-      delete rf;
-      rf = nullptr;
-    }
-    if (mqttClient) {
-      delete mqttClient;
-      mqttClient = nullptr;
-    }
-    WiFiUDP::stopAll();
-  });
+  webServer->registerCodeLibrary(codeLibrary);
+  webServer->registerRuleEngine(rules);
+  webServer->registerOtaHook(prepareOta);
   webServer->registerDebugFlagHandler(
       F("protocolRaw"), []() { return rf && rf->isRawModeEnabled(); },
       [](bool state) {
         if (rf) rf->setRawMode(state);
       });
   webServer->registerDebugFlagHandler(
-      F("systemLoad"), []() { return systemLoad != nullptr; },
+      F("rawCapture"), []() { return rf && rf->rawCapture().isRecording(); },
+      [](bool state) {
+        if (rf) rf->rawCapture().setRecording(state);
+      });
+  webServer->registerDebugFlagHandler(
+      F("rawCaptureMqtt"), []() { return rawCaptureMqtt; },
+      [](bool state) { rawCaptureMqtt = state; });
+  webServer->registerDebugFlagHandler(
+      F("systemLoad"), []() { return static_cast<bool>(systemLoad); },
       [](bool state) {
         if (state) {
-          systemLoad = new SystemLoad(Logger.info);
-        } else if (systemLoad) {
-          delete systemLoad;
-          systemLoad = nullptr;
+          systemLoad.emplace(Logger.info);
+        } else {
+          systemLoad.reset();
         }
       });
   webServer->registerDebugFlagHandler(
-      F("freeHeap"), []() { return systemHeap != nullptr; },
+      F("freeHeap"), []() { return static_cast<bool>(systemHeap); },
       [](bool state) {
         if (state) {
-          systemHeap = new SystemHeap(Logger.info);
-        } else if (systemHeap) {
-          delete systemHeap;
-          systemHeap = nullptr;
+          systemHeap.emplace(Logger.info);
+        } else {
+          systemHeap.reset();
+        }
+      });
+  webServer->registerDebugFlagHandler(
+      F("freeHeapMqtt"), []() { return freeHeapMqtt; },
+      [](bool state) { freeHeapMqtt = state; });
+  webServer->registerDebugFlagHandler(
+      F("loopProfile"), []() { return static_cast<bool>(loopProfiler); },
+      [](bool state) {
+        if (state && !loopProfiler) {
+          loopProfiler.emplace(LOOP_STAGE_NAMES, STAGE_COUNT);
+        } else if (!state) {
+          loopProfiler.reset();
         }
       });
+  webServer->registerDebugFlagHandler(
+      F("loopProfileMqtt"), []() { return loopProfileMqtt; },
+      [](bool state) { loopProfileMqtt = state; });
+  webServer->registerDebugFlagHandler(
+      F("loadTest"), []() { return loadTest.isRunning(); },
+      [](bool state) {
+        if (state) {
+          loadTest.start(settings.loadTestRate);
+        } else {
+          loadTest.stop();
+        }
+      });
+  webServer->registerDebugFlagHandler(
+      F("loadTestTransmit"), []() { return loadTestTransmit; },
+      [](bool state) {
+        if (state &&
+            !codeLibrary.find(String(FPSTR(LOAD_TEST_PROTOCOL)).c_str())) {
+          Logger.error.println(F("Store a code named loadtest first!"));
+          return;
+        }
+        loadTestTransmit = state;
+      });
+  webServer->registerProfileProvider(
+      []() { return loopProfiler ? loopProfiler->toJson() : String(); });
+  webServer->registerProtocolStatsProvider(
+      []() { return rf ? rf->decoderStats().toJson() : String(); });
 
   webServer->begin();
   Logger.info.println(F("WebServer instance created."));
@@ -191,12 +367,15 @@ void setupMdns(const Settings &s) {
     return;
   }
   MDNS.addService("http", "tcp", 80);
+  if (settings.clusterTopic.length() > 0) {
+    // lets tools find the gateways sharing a cluster
+    MDNS.addServiceTxt("http", "tcp", "cluster", settings.clusterTopic.c_str());
+  }
   Logger.info.println(F("MDNS service registered."));
 }
 
 void setupStatusLED(const Settings &s) {
-  delete statusLED;
-  statusLED = new StatusLED(s.ledPin, s.ledActiveHigh);
+  statusLED.emplace(s.ledPin, s.ledActiveHigh);
   Logger.debug.print("Change status LED config: pin=");
   Logger.debug.print(s.ledPin);
   Logger.debug.print(" activeHigh=");
@@ -215,6 +394,7 @@ void setupWifi() {
   // Restart after we had the portal running
   wifiManager.setSaveConfigCallback([]() {
     Logger.info.println(F("Wifi config changed. Restart."));
+    Logs.flush();
     delay(100);
     ESP.restart();
   });
@@ -222,20 +402,33 @@ void setupWifi() {
   if (!wifiManager.autoConnect(settings.deviceName.c_str(),
                                settings.configPassword.c_str())) {
     Logger.warning.println(F("Try connecting again after reboot"));
+    Logs.flush();
     ESP.restart();
   }
 }
 
 void setup() {
   Serial.begin(115200, SERIAL_8N1, SERIAL_TX_ONLY);
-  Logger.addHandler(Logger.DEBUG, Serial);
+  Logs.attach(serialLog, Logger.DEBUG);
   if (!SPIFFS.begin()) {
     Logger.error.println(F("Initializing of SPIFFS failed!"));
   }
 
+  setupPullUpdate();
   settings.registerChangeHandler(STATUSLED, setupStatusLED);
   settings.registerChangeHandler(BASE, setupMdns);
   settings.registerChangeHandler(MQTT, setupMqtt);
+  settings.registerChangeHandler(MQTT_TOPICS, [](const Settings &s) {
+    Logger.debug.println(F("Configure MQTT topics."));
+    if (mqttClient) {
+      mqttClient->updateTopics();
+    }
+    setupMdns(s);
+  });
+  settings.registerChangeHandler(MQTT_OFFLINE, [](const Settings &s) {
+    Logger.debug.println(F("Configure MQTT offline buffer."));
+    offlineEvents.begin(s.mqttOfflineBuffer, s.mqttOfflineSpill);
+  });
   settings.registerChangeHandler(RF_ECHO, [](const Settings &s) {
     Logger.debug.println(F("Configure rfEchoMessages."));
     if (rf) {
@@ -244,10 +437,36 @@ void setup() {
       Logger.warning.println(F("No Rf instance available"));
     }
   });
+  settings.registerChangeHandler(RF_RECEIVER, [](const Settings &s) {
+    Logger.debug.println(F("Configure rf receiver."));
+    if (rf) {
+      rf->restartReceiver();
+    } else {
+      Logger.warning.println(F("No Rf instance available"));
+    }
+  });
+  settings.registerChangeHandler(RF_CACHE, [](const Settings &s) {
+    Logger.debug.println(F("Configure rf pulse train cache."));
+    if (rf) {
+      rf->setPulseCachePersistent(s.rfPulseCachePersist);
+    } else {
+      Logger.warning.println(F("No Rf instance available"));
+    }
+  });
   settings.registerChangeHandler(RF_PROTOCOL, [](const Settings &s) {
     Logger.debug.println(F("Configure rfProtocols."));
     if (rf) {
       rf->filterProtocols(s.rfProtocols);
+      rf->decoderStats().observe(s.rfAutoTune * 60000UL);
+    } else {
+      Logger.warning.println(F("No Rf instance available"));
+    }
+  });
+  settings.registerChangeHandler(RF_FILTER, [](const Settings &s) {
+    Logger.debug.println(F("Configure rf filter."));
+    if (rf) {
+      rf->setDuplicateWindow(s.rfDuplicateWindow);
+      rf->configureDeviceFilter();
     } else {
       Logger.warning.println(F("No Rf instance available"));
     }
@@ -260,32 +479,41 @@ void setup() {
   });
   settings.registerChangeHandler(SYSLOG, [](const Settings &s) {
     if (syslogLog) {
-      Logger.removeHandler(*syslogLog);
-      delete syslogLog;
-      syslogLog = nullptr;
+      Logs.detach(*syslogLog);
+      syslogLog.reset();
       Logger.debug.println(F("Syslog instance removed."));
     }
     if (s.syslogLevel.length() > 0 && s.syslogHost.length() > 0 &&
         s.syslogPort != 0) {
-      syslogLog = new SyslogLogTarget();
-      syslogLog->begin(s.deviceName, s.syslogHost, s.syslogPort);
+      syslogLog.emplace();
+      syslogLog->begin(s.deviceName, s.syslogHost, s.syslogPort,
+                       s.syslogStructured);
       Logger.debug.println(F("Syslog instance created."));
-      Logger.addHandler(Logger.stringToLevel(s.syslogLevel), *syslogLog);
+      Logs.attach(*syslogLog, Logger.stringToLevel(s.syslogLevel));
     }
   });
   settings.registerChangeHandler(RF_CONFIG, setupRf);
+  settings.registerChangeHandler(POWER, [](const Settings &s) {
+    Logger.debug.println(F("Configure power profile."));
+    power.setProfile(s.powerProfile);
+  });
+  settings.registerChangeHandler(LOAD_TEST, [](const Settings &s) {
+    loadTest.setRate(s.loadTestRate);
+  });
   settings.registerChangeHandler(LOGGING, [](const Settings &s) {
     Logger.debug.println(F("Configure logging."));
     if (s.serialLogLevel.length() > 0) {
-      Logger.addHandler(Logger.stringToLevel(settings.serialLogLevel), Serial);
+      Logs.attach(serialLog, Logger.stringToLevel(settings.serialLogLevel));
     } else {
-      Logger.removeHandler(Serial);
+      Logs.detach(serialLog);
     }
     setupWebLog();
   });
 
   Logger.info.println(F("Load Settings..."));
   settings.load();
+  codeLibrary.load();
+  rules.load();
 
   setupStatusLED(settings);
   if (statusLED) statusLED->setState(StatusLED::wifiConnect);
@@ -293,9 +521,19 @@ void setup() {
   Serial.print(F("configPassword: "));
   Serial.println(settings.configPassword);
   setupWifi();
-
-  // Notify all setting listeners
-  settings.notifyAll();
+  power.begin();
+
+  // Initialize each subsystem once, setupMqtt() and setupRf() already
+  // apply the settings of the in-place handlers.
+  settings.notify(Settings::SettingTypeSet()
+                      .set(BASE)
+                      .set(WEB_CONFIG)
+                      .set(MQTT)
+                      .set(RF_CONFIG)
+                      .set(LOGGING)
+                      .set(SYSLOG)
+                      .set(STATUSLED)
+                      .set(POWER));
   if (statusLED) statusLED->setState(StatusLED::startup);
 
   Logger.debug.println(F("Current configuration:"));
@@ -303,9 +541,15 @@ void setup() {
   Logger.debug.println();
   Logger.info.print(F("Listen on IP: "));
   Logger.info.println(WiFi.localIP());
+  // from now on, log targets are written in the main loop
+  Logs.begin();
 }
 
 void loop() {
+  if (loopProfiler) {
+    loopProfiler->startLoop();
+  }
+
   if (rf && mqttClient && mqttClient->isConnected()) {
     if (statusLED) statusLED->setState(StatusLED::normalOperation);
   } else {
@@ -314,25 +558,67 @@ void loop() {
   if (statusLED) {
     statusLED->loop();
   }
+  endStage(STAGE_STATUSLED, HEAP_TAG_SYSTEM);
 
   MDNS.update();
+  endStage(STAGE_MDNS, HEAP_TAG_SYSTEM);
 
   if (webServer) {
     webServer->loop();
   }
+  endStage(STAGE_WEBSERVER, HEAP_TAG_WEB);
 
   if (mqttClient) {
     mqttClient->loop();
   }
+  if (pullUpdate.isRunning()) {
+    power.boost();
+    pullUpdate.loop();
+  }
+  endStage(STAGE_MQTT, HEAP_TAG_MQTT);
 
   if (rf) {
+    if (rf->active()) {
+      power.boost();
+    }
+    rf->rawCapture().setStreaming(
+        (rawCaptureMqtt && mqttClient) ||
+        (webServer && webServer->eventStream().wantsRaw()));
     rf->loop();
+    if (rf->decoderStats().observationDone()) {
+      applyAutoTune();
+    }
+    loadTest.loop([](const String &protocol, const String &message) {
+      rf->injectCode(protocol, message, String());
+      if (loadTestTransmit) {
+        // the code library entry named like the protocol
+        rf->transmitNamedCode(protocol);
+      }
+    });
+  }
+  endStage(STAGE_RF, HEAP_TAG_RF);
+
+  rfEvents.drain([](const RfEvent &event) {
+    return mqttClient && mqttClient->publishCode(event);
+  });
+  endStage(STAGE_PUBLISH, HEAP_TAG_MQTT);
+
+  Logs.loop();
+  if (syslogLog) {
+    syslogLog->loop();
+  }
+  endStage(STAGE_LOG, HEAP_TAG_SYSTEM);
+
+  if (loopProfiler && loopProfileMqtt && mqttClient &&
+      loopProfiler->reportDue()) {
+    mqttClient->publishStatus(F("profile"), loopProfiler->toJson());
   }
 
   if (systemLoad) {
     systemLoad->loop();
   }
-  if (systemHeap) {
-    systemHeap->loop();
+  if (systemHeap && systemHeap->loop() && freeHeapMqtt && mqttClient) {
+    mqttClient->publishStatus(F("heap"), systemHeap->toJson());
   }
+  power.loop();
 }
@@ -0,0 +1,74 @@
+// Split the inlined web page into index.html, app.css and app.js and
+// embed them gzip compressed into a C header for the firmware.  The
+// asset URLs carry a hash of their content, so that browsers can cache
+// them for a long time.
+//
+// Usage: node embed.js <inlined index.html> <header>
+
+const crypto = require('crypto');
+const fs = require('fs');
+const zlib = require('zlib');
+
+function contentHash(data) {
+    return crypto.createHash('sha1').update(data).digest('hex').substr(0, 8);
+}
+
+// Remove all <tag> elements, the first one is replaced by placeholder
+function extract(html, tag, placeholder) {
+    var parts = [];
+    var pattern = new RegExp('<' + tag + '[^>]*>([\\s\\S]*?)</' + tag + '>', 'g');
+    html = html.replace(pattern, function(match, content) {
+        parts.push(content);
+        return parts.length === 1 ? placeholder : '';
+    });
+    return { html: html, content: parts.join(tag === 'script' ? ';\n' : '\n') };
+}
+
+function toHex(x) {
+    var prefix = '0x';
+    if (x < 16) prefix = '0x0';
+    return prefix + x.toString(16);
+}
+
+function writeArray(wstream, name, data) {
+    wstream.write('static const unsigned int ' + name + '_len = ' + data.length + ';\n');
+    wstream.write('static const char ' + name + '[] PROGMEM = {\n    ');
+    for (var i = 0; i < data.length; i++) {
+        wstream.write(toHex(data[i]));
+        if (i < data.length-1) {
+            if (i % 12 >= 11) {
+                wstream.write(',\n    ');
+            } else {
+                wstream.write(', ');
+            }
+        }
+    }
+    wstream.write('};\n');
+}
+
+function embed(source, destination) {
+    var html = fs.readFileSync(source, 'utf8');
+
+    var styles = extract(html, 'style', '@STYLES@');
+    var scripts = extract(styles.html, 'script', '@SCRIPTS@');
+    html = scripts.html
+        .replace('@STYLES@', '<link rel="stylesheet" href="app.css?v=' + contentHash(styles.content) + '">')
+        .replace('@SCRIPTS@', '<script src="app.js?v=' + contentHash(scripts.content) + '"></script>');
+
+    var wstream = fs.createWriteStream(destination);
+    wstream.on('error', function (err) {
+        console.log(err);
+    });
+    var gzipOptions = { level: 9 };
+    writeArray(wstream, 'index_html_gz', zlib.gzipSync(html, gzipOptions));
+    writeArray(wstream, 'app_css_gz', zlib.gzipSync(styles.content, gzipOptions));
+    writeArray(wstream, 'app_js_gz', zlib.gzipSync(scripts.content, gzipOptions));
+    wstream.end();
+    return wstream;
+}
+
+module.exports = embed;
+
+if (require.main === module) {
+    embed(process.argv[2], process.argv[3]);
+}
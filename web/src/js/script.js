@@ -40,22 +40,43 @@ $(function () {
         new ConfigItem("mqttBrokerPort", portNumberInputFactory, inputApply, inputGetInt, "MQTT Broker port"),
         new ConfigItem("mqttUser", inputFieldFactory, inputApply, inputGet, "MQTT username (optional)"),
         new ConfigItem("mqttPassword", passwordFieldFactory, inputApply, inputGet, "MQTT password (optional)"),
+        new ConfigItem("mqttAsync", checkboxFactory, checkboxApply, checkboxGet, "Use the non-blocking MQTT client (required for QoS 1)"),
         new ConfigItem("mqttRetain", checkboxFactory, checkboxApply, checkboxGet, "Retain MQTT messages"),
+        new ConfigItem("mqttOta", checkboxFactory, checkboxApply, checkboxGet, "Accept firmware updates pulled from the URL sent to <send topic>ota"),
+        new ConfigItem("mqttQosProtocols", inputFieldFactory, inputApply, inputGet, "Comma separated protocols published with QoS 1 (requires the non-blocking MQTT client)"),
+        new ConfigItem("mqttOfflineBuffer", offlineBufferInputFactory, inputApply, inputGetInt, "Number of received messages kept in RAM while MQTT is disconnected (0 disables)"),
+        new ConfigItem("mqttOfflineSpill", offlineSpillInputFactory, inputApply, inputGetInt, "Number of additional messages stored on flash if the RAM buffer is full (0 disables)"),
+        new ConfigItem("mqttMetricsInterval", metricsIntervalInputFactory, inputApply, inputGetInt, "Interval in seconds to publish the gateway metrics below the state topic (0 disables)"),
+        new ConfigItem("mqttBatchInterval", batchIntervalInputFactory, inputApply, inputGetInt, "Milliseconds to collect received messages for one JSON array on <receive topic>batch (0 disables)"),
+        new ConfigItem("mqttBatchSize", batchSizeInputFactory, inputApply, inputGetInt, "Maximum number of messages per batch"),
+        new ConfigItem("clusterHoldoff", clusterHoldoffInputFactory, inputApply, inputGetInt, "Milliseconds to wait for claims of other gateways before publishing a message"),
 
         new GroupItem("MQTT Topic Config", legendFactory),
         new ConfigItem("mqttReceiveTopic", mqttTopicInputFactory, inputApply, inputGet, "Topic to publish received signal"),
         new ConfigItem("mqttSendTopic", mqttTopicInputFactory, inputApply, inputGet, "Topic to get signals to send from"),
         new ConfigItem("mqttStateTopic", mqttTopicInputFactory, inputApply, inputGet, "Topic to publish the device state"),
         new ConfigItem("mqttVersionTopic", mqttTopicInputFactory, inputApply, inputGet, "Topic to publish the current device version"),
+        new ConfigItem("clusterTopic", inputFieldFactory, inputApply, inputGet, "Topic shared by all gateways to publish each message only once (empty disables)"),
 
         new GroupItem("433MHz RF Config", legendFactory),
         new ConfigItem("rfEchoMessages", checkboxFactory, checkboxApply, checkboxGet, "Echo sent rf messages back"),
         new ConfigItem("rfReceiverPin", pinNumberInputFactory, inputApply, inputGetInt, "The GPIO pin used for the rf receiver"),
         new ConfigItem("rfReceiverPinPullUp", checkboxFactory, checkboxApply, checkboxGet, "Activate pullup on rf receiver pin (required for 5V protection with reverse diode)"),
+        new ConfigItem("rfPulseCachePersist", checkboxFactory, checkboxApply, checkboxGet, "Keep parsed RAW pulse trains on flash across restarts"),
         new ConfigItem("rfTransmitterPin", pinNumberInputFactory, inputApply, inputGetInt, "The GPIO pin used for the RF transmitter"),
+        new ConfigItem("rfDuplicateWindow", timeWindowInputFactory, inputApply, inputGetInt, "Suppress repeated rf messages received within this time in ms (0 disables)"),
+
+        new GroupItem("RF Device Filter", legendFactory),
+        new ConfigItem("rfDeviceAllow", inputFieldFactory, inputApply, inputGet, "Only publish these devices, comma separated <protocol> or <protocol>/<deviceID> (empty allows all)"),
+        new ConfigItem("rfDeviceDeny", inputFieldFactory, inputApply, inputGet, "Never publish these devices, comma separated <protocol> or <protocol>/<deviceID>"),
+        new ConfigItem("rfDeviceRate", deviceRateInputFactory, inputApply, inputGetInt, "Maximum messages per minute and device (0 disables)"),
+        new ConfigItem("rfDeviceBurst", deviceBurstInputFactory, inputApply, inputGetInt, "Messages a device may send at once above the rate"),
+        new ConfigItem("rfChangeOnly", checkboxFactory, checkboxApply, checkboxGet, "Only publish messages that differ from the last one of the device"),
+        new ConfigItem("rfChangeRefresh", timeWindowInputFactory, inputApply, inputGetInt, "Publish unchanged messages again after this time in s (0 never)"),
 
         new GroupItem("Enabled RF protocols", legendFactory),
         new ConfigItem("rfProtocols", protocolInputField, protocolApply, protocolGet, ""),
+        new ConfigItem("rfAutoTune", timeWindowInputFactory, inputApply, inputGetInt, "Reduce the protocols to the received ones after this time in minutes (0 disables)"),
 
         new GroupItem("Log Config", legendFactory),
         new ConfigItem("serialLogLevel", logLevelInputFactory, inputApply, inputGet, "Level for serial logging"),
@@ -63,16 +84,30 @@ $(function () {
         new ConfigItem("syslogLevel", logLevelInputFactory, inputApply, inputGet, "Level for syslog logging"),
         new ConfigItem("syslogHost", hostNameInputFactory, inputApply, inputGet, "Syslog server (optional)"),
         new ConfigItem("syslogPort", portNumberInputFactory, inputApply, inputGetInt, "Syslog port (optional)"),
+        new ConfigItem("syslogStructured", checkboxFactory, checkboxApply, checkboxGet, "Add protocol and deviceID as syslog structured data"),
 
         new GroupItem("Status LED", legendFactory),
         new ConfigItem("ledPin", pinNumberInputFactory, inputApply, inputGetInt, "The GPIO pin used for the status LED"),
-        new ConfigItem("ledActiveHigh", checkboxFactory, checkboxApply, checkboxGet, "The way how the LED is connected to the pin (false for built-in led)")
+        new ConfigItem("ledActiveHigh", checkboxFactory, checkboxApply, checkboxGet, "The way how the LED is connected to the pin (false for built-in led)"),
+
+        new GroupItem("Power", legendFactory),
+        new ConfigItem("powerProfile", powerProfileInputFactory, inputApply, inputGet, "CPU frequency and Wi-Fi sleep profile"),
+
+        new GroupItem("Load Test", legendFactory),
+        new ConfigItem("loadTestRate", loadTestRateInputFactory, inputApply, inputGetInt, "Synthetic events per second injected by the loadTest debug flag")
     ];
 
     var DEBUG_FLAGS = {
         protocolRaw: "Enable Raw RF message logging",
+        rawCapture: "Record received RAW pulse trains to flash, download them from /debug/capture",
+        rawCaptureMqtt: "Publish the recorded pulse trains to the MQTT state topic",
         systemLoad: "Show the processed loop() iterations for each second",
-        freeHeap: "Show the free heap memory every second"
+        freeHeap: "Show the free heap memory, fragmentation and allocations per subsystem every second",
+        freeHeapMqtt: "Publish the heap statistics to the MQTT state topic",
+        loopProfile: "Measure the time of each loop() stage, see /debug/profile",
+        loopProfileMqtt: "Publish the loop() profile to the MQTT state topic",
+        loadTest: "Inject synthetic events at loadTestRate and measure the receive to publish latency",
+        loadTestTransmit: "Also queue the code library entry loadtest for transmission during the load test"
     };
 
     var SystemCommandActions = {
@@ -149,6 +184,24 @@ $(function () {
         ];
     }
 
+    function powerProfileInputFactory(item) {
+        var element = $('<select>', {
+            class: 'config-item',
+            id: 'cfg-' + item.name,
+            name: item.name,
+        }).append([
+            $('<option>', {value: 'performance', text: 'Performance'}),
+            $('<option>', {value: 'balanced', text: 'Balanced'}),
+            $('<option>', {value: 'powersave', text: 'Power save'}),
+        ]);
+        registerConfigUi(element, item);
+        return [
+            inputLabelFactory(item),
+            element,
+            inputHelpFactory(item),
+        ];
+    }
+
     function inputFieldFactory(item, pattern, required) {
         var element = $('<input>', {
             type: 'text',
@@ -203,6 +256,46 @@ $(function () {
         return inputFieldNumberFactory(item, 0, 16);
     }
 
+    function timeWindowInputFactory(item) {
+        return inputFieldNumberFactory(item, 0, 65535);
+    }
+
+    function deviceRateInputFactory(item) {
+        return inputFieldNumberFactory(item, 0, 6000);
+    }
+
+    function loadTestRateInputFactory(item) {
+        return inputFieldNumberFactory(item, 1, 1000);
+    }
+
+    function deviceBurstInputFactory(item) {
+        return inputFieldNumberFactory(item, 1, 255);
+    }
+
+    function offlineBufferInputFactory(item) {
+        return inputFieldNumberFactory(item, 0, 32);
+    }
+
+    function metricsIntervalInputFactory(item) {
+        return inputFieldNumberFactory(item, 0, 65535);
+    }
+
+    function batchIntervalInputFactory(item) {
+        return inputFieldNumberFactory(item, 0, 60000);
+    }
+
+    function batchSizeInputFactory(item) {
+        return inputFieldNumberFactory(item, 1, 64);
+    }
+
+    function clusterHoldoffInputFactory(item) {
+        return inputFieldNumberFactory(item, 10, 2000);
+    }
+
+    function offlineSpillInputFactory(item) {
+        return inputFieldNumberFactory(item, 0, 512);
+    }
+
     function passwordFieldFactory(item, minlength) {
         var element = $('<input>', {
             type: 'password',